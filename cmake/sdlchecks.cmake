@@ -1202,3 +1202,26 @@ macro(CheckKMSDRM)
     endif()
   endif()
 endmacro()
+
+# Requires:
+# - Linux, for eventfd and memfd
+macro(CheckOffscreen)
+  if(VIDEO_OFFSCREEN AND LINUX)
+    check_c_source_compiles("
+        #include <time.h>
+        #include <sys/eventfd.h>
+        #include <sys/mman.h>
+        #include <sys/syscall.h>
+        int main(int argc, char** argv) {
+          struct timespec ts;
+          clock_gettime(CLOCK_MONOTONIC, &ts);
+          return eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        }" HAVE_VIDEO_OFFSCREEN)
+    if(HAVE_VIDEO_OFFSCREEN)
+      set(SDL_VIDEO_DRIVER_OFFSCREEN 1)
+      file(GLOB OFFSCREEN_SOURCES ${SDL2_SOURCE_DIR}/src/video/offscreen/*.c)
+      set(SOURCE_FILES ${SOURCE_FILES} ${OFFSCREEN_SOURCES})
+      set(HAVE_SDL_VIDEO TRUE)
+    endif()
+  endif()
+endmacro()
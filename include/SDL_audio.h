@@ -436,6 +436,8 @@ extern DECLSPEC void SDLCALL SDL_PauseAudioDevice(SDL_AudioDeviceID dev,
  *  This function returns NULL and sets the SDL error message if the
  *  wave file cannot be opened, uses an unknown data format, or is
  *  corrupt.  Currently raw and MS-ADPCM WAVE files are supported.
+ *
+ *  \sa SDL_NewWAVDecoder
  */
 extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
                                                       int freesrc,
@@ -522,6 +524,51 @@ extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStream(const SDL_AudioForm
                                            const Uint8 dst_channels,
                                            const int dst_rate);
 
+/**
+ *  Create a new audio stream that never allocates memory after creation
+ *
+ *  Work buffers are sized once for converting \c max_put_len bytes of
+ *  source audio at a time, and converted output is kept in a ring buffer
+ *  of \c buffer_len bytes instead of a growing queue, so
+ *  SDL_AudioStreamPut(), SDL_AudioStreamGet(), SDL_AudioStreamFlush() and
+ *  SDL_AudioStreamClear() never call SDL_malloc(). Larger puts are still
+ *  accepted; they are converted in pieces of \c max_put_len bytes.
+ *
+ *  A put or flush that might not fit in the free space of the ring buffer
+ *  fails without consuming any input, so size the buffer for the most
+ *  output you will have queued between calls to SDL_AudioStreamGet().
+ *
+ *  \param src_format The format of the source audio
+ *  \param src_channels The number of channels of the source audio
+ *  \param src_rate The sampling rate of the source audio
+ *  \param dst_format The format of the desired audio output
+ *  \param dst_channels The number of channels of the desired audio output
+ *  \param dst_rate The sampling rate of the desired audio output
+ *  \param max_put_len The most bytes of source audio converted in one pass
+ *  \param buffer Memory for the output ring buffer, or NULL to have it
+ *                allocated (once) along with the stream. Caller-provided
+ *                memory must stay valid until SDL_FreeAudioStream().
+ *  \param buffer_len The size of the output ring buffer in bytes
+ *  \return the new stream, or NULL on error.
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamAvailable
+ *  \sa SDL_AudioStreamFlush
+ *  \sa SDL_AudioStreamClear
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStreamWithBuffer(const SDL_AudioFormat src_format,
+                                           const Uint8 src_channels,
+                                           const int src_rate,
+                                           const SDL_AudioFormat dst_format,
+                                           const Uint8 dst_channels,
+                                           const int dst_rate,
+                                           const int max_put_len,
+                                           void *buffer,
+                                           const int buffer_len);
+
 /**
  *  Add data to be converted/resampled to the stream
  *
@@ -612,6 +659,137 @@ extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream *stream);
  */
 extern DECLSPEC void SDLCALL SDL_FreeAudioStream(SDL_AudioStream *stream);
 
+/**
+ *  Mix an audio stream into an output device's audio
+ *
+ *  Every time the device needs more audio, SDL pulls one callback's worth
+ *  from each bound stream, sums them with their gains in floating point,
+ *  converts the sum to the device format once and mixes it over whatever
+ *  the callback (or SDL_QueueAudio()) provided. A stream that doesn't have
+ *  enough data contributes silence for the rest of the buffer.
+ *
+ *  The stream must output AUDIO_F32SYS at the channels and rate of the
+ *  device's obtained spec. Binding a stream that is already bound just
+ *  changes its gain. Lock the device with SDL_LockAudioDevice() while
+ *  putting data into a bound stream, and unbind it before freeing it.
+ *  Streams can't be bound on audio drivers that run their own callback
+ *  thread.
+ *
+ *  \param dev The playback device to mix the stream into
+ *  \param stream The stream to mix
+ *  \param gain The scale applied to the stream's samples, 1.0f for none
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_UnbindAudioStream
+ *  \sa SDL_NewAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_BindAudioStream(SDL_AudioDeviceID dev, SDL_AudioStream *stream, float gain);
+
+/**
+ *  Stop mixing an audio stream into an output device's audio
+ *
+ *  \param dev The device the stream was bound to
+ *  \param stream The stream to unbind
+ *  \return 0 on success, or -1 if the stream wasn't bound to the device.
+ *
+ *  \sa SDL_BindAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_UnbindAudioStream(SDL_AudioDeviceID dev, SDL_AudioStream *stream);
+
+/**
+ *  An incremental WAVE decoder, for playing long files without loading
+ *  them into memory first.
+ */
+struct _SDL_WAVDecoder;
+typedef struct _SDL_WAVDecoder SDL_WAVDecoder;
+
+/**
+ *  Create a decoder that reads a WAVE file from a data source on demand.
+ *
+ *  This parses the headers once and leaves the data source at the start of
+ *  the audio data. The decoder produces the same audio format and samples
+ *  as SDL_LoadWAV_RW(), but only ever holds one encoded block in memory, so
+ *  its memory use doesn't depend on the length of the file.
+ *
+ *  \param src The data source for the WAVE data
+ *  \param freesrc Non-zero to close the data source when the decoder is
+ *                 freed, or if creating it fails
+ *  \param spec Filled with the audio format of the decoded data
+ *  \return the new decoder, or NULL on error.
+ *
+ *  \sa SDL_WAVDecoderRead
+ *  \sa SDL_WAVDecoderSeek
+ *  \sa SDL_WAVDecoderPutStream
+ *  \sa SDL_FreeWAVDecoder
+ */
+extern DECLSPEC SDL_WAVDecoder * SDLCALL SDL_NewWAVDecoder(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec);
+
+/**
+ *  Decode audio from the current position into a buffer
+ *
+ *  \param decoder The decoder to read from
+ *  \param buf A buffer to fill with decoded audio
+ *  \param len The size of the buffer in bytes. Only whole frames are decoded.
+ *  \return The number of bytes decoded, 0 at the end of the data, or -1 on
+ *          error.
+ *
+ *  \sa SDL_NewWAVDecoder
+ *  \sa SDL_WAVDecoderSeek
+ */
+extern DECLSPEC int SDLCALL SDL_WAVDecoderRead(SDL_WAVDecoder *decoder, void *buf, int len);
+
+/**
+ *  Move the decoding position to a sample frame
+ *
+ *  This needs a data source that can seek.
+ *
+ *  \param decoder The decoder to seek
+ *  \param frame The frame to decode next, from 0 to SDL_WAVDecoderFrames()
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_WAVDecoderTell
+ *  \sa SDL_WAVDecoderFrames
+ */
+extern DECLSPEC int SDLCALL SDL_WAVDecoderSeek(SDL_WAVDecoder *decoder, Uint32 frame);
+
+/**
+ *  Get the sample frame that will be decoded next
+ *
+ *  \sa SDL_WAVDecoderSeek
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_WAVDecoderTell(SDL_WAVDecoder *decoder);
+
+/**
+ *  Get the number of sample frames in the WAVE data
+ *
+ *  \sa SDL_WAVDecoderSeek
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_WAVDecoderFrames(SDL_WAVDecoder *decoder);
+
+/**
+ *  Decode audio from the current position into an audio stream
+ *
+ *  The stream's source format must match the spec from SDL_NewWAVDecoder().
+ *
+ *  \param decoder The decoder to read from
+ *  \param stream The stream to put the decoded audio into
+ *  \param len The most bytes of decoded audio to put into the stream
+ *  \return The number of bytes put into the stream, 0 at the end of the
+ *          data, or -1 on error.
+ *
+ *  \sa SDL_NewWAVDecoder
+ *  \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_WAVDecoderPutStream(SDL_WAVDecoder *decoder, SDL_AudioStream *stream, int len);
+
+/**
+ *  Free a WAVE decoder, closing its data source if it was created with
+ *  \c freesrc set.
+ *
+ *  \sa SDL_NewWAVDecoder
+ */
+extern DECLSPEC void SDLCALL SDL_FreeWAVDecoder(SDL_WAVDecoder *decoder);
+
 #define SDL_MIX_MAXVOLUME 128
 /**
  *  This takes two audio buffers of the playing audio format and mixes
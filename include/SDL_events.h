@@ -601,6 +601,27 @@ typedef enum
 extern DECLSPEC int SDLCALL SDL_PeepEvents(SDL_Event * events, int numevents,
                                            SDL_eventaction action,
                                            Uint32 minType, Uint32 maxType);
+
+/**
+ *  Like SDL_PeepEvents(), but also returns the time each event happened.
+ *
+ *  If \c timestamps_ns isn't NULL, it's filled in with the time of each
+ *  event returned, in nanoseconds on the SDL_GetTicksNS() clock. The event
+ *  queue only keeps these while ::SDL_HINT_EVENT_TIMESTAMPS_NS is enabled.
+ *  For Linux evdev and joystick input they come from the kernel's timestamp
+ *  for the input, otherwise they're when the event was queued. For events
+ *  queued while the hint was disabled, they're the millisecond \c timestamp
+ *  scaled up.
+ *
+ *  \c timestamps_ns isn't used if \c action is ::SDL_ADDEVENT.
+ *
+ *  \return The number of events actually stored, or -1 if there was an error.
+ *
+ *  This function is thread-safe.
+ */
+extern DECLSPEC int SDLCALL SDL_PeepEventsTimestamps(SDL_Event * events, Uint64 * timestamps_ns,
+                                                     int numevents, SDL_eventaction action,
+                                                     Uint32 minType, Uint32 maxType);
 /* @} */
 
 /**
@@ -64,6 +64,22 @@ extern "C" {
  */
 #define SDL_HINT_FRAMEBUFFER_ACCELERATION   "SDL_FRAMEBUFFER_ACCELERATION"
 
+/**
+ *  \brief  A variable controlling whether the window surface tracks what has been drawn on it
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - SDL_UpdateWindowSurface() copies the whole surface (default)
+ *    "1"       - SDL_UpdateWindowSurface() copies only the areas changed since the last update
+ *
+ *  Changes are tracked through SDL_FillRect(), the blit functions and the
+ *  software renderer.  Pixels written directly must be surrounded by
+ *  SDL_LockSurface() and SDL_UnlockSurface(), which marks the whole surface
+ *  as changed.
+ *
+ *  This hint is checked when the window surface is created.
+ */
+#define SDL_HINT_FRAMEBUFFER_DAMAGE   "SDL_FRAMEBUFFER_DAMAGE"
+
 /**
  *  \brief  A variable specifying which render driver to use.
  *
@@ -153,6 +169,60 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_VSYNC               "SDL_RENDER_VSYNC"
 
+/**
+ *  \brief  A variable controlling whether the 2D render API batches draw calls
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Send each draw call to the render backend immediately
+ *    "1"       - Queue draw calls and submit them to the backend in batches
+ *
+ *  Queued commands are submitted by SDL_RenderPresent(), SDL_RenderReadPixels(),
+ *  SDL_RenderFlush(), render target changes and updates to textures that are
+ *  still in use by the queue.
+ *
+ *  By default batching is enabled for window renderers whose backend supports
+ *  it, and disabled for renderers created with SDL_CreateSoftwareRenderer(),
+ *  since the application may access the target surface directly.
+ *
+ *  This hint is checked when the renderer is created.
+ */
+#define SDL_HINT_RENDER_BATCHING            "SDL_RENDER_BATCHING"
+
+/**
+ *  \brief  A variable controlling how many threads the software renderer draws with
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "1" - Draw everything on the thread that submits the render commands
+ *    "N"        - Split the target into horizontal bands and draw them on N threads
+ *    "-1"       - Use one thread per CPU core
+ *
+ *  Only batched commands are split up (see SDL_HINT_RENDER_BATCHING), and only
+ *  clears, rect fills and unscaled copies; everything else is still drawn in
+ *  order on the submitting thread.  The output is identical either way.
+ *
+ *  By default the software renderer is single threaded.
+ *
+ *  This hint is checked when the renderer is created.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS    "SDL_RENDER_SOFTWARE_THREADS"
+
+/**
+ *  \brief  A variable controlling how many threads SDL_ConvertPixels() and SDL_ConvertSurface() use
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "1" - Convert everything on the calling thread
+ *    "N"        - Split large images into horizontal bands and convert them on N threads
+ *    "-1"       - Use one thread per CPU core
+ *
+ *  Small images are always converted on the calling thread, and so are
+ *  conversions between two YUV formats.  The output is identical either way.
+ *
+ *  By default conversions are single threaded.
+ *
+ *  This hint is checked on each conversion.
+ */
+#define SDL_HINT_CONVERT_THREADS    "SDL_CONVERT_THREADS"
+
 /**
  *  \brief  A variable controlling whether the screensaver is enabled. 
  *
@@ -223,6 +293,19 @@ extern "C" {
  */
 #define SDL_HINT_VIDEO_X11_NET_WM_BYPASS_COMPOSITOR "SDL_VIDEO_X11_NET_WM_BYPASS_COMPOSITOR"
 
+/**
+ *  \brief  A variable controlling how many frames the offscreen video driver keeps for each window
+ *
+ *  The offscreen video driver presents frames into a ring in shared memory,
+ *  see SDL_OffscreenHeader.  A reader that falls further behind than this
+ *  loses frames.
+ *
+ *  This variable can be set from 2 to 16, and defaults to 3.
+ *
+ *  This hint is checked when the window is created.
+ */
+#define SDL_HINT_VIDEO_OFFSCREEN_FRAMES     "SDL_VIDEO_OFFSCREEN_FRAMES"
+
 /**
  *  \brief  A variable controlling whether the window frame and title bar are interactive when the cursor is hidden 
  *
@@ -465,6 +548,35 @@ extern "C" {
  */
 #define SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS "SDL_JOYSTICK_ALLOW_BACKGROUND_EVENTS"
 
+/**
+ *  \brief  A variable controlling whether Linux evdev and joystick input is read on a background thread.
+ *
+ *  The variable can be set to the following values:
+ *    "0"       - Input devices are read when events are pumped.
+ *    "1"       - A high priority thread reads input devices as soon as
+ *                they have data, so the kernel's buffers don't overflow
+ *                when the application is slow to pump events.
+ *
+ *  Either way, the input is handled and its events are sent, and event
+ *  filters and watchers are called, when events are pumped.
+ *
+ *  The default value is "0".  This hint is checked when input is initialized.
+ */
+#define SDL_HINT_LINUX_INPUT_THREAD "SDL_LINUX_INPUT_THREAD"
+
+/**
+ *  \brief  A variable controlling whether the event queue keeps the time each event happened, in nanoseconds.
+ *
+ *  The variable can be set to the following values:
+ *    "0"       - Events only have their millisecond timestamp, and
+ *                SDL_PeepEventsTimestamps() returns that scaled up.
+ *    "1"       - Each queued event keeps the time it happened on the
+ *                SDL_GetTicksNS() clock, for SDL_PeepEventsTimestamps().
+ *
+ *  The default value is "0".  This hint may be set at any time, and applies to events queued after that.
+ */
+#define SDL_HINT_EVENT_TIMESTAMPS_NS "SDL_EVENT_TIMESTAMPS_NS"
+
 /**
  *  \brief If set to "0" then never set the top most bit on a SDL Window, even if the video mode expects it.
  *      This is a debugging aid for developers and not expected to be used by end users. The default is "1"
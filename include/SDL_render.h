@@ -860,6 +860,21 @@ extern DECLSPEC int SDLCALL SDL_RenderReadPixels(SDL_Renderer * renderer,
  */
 extern DECLSPEC void SDLCALL SDL_RenderPresent(SDL_Renderer * renderer);
 
+/**
+ *  \brief Submit any draw commands the renderer has queued.
+ *
+ *  When batching is enabled (see SDL_HINT_RENDER_BATCHING), draw calls are
+ *  recorded and only handed to the render backend at certain points, like
+ *  SDL_RenderPresent(). Call this before accessing the render target outside
+ *  of the SDL render API, e.g. reading the surface given to
+ *  SDL_CreateSoftwareRenderer().
+ *
+ *  \param renderer The renderer to flush
+ *
+ *  \return 0 on success, or -1 if a queued command failed
+ */
+extern DECLSPEC int SDLCALL SDL_RenderFlush(SDL_Renderer * renderer);
+
 /**
  *  \brief Destroy the specified texture.
  *
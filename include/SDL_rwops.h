@@ -45,6 +45,7 @@ extern "C" {
 #define SDL_RWOPS_JNIFILE   3U  /**< Android asset */
 #define SDL_RWOPS_MEMORY    4U  /**< Memory stream */
 #define SDL_RWOPS_MEMORY_RO 5U  /**< Read-Only memory stream */
+#define SDL_RWOPS_MAPPED    6U  /**< Read-only memory-mapped file */
 
 /**
  * This is the read/write operation structure -- very basic.
@@ -165,6 +166,22 @@ extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMem(void *mem, int size);
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromConstMem(const void *mem,
                                                       int size);
 
+/**
+ *  Open a file for reading by mapping it into memory.
+ *
+ *  Reads from the returned stream are plain memory copies with no
+ *  intermediate buffering, and SDL_RWGetMappedData() gives direct access
+ *  to the whole file for parsing it in place. The stream can't be
+ *  written to.
+ *
+ *  \return the new stream, or NULL if the file couldn't be opened or
+ *          mapped, or if mapping isn't supported on this platform.
+ *
+ *  \sa SDL_RWGetMappedData
+ *  \sa SDL_RWAdviseMapped
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromFileMapped(const char *file);
+
 /* @} *//* RWFrom functions */
 
 
@@ -190,6 +207,49 @@ extern DECLSPEC void SDLCALL SDL_FreeRW(SDL_RWops * area);
 /* @} *//* Read/write macros */
 
 
+/**
+ *  Get the contents of a stream opened with SDL_RWFromFileMapped().
+ *
+ *  The returned memory is read-only and stays valid until the stream is
+ *  closed. It may be NULL for an empty file.
+ *
+ *  \param context A stream opened with SDL_RWFromFileMapped().
+ *  \param size Filled with the size of the file in bytes, may be NULL.
+ *
+ *  \return the start of the file, or NULL if the stream isn't mapped.
+ */
+extern DECLSPEC const void *SDLCALL SDL_RWGetMappedData(SDL_RWops * context,
+                                                        size_t *size);
+
+/**
+ *  \brief Access patterns for SDL_RWAdviseMapped()
+ */
+typedef enum
+{
+    SDL_RWMAP_ADVICE_NORMAL,        /**< No particular pattern */
+    SDL_RWMAP_ADVICE_SEQUENTIAL,    /**< Read from start to end; read ahead aggressively */
+    SDL_RWMAP_ADVICE_RANDOM,        /**< Read in no particular order; don't read ahead */
+    SDL_RWMAP_ADVICE_WILLNEED,      /**< Will be read soon; start loading it now */
+    SDL_RWMAP_ADVICE_DONTNEED       /**< Won't be needed again soon */
+} SDL_RWMapAdvice;
+
+/**
+ *  Tell the system how part of a mapped file is going to be read.
+ *
+ *  This is only a hint, and it is ignored on platforms that don't support it.
+ *
+ *  \param context A stream opened with SDL_RWFromFileMapped().
+ *  \param offset The start of the range, in bytes from the start of the file.
+ *  \param length The size of the range, or 0 for the rest of the file.
+ *  \param advice How the range will be read.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_RWAdviseMapped(SDL_RWops * context,
+                                               Sint64 offset, Sint64 length,
+                                               SDL_RWMapAdvice advice);
+
+
 /**
  *  Load all the data from an SDL data stream.
  *
@@ -201,6 +261,9 @@ extern DECLSPEC void SDLCALL SDL_FreeRW(SDL_RWops * area);
  *
  *  The data should be freed with SDL_free().
  *
+ *  A stream from SDL_RWFromFileMapped() is copied out in one step; use
+ *  SDL_RWGetMappedData() instead to read its contents without a copy.
+ *
  *  \return the data, or NULL if there was an error.
  */
 extern DECLSPEC void *SDLCALL SDL_LoadFile_RW(SDL_RWops * src, size_t *datasize,
@@ -213,6 +276,119 @@ extern DECLSPEC void *SDLCALL SDL_LoadFile_RW(SDL_RWops * src, size_t *datasize,
  */
 #define SDL_LoadFile(file, datasize)   SDL_LoadFile_RW(SDL_RWFromFile(file, "rb"), datasize, 1)
 
+/**
+ *  \name Asynchronous I/O
+ *
+ *  Reads and writes queued here run on a pool of worker threads, and their
+ *  outcomes are collected with SDL_GetAsyncIOResult() or
+ *  SDL_WaitAsyncIOResult(), so a game loop can poll for finished I/O
+ *  without ever blocking on the disk.
+ *
+ *  Requests on the same stream run one at a time in the order they were
+ *  queued. Requests on different streams run concurrently, so a stream must
+ *  not be used by anything else while it has requests in flight.
+ */
+/* @{ */
+typedef struct SDL_AsyncIOQueue SDL_AsyncIOQueue;
+
+typedef enum
+{
+    SDL_ASYNCIO_READ,       /**< SDL_AsyncRead() */
+    SDL_ASYNCIO_WRITE,      /**< SDL_AsyncWrite() */
+    SDL_ASYNCIO_LOADFILE    /**< SDL_AsyncLoadFile() */
+} SDL_AsyncIOType;
+
+typedef enum
+{
+    SDL_ASYNCIO_COMPLETE,   /**< Finished; a read may have stopped early at the end of the stream */
+    SDL_ASYNCIO_FAILURE     /**< Failed; bytes_transferred says how far it got */
+} SDL_AsyncIOResult;
+
+typedef struct SDL_AsyncIOOutcome
+{
+    SDL_AsyncIOType type;
+    SDL_AsyncIOResult result;
+    SDL_RWops *rwops;           /**< The stream, or NULL for SDL_AsyncLoadFile() */
+    void *buffer;               /**< The caller's buffer, or the loaded file, to be freed with SDL_free() */
+    Sint64 offset;              /**< The offset requested, or -1 for the current position */
+    size_t bytes_requested;
+    size_t bytes_transferred;
+    void *userdata;
+} SDL_AsyncIOOutcome;
+
+/**
+ *  Create a queue for asynchronous I/O.
+ *
+ *  \param num_threads The number of worker threads, or 0 for one per CPU core.
+ *
+ *  \return the new queue, or NULL on error.
+ */
+extern DECLSPEC SDL_AsyncIOQueue *SDLCALL SDL_CreateAsyncIOQueue(int num_threads);
+
+/**
+ *  Queue a read of \c size bytes from \c rwops into \c ptr.
+ *
+ *  \param offset Where to read from, or -1 for the stream's position when
+ *                the request runs.
+ *
+ *  \return 0 if the request was queued, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_AsyncRead(SDL_AsyncIOQueue *queue, SDL_RWops *rwops,
+                                          void *ptr, Sint64 offset, size_t size,
+                                          void *userdata);
+
+/**
+ *  Queue a write of \c size bytes from \c ptr to \c rwops.
+ *
+ *  \c ptr must stay valid until the outcome has been collected.
+ *
+ *  \param offset Where to write to, or -1 for the stream's position when
+ *                the request runs.
+ *
+ *  \return 0 if the request was queued, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_AsyncWrite(SDL_AsyncIOQueue *queue, SDL_RWops *rwops,
+                                           const void *ptr, Sint64 offset, size_t size,
+                                           void *userdata);
+
+/**
+ *  Queue loading a whole file, as SDL_LoadFile() would.
+ *
+ *  The outcome's buffer holds the data and should be freed with SDL_free().
+ *
+ *  \return 0 if the request was queued, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_AsyncLoadFile(SDL_AsyncIOQueue *queue, const char *file,
+                                              void *userdata);
+
+/**
+ *  Collect the outcome of a finished request, without waiting.
+ *
+ *  \return 1 if an outcome was returned, 0 if none are ready, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_GetAsyncIOResult(SDL_AsyncIOQueue *queue,
+                                                 SDL_AsyncIOOutcome *outcome);
+
+/**
+ *  Collect the outcome of a finished request, waiting up to \c timeout
+ *  milliseconds for one, or forever if \c timeout is -1.
+ *
+ *  \return 1 if an outcome was returned, 0 on timeout, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue,
+                                                  SDL_AsyncIOOutcome *outcome,
+                                                  Sint32 timeout);
+
+/**
+ *  Destroy an asynchronous I/O queue.
+ *
+ *  Requests that are running are finished first, and requests that haven't
+ *  started are dropped. Uncollected outcomes are discarded, and files
+ *  loaded for them are freed.
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue);
+/* @} *//* Asynchronous I/O */
+
 /**
  *  \name Read endian functions
  *
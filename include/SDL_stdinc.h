@@ -394,6 +394,54 @@ extern DECLSPEC int SDLCALL SDL_SetMemoryFunctions(SDL_malloc_func malloc_func,
  */
 extern DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
 
+/**
+ *  \brief Get a set of memory functions that cache small blocks per thread.
+ *
+ *  Requests of up to 1024 bytes are rounded up to a size class and served
+ *  from a free list owned by the calling thread, so allocation-heavy code
+ *  running on several threads rarely contends on the underlying allocator.
+ *  Blocks move between threads in batches through a shared list per size
+ *  class. Larger requests go straight to the underlying allocator.
+ *
+ *  Pass the results to SDL_SetMemoryFunctions() before anything has been
+ *  allocated; memory from one set of functions can't be freed by another.
+ *
+ *  \return 0 on success, or -1 if thread-local storage isn't available
+ *          with this compiler.
+ *
+ *  \sa SDL_SetMemoryFunctions
+ *  \sa SDL_GetMemorySizeClassStats
+ */
+extern DECLSPEC int SDLCALL SDL_GetThreadCachedMemoryFunctions(SDL_malloc_func *malloc_func,
+                                                               SDL_calloc_func *calloc_func,
+                                                               SDL_realloc_func *realloc_func,
+                                                               SDL_free_func *free_func);
+
+typedef struct SDL_MemorySizeClassStats
+{
+    size_t size;                /**< Bytes per block, or 0 for requests too large to cache */
+    Uint64 allocations;         /**< Allocations served from this class */
+    Uint64 frees;               /**< Blocks returned to this class */
+    Uint64 cache_hits;          /**< Allocations served from the calling thread's own list */
+    Uint64 heap_allocations;    /**< Allocations that had to go to the underlying allocator */
+} SDL_MemorySizeClassStats;
+
+/**
+ *  \brief Get per-size-class counters for the thread-caching allocator.
+ *
+ *  Other threads add their counts at batch boundaries, so the totals may
+ *  lag behind the allocations actually made by a few dozen per class.
+ *
+ *  \param stats An array to fill, may be NULL if maxstats is 0.
+ *  \param maxstats The number of entries in stats.
+ *
+ *  \return The number of size classes, which may be more than maxstats,
+ *          or 0 if the thread-caching allocator isn't available.
+ *
+ *  \sa SDL_GetThreadCachedMemoryFunctions
+ */
+extern DECLSPEC int SDLCALL SDL_GetMemorySizeClassStats(SDL_MemorySizeClassStats *stats, int maxstats);
+
 extern DECLSPEC char *SDLCALL SDL_getenv(const char *name);
 extern DECLSPEC int SDLCALL SDL_setenv(const char *name, const char *value, int overwrite);
 
@@ -199,6 +199,38 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_LoadBMP_RW(SDL_RWops * src,
  */
 #define SDL_LoadBMP(file)   SDL_LoadBMP_RW(SDL_RWFromFile(file, "rb"), 1)
 
+/**
+ *  Load a surface from a seekable SDL data stream (memory or file) in the
+ *  given pixel format.
+ *
+ *  This gives the same result as SDL_LoadBMP_RW() followed by
+ *  SDL_ConvertSurfaceFormat(), but paletted, 24-bit and 32-bit images are
+ *  decoded straight into 32-bit formats with 8 bits per channel, such as
+ *  ::SDL_PIXELFORMAT_ARGB8888, without an intermediate surface. Streams
+ *  from SDL_RWFromMem(), SDL_RWFromConstMem() and SDL_RWFromFileMapped()
+ *  are decoded in place.
+ *
+ *  If \c format is ::SDL_PIXELFORMAT_UNKNOWN, the surface is in the format
+ *  stored in the file, as with SDL_LoadBMP_RW().
+ *
+ *  If \c freesrc is non-zero, the stream will be closed after being read.
+ *
+ *  The new surface should be freed with SDL_FreeSurface().
+ *
+ *  \return the new surface, or NULL if there was an error.
+ */
+extern DECLSPEC SDL_Surface *SDLCALL SDL_LoadBMPFormat_RW(SDL_RWops * src,
+                                                          int freesrc,
+                                                          Uint32 format);
+
+/**
+ *  Load a surface from a file in the given pixel format.
+ *
+ *  Convenience macro.
+ */
+#define SDL_LoadBMPFormat(file, format) \
+        SDL_LoadBMPFormat_RW(SDL_RWFromFile(file, "rb"), 1, format)
+
 /**
  *  Save a surface to a seekable SDL data stream (memory or file).
  *
@@ -502,6 +534,21 @@ extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             SDL_Surface * dst,
                                             const SDL_Rect * dstrect);
 
+/**
+ *  \brief Perform a filtered stretch blit between two surfaces of the same
+ *         32-bit pixel format.
+ *
+ *  Enlarged directions are interpolated linearly, and shrunk directions
+ *  average all the source pixels that each destination pixel covers.
+ *
+ *  \note This function keeps its buffers with the source surface, and is
+ *        not thread-safe for the same source surface.
+ */
+extern DECLSPEC int SDLCALL SDL_SoftStretchLinear(SDL_Surface * src,
+                                                  const SDL_Rect * srcrect,
+                                                  SDL_Surface * dst,
+                                                  const SDL_Rect * dstrect);
+
 #define SDL_BlitScaled SDL_UpperBlitScaled
 
 /**
@@ -76,6 +76,24 @@ extern DECLSPEC SDL_bool SDLCALL SDL_DXGIGetOutputInfo( int displayIndex, int *a
 #endif /* __WIN32__ */
 
 
+/* Platform specific functions for Linux */
+#if defined(__LINUX__) && __LINUX__
+
+/**
+   \brief Get a file descriptor that becomes readable when there's evdev,
+          joystick or udev input for SDL_PumpEvents() to read.
+
+   An application with its own event loop can wait on this alongside its
+   other descriptors, then pump events when it's readable.  It stays valid
+   until the subsystems that read evdev devices are shut down.
+
+   \return The descriptor, or -1 if SDL isn't reading evdev devices.
+ */
+extern DECLSPEC int SDLCALL SDL_LinuxGetInputFD(void);
+
+#endif /* __LINUX__ */
+
+
 /* Platform specific functions for iOS */
 #if defined(__IPHONEOS__) && __IPHONEOS__
 
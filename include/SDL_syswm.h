@@ -110,6 +110,45 @@ typedef void *EGLSurface;
 #include "SDL_egl.h"
 #endif
 
+#if defined(SDL_VIDEO_DRIVER_OFFSCREEN)
+/**
+ *  The layout of the shared memory the offscreen video driver presents each
+ *  window in.  It starts with an SDL_OffscreenHeader, and frame number N is
+ *  presented in frames[(N - 1) % num_frames], overwriting an older frame.
+ *
+ *  The eventfd is incremented each time a frame is presented.  To read frame
+ *  N, check that the slot's sequence is N, issue a read barrier, read the
+ *  pixels, issue another read barrier, and check the sequence again: if it
+ *  changed, the frame was overwritten while you read it.  The shared memory
+ *  never shrinks, but it grows when the window does, so map it again when a
+ *  frame lies past the end of your mapping.
+ */
+#define SDL_OFFSCREEN_MAGIC         0x4F4C4453  /* "SDLO" */
+#define SDL_OFFSCREEN_VERSION       1
+#define SDL_OFFSCREEN_MAX_FRAMES    16
+
+typedef struct SDL_OffscreenFrame
+{
+    Uint32 sequence;    /**< The frame number, or 0 while the frame is written */
+    Uint32 format;      /**< One of the SDL_PixelFormatEnum values */
+    Uint64 timestamp;   /**< When the frame was presented, CLOCK_MONOTONIC in nanoseconds */
+    Uint64 offset;      /**< Where the pixels start in the shared memory */
+    int w, h;           /**< The size of the frame */
+    int pitch;          /**< The length of a row of pixels in bytes */
+    SDL_Rect damage;    /**< The area that changed since the previous frame */
+    Uint32 padding;
+} SDL_OffscreenFrame;
+
+typedef struct SDL_OffscreenHeader
+{
+    Uint32 magic;       /**< SDL_OFFSCREEN_MAGIC */
+    Uint32 version;     /**< SDL_OFFSCREEN_VERSION */
+    Uint32 num_frames;  /**< The number of frames in use */
+    Uint32 sequence;    /**< The number of the last frame presented, 0 before the first one */
+    SDL_OffscreenFrame frames[SDL_OFFSCREEN_MAX_FRAMES];
+} SDL_OffscreenHeader;
+#endif
+
 /**
  *  These are the various supported windowing subsystems
  */
@@ -126,7 +165,8 @@ typedef enum
     SDL_SYSWM_WINRT,
     SDL_SYSWM_ANDROID,
     SDL_SYSWM_VIVANTE,
-    SDL_SYSWM_OS2
+    SDL_SYSWM_OS2,
+    SDL_SYSWM_OFFSCREEN
 } SDL_SYSWM_TYPE;
 
 /**
@@ -281,6 +321,14 @@ struct SDL_SysWMinfo
         } vivante;
 #endif
 
+#if defined(SDL_VIDEO_DRIVER_OFFSCREEN)
+        struct
+        {
+            int memfd;      /**< The shared memory, starting with an SDL_OffscreenHeader */
+            int eventfd;    /**< Incremented each time a frame is presented */
+        } offscreen;
+#endif
+
         /* Make sure this union is always 64 bytes (8 64-bit pointers). */
         /* Be careful not to overflow this if you add a new target! */
         Uint8 dummy[64];
@@ -55,6 +55,15 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetTicks(void);
  */
 #define SDL_TICKS_PASSED(A, B)  ((Sint32)((B) - (A)) <= 0)
 
+/**
+ * \brief Get the number of nanoseconds since the SDL library initialization.
+ *
+ * This is read from the high resolution counter and starts out in step with
+ * SDL_GetTicks(), so dividing it by 1000000 gives the same value give or
+ * take a millisecond. It doesn't wrap.
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_GetTicksNS(void);
+
 /**
  * \brief Get the current value of the high resolution counter
  */
@@ -0,0 +1,152 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_trace_h_
+#define SDL_trace_h_
+
+/**
+ *  \file SDL_trace.h
+ *
+ *  Header for the SDL tracing routines.
+ *
+ *  When tracing is enabled, SDL times named zones around its own hot paths
+ *  (event pumping, renderer backend calls, blits, the audio callback, audio
+ *  stream conversion and joystick updates) with SDL_GetPerformanceCounter().
+ *  Each thread records into its own ring buffer, so recording never blocks,
+ *  and the oldest events are dropped if they aren't collected in time.
+ *  Every zone is also counted, for per-frame statistics.
+ *
+ *  Applications can time their own zones with SDL_TraceBegin() and
+ *  SDL_TraceEnd().  Tracing costs a single test per zone when it's disabled.
+ */
+
+#include "SDL_stdinc.h"
+#include "SDL_error.h"
+#include "SDL_rwops.h"
+#include "SDL_thread.h"
+
+#include "begin_code.h"
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  \brief One timed zone, in SDL_GetPerformanceCounter() units.
+ */
+typedef struct SDL_TraceEvent
+{
+    const char *name;       /**< The zone name */
+    SDL_threadID thread;    /**< The thread that ran it */
+    Uint64 start;           /**< When the zone was entered */
+    Uint64 end;             /**< When the zone was left */
+} SDL_TraceEvent;
+
+/**
+ *  \brief The totals for a zone since the counters were last reset.
+ */
+typedef struct SDL_TraceCounter
+{
+    const char *name;       /**< The zone name */
+    Uint32 count;           /**< The number of times the zone ran, on all threads */
+    Uint64 total;           /**< The total time spent in it */
+    Uint64 max;             /**< The longest single run */
+} SDL_TraceCounter;
+
+/**
+ *  \brief Enable or disable tracing.
+ *
+ *  Events and counters that were recorded are kept when tracing is disabled.
+ */
+extern DECLSPEC void SDLCALL SDL_SetTraceEnabled(SDL_bool enabled);
+
+/**
+ *  \brief Get whether tracing is enabled.
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_GetTraceEnabled(void);
+
+/**
+ *  \brief Start timing a zone.
+ *
+ *  \return A value to pass to SDL_TraceEnd(), or 0 if tracing is disabled.
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_TraceBegin(void);
+
+/**
+ *  \brief Finish timing a zone, and record it.
+ *
+ *  \param name  The zone name, which must stay valid while it's being traced;
+ *               a string literal is best.
+ *  \param start The value returned by the matching SDL_TraceBegin().
+ */
+extern DECLSPEC void SDLCALL SDL_TraceEnd(const char *name, Uint64 start);
+
+/**
+ *  \brief Collect recorded events, oldest first for each thread.
+ *
+ *  The events are removed from the ring buffers.
+ *
+ *  \param events    An array to fill in
+ *  \param maxevents The size of the array
+ *
+ *  \return The number of events stored in the array.
+ */
+extern DECLSPEC int SDLCALL SDL_GetTraceEvents(SDL_TraceEvent *events, int maxevents);
+
+/**
+ *  \brief Get the totals for each zone since the counters were last reset.
+ *
+ *  Zones with the same name are added together, whichever thread ran them.
+ *
+ *  \param counters    An array to fill in, or NULL to just count the zones
+ *  \param maxcounters The size of the array
+ *
+ *  \return The number of zones, which may be more than maxcounters.
+ *
+ *  \sa SDL_ResetTraceCounters
+ */
+extern DECLSPEC int SDLCALL SDL_GetTraceCounters(SDL_TraceCounter *counters, int maxcounters);
+
+/**
+ *  \brief Reset the zone counters, for example at the start of each frame.
+ */
+extern DECLSPEC void SDLCALL SDL_ResetTraceCounters(void);
+
+/**
+ *  \brief Collect the recorded events and write them in the Chrome trace
+ *         event format, for chrome://tracing and similar tools.
+ *
+ *  \param dst     The stream to write to
+ *  \param freedst Non-zero to close the stream after writing
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SaveTraceJSON_RW(SDL_RWops *dst, int freedst);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include "close_code.h"
+
+#endif /* SDL_trace_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
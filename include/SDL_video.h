@@ -820,7 +820,12 @@ extern DECLSPEC SDL_Surface * SDLCALL SDL_GetWindowSurface(SDL_Window * window);
  *
  *  \return 0 on success, or -1 on error.
  *
+ *  If SDL_HINT_FRAMEBUFFER_DAMAGE is enabled, only the areas drawn since
+ *  the last update are copied, and nothing is copied if the surface hasn't
+ *  changed.
+ *
  *  \sa SDL_GetWindowSurface()
+ *  \sa SDL_GetWindowSurfaceDamage()
  *  \sa SDL_UpdateWindowSurfaceRects()
  */
 extern DECLSPEC int SDLCALL SDL_UpdateWindowSurface(SDL_Window * window);
@@ -837,6 +842,24 @@ extern DECLSPEC int SDLCALL SDL_UpdateWindowSurfaceRects(SDL_Window * window,
                                                          const SDL_Rect * rects,
                                                          int numrects);
 
+/**
+ *  \brief Get the rectangles SDL_UpdateWindowSurface() would copy to the screen.
+ *
+ *  \param window   The window to query.
+ *  \param rects    A pointer filled in with up to \c maxrects rectangles, or NULL.
+ *  \param maxrects The number of rectangles \c rects can hold.
+ *
+ *  \return The number of rectangles that would be copied, which may be more
+ *          than \c maxrects, or -1 on error.
+ *
+ *  Without SDL_HINT_FRAMEBUFFER_DAMAGE this is always the whole window.
+ *
+ *  \sa SDL_UpdateWindowSurface()
+ */
+extern DECLSPEC int SDLCALL SDL_GetWindowSurfaceDamage(SDL_Window * window,
+                                                       SDL_Rect * rects,
+                                                       int maxrects);
+
 /**
  *  \brief Set a window's input grab mode.
  *
@@ -33,6 +33,8 @@
 #include "events/SDL_events_c.h"
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
+#include "video/SDL_convert_c.h"
+#include "SDL_trace_c.h"
 
 /* Initialization/Cleanup routines */
 #if !SDL_TIMERS_DISABLED
@@ -357,6 +359,10 @@ SDL_Quit(void)
     SDL_TicksQuit();
 #endif
 
+    SDL_QuitConvertThreads();
+
+    SDL_QuitTrace();
+
     SDL_ClearHints();
     SDL_AssertionsQuit();
     SDL_LogResetPriorities();
@@ -0,0 +1,398 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "./SDL_internal.h"
+
+/* Lightweight tracing of SDL's internal hot paths */
+
+#include "SDL_atomic.h"
+#include "SDL_thread.h"
+#include "SDL_timer.h"
+#include "SDL_trace_c.h"
+
+/* Each thread records into its own buffer, guarded by a spinlock that is
+   only contended while the application is collecting the results.
+   Both sizes must be powers of two.
+ */
+#define SDL_TRACE_MAX_EVENTS    4096
+#define SDL_TRACE_MAX_COUNTERS  64
+
+typedef struct SDL_TraceBuffer
+{
+    SDL_SpinLock lock;
+    SDL_bool in_use;
+    SDL_threadID thread;
+
+    /* The event ring; the oldest events are overwritten when it's full */
+    Uint32 read;
+    Uint32 written;
+    SDL_TraceEvent events[SDL_TRACE_MAX_EVENTS];
+
+    /* Counters, hashed by name pointer, valid while epoch is current */
+    int epoch;
+    SDL_TraceCounter counters[SDL_TRACE_MAX_COUNTERS];
+
+    struct SDL_TraceBuffer *next;
+} SDL_TraceBuffer;
+
+SDL_bool SDL_trace_enabled = SDL_FALSE;
+
+static SDL_SpinLock trace_lock;
+static SDL_TLSID trace_tls;
+static SDL_atomic_t trace_epoch;
+static SDL_TraceBuffer *trace_buffers;   /* Never freed, threads may hold them */
+
+static void SDLCALL
+SDL_ReleaseTraceBuffer(void *data)
+{
+    SDL_TraceBuffer *buf = (SDL_TraceBuffer *) data;
+
+    /* Leave any events to be collected, and let another thread reuse it */
+    SDL_AtomicLock(&trace_lock);
+    buf->in_use = SDL_FALSE;
+    SDL_AtomicUnlock(&trace_lock);
+}
+
+static SDL_TraceBuffer *
+SDL_GetTraceBuffer(void)
+{
+    SDL_TraceBuffer *buf;
+
+    if (!trace_tls) {
+        SDL_AtomicLock(&trace_lock);
+        if (!trace_tls) {
+            trace_tls = SDL_TLSCreate();
+        }
+        SDL_AtomicUnlock(&trace_lock);
+        if (!trace_tls) {
+            return NULL;
+        }
+    }
+
+    buf = (SDL_TraceBuffer *) SDL_TLSGet(trace_tls);
+    if (buf) {
+        return buf;
+    }
+
+    SDL_AtomicLock(&trace_lock);
+    for (buf = trace_buffers; buf; buf = buf->next) {
+        if (!buf->in_use) {
+            break;
+        }
+    }
+    if (!buf) {
+        buf = (SDL_TraceBuffer *) SDL_calloc(1, sizeof(*buf));
+        if (buf) {
+            buf->epoch = SDL_AtomicGet(&trace_epoch) - 1;
+            buf->next = trace_buffers;
+            trace_buffers = buf;
+        }
+    }
+    if (buf) {
+        buf->in_use = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&trace_lock);
+
+    if (!buf) {
+        return NULL;
+    }
+
+    buf->thread = SDL_ThreadID();
+    if (SDL_TLSSet(trace_tls, buf, SDL_ReleaseTraceBuffer) < 0) {
+        SDL_ReleaseTraceBuffer(buf);
+        return NULL;
+    }
+    return buf;
+}
+
+void
+SDL_TraceRecord(const char *name, Uint64 start)
+{
+    const Uint64 end = SDL_GetPerformanceCounter();
+    const Uint64 elapsed = end - start;
+    SDL_TraceBuffer *buf = SDL_GetTraceBuffer();
+    SDL_TraceEvent *event;
+    SDL_TraceCounter *counter;
+    int epoch, i, slot;
+
+    if (!buf) {
+        return;  /* Out of memory, just drop it */
+    }
+
+    SDL_AtomicLock(&buf->lock);
+
+    event = &buf->events[buf->written & (SDL_TRACE_MAX_EVENTS - 1)];
+    event->name = name;
+    event->thread = buf->thread;
+    event->start = start;
+    event->end = end;
+    ++buf->written;
+    if ((buf->written - buf->read) > SDL_TRACE_MAX_EVENTS) {
+        buf->read = buf->written - SDL_TRACE_MAX_EVENTS;
+    }
+
+    epoch = SDL_AtomicGet(&trace_epoch);
+    if (buf->epoch != epoch) {
+        SDL_memset(buf->counters, 0, sizeof(buf->counters));
+        buf->epoch = epoch;
+    }
+    slot = (int) (((uintptr_t) name >> 3) & (SDL_TRACE_MAX_COUNTERS - 1));
+    for (i = 0; i < SDL_TRACE_MAX_COUNTERS; ++i) {
+        counter = &buf->counters[(slot + i) & (SDL_TRACE_MAX_COUNTERS - 1)];
+        if (counter->name == name || !counter->name) {
+            counter->name = name;
+            ++counter->count;
+            counter->total += elapsed;
+            if (elapsed > counter->max) {
+                counter->max = elapsed;
+            }
+            break;
+        }
+    }
+
+    SDL_AtomicUnlock(&buf->lock);
+}
+
+void
+SDL_SetTraceEnabled(SDL_bool enabled)
+{
+    SDL_trace_enabled = enabled ? SDL_TRUE : SDL_FALSE;
+}
+
+SDL_bool
+SDL_GetTraceEnabled(void)
+{
+    return SDL_trace_enabled;
+}
+
+Uint64
+SDL_TraceBegin(void)
+{
+    return SDL_TRACE_BEGIN();
+}
+
+void
+SDL_TraceEnd(const char *name, Uint64 start)
+{
+    if (name) {
+        SDL_TRACE_END(name, start);
+    }
+}
+
+int
+SDL_GetTraceEvents(SDL_TraceEvent *events, int maxevents)
+{
+    SDL_TraceBuffer *buf;
+    int count = 0;
+
+    if (!events) {
+        return SDL_InvalidParamError("events");
+    }
+
+    SDL_AtomicLock(&trace_lock);
+    for (buf = trace_buffers; buf && count < maxevents; buf = buf->next) {
+        SDL_AtomicLock(&buf->lock);
+        while (buf->read != buf->written && count < maxevents) {
+            events[count++] = buf->events[buf->read & (SDL_TRACE_MAX_EVENTS - 1)];
+            ++buf->read;
+        }
+        SDL_AtomicUnlock(&buf->lock);
+    }
+    SDL_AtomicUnlock(&trace_lock);
+
+    return count;
+}
+
+static int SDLCALL
+SDL_CompareTraceCounters(const void *a, const void *b)
+{
+    const SDL_TraceCounter *A = (const SDL_TraceCounter *) a;
+    const SDL_TraceCounter *B = (const SDL_TraceCounter *) b;
+
+    /* Busiest zones first */
+    if (A->total != B->total) {
+        return (A->total > B->total) ? -1 : 1;
+    }
+    return SDL_strcmp(A->name, B->name);
+}
+
+int
+SDL_GetTraceCounters(SDL_TraceCounter *counters, int maxcounters)
+{
+    SDL_TraceBuffer *buf;
+    SDL_TraceCounter *merged;
+    const SDL_TraceCounter *counter;
+    int nbuffers = 0;
+    int epoch, count = 0;
+    int i, j;
+
+    SDL_AtomicLock(&trace_lock);
+
+    for (buf = trace_buffers; buf; buf = buf->next) {
+        ++nbuffers;
+    }
+    merged = (SDL_TraceCounter *) SDL_malloc((nbuffers * SDL_TRACE_MAX_COUNTERS + 1) * sizeof(*merged));
+    if (!merged) {
+        SDL_AtomicUnlock(&trace_lock);
+        return SDL_OutOfMemory();
+    }
+
+    /* The same name may be a different pointer in each module that uses it */
+    epoch = SDL_AtomicGet(&trace_epoch);
+    for (buf = trace_buffers; buf; buf = buf->next) {
+        SDL_AtomicLock(&buf->lock);
+        if (buf->epoch == epoch) {
+            for (i = 0; i < SDL_TRACE_MAX_COUNTERS; ++i) {
+                counter = &buf->counters[i];
+                if (!counter->name) {
+                    continue;
+                }
+                for (j = 0; j < count; ++j) {
+                    if (SDL_strcmp(merged[j].name, counter->name) == 0) {
+                        break;
+                    }
+                }
+                if (j == count) {
+                    merged[count++] = *counter;
+                } else {
+                    merged[j].count += counter->count;
+                    merged[j].total += counter->total;
+                    if (counter->max > merged[j].max) {
+                        merged[j].max = counter->max;
+                    }
+                }
+            }
+        }
+        SDL_AtomicUnlock(&buf->lock);
+    }
+
+    SDL_AtomicUnlock(&trace_lock);
+
+    if (counters && maxcounters > 0) {
+        SDL_qsort(merged, count, sizeof(*merged), SDL_CompareTraceCounters);
+        SDL_memcpy(counters, merged, SDL_min(count, maxcounters) * sizeof(*merged));
+    }
+    SDL_free(merged);
+
+    return count;
+}
+
+void
+SDL_ResetTraceCounters(void)
+{
+    SDL_AtomicIncRef(&trace_epoch);
+}
+
+/* Write a counter value in microseconds, with nanosecond precision */
+static void
+SDL_FormatTraceTime(char *text, size_t maxlen, Uint64 ticks, Uint64 freq)
+{
+    const Uint64 ns = (ticks / freq) * 1000000000 + ((ticks % freq) * 1000000000) / freq;
+
+    SDL_snprintf(text, maxlen, "%" SDL_PRIu64 ".%03u", ns / 1000, (unsigned int) (ns % 1000));
+}
+
+static void
+SDL_EscapeTraceName(char *text, size_t maxlen, const char *name)
+{
+    size_t len = 0;
+
+    for (; *name && len + 7 < maxlen; ++name) {
+        const unsigned char ch = (unsigned char) *name;
+        if (ch == '"' || ch == '\\') {
+            text[len++] = '\\';
+            text[len++] = ch;
+        } else if (ch < ' ') {
+            len += SDL_snprintf(&text[len], maxlen - len, "\\u%04x", ch);
+        } else {
+            text[len++] = ch;
+        }
+    }
+    text[len] = '\0';
+}
+
+static int
+SDL_WriteTraceText(SDL_RWops *dst, const char *text)
+{
+    const size_t len = SDL_strlen(text);
+
+    if (SDL_RWwrite(dst, text, 1, len) != len) {
+        return SDL_Error(SDL_EFWRITE);
+    }
+    return 0;
+}
+
+int
+SDL_SaveTraceJSON_RW(SDL_RWops *dst, int freedst)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    SDL_TraceEvent events[64];
+    char name[128], ts[32], dur[32];
+    char line[256];
+    SDL_bool first = SDL_TRUE;
+    int i, count;
+    int retval;
+
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+
+    retval = SDL_WriteTraceText(dst, "{\"traceEvents\":[");
+    while (retval == 0 && (count = SDL_GetTraceEvents(events, SDL_arraysize(events))) > 0) {
+        for (i = 0; i < count && retval == 0; ++i) {
+            SDL_EscapeTraceName(name, sizeof(name), events[i].name);
+            SDL_FormatTraceTime(ts, sizeof(ts), events[i].start, freq);
+            SDL_FormatTraceTime(dur, sizeof(dur), events[i].end - events[i].start, freq);
+            SDL_snprintf(line, sizeof(line),
+                         "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%s,\"dur\":%s}",
+                         first ? "" : ",", name, events[i].thread, ts, dur);
+            retval = SDL_WriteTraceText(dst, line);
+            first = SDL_FALSE;
+        }
+    }
+    if (retval == 0) {
+        retval = SDL_WriteTraceText(dst, "\n]}\n");
+    }
+
+    if (freedst) {
+        SDL_RWclose(dst);
+    }
+    return retval;
+}
+
+void
+SDL_QuitTrace(void)
+{
+    SDL_TraceBuffer *buf;
+
+    SDL_trace_enabled = SDL_FALSE;
+
+    /* Threads may still hold their buffers, so just empty them */
+    SDL_AtomicLock(&trace_lock);
+    for (buf = trace_buffers; buf; buf = buf->next) {
+        SDL_AtomicLock(&buf->lock);
+        buf->read = buf->written;
+        SDL_AtomicUnlock(&buf->lock);
+    }
+    SDL_AtomicUnlock(&trace_lock);
+    SDL_ResetTraceCounters();
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
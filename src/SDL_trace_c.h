@@ -0,0 +1,49 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "./SDL_internal.h"
+
+#ifndef SDL_trace_c_h_
+#define SDL_trace_c_h_
+
+#include "SDL_trace.h"
+#include "SDL_timer.h"
+
+/* Tracing is checked inline, so a disabled zone costs one test.
+   Usage, with the declaration at the top of the block:
+
+    Uint64 trace_start;
+    ...
+    trace_start = SDL_TRACE_BEGIN();
+    ...do the work...
+    SDL_TRACE_END("SDL_Something", trace_start);
+ */
+extern SDL_bool SDL_trace_enabled;
+
+#define SDL_TRACE_BEGIN()   (SDL_trace_enabled ? SDL_GetPerformanceCounter() : 0)
+#define SDL_TRACE_END(name, start) \
+    do { if (start) { SDL_TraceRecord(name, start); } } while (0)
+
+extern void SDL_TraceRecord(const char *name, Uint64 start);
+extern void SDL_QuitTrace(void);
+
+#endif /* SDL_trace_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
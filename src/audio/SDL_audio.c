@@ -27,6 +27,7 @@
 #include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
 #include "../thread/SDL_systhread.h"
+#include "../SDL_trace_c.h"
 
 #define _THIS SDL_AudioDevice *_this
 
@@ -638,6 +639,151 @@ SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
 }
 
 
+/* bound stream support... */
+
+static void
+SDL_MixBoundAudioStreams(SDL_AudioDevice *device, Uint8 *data, int len)
+{
+    /* this function always holds the mixer lock before being called. */
+    const int samples = device->callbackspec.samples * device->callbackspec.channels;
+    const int floatlen = samples * (int) sizeof (float);
+    const SDL_bool direct = (device->callbackspec.format == AUDIO_F32SYS) ? SDL_TRUE : SDL_FALSE;
+    float *mix = direct ? (float *) data : device->mix_buffer;
+    int i;
+
+    SDL_assert(len == (int) device->callbackspec.size);
+
+    /* float output sums straight into the callback's data, anything
+       else is summed on its own and converted once at the end. */
+    if (!direct) {
+        SDL_memset(mix, '\0', floatlen);
+    }
+
+    for (i = 0; i < device->num_bound_streams; i++) {
+        const SDL_AudioStreamBinding *binding = &device->bound_streams[i];
+        const int got = SDL_AudioStreamGet(binding->stream, device->mix_scratch, floatlen);
+        if (got > 0) {  /* a stream that runs dry just contributes silence. */
+            SDL_MixFloat32Gain(mix, device->mix_scratch, got / (int) sizeof (float), binding->gain);
+        }
+    }
+
+    if (direct) {
+        SDL_ClampFloat32(mix, samples);
+    } else {
+        device->mix_cvt.buf = (Uint8 *) mix;
+        device->mix_cvt.len = floatlen;
+        SDL_ConvertAudio(&device->mix_cvt);
+        SDL_MixAudioFormat(data, (const Uint8 *) mix, device->callbackspec.format, device->mix_cvt.len_cvt, SDL_MIX_MAXVOLUME);
+    }
+}
+
+int
+SDL_BindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream, float gain)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioStreamBinding *bindings;
+    SDL_AudioFormat format;
+    Uint8 channels;
+    int rate;
+    int i;
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (device->iscapture) {
+        return SDL_SetError("This is a capture device, binding streams not allowed");
+    } else if (current_audio.impl.ProvidesOwnCallbackThread) {
+        return SDL_SetError("Audio driver doesn't support binding streams");
+    }
+
+    SDL_GetAudioStreamOutputFormat(stream, &format, &channels, &rate);
+    if ((format != AUDIO_F32SYS) || (channels != device->callbackspec.channels) || (rate != device->callbackspec.freq)) {
+        return SDL_SetError("Bound streams must output AUDIO_F32SYS at the device's channels and rate");
+    }
+
+    current_audio.impl.LockDevice(device);
+
+    /* already bound? Just update the gain. */
+    for (i = 0; i < device->num_bound_streams; i++) {
+        if (device->bound_streams[i].stream == stream) {
+            device->bound_streams[i].gain = gain;
+            current_audio.impl.UnlockDevice(device);
+            return 0;
+        }
+    }
+
+    /* the mixing buffers come with the first binding, so the audio thread never allocates. */
+    if (!device->mix_scratch) {
+        const size_t floatlen = device->callbackspec.samples * device->callbackspec.channels * sizeof (float);
+        if (device->callbackspec.format != AUDIO_F32SYS) {
+            if (SDL_BuildAudioCVT(&device->mix_cvt, AUDIO_F32SYS, channels, rate,
+                                  device->callbackspec.format, channels, rate) < 0) {
+                current_audio.impl.UnlockDevice(device);
+                return -1;  /* SDL_BuildAudioCVT should have called SDL_SetError. */
+            }
+            SDL_assert(device->mix_cvt.len_mult == 1);  /* converting from float never grows. */
+            if (!device->mix_buffer) {
+                device->mix_buffer = (float *) SDL_malloc(floatlen);
+            }
+        }
+        if (device->mix_buffer || (device->callbackspec.format == AUDIO_F32SYS)) {
+            device->mix_scratch = (float *) SDL_malloc(floatlen);
+        }
+        if (!device->mix_scratch) {
+            current_audio.impl.UnlockDevice(device);
+            return SDL_OutOfMemory();
+        }
+    }
+
+    if (device->num_bound_streams == device->max_bound_streams) {
+        const int newmax = device->max_bound_streams ? (device->max_bound_streams * 2) : 8;
+        bindings = (SDL_AudioStreamBinding *) SDL_realloc(device->bound_streams, newmax * sizeof (SDL_AudioStreamBinding));
+        if (!bindings) {
+            current_audio.impl.UnlockDevice(device);
+            return SDL_OutOfMemory();
+        }
+        device->bound_streams = bindings;
+        device->max_bound_streams = newmax;
+    }
+
+    device->bound_streams[device->num_bound_streams].stream = stream;
+    device->bound_streams[device->num_bound_streams].gain = gain;
+    device->num_bound_streams++;
+
+    current_audio.impl.UnlockDevice(device);
+
+    return 0;
+}
+
+int
+SDL_UnbindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    int i;
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    current_audio.impl.LockDevice(device);
+    for (i = 0; i < device->num_bound_streams; i++) {
+        if (device->bound_streams[i].stream == stream) {
+            device->num_bound_streams--;
+            SDL_memmove(&device->bound_streams[i], &device->bound_streams[i + 1],
+                        (device->num_bound_streams - i) * sizeof (SDL_AudioStreamBinding));
+            current_audio.impl.UnlockDevice(device);
+            return 0;
+        }
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    return SDL_SetError("Audio stream isn't bound to this device");
+}
+
+
 /* The general mixing thread function */
 static int SDLCALL
 SDL_RunAudio(void *devicep)
@@ -647,6 +793,7 @@ SDL_RunAudio(void *devicep)
     SDL_AudioCallback callback = device->callbackspec.callback;
     int data_len = 0;
     Uint8 *data;
+    Uint64 trace_start;
 
     SDL_assert(!device->iscapture);
 
@@ -685,7 +832,14 @@ SDL_RunAudio(void *devicep)
         if (SDL_AtomicGet(&device->paused)) {
             SDL_memset(data, device->spec.silence, data_len);
         } else {
+            trace_start = SDL_TRACE_BEGIN();
             callback(udata, data, data_len);
+            SDL_TRACE_END("SDL_AudioCallback", trace_start);
+            if (device->num_bound_streams > 0) {
+                trace_start = SDL_TRACE_BEGIN();
+                SDL_MixBoundAudioStreams(device, data, data_len);
+                SDL_TRACE_END("SDL_MixBoundAudioStreams", trace_start);
+            }
         }
         SDL_UnlockMutex(device->mixer_lock);
 
@@ -744,6 +898,7 @@ SDL_CaptureAudio(void *devicep)
     Uint8 *data;
     void *udata = device->callbackspec.userdata;
     SDL_AudioCallback callback = device->callbackspec.callback;
+    Uint64 trace_start;
 
     SDL_assert(device->iscapture);
 
@@ -818,7 +973,9 @@ SDL_CaptureAudio(void *devicep)
                 /* !!! FIXME: this should be LockDevice. */
                 SDL_LockMutex(device->mixer_lock);
                 if (!SDL_AtomicGet(&device->paused)) {
+                    trace_start = SDL_TRACE_BEGIN();
                     callback(udata, device->work_buffer, device->callbackspec.size);
+                    SDL_TRACE_END("SDL_AudioCallback", trace_start);
                 }
                 SDL_UnlockMutex(device->mixer_lock);
             }
@@ -826,7 +983,9 @@ SDL_CaptureAudio(void *devicep)
             /* !!! FIXME: this should be LockDevice. */
             SDL_LockMutex(device->mixer_lock);
             if (!SDL_AtomicGet(&device->paused)) {
+                trace_start = SDL_TRACE_BEGIN();
                 callback(udata, data, device->callbackspec.size);
+                SDL_TRACE_END("SDL_AudioCallback", trace_start);
             }
             SDL_UnlockMutex(device->mixer_lock);
         }
@@ -1073,6 +1232,9 @@ close_audio_device(SDL_AudioDevice * device)
 
     SDL_free(device->work_buffer);
     SDL_FreeAudioStream(device->stream);
+    SDL_free(device->bound_streams);  /* the streams themselves belong to the app. */
+    SDL_free(device->mix_buffer);
+    SDL_free(device->mix_scratch);
 
     if (device->hidden != NULL) {
         current_audio.impl.CloseDevice(device);
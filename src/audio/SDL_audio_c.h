@@ -69,6 +69,13 @@ extern SDL_AudioFilter SDL_Convert_F32_to_S16;
 extern SDL_AudioFilter SDL_Convert_F32_to_U16;
 extern SDL_AudioFilter SDL_Convert_F32_to_S32;
 
+/* Float mixing kernels from SDL_mixer.c, used to sum bound audio streams. */
+extern void SDL_MixFloat32Gain(float *dst, const float *src, const int samples, const float gain);  /* dst += src * gain */
+extern void SDL_ClampFloat32(float *buf, const int samples);  /* clamp to [-1, 1] */
+
+/* Output format of an audio stream, for checking it against a device. */
+extern void SDL_GetAudioStreamOutputFormat(SDL_AudioStream *stream, SDL_AudioFormat *format, Uint8 *channels, int *rate);
+
 /* You need to call SDL_PrepareResampleFilter() before using the internal resampler.
    SDL_AudioQuit() calls SDL_FreeResamplerFilter(), you should never call it yourself. */
 extern int SDL_PrepareResampleFilter(void);
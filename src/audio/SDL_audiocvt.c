@@ -32,14 +32,11 @@
 #include "SDL_loadso.h"
 #include "SDL_assert.h"
 #include "../SDL_dataqueue.h"
-#include "SDL_cpuinfo.h"
+#include "../SDL_trace_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 #define DEBUG_AUDIOSTREAM 0
 
-#ifdef __SSE3__
-#define HAVE_SSE3_INTRINSICS 1
-#endif
-
 #if HAVE_SSE3_INTRINSICS
 /* Convert from stereo to mono. Average left and right. */
 static void SDLCALL
@@ -460,35 +457,415 @@ SDL_PrepareResampleFilter(void)
     return 0;
 }
 
+static int
+ResamplerPadding(const int inrate, const int outrate)
+{
+    if (inrate == outrate) {
+        return 0;
+    } else if (inrate > outrate) {
+        return (int) SDL_ceil(((float) (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * inrate) / ((float) outrate)));
+    }
+    return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+}
+
+/* The resampler is polyphase: SDL_ResampleAudio only ever evaluates the
+   filter at a fixed set of fractional positions ("phases") between input
+   frames, determined by the ratio of the two rates. We calculate the
+   coefficients for every phase once, ordered by input frame, so producing
+   an output frame is a single dot product over RESAMPLER_TAPS input frames.
+   The first tap is RESAMPLER_TAPS_BEFORE frames before the input frame that
+   precedes the output frame in time. */
+#define RESAMPLER_TAPS ((RESAMPLER_ZERO_CROSSINGS + 1) * 2)
+#define RESAMPLER_TAPS_BEFORE RESAMPLER_ZERO_CROSSINGS
+
+/* Ratios of rates that don't reduce well (44100 -> 48001, etc) would need huge
+   tables; past this many phases we calculate the coefficients per frame. */
+#define RESAMPLER_MAX_PHASES 2048
+
+/* the SIMD kernels for mono and stereo consume the coefficients four at a time. */
+SDL_COMPILE_TIME_ASSERT(resampler_taps, (RESAMPLER_TAPS % 4) == 0);
+
+typedef void (*SDL_ResampleFrameFunc)(const int chans, const float *src, const float *coefficients, float *dst);
+
+typedef struct
+{
+    int chans;
+    int inrate;  /* rates reduced by their greatest common divisor. */
+    int outrate;
+    float *coefficients;  /* (outrate * RESAMPLER_TAPS) floats, NULL if we calculate per frame. */
+    SDL_ResampleFrameFunc resample_frame;
+} SDL_ResamplerPhases;
+
+static void
+ResamplerCalculateCoefficients(const double interpolation1, float *coefficients)
+{
+    const double interpolation2 = 1.0 - interpolation1;
+    const double filterpos1 = interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+    const double filterpos2 = interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+    const int filterindex1 = (int) filterpos1;
+    const int filterindex2 = (int) filterpos2;
+    /* linear interpolation between neighboring filter table entries. */
+    const double weight1 = filterpos1 - filterindex1;
+    const double weight2 = filterpos2 - filterindex2;
+    int j;
+
+    SDL_memset(coefficients, '\0', RESAMPLER_TAPS * sizeof (float));
+
+    /* the "left wing" runs backwards from the input frame before the output frame... */
+    for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+        const int idx = filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        coefficients[RESAMPLER_TAPS_BEFORE - j] = (float) (ResamplerFilter[idx] + (weight1 * ResamplerFilterDifference[idx]));
+    }
+
+    /* ...and the "right wing" runs forward from the input frame after it. */
+    for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+        const int idx = filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+        coefficients[RESAMPLER_TAPS_BEFORE + 1 + j] = (float) (ResamplerFilter[idx] + (weight2 * ResamplerFilterDifference[idx]));
+    }
+}
+
+static void
+SDL_ResampleFrame_Scalar(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    int chan, k;
+    for (chan = 0; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (k = 0; k < RESAMPLER_TAPS; k++) {
+            outsample += src[(k * chans) + chan] * coefficients[k];
+        }
+        dst[chan] = outsample;
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+SDL_ResampleFrame_c1_SSE2(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    __m128 sum = _mm_setzero_ps();
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k += 4) {
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + k), _mm_loadu_ps(coefficients + k)));
+    }
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    _mm_store_ss(dst, sum);
+}
+
+static void
+SDL_ResampleFrame_c2_SSE2(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    __m128 sum = _mm_setzero_ps();
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k += 4) {
+        /* four coefficients cover four stereo frames, two frames per register. */
+        const __m128 c = _mm_loadu_ps(coefficients + k);
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (k * 2)), _mm_unpacklo_ps(c, c)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (k * 2) + 4), _mm_unpackhi_ps(c, c)));
+    }
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    _mm_storel_pi((__m64 *) dst, sum);
+}
+
+static void
+SDL_ResampleFrame_c4_SSE2(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    __m128 sum = _mm_setzero_ps();
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k++) {
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + (k * 4)), _mm_set1_ps(coefficients[k])));
+    }
+    _mm_storeu_ps(dst, sum);
+}
+
+static void
+SDL_ResampleFrame_c6_SSE2(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    __m128 sum1 = _mm_setzero_ps();
+    __m128 sum2 = _mm_setzero_ps();
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k++) {
+        const __m128 c = _mm_set1_ps(coefficients[k]);
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(src + (k * 6)), c));
+        sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (src + (k * 6) + 4)), c));
+    }
+    _mm_storeu_ps(dst, sum1);
+    _mm_storel_pi((__m64 *) (dst + 4), sum2);
+}
+
+static void
+SDL_ResampleFrame_c8_SSE2(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    __m128 sum1 = _mm_setzero_ps();
+    __m128 sum2 = _mm_setzero_ps();
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k++) {
+        const __m128 c = _mm_set1_ps(coefficients[k]);
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(src + (k * 8)), c));
+        sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_loadu_ps(src + (k * 8) + 4), c));
+    }
+    _mm_storeu_ps(dst, sum1);
+    _mm_storeu_ps(dst + 4, sum2);
+}
+#endif
+
+#if HAVE_AVX2_INTRINSICS
+SDL_TARGETING_AVX2 static void
+SDL_ResampleFrame_c8_AVX2(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    __m256 sum = _mm256_setzero_ps();
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k++) {
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(src + (k * 8)), _mm256_set1_ps(coefficients[k])));
+    }
+    _mm256_storeu_ps(dst, sum);
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_ResampleFrame_c1_NEON(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    float32x2_t sum2;
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k += 4) {
+        sum = vmlaq_f32(sum, vld1q_f32(src + k), vld1q_f32(coefficients + k));
+    }
+    sum2 = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    sum2 = vpadd_f32(sum2, sum2);
+    vst1_lane_f32(dst, sum2, 0);
+}
+
+static void
+SDL_ResampleFrame_c2_NEON(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k += 4) {
+        /* four coefficients cover four stereo frames, two frames per register. */
+        const float32x4_t c = vld1q_f32(coefficients + k);
+        const float32x4x2_t cc = vzipq_f32(c, c);
+        sum = vmlaq_f32(sum, vld1q_f32(src + (k * 2)), cc.val[0]);
+        sum = vmlaq_f32(sum, vld1q_f32(src + (k * 2) + 4), cc.val[1]);
+    }
+    vst1_f32(dst, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+}
+
+static void
+SDL_ResampleFrame_c4_NEON(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k++) {
+        sum = vmlaq_n_f32(sum, vld1q_f32(src + (k * 4)), coefficients[k]);
+    }
+    vst1q_f32(dst, sum);
+}
+
+static void
+SDL_ResampleFrame_c6_NEON(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    float32x2_t sum2 = vdup_n_f32(0.0f);
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k++) {
+        sum1 = vmlaq_n_f32(sum1, vld1q_f32(src + (k * 6)), coefficients[k]);
+        sum2 = vmla_n_f32(sum2, vld1_f32(src + (k * 6) + 4), coefficients[k]);
+    }
+    vst1q_f32(dst, sum1);
+    vst1_f32(dst + 4, sum2);
+}
+
+static void
+SDL_ResampleFrame_c8_NEON(const int chans, const float *src, const float *coefficients, float *dst)
+{
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    float32x4_t sum2 = vdupq_n_f32(0.0f);
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k++) {
+        sum1 = vmlaq_n_f32(sum1, vld1q_f32(src + (k * 8)), coefficients[k]);
+        sum2 = vmlaq_n_f32(sum2, vld1q_f32(src + (k * 8) + 4), coefficients[k]);
+    }
+    vst1q_f32(dst, sum1);
+    vst1q_f32(dst + 4, sum2);
+}
+#endif
+
+static SDL_ResampleFrameFunc
+ChooseResampleFrameFunc(const int chans)
+{
+#if HAVE_AVX2_INTRINSICS
+    if ((chans == 8) && SDL_HasAVX2()) {
+        return SDL_ResampleFrame_c8_AVX2;
+    }
+#endif
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        switch (chans) {
+            case 1: return SDL_ResampleFrame_c1_SSE2;
+            case 2: return SDL_ResampleFrame_c2_SSE2;
+            case 4: return SDL_ResampleFrame_c4_SSE2;
+            case 6: return SDL_ResampleFrame_c6_SSE2;
+            case 8: return SDL_ResampleFrame_c8_SSE2;
+            default: break;
+        }
+    }
+#endif
+
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        switch (chans) {
+            case 1: return SDL_ResampleFrame_c1_NEON;
+            case 2: return SDL_ResampleFrame_c2_NEON;
+            case 4: return SDL_ResampleFrame_c4_NEON;
+            case 6: return SDL_ResampleFrame_c6_NEON;
+            case 8: return SDL_ResampleFrame_c8_NEON;
+            default: break;
+        }
+    }
+#endif
+
+    return SDL_ResampleFrame_Scalar;
+}
+
+static int
+ResamplerGCD(int a, int b)
+{
+    while (b != 0) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* You need to call SDL_PrepareResampleFilter() before this. */
+static int
+SDL_BuildResamplerPhases(SDL_ResamplerPhases *phases, const int chans, const int inrate, const int outrate)
+{
+    const int gcd = ResamplerGCD(inrate, outrate);
+    int i;
+
+    SDL_assert(ResamplerFilter != NULL);
+    SDL_assert((chans > 0) && (chans <= 8));
+
+    phases->chans = chans;
+    phases->inrate = inrate / gcd;
+    phases->outrate = outrate / gcd;
+    phases->coefficients = NULL;
+    phases->resample_frame = ChooseResampleFrameFunc(chans);
+
+    if (phases->outrate <= RESAMPLER_MAX_PHASES) {
+        phases->coefficients = (float *) SDL_malloc(phases->outrate * RESAMPLER_TAPS * sizeof (float));
+        if (!phases->coefficients) {
+            return SDL_OutOfMemory();
+        }
+        for (i = 0; i < phases->outrate; i++) {
+            const double interpolation = ((double) i) / ((double) phases->outrate);
+            ResamplerCalculateCoefficients(interpolation, phases->coefficients + (i * RESAMPLER_TAPS));
+        }
+    }
+
+    return 0;
+}
+
+static void
+SDL_FreeResamplerPhases(SDL_ResamplerPhases *phases)
+{
+    SDL_free(phases->coefficients);
+    phases->coefficients = NULL;
+}
+
+/* SDL_AudioCVT has nowhere to keep a phase table, so SDL_ResampleCVT() hangs on
+   to the last one it used here. A caller takes the table out of the cache while
+   it resamples, so other threads converting at the same time build their own. */
+static SDL_SpinLock ResamplerCVTPhasesSpinlock;
+static SDL_ResamplerPhases ResamplerCVTPhases;
+static SDL_bool ResamplerCVTPhasesCached = SDL_FALSE;
+
+static int
+SDL_TakeCVTResamplerPhases(SDL_ResamplerPhases *phases, const int chans, const int inrate, const int outrate)
+{
+    const int gcd = ResamplerGCD(inrate, outrate);
+    SDL_bool found = SDL_FALSE;
+
+    SDL_AtomicLock(&ResamplerCVTPhasesSpinlock);
+    if (ResamplerCVTPhasesCached && (ResamplerCVTPhases.chans == chans) &&
+        (ResamplerCVTPhases.inrate == (inrate / gcd)) && (ResamplerCVTPhases.outrate == (outrate / gcd))) {
+        *phases = ResamplerCVTPhases;
+        ResamplerCVTPhasesCached = SDL_FALSE;
+        found = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&ResamplerCVTPhasesSpinlock);
+
+    return found ? 0 : SDL_BuildResamplerPhases(phases, chans, inrate, outrate);
+}
+
+static void
+SDL_ReturnCVTResamplerPhases(SDL_ResamplerPhases *phases)
+{
+    SDL_ResamplerPhases previous;
+    SDL_bool hadprevious;
+
+    SDL_AtomicLock(&ResamplerCVTPhasesSpinlock);
+    previous = ResamplerCVTPhases;
+    hadprevious = ResamplerCVTPhasesCached;
+    ResamplerCVTPhases = *phases;
+    ResamplerCVTPhasesCached = SDL_TRUE;
+    SDL_AtomicUnlock(&ResamplerCVTPhasesSpinlock);
+
+    if (hadprevious) {
+        SDL_FreeResamplerPhases(&previous);
+    }
+}
+
 void
 SDL_FreeResampleFilter(void)
 {
+    SDL_AtomicLock(&ResamplerCVTPhasesSpinlock);
+    if (ResamplerCVTPhasesCached) {
+        SDL_FreeResamplerPhases(&ResamplerCVTPhases);
+        ResamplerCVTPhasesCached = SDL_FALSE;
+    }
+    SDL_AtomicUnlock(&ResamplerCVTPhasesSpinlock);
+
     SDL_free(ResamplerFilter);
     SDL_free(ResamplerFilterDifference);
     ResamplerFilter = NULL;
     ResamplerFilterDifference = NULL;
 }
 
-static int
-ResamplerPadding(const int inrate, const int outrate)
+/* Copy the input frames a filter window starting at (firstframe) covers into (window),
+   pulling from the padding where it hangs off either end of the input. */
+static void
+ResamplerGatherWindow(const int chans, const int firstframe, const int paddinglen,
+                      const float *lpadding, const float *rpadding,
+                      const float *inbuf, const int inframes, float *window)
 {
-    if (inrate == outrate) {
-        return 0;
-    } else if (inrate > outrate) {
-        return (int) SDL_ceil(((float) (RESAMPLER_SAMPLES_PER_ZERO_CROSSING * inrate) / ((float) outrate)));
+    int k;
+    for (k = 0; k < RESAMPLER_TAPS; k++) {
+        const int srcframe = firstframe + k;
+        const float *src;
+        if (srcframe < 0) {
+            src = lpadding + ((paddinglen + srcframe) * chans);
+        } else if (srcframe >= inframes) {
+            src = rpadding + ((srcframe - inframes) * chans);
+        } else {
+            src = inbuf + (srcframe * chans);
+        }
+        SDL_memcpy(window + (k * chans), src, chans * sizeof (float));
     }
-    return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
 /* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes. */
 static int
-SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+SDL_ResampleAudio(const SDL_ResamplerPhases *phases, const int chans,
+                        const int inrate, const int outrate,
                         const float *lpadding, const float *rpadding,
                         const float *inbuf, const int inbuflen,
                         float *outbuf, const int outbuflen)
 {
-    const double finrate = (double) inrate;
-    const double outtimeincr = 1.0 / ((float) outrate);
     const double  ratio = ((float) outrate) / ((float) inrate);
     const int paddinglen = ResamplerPadding(inrate, outrate);
     const int framelen = chans * (int)sizeof (float);
@@ -496,49 +873,72 @@ SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
     const int wantedoutframes = (int) ((inbuflen / framelen) * ratio);  /* outbuflen isn't total to write, it's total available. */
     const int maxoutframes = outbuflen / framelen;
     const int outframes = SDL_min(wantedoutframes, maxoutframes);
+    const SDL_ResampleFrameFunc resample_frame = phases->resample_frame;
+    /* each output frame moves us (srcstep + (phasestep / phases->outrate)) input frames. */
+    const int srcstep = phases->inrate / phases->outrate;
+    const int phasestep = phases->inrate % phases->outrate;
+    const int lastframe = inframes - (RESAMPLER_TAPS - RESAMPLER_TAPS_BEFORE);
+    float window[RESAMPLER_TAPS * 8];
+    float scratch[RESAMPLER_TAPS];
+    const float *coefficients;
     float *dst = outbuf;
-    double outtime = 0.0;
-    int i, j, chan;
-
-    for (i = 0; i < outframes; i++) {
-        const int srcindex = (int) (outtime * inrate);
-        const double intime = ((double) srcindex) / finrate;
-        const double innexttime = ((double) (srcindex + 1)) / finrate;
-        const double interpolation1 = 1.0 - ((innexttime - outtime) / (innexttime - intime));
-        const int filterindex1 = (int) (interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-        const double interpolation2 = 1.0 - interpolation1;
-        const int filterindex2 = (int) (interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
-
-        for (chan = 0; chan < chans; chan++) {
-            float outsample = 0.0f;
-
-            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
-            /* !!! FIXME: do both wings in one loop */
-            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex - j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a pre loop. */
-                const float insample = (srcframe < 0) ? lpadding[((paddinglen + srcframe) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation1 * ResamplerFilterDifference[filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
-            }
+    int srcindex = 0;
+    int phase = 0;
+    int i = 0;
+
+    SDL_assert(chans <= 8);
+
+    #define RESAMPLER_COEFFICIENTS() \
+        if (phases->coefficients) { \
+            coefficients = phases->coefficients + (phase * RESAMPLER_TAPS); \
+        } else { \
+            ResamplerCalculateCoefficients(((double) phase) / ((double) phases->outrate), scratch); \
+            coefficients = scratch; \
+        }
 
-            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int srcframe = srcindex + 1 + j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a post loop. */
-                const float insample = (srcframe >= inframes) ? rpadding[((srcframe - inframes) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float)(insample * (ResamplerFilter[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)] + (interpolation2 * ResamplerFilterDifference[filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)])));
-            }
-            *(dst++) = outsample;
+    #define RESAMPLER_ADVANCE() \
+        dst += chans; \
+        srcindex += srcstep; \
+        phase += phasestep; \
+        if (phase >= phases->outrate) { \
+            phase -= phases->outrate; \
+            srcindex++; \
         }
 
-        outtime += outtimeincr;
+    /* frames whose filter window starts in the left padding. */
+    for (; (i < outframes) && (srcindex < RESAMPLER_TAPS_BEFORE); i++) {
+        RESAMPLER_COEFFICIENTS();
+        ResamplerGatherWindow(chans, srcindex - RESAMPLER_TAPS_BEFORE, paddinglen, lpadding, rpadding, inbuf, inframes, window);
+        resample_frame(chans, window, coefficients, dst);
+        RESAMPLER_ADVANCE();
     }
 
+    /* the filter window is entirely inside the input buffer here, which is nearly every frame. */
+    for (; (i < outframes) && (srcindex <= lastframe); i++) {
+        RESAMPLER_COEFFICIENTS();
+        resample_frame(chans, inbuf + ((srcindex - RESAMPLER_TAPS_BEFORE) * chans), coefficients, dst);
+        RESAMPLER_ADVANCE();
+    }
+
+    /* frames whose filter window ends in the right padding. */
+    for (; i < outframes; i++) {
+        RESAMPLER_COEFFICIENTS();
+        ResamplerGatherWindow(chans, srcindex - RESAMPLER_TAPS_BEFORE, paddinglen, lpadding, rpadding, inbuf, inframes, window);
+        resample_frame(chans, window, coefficients, dst);
+        RESAMPLER_ADVANCE();
+    }
+
+    #undef RESAMPLER_COEFFICIENTS
+    #undef RESAMPLER_ADVANCE
+
     return outframes * chans * sizeof (float);
 }
 
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
+    Uint64 trace_start;
+
     /* !!! FIXME: (cvt) should be const; stack-copy it here. */
     /* !!! FIXME: (actually, we can't...len_cvt needs to be updated. Grr.) */
 
@@ -554,8 +954,10 @@ SDL_ConvertAudio(SDL_AudioCVT * cvt)
     }
 
     /* Set up the conversion and go! */
+    trace_start = SDL_TRACE_BEGIN();
     cvt->filter_index = 0;
     cvt->filters[0] (cvt, cvt->src_format);
+    SDL_TRACE_END("SDL_ConvertAudio", trace_start);
     return 0;
 }
 
@@ -719,6 +1121,7 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
     float *dst = (float *) (cvt->buf + srclen);
     const int dstlen = (cvt->len * cvt->len_mult) - srclen;
     const int paddingsamples = (ResamplerPadding(inrate, outrate) * chans);
+    SDL_ResamplerPhases phases;
     float *padding;
 
     SDL_assert(format == AUDIO_F32SYS);
@@ -730,8 +1133,14 @@ SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    if (SDL_TakeCVTResamplerPhases(&phases, chans, inrate, outrate) < 0) {
+        SDL_free(padding);
+        return;
+    }
 
+    cvt->len_cvt = SDL_ResampleAudio(&phases, chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+
+    SDL_ReturnCVTResamplerPhases(&phases);
     SDL_free(padding);
 
     SDL_memmove(cvt->buf, dst, cvt->len_cvt);  /* !!! FIXME: remove this if we can get the resampler to work in-place again. */
@@ -1080,6 +1489,13 @@ typedef int (*SDL_ResampleAudioStreamFunc)(SDL_AudioStream *stream, const void *
 typedef void (*SDL_ResetAudioStreamResamplerFunc)(SDL_AudioStream *stream);
 typedef void (*SDL_CleanupAudioStreamResamplerFunc)(SDL_AudioStream *stream);
 
+/* resampler_state for SDL's internal resampler. */
+typedef struct
+{
+    SDL_ResamplerPhases phases;
+    float *lpadding;
+} SDL_AudioStreamResamplerState;
+
 struct _SDL_AudioStream
 {
     SDL_AudioCVT cvt_before_resampling;
@@ -1108,8 +1524,96 @@ struct _SDL_AudioStream
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
     SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
+    /* Streams from SDL_NewAudioStreamWithBuffer() never allocate after
+       creation: input is converted at most max_put_len bytes at a time and
+       output goes into this ring instead of the data queue. */
+    int max_put_len;
+    Uint8 *ring;
+    SDL_bool ring_owned;
+    int ring_len;
+    int ring_start;
+    int ring_filled;
 };
 
+static int
+StreamOutputWrite(SDL_AudioStream *stream, const void *_buf, const int len)
+{
+    const Uint8 *buf = (const Uint8 *) _buf;
+    int end, cpy;
+
+    if (!stream->ring) {
+        return SDL_WriteToDataQueue(stream->queue, buf, len);
+    } else if (len > (stream->ring_len - stream->ring_filled)) {
+        return SDL_SetError("Audio stream buffer is full");
+    }
+
+    end = (stream->ring_start + stream->ring_filled) % stream->ring_len;
+    cpy = SDL_min(len, stream->ring_len - end);
+    SDL_memcpy(stream->ring + end, buf, cpy);
+    SDL_memcpy(stream->ring, buf + cpy, len - cpy);
+    stream->ring_filled += len;
+    return 0;
+}
+
+static int
+StreamOutputRead(SDL_AudioStream *stream, void *_buf, const int _len)
+{
+    Uint8 *buf = (Uint8 *) _buf;
+    int len, cpy;
+
+    if (!stream->ring) {
+        return (int) SDL_ReadFromDataQueue(stream->queue, buf, _len);
+    }
+
+    len = SDL_min(_len, stream->ring_filled);
+    cpy = SDL_min(len, stream->ring_len - stream->ring_start);
+    SDL_memcpy(buf, stream->ring + stream->ring_start, cpy);
+    SDL_memcpy(buf + cpy, stream->ring, len - cpy);
+    stream->ring_start = (stream->ring_start + len) % stream->ring_len;
+    stream->ring_filled -= len;
+    if (stream->ring_filled == 0) {
+        stream->ring_start = 0;
+    }
+    return len;
+}
+
+static int
+StreamOutputAvailable(SDL_AudioStream *stream)
+{
+    return stream->ring ? stream->ring_filled : (int) SDL_CountDataQueue(stream->queue);
+}
+
+/* Bytes of work buffer SDL_AudioStreamPutInternal() needs to convert (buflen) bytes of input. */
+static int
+GetStreamWorkBufferLen(SDL_AudioStream *stream, const int buflen, int *resamplebuflen)
+{
+    int workbuflen = buflen;
+
+    *resamplebuflen = 0;
+
+    if (stream->cvt_before_resampling.needed) {
+        workbuflen *= stream->cvt_before_resampling.len_mult;
+    }
+
+    if (stream->dst_rate != stream->src_rate) {
+        /* resamples can't happen in place, so make space for second buf. */
+        const int framesize = stream->pre_resample_channels * sizeof (float);
+        const int frames = workbuflen / framesize;
+        *resamplebuflen = ((int) SDL_ceil(frames * stream->rate_incr)) * framesize;
+        #if DEBUG_AUDIOSTREAM
+        printf("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, *resamplebuflen, stream->rate_incr);
+        #endif
+        workbuflen += *resamplebuflen;
+    }
+
+    if (stream->cvt_after_resampling.needed) {
+        /* !!! FIXME: buffer might be big enough already? */
+        workbuflen *= stream->cvt_after_resampling.len_mult;
+    }
+
+    return workbuflen + (stream->resampler_padding_samples * sizeof (float));
+}
+
 static Uint8 *
 EnsureStreamBufferSize(SDL_AudioStream *stream, const int newlen)
 {
@@ -1119,6 +1623,8 @@ EnsureStreamBufferSize(SDL_AudioStream *stream, const int newlen)
     if (stream->work_buffer_len >= newlen) {
         ptr = stream->work_buffer_base;
     } else {
+        /* fixed streams size this once at creation. */
+        SDL_assert(!stream->ring || !stream->work_buffer_base);
         ptr = (Uint8 *) SDL_realloc(stream->work_buffer_base, newlen + 32);
         if (!ptr) {
             SDL_OutOfMemory();
@@ -1227,14 +1733,15 @@ SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf, const int i
     const int outrate = stream->dst_rate;
     const int paddingsamples = stream->resampler_padding_samples;
     const int paddingbytes = paddingsamples * sizeof (float);
-    float *lpadding = (float *) stream->resampler_state;
+    SDL_AudioStreamResamplerState *state = (SDL_AudioStreamResamplerState *) stream->resampler_state;
+    float *lpadding = state->lpadding;
     const float *rpadding = (const float *) inbufend; /* we set this up so there are valid padding samples at the end of the input buffer. */
     const int cpy = SDL_min(inbuflen, paddingbytes);
     int retval;
 
     SDL_assert(inbuf != ((const float *) outbuf));  /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    retval = SDL_ResampleAudio(&state->phases, chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof (float)), inbufend - cpy, cpy);
@@ -1245,23 +1752,62 @@ static void
 SDL_ResetAudioStreamResampler(SDL_AudioStream *stream)
 {
     /* set all the padding to silence. */
+    SDL_AudioStreamResamplerState *state = (SDL_AudioStreamResamplerState *) stream->resampler_state;
     const int len = stream->resampler_padding_samples;
-    SDL_memset(stream->resampler_state, '\0', len * sizeof (float));
+    SDL_memset(state->lpadding, '\0', len * sizeof (float));
 }
 
 static void
 SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
 {
-    SDL_free(stream->resampler_state);
+    SDL_AudioStreamResamplerState *state = (SDL_AudioStreamResamplerState *) stream->resampler_state;
+    if (state) {
+        SDL_FreeResamplerPhases(&state->phases);
+        SDL_free(state->lpadding);
+        SDL_free(state);
+    }
 }
 
-SDL_AudioStream *
-SDL_NewAudioStream(const SDL_AudioFormat src_format,
-                   const Uint8 src_channels,
-                   const int src_rate,
-                   const SDL_AudioFormat dst_format,
-                   const Uint8 dst_channels,
-                   const int dst_rate)
+static int
+SetupInternalResampling(SDL_AudioStream *stream)
+{
+    SDL_AudioStreamResamplerState *state;
+
+    if (SDL_PrepareResampleFilter() < 0) {
+        return -1;
+    }
+
+    state = (SDL_AudioStreamResamplerState *) SDL_calloc(1, sizeof (SDL_AudioStreamResamplerState));
+    if (!state) {
+        return SDL_OutOfMemory();
+    }
+
+    state->lpadding = (float *) SDL_calloc(stream->resampler_padding_samples, sizeof (float));
+    if (!state->lpadding) {
+        SDL_free(state);
+        return SDL_OutOfMemory();
+    }
+
+    if (SDL_BuildResamplerPhases(&state->phases, stream->pre_resample_channels, stream->src_rate, stream->dst_rate) < 0) {
+        SDL_free(state->lpadding);
+        SDL_free(state);
+        return -1;
+    }
+
+    stream->resampler_state = state;
+    stream->resampler_func = SDL_ResampleAudioStream;
+    stream->reset_resampler_func = SDL_ResetAudioStreamResampler;
+    stream->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
+    return 0;
+}
+
+static SDL_AudioStream *
+CreateAudioStream(const SDL_AudioFormat src_format,
+                  const Uint8 src_channels,
+                  const int src_rate,
+                  const SDL_AudioFormat dst_format,
+                  const Uint8 dst_channels,
+                  const int dst_rate)
 {
     const int packetlen = 4096;  /* !!! FIXME: good enough for now. */
     Uint8 pre_resample_channels;
@@ -1329,23 +1875,10 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
 #endif
 
         if (!retval->resampler_func) {
-            retval->resampler_state = SDL_calloc(retval->resampler_padding_samples, sizeof (float));
-            if (!retval->resampler_state) {
-                SDL_FreeAudioStream(retval);
-                SDL_OutOfMemory();
-                return NULL;
-            }
-
-            if (SDL_PrepareResampleFilter() < 0) {
-                SDL_free(retval->resampler_state);
-                retval->resampler_state = NULL;
+            if (SetupInternalResampling(retval) < 0) {
                 SDL_FreeAudioStream(retval);
-                return NULL;
+                return NULL;  /* SetupInternalResampling should have called SDL_SetError. */
             }
-
-            retval->resampler_func = SDL_ResampleAudioStream;
-            retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
-            retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
         }
 
         /* Convert us to the final format after resampling. */
@@ -1355,7 +1888,23 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
         }
     }
 
-    retval->queue = SDL_NewDataQueue(packetlen, packetlen * 2);
+    return retval;
+}
+
+SDL_AudioStream *
+SDL_NewAudioStream(const SDL_AudioFormat src_format,
+                   const Uint8 src_channels,
+                   const int src_rate,
+                   const SDL_AudioFormat dst_format,
+                   const Uint8 dst_channels,
+                   const int dst_rate)
+{
+    SDL_AudioStream *retval = CreateAudioStream(src_format, src_channels, src_rate, dst_format, dst_channels, dst_rate);
+    if (!retval) {
+        return NULL;
+    }
+
+    retval->queue = SDL_NewDataQueue(retval->packetlen, retval->packetlen * 2);
     if (!retval->queue) {
         SDL_FreeAudioStream(retval);
         return NULL;  /* SDL_NewDataQueue should have called SDL_SetError. */
@@ -1364,6 +1913,59 @@ SDL_NewAudioStream(const SDL_AudioFormat src_format,
     return retval;
 }
 
+SDL_AudioStream *
+SDL_NewAudioStreamWithBuffer(const SDL_AudioFormat src_format,
+                             const Uint8 src_channels,
+                             const int src_rate,
+                             const SDL_AudioFormat dst_format,
+                             const Uint8 dst_channels,
+                             const int dst_rate,
+                             const int max_put_len,
+                             void *buffer,
+                             const int buffer_len)
+{
+    SDL_AudioStream *retval;
+    int resamplebuflen;
+
+    if (max_put_len <= 0) {
+        SDL_InvalidParamError("max_put_len");
+        return NULL;
+    } else if (buffer_len <= 0) {
+        SDL_InvalidParamError("buffer_len");
+        return NULL;
+    }
+
+    retval = CreateAudioStream(src_format, src_channels, src_rate, dst_format, dst_channels, dst_rate);
+    if (!retval) {
+        return NULL;
+    }
+
+    /* whole sample frames only, and never less than the staging buffer,
+       since the first conversion after a flush has to cover the resampler padding. */
+    retval->max_put_len = SDL_max(max_put_len - (max_put_len % retval->src_sample_frame_size), retval->src_sample_frame_size);
+    retval->max_put_len = SDL_max(retval->max_put_len, retval->staging_buffer_size);
+
+    if (!EnsureStreamBufferSize(retval, GetStreamWorkBufferLen(retval, retval->max_put_len, &resamplebuflen))) {
+        SDL_FreeAudioStream(retval);
+        return NULL;
+    }
+
+    if (buffer) {
+        retval->ring = (Uint8 *) buffer;
+    } else {
+        retval->ring = (Uint8 *) SDL_malloc(buffer_len);
+        if (!retval->ring) {
+            SDL_FreeAudioStream(retval);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        retval->ring_owned = SDL_TRUE;
+    }
+    retval->ring_len = buffer_len;
+
+    return retval;
+}
+
 static int
 SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, int *maxputbytes)
 {
@@ -1371,9 +1973,10 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
     int workbuflen;
     Uint8 *workbuf;
     Uint8 *resamplebuf = NULL;
-    int resamplebuflen = 0;
+    int resamplebuflen;
     int neededpaddingbytes;
     int paddingbytes;
+    Uint64 trace_start;
 
     /* !!! FIXME: several converters can take advantage of SIMD, but only
        !!! FIXME:  if the data is aligned to 16 bytes. EnsureStreamBufferSize()
@@ -1389,28 +1992,7 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
     stream->first_run = SDL_FALSE;
 
     /* Make sure the work buffer can hold all the data we need at once... */
-    workbuflen = buflen;
-    if (stream->cvt_before_resampling.needed) {
-        workbuflen *= stream->cvt_before_resampling.len_mult;
-    }
-
-    if (stream->dst_rate != stream->src_rate) {
-        /* resamples can't happen in place, so make space for second buf. */
-        const int framesize = stream->pre_resample_channels * sizeof (float);
-        const int frames = workbuflen / framesize;
-        resamplebuflen = ((int) SDL_ceil(frames * stream->rate_incr)) * framesize;
-        #if DEBUG_AUDIOSTREAM
-        printf("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, resamplebuflen, stream->rate_incr);
-        #endif
-        workbuflen += resamplebuflen;
-    }
-
-    if (stream->cvt_after_resampling.needed) {
-        /* !!! FIXME: buffer might be big enough already? */
-        workbuflen *= stream->cvt_after_resampling.len_mult;
-    }
-
-    workbuflen += neededpaddingbytes;
+    workbuflen = GetStreamWorkBufferLen(stream, buflen, &resamplebuflen);
 
     #if DEBUG_AUDIOSTREAM
     printf("AUDIOSTREAM: Putting %d bytes of preconverted audio, need %d byte work buffer\n", buflen, workbuflen);
@@ -1455,7 +2037,9 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
         resamplebuf = workbuf + buflen;  /* skip to second piece of workbuf. */
         SDL_assert(buflen >= neededpaddingbytes);
         if (buflen > neededpaddingbytes) {
+            trace_start = SDL_TRACE_BEGIN();
             buflen = stream->resampler_func(stream, workbuf, buflen - neededpaddingbytes, resamplebuf, resamplebuflen);
+            SDL_TRACE_END("SDL_AudioStreamResample", trace_start);
         } else {
             buflen = 0;
         }
@@ -1490,7 +2074,33 @@ SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf, int len, in
     }
 
     /* resamplebuf holds the final output, even if we didn't resample. */
-    return buflen ? SDL_WriteToDataQueue(stream->queue, resamplebuf, buflen) : 0;
+    return buflen ? StreamOutputWrite(stream, resamplebuf, buflen) : 0;
+}
+
+/* Fixed streams only have work buffer space for max_put_len bytes at a time. */
+static int
+SDL_AudioStreamPutChunks(SDL_AudioStream *stream, const void *buf, int len)
+{
+    const int maxlen = stream->max_put_len;
+
+    while (maxlen && (len > maxlen)) {
+        if (SDL_AudioStreamPutInternal(stream, buf, maxlen, NULL) < 0) {
+            return -1;
+        }
+        buf = (const void *)((const Uint8 *)buf + maxlen);
+        len -= maxlen;
+    }
+    return SDL_AudioStreamPutInternal(stream, buf, len, NULL);
+}
+
+/* Most output bytes putting (len) more bytes can produce; fixed streams
+   check this against the ring so a put never fails halfway through. */
+static int
+GetStreamMaxPutOutput(SDL_AudioStream *stream, const int len)
+{
+    const int frames = (stream->staging_buffer_filled + len) / stream->src_sample_frame_size;
+    const int chunks = 2 + ((stream->staging_buffer_filled + len) / stream->max_put_len);
+    return ((int) SDL_ceil(frames * stream->rate_incr) + chunks) * stream->dst_sample_frame_size;
 }
 
 int
@@ -1524,7 +2134,11 @@ SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
         #if DEBUG_AUDIOSTREAM
         printf("AUDIOSTREAM: no conversion needed at all, queueing %d bytes.\n", len);
         #endif
-        return SDL_WriteToDataQueue(stream->queue, buf, len);
+        return StreamOutputWrite(stream, buf, len);
+    }
+
+    if (stream->ring && (GetStreamMaxPutOutput(stream, len) > (stream->ring_len - stream->ring_filled))) {
+        return SDL_SetError("Audio stream buffer is full");
     }
 
     while (len > 0) {
@@ -1534,7 +2148,7 @@ SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
            we don't need to store it for later, skip the staging process.
          */
         if (!stream->staging_buffer_filled && len >= stream->staging_buffer_size) {
-            return SDL_AudioStreamPutInternal(stream, buf, len, NULL);
+            return SDL_AudioStreamPutChunks(stream, buf, len);
         }
 
         /* If there's not enough data to fill the staging buffer, just save it */
@@ -1589,6 +2203,10 @@ int SDL_AudioStreamFlush(SDL_AudioStream *stream)
             printf("AUDIOSTREAM: flushing with padding to get max %d bytes!\n", flush_remaining);
             #endif
 
+            if (stream->ring && (flush_remaining > (stream->ring_len - stream->ring_filled))) {
+                return SDL_SetError("Audio stream buffer is full");
+            }
+
             SDL_memset(stream->staging_buffer + filled, '\0', stream->staging_buffer_size - filled);
             if (SDL_AudioStreamPutInternal(stream, stream->staging_buffer, stream->staging_buffer_size, &flush_remaining) < 0) {
                 return -1;
@@ -1628,14 +2246,14 @@ SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
         return SDL_SetError("Can't request partial sample frames");
     }
 
-    return (int) SDL_ReadFromDataQueue(stream->queue, buf, len);
+    return StreamOutputRead(stream, buf, len);
 }
 
 /* number of converted/resampled bytes available */
 int
 SDL_AudioStreamAvailable(SDL_AudioStream *stream)
 {
-    return stream ? (int) SDL_CountDataQueue(stream->queue) : 0;
+    return stream ? StreamOutputAvailable(stream) : 0;
 }
 
 void
@@ -1644,7 +2262,12 @@ SDL_AudioStreamClear(SDL_AudioStream *stream)
     if (!stream) {
         SDL_InvalidParamError("stream");
     } else {
-        SDL_ClearDataQueue(stream->queue, stream->packetlen * 2);
+        if (stream->ring) {
+            stream->ring_start = 0;
+            stream->ring_filled = 0;
+        } else {
+            SDL_ClearDataQueue(stream->queue, stream->packetlen * 2);
+        }
         if (stream->reset_resampler_func) {
             stream->reset_resampler_func(stream);
         }
@@ -1653,6 +2276,14 @@ SDL_AudioStreamClear(SDL_AudioStream *stream)
     }
 }
 
+void
+SDL_GetAudioStreamOutputFormat(SDL_AudioStream *stream, SDL_AudioFormat *format, Uint8 *channels, int *rate)
+{
+    *format = stream->dst_format;
+    *channels = stream->dst_channels;
+    *rate = stream->dst_rate;
+}
+
 /* dispose of a stream */
 void
 SDL_FreeAudioStream(SDL_AudioStream *stream)
@@ -1665,6 +2296,9 @@ SDL_FreeAudioStream(SDL_AudioStream *stream)
         SDL_free(stream->staging_buffer);
         SDL_free(stream->work_buffer_base);
         SDL_free(stream->resampler_padding);
+        if (stream->ring_owned) {
+            SDL_free(stream->ring);
+        }
         SDL_free(stream);
     }
 }
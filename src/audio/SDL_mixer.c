@@ -22,7 +22,7 @@
 
 /* This provides the default mixing callback for the SDL audio routines */
 
-#include "SDL_cpuinfo.h"
+#include "../cpuinfo/SDL_simd.h"
 #include "SDL_timer.h"
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
@@ -85,6 +85,184 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(s, v) (s = (s*v)/SDL_MIX_MAXVOLUME)
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 
+/* The SIMD mixers below give the same results as the scalar loops in
+   SDL_MixAudioFormat(), and return how many samples they handled; the
+   scalar code finishes the rest. They only handle native byte order. */
+
+#if HAVE_SSE2_INTRINSICS
+static int
+SDL_MixAudio_S16_SSE2(Sint16 *dst, const Sint16 *src, const int samples, const int volume)
+{
+    const __m128i vol = _mm_set1_epi16((short) volume);
+    const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    int i;
+
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        if (volume != SDL_MIX_MAXVOLUME) {
+            const __m128i plo = _mm_mullo_epi16(s, vol);
+            const __m128i phi = _mm_mulhi_epi16(s, vol);
+            __m128i lo = _mm_unpacklo_epi16(plo, phi);
+            __m128i hi = _mm_unpackhi_epi16(plo, phi);
+            /* divide by 128, rounding toward zero like ADJUST_VOLUME. */
+            lo = _mm_srai_epi32(_mm_add_epi32(lo, _mm_and_si128(_mm_srai_epi32(lo, 31), bias)), 7);
+            hi = _mm_srai_epi32(_mm_add_epi32(hi, _mm_and_si128(_mm_srai_epi32(hi, 31), bias)), 7);
+            s = _mm_packs_epi32(lo, hi);
+        }
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_adds_epi16(s, d));
+    }
+    return i;
+}
+
+static int
+SDL_MixAudio_F32_SSE2(float *dst, const float *src, const int samples, const float fvolume, const float fmaxvolume)
+{
+    const __m128 vol = _mm_set1_ps(fvolume);
+    const __m128 maxvol = _mm_set1_ps(fmaxvolume);
+    const __m128 maxval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 minval = _mm_set1_ps(-3.402823466e+38F);
+    int i;
+
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        const __m128 s = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src + i), vol), maxvol);
+        /* min/max return the second operand for NaN, so NaN passes through like the scalar code. */
+        const __m128 sum = _mm_add_ps(s, _mm_loadu_ps(dst + i));
+        _mm_storeu_ps(dst + i, _mm_max_ps(minval, _mm_min_ps(maxval, sum)));
+    }
+    return i;
+}
+
+static int
+SDL_MixFloat32Gain_SSE2(float *dst, const float *src, const int samples, const float gain)
+{
+    const __m128 g = _mm_set1_ps(gain);
+    int i;
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), g)));
+    }
+    return i;
+}
+
+static int
+SDL_ClampFloat32_SSE2(float *buf, const int samples)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 negone = _mm_set1_ps(-1.0f);
+    int i;
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        _mm_storeu_ps(buf + i, _mm_max_ps(negone, _mm_min_ps(one, _mm_loadu_ps(buf + i))));
+    }
+    return i;
+}
+#endif
+
+#if HAVE_NEON_INTRINSICS
+static int
+SDL_MixAudio_S16_NEON(Sint16 *dst, const Sint16 *src, const int samples, const int volume)
+{
+    const int16x4_t vol = vdup_n_s16((int16_t) volume);
+    const int32x4_t bias = vdupq_n_s32(SDL_MIX_MAXVOLUME - 1);
+    int i;
+
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        int16x8_t s = vld1q_s16(src + i);
+        const int16x8_t d = vld1q_s16(dst + i);
+        if (volume != SDL_MIX_MAXVOLUME) {
+            int32x4_t lo = vmull_s16(vget_low_s16(s), vol);
+            int32x4_t hi = vmull_s16(vget_high_s16(s), vol);
+            /* divide by 128, rounding toward zero like ADJUST_VOLUME. */
+            lo = vshrq_n_s32(vaddq_s32(lo, vandq_s32(vshrq_n_s32(lo, 31), bias)), 7);
+            hi = vshrq_n_s32(vaddq_s32(hi, vandq_s32(vshrq_n_s32(hi, 31), bias)), 7);
+            s = vcombine_s16(vmovn_s32(lo), vmovn_s32(hi));
+        }
+        vst1q_s16(dst + i, vqaddq_s16(s, d));
+    }
+    return i;
+}
+
+static int
+SDL_MixAudio_F32_NEON(float *dst, const float *src, const int samples, const float fvolume, const float fmaxvolume)
+{
+    const float32x4_t maxval = vdupq_n_f32(3.402823466e+38F);
+    const float32x4_t minval = vdupq_n_f32(-3.402823466e+38F);
+    int i;
+
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        const float32x4_t s = vmulq_n_f32(vmulq_n_f32(vld1q_f32(src + i), fvolume), fmaxvolume);
+        const float32x4_t sum = vaddq_f32(s, vld1q_f32(dst + i));
+        vst1q_f32(dst + i, vmaxq_f32(vminq_f32(sum, maxval), minval));
+    }
+    return i;
+}
+
+static int
+SDL_MixFloat32Gain_NEON(float *dst, const float *src, const int samples, const float gain)
+{
+    int i;
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        vst1q_f32(dst + i, vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), gain));
+    }
+    return i;
+}
+
+static int
+SDL_ClampFloat32_NEON(float *buf, const int samples)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t negone = vdupq_n_f32(-1.0f);
+    int i;
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        vst1q_f32(buf + i, vmaxq_f32(vminq_f32(vld1q_f32(buf + i), one), negone));
+    }
+    return i;
+}
+#endif
+
+void
+SDL_MixFloat32Gain(float *dst, const float *src, const int samples, const float gain)
+{
+    int i = 0;
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i = SDL_MixFloat32Gain_SSE2(dst, src, samples, gain);
+    }
+#elif HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        i = SDL_MixFloat32Gain_NEON(dst, src, samples, gain);
+    }
+#endif
+
+    for (; i < samples; i++) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+void
+SDL_ClampFloat32(float *buf, const int samples)
+{
+    int i = 0;
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        i = SDL_ClampFloat32_SSE2(buf, samples);
+    }
+#elif HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        i = SDL_ClampFloat32_NEON(buf, samples);
+    }
+#endif
+
+    for (; i < samples; i++) {
+        if (buf[i] > 1.0f) {
+            buf[i] = 1.0f;
+        } else if (buf[i] < -1.0f) {
+            buf[i] = -1.0f;
+        }
+    }
+}
+
 
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
@@ -151,6 +329,23 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const int min_audioval = -(1 << (16 - 1));
 
             len /= 2;
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            if ((volume > 0) && (volume <= SDL_MIX_MAXVOLUME)) {
+                int done = 0;
+#if HAVE_SSE2_INTRINSICS
+                if (SDL_HasSSE2()) {
+                    done = SDL_MixAudio_S16_SSE2((Sint16 *) dst, (const Sint16 *) src, (int) len, volume);
+                }
+#elif HAVE_NEON_INTRINSICS
+                if (SDL_HasNEON()) {
+                    done = SDL_MixAudio_S16_NEON((Sint16 *) dst, (const Sint16 *) src, (int) len, volume);
+                }
+#endif
+                src += done * 2;
+                dst += done * 2;
+                len -= done;
+            }
+#endif
             while (len--) {
                 src1 = ((src[1]) << 8 | src[0]);
                 ADJUST_VOLUME(src1, volume);
@@ -315,6 +510,23 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const double min_audioval = -3.402823466e+38F;
 
             len /= 4;
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            {
+                int done = 0;
+#if HAVE_SSE2_INTRINSICS
+                if (SDL_HasSSE2()) {
+                    done = SDL_MixAudio_F32_SSE2(dst32, src32, (int) len, fvolume, fmaxvolume);
+                }
+#elif HAVE_NEON_INTRINSICS
+                if (SDL_HasNEON()) {
+                    done = SDL_MixAudio_F32_NEON(dst32, src32, (int) len, fvolume, fmaxvolume);
+                }
+#endif
+                src32 += done;
+                dst32 += done;
+                len -= done;
+            }
+#endif
             while (len--) {
                 src1 = ((SDL_SwapFloatLE(*src32) * fvolume) * fmaxvolume);
                 src2 = SDL_SwapFloatLE(*dst32);
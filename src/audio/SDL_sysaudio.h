@@ -126,6 +126,13 @@ typedef struct SDL_AudioDriver
 } SDL_AudioDriver;
 
 
+/* An audio stream mixed into a device's output. */
+typedef struct SDL_AudioStreamBinding
+{
+    SDL_AudioStream *stream;
+    float gain;
+} SDL_AudioStreamBinding;
+
 /* Define the SDL audio driver structure */
 struct SDL_AudioDevice
 {
@@ -164,6 +171,18 @@ struct SDL_AudioDevice
     /* Queued buffers (if app not using callback). */
     SDL_DataQueue *buffer_queue;
 
+    /* Streams summed into the output after the callback (SDL_BindAudioStream). */
+    SDL_AudioStreamBinding *bound_streams;
+    int num_bound_streams;
+    int max_bound_streams;
+
+    /* Float accumulator and scratch for bound streams, callbackspec.samples frames each. */
+    float *mix_buffer;
+    float *mix_scratch;
+
+    /* Converts the float mix to callbackspec.format, in place. */
+    SDL_AudioCVT mix_cvt;
+
     /* * * */
     /* Data private to this driver */
     struct SDL_PrivateAudioData *hidden;
@@ -35,7 +35,7 @@ struct MS_ADPCM_decodestate
     Sint16 iSamp1;
     Sint16 iSamp2;
 };
-static struct MS_ADPCM_decoder
+struct MS_ADPCM_decoder
 {
     WaveFMT wavefmt;
     Uint16 wSamplesPerBlock;
@@ -43,41 +43,61 @@ static struct MS_ADPCM_decoder
     Sint16 aCoeff[7][2];
     /* * * */
     struct MS_ADPCM_decodestate state[2];
-} MS_ADPCM_state;
+};
+static struct MS_ADPCM_decoder MS_ADPCM_state;
 
 static int
-InitMS_ADPCM(WaveFMT * format)
+InitMS_ADPCM(struct MS_ADPCM_decoder *decoder, WaveFMT * format, Uint32 fmtlen)
 {
     Uint8 *rogue_feel;
     int i;
 
+    /* The coefficients follow the extra size, samples per block and count */
+    if (fmtlen < sizeof(*format) + 3 * sizeof(Uint16) + sizeof(decoder->aCoeff)) {
+        SDL_SetError("MS_ADPCM format chunk is too short");
+        return (-1);
+    }
+
     /* Set the rogue pointer to the MS_ADPCM specific data */
-    MS_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    MS_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    MS_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    MS_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    MS_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    MS_ADPCM_state.wavefmt.bitspersample =
+    decoder->wavefmt.encoding = SDL_SwapLE16(format->encoding);
+    decoder->wavefmt.channels = SDL_SwapLE16(format->channels);
+    decoder->wavefmt.frequency = SDL_SwapLE32(format->frequency);
+    decoder->wavefmt.byterate = SDL_SwapLE32(format->byterate);
+    decoder->wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
+    decoder->wavefmt.bitspersample =
         SDL_SwapLE16(format->bitspersample);
     rogue_feel = (Uint8 *) format + sizeof(*format);
     if (sizeof(*format) == 16) {
         /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
         rogue_feel += sizeof(Uint16);
     }
-    MS_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    MS_ADPCM_state.wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    if (MS_ADPCM_state.wNumCoef != 7) {
+    if (decoder->wNumCoef != 7) {
         SDL_SetError("Unknown set of MS_ADPCM coefficients");
         return (-1);
     }
-    for (i = 0; i < MS_ADPCM_state.wNumCoef; ++i) {
-        MS_ADPCM_state.aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    for (i = 0; i < decoder->wNumCoef; ++i) {
+        decoder->aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
-        MS_ADPCM_state.aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+        decoder->aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
     }
+
+    /* Each block starts with 7 header bytes per channel, which also hold
+       the first two samples, then packs two samples into every byte */
+    if (decoder->wavefmt.channels < 1 || decoder->wavefmt.channels > 2) {
+        SDL_SetError("MS_ADPCM decoder can only handle mono or stereo");
+        return (-1);
+    }
+    if (decoder->wSamplesPerBlock < 2 ||
+        (((decoder->wSamplesPerBlock - 2) * decoder->wavefmt.channels) & 1) ||
+        (7 * decoder->wavefmt.channels + (decoder->wSamplesPerBlock - 2) * decoder->wavefmt.channels / 2) > decoder->wavefmt.blockalign) {
+        SDL_SetError("MS_ADPCM samples per block don't fit the block size");
+        return (-1);
+    }
     return (0);
 }
 
@@ -115,24 +135,108 @@ MS_ADPCM_nibble(struct MS_ADPCM_decodestate *state,
     return (new_sample);
 }
 
+/* Decode one block of wSamplesPerBlock frames */
 static int
-MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+MS_ADPCM_decodeblock(struct MS_ADPCM_decoder *decoder,
+                     const Uint8 * encoded, Uint8 * decoded)
 {
     struct MS_ADPCM_decodestate *state[2];
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
+    Sint32 samplesleft;
     Sint8 nybble;
     Uint8 stereo;
     Sint16 *coeff[2];
     Sint32 new_sample;
 
+    stereo = (decoder->wavefmt.channels == 2);
+    state[0] = &decoder->state[0];
+    state[1] = &decoder->state[stereo];
+
+    /* Grab the initial information for this block */
+    state[0]->hPredictor = *encoded++;
+    if (stereo) {
+        state[1]->hPredictor = *encoded++;
+    }
+    if (state[0]->hPredictor >= decoder->wNumCoef ||
+        state[1]->hPredictor >= decoder->wNumCoef) {
+        return SDL_SetError("Invalid MS_ADPCM predictor");
+    }
+    state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
+        encoded += sizeof(Sint16);
+    }
+    state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+        encoded += sizeof(Sint16);
+    }
+    state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+        encoded += sizeof(Sint16);
+    }
+    coeff[0] = decoder->aCoeff[state[0]->hPredictor];
+    coeff[1] = decoder->aCoeff[state[1]->hPredictor];
+
+    /* Store the two initial samples we start with */
+    decoded[0] = state[0]->iSamp2 & 0xFF;
+    decoded[1] = state[0]->iSamp2 >> 8;
+    decoded += 2;
+    if (stereo) {
+        decoded[0] = state[1]->iSamp2 & 0xFF;
+        decoded[1] = state[1]->iSamp2 >> 8;
+        decoded += 2;
+    }
+    decoded[0] = state[0]->iSamp1 & 0xFF;
+    decoded[1] = state[0]->iSamp1 >> 8;
+    decoded += 2;
+    if (stereo) {
+        decoded[0] = state[1]->iSamp1 & 0xFF;
+        decoded[1] = state[1]->iSamp1 >> 8;
+        decoded += 2;
+    }
+
+    /* Decode and store the other samples in this block */
+    samplesleft = (decoder->wSamplesPerBlock - 2) *
+        decoder->wavefmt.channels;
+    while (samplesleft > 0) {
+        nybble = (*encoded) >> 4;
+        new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
+        decoded[0] = new_sample & 0xFF;
+        new_sample >>= 8;
+        decoded[1] = new_sample & 0xFF;
+        decoded += 2;
+
+        nybble = (*encoded) & 0x0F;
+        new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
+        decoded[0] = new_sample & 0xFF;
+        new_sample >>= 8;
+        decoded[1] = new_sample & 0xFF;
+        decoded += 2;
+
+        ++encoded;
+        samplesleft -= 2;
+    }
+    return (0);
+}
+
+static int
+MS_ADPCM_decode(struct MS_ADPCM_decoder *decoder,
+                Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    Uint8 *freeable, *encoded, *decoded;
+    Sint32 encoded_len;
+
     /* Allocate the proper sized output buffer */
     encoded_len = *audio_len;
     encoded = *audio_buf;
     freeable = *audio_buf;
-    *audio_len = (encoded_len / MS_ADPCM_state.wavefmt.blockalign) *
-        MS_ADPCM_state.wSamplesPerBlock *
-        MS_ADPCM_state.wavefmt.channels * sizeof(Sint16);
+    *audio_len = (encoded_len / decoder->wavefmt.blockalign) *
+        decoder->wSamplesPerBlock *
+        decoder->wavefmt.channels * sizeof(Sint16);
     *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
     if (*audio_buf == NULL) {
         return SDL_OutOfMemory();
@@ -140,76 +244,16 @@ MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
     decoded = *audio_buf;
 
     /* Get ready... Go! */
-    stereo = (MS_ADPCM_state.wavefmt.channels == 2);
-    state[0] = &MS_ADPCM_state.state[0];
-    state[1] = &MS_ADPCM_state.state[stereo];
-    while (encoded_len >= MS_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        state[0]->hPredictor = *encoded++;
-        if (stereo) {
-            state[1]->hPredictor = *encoded++;
+    while (encoded_len >= decoder->wavefmt.blockalign) {
+        if (MS_ADPCM_decodeblock(decoder, encoded, decoded) < 0) {
+            SDL_free(*audio_buf);
+            *audio_buf = NULL;
+            SDL_free(freeable);
+            return (-1);
         }
-        state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        coeff[0] = MS_ADPCM_state.aCoeff[state[0]->hPredictor];
-        coeff[1] = MS_ADPCM_state.aCoeff[state[1]->hPredictor];
-
-        /* Store the two initial samples we start with */
-        decoded[0] = state[0]->iSamp2 & 0xFF;
-        decoded[1] = state[0]->iSamp2 >> 8;
-        decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp2 & 0xFF;
-            decoded[1] = state[1]->iSamp2 >> 8;
-            decoded += 2;
-        }
-        decoded[0] = state[0]->iSamp1 & 0xFF;
-        decoded[1] = state[0]->iSamp1 >> 8;
-        decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp1 & 0xFF;
-            decoded[1] = state[1]->iSamp1 >> 8;
-            decoded += 2;
-        }
-
-        /* Decode and store the other samples in this block */
-        samplesleft = (MS_ADPCM_state.wSamplesPerBlock - 2) *
-            MS_ADPCM_state.wavefmt.channels;
-        while (samplesleft > 0) {
-            nybble = (*encoded) >> 4;
-            new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            nybble = (*encoded) & 0x0F;
-            new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            ++encoded;
-            samplesleft -= 2;
-        }
-        encoded_len -= MS_ADPCM_state.wavefmt.blockalign;
+        encoded += decoder->wavefmt.blockalign;
+        decoded += decoder->wSamplesPerBlock * decoder->wavefmt.channels * sizeof(Sint16);
+        encoded_len -= decoder->wavefmt.blockalign;
     }
     SDL_free(freeable);
     return (0);
@@ -220,33 +264,57 @@ struct IMA_ADPCM_decodestate
     Sint32 sample;
     Sint8 index;
 };
-static struct IMA_ADPCM_decoder
+struct IMA_ADPCM_decoder
 {
     WaveFMT wavefmt;
     Uint16 wSamplesPerBlock;
     /* * * */
     struct IMA_ADPCM_decodestate state[2];
-} IMA_ADPCM_state;
+};
+static struct IMA_ADPCM_decoder IMA_ADPCM_state;
 
 static int
-InitIMA_ADPCM(WaveFMT * format)
+InitIMA_ADPCM(struct IMA_ADPCM_decoder *decoder, WaveFMT * format, Uint32 fmtlen)
 {
     Uint8 *rogue_feel;
 
+    /* The samples per block follow the extra size */
+    if (fmtlen < sizeof(*format) + 2 * sizeof(Uint16)) {
+        SDL_SetError("IMA_ADPCM format chunk is too short");
+        return (-1);
+    }
+
     /* Set the rogue pointer to the IMA_ADPCM specific data */
-    IMA_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    IMA_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    IMA_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    IMA_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    IMA_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    IMA_ADPCM_state.wavefmt.bitspersample =
+    decoder->wavefmt.encoding = SDL_SwapLE16(format->encoding);
+    decoder->wavefmt.channels = SDL_SwapLE16(format->channels);
+    decoder->wavefmt.frequency = SDL_SwapLE32(format->frequency);
+    decoder->wavefmt.byterate = SDL_SwapLE32(format->byterate);
+    decoder->wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
+    decoder->wavefmt.bitspersample =
         SDL_SwapLE16(format->bitspersample);
     rogue_feel = (Uint8 *) format + sizeof(*format);
     if (sizeof(*format) == 16) {
         /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
         rogue_feel += sizeof(Uint16);
     }
-    IMA_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+
+    /* Check to make sure we have enough variables in the state array */
+    if (decoder->wavefmt.channels < 1 ||
+        decoder->wavefmt.channels > SDL_arraysize(decoder->state)) {
+        SDL_SetError("IMA ADPCM decoder can only handle %u channels",
+                     (unsigned int)SDL_arraysize(decoder->state));
+        return (-1);
+    }
+
+    /* Each block starts with 4 header bytes per channel, which also hold
+       the first sample, then packs 8 samples per channel into 4 bytes */
+    if (decoder->wSamplesPerBlock < 1 ||
+        ((decoder->wSamplesPerBlock - 1) % 8) != 0 ||
+        (4 * decoder->wavefmt.channels + (decoder->wSamplesPerBlock - 1) * decoder->wavefmt.channels / 2) > decoder->wavefmt.blockalign) {
+        SDL_SetError("IMA ADPCM samples per block don't fit the block size");
+        return (-1);
+    }
     return (0);
 }
 
@@ -306,7 +374,7 @@ IMA_ADPCM_nibble(struct IMA_ADPCM_decodestate *state, Uint8 nybble)
 
 /* Fill the decode buffer with a channel block of data (8 samples) */
 static void
-Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
+Fill_IMA_ADPCM_block(Uint8 * decoded, const Uint8 * encoded,
                      int channel, int numchannels,
                      struct IMA_ADPCM_decodestate *state)
 {
@@ -334,30 +402,62 @@ Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
     }
 }
 
-static int
-IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+/* Decode one block of wSamplesPerBlock frames */
+static void
+IMA_ADPCM_decodeblock(struct IMA_ADPCM_decoder *decoder,
+                      const Uint8 * encoded, Uint8 * decoded)
 {
-    struct IMA_ADPCM_decodestate *state;
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
-    unsigned int c, channels;
+    struct IMA_ADPCM_decodestate *state = decoder->state;
+    unsigned int c, channels = decoder->wavefmt.channels;
+    Sint32 samplesleft;
 
-    /* Check to make sure we have enough variables in the state array */
-    channels = IMA_ADPCM_state.wavefmt.channels;
-    if (channels > SDL_arraysize(IMA_ADPCM_state.state)) {
-        SDL_SetError("IMA ADPCM decoder can only handle %u channels",
-                     (unsigned int)SDL_arraysize(IMA_ADPCM_state.state));
-        return (-1);
+    /* Grab the initial information for this block */
+    for (c = 0; c < channels; ++c) {
+        /* Fill the state information for this block */
+        state[c].sample = ((encoded[1] << 8) | encoded[0]);
+        encoded += 2;
+        if (state[c].sample & 0x8000) {
+            state[c].sample -= 0x10000;
+        }
+        state[c].index = *encoded++;
+        /* Reserved byte in buffer header, should be 0 */
+        if (*encoded++ != 0) {
+            /* Uh oh, corrupt data?  Buggy code? */ ;
+        }
+
+        /* Store the initial sample we start with */
+        decoded[0] = (Uint8) (state[c].sample & 0xFF);
+        decoded[1] = (Uint8) (state[c].sample >> 8);
+        decoded += 2;
     }
-    state = IMA_ADPCM_state.state;
+
+    /* Decode and store the other samples in this block */
+    samplesleft = (decoder->wSamplesPerBlock - 1) * channels;
+    while (samplesleft > 0) {
+        for (c = 0; c < channels; ++c) {
+            Fill_IMA_ADPCM_block(decoded, encoded,
+                                 c, channels, &state[c]);
+            encoded += 4;
+            samplesleft -= 8;
+        }
+        decoded += (channels * 8 * 2);
+    }
+}
+
+static int
+IMA_ADPCM_decode(struct IMA_ADPCM_decoder *decoder,
+                 Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    Uint8 *freeable, *encoded, *decoded;
+    Sint32 encoded_len;
 
     /* Allocate the proper sized output buffer */
     encoded_len = *audio_len;
     encoded = *audio_buf;
     freeable = *audio_buf;
-    *audio_len = (encoded_len / IMA_ADPCM_state.wavefmt.blockalign) *
-        IMA_ADPCM_state.wSamplesPerBlock *
-        IMA_ADPCM_state.wavefmt.channels * sizeof(Sint16);
+    *audio_len = (encoded_len / decoder->wavefmt.blockalign) *
+        decoder->wSamplesPerBlock *
+        decoder->wavefmt.channels * sizeof(Sint16);
     *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
     if (*audio_buf == NULL) {
         return SDL_OutOfMemory();
@@ -365,51 +465,32 @@ IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
     decoded = *audio_buf;
 
     /* Get ready... Go! */
-    while (encoded_len >= IMA_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        for (c = 0; c < channels; ++c) {
-            /* Fill the state information for this block */
-            state[c].sample = ((encoded[1] << 8) | encoded[0]);
-            encoded += 2;
-            if (state[c].sample & 0x8000) {
-                state[c].sample -= 0x10000;
-            }
-            state[c].index = *encoded++;
-            /* Reserved byte in buffer header, should be 0 */
-            if (*encoded++ != 0) {
-                /* Uh oh, corrupt data?  Buggy code? */ ;
-            }
-
-            /* Store the initial sample we start with */
-            decoded[0] = (Uint8) (state[c].sample & 0xFF);
-            decoded[1] = (Uint8) (state[c].sample >> 8);
-            decoded += 2;
-        }
-
-        /* Decode and store the other samples in this block */
-        samplesleft = (IMA_ADPCM_state.wSamplesPerBlock - 1) * channels;
-        while (samplesleft > 0) {
-            for (c = 0; c < channels; ++c) {
-                Fill_IMA_ADPCM_block(decoded, encoded,
-                                     c, channels, &state[c]);
-                encoded += 4;
-                samplesleft -= 8;
-            }
-            decoded += (channels * 8 * 2);
-        }
-        encoded_len -= IMA_ADPCM_state.wavefmt.blockalign;
+    while (encoded_len >= decoder->wavefmt.blockalign) {
+        IMA_ADPCM_decodeblock(decoder, encoded, decoded);
+        encoded += decoder->wavefmt.blockalign;
+        decoded += decoder->wSamplesPerBlock * decoder->wavefmt.channels * sizeof(Sint16);
+        encoded_len -= decoder->wavefmt.blockalign;
     }
     SDL_free(freeable);
     return (0);
 }
 
 
+static SDL_INLINE Sint32
+Sint24ToSint32(const Uint8 * src)
+{
+    const double DIVBY8388608 = 0.00000011920928955078125;
+    const Sint32 converted = ((Sint32) ( (((Uint32) src[2]) << 24) |
+                                         (((Uint32) src[1]) << 16) |
+                                         (((Uint32) src[0]) << 8) )) >> 8;
+    const double scaled = (((double) converted) * DIVBY8388608);
+    return (Sint32) (scaled * 2147483647.0);
+}
+
 static int
 ConvertSint24ToSint32(Uint8 ** audio_buf, Uint32 * audio_len)
 {
-    const double DIVBY8388608 = 0.00000011920928955078125;
-    const Uint32 original_len = *audio_len;
-    const Uint32 samples = original_len / 3;
+    const Uint32 samples = *audio_len / 3;
     const Uint32 expanded_len = samples * sizeof (Uint32);
     Uint8 *ptr = (Uint8 *) SDL_realloc(*audio_buf, expanded_len);
     const Uint8 *src;
@@ -424,16 +505,12 @@ ConvertSint24ToSint32(Uint8 ** audio_buf, Uint32 * audio_len)
     *audio_len = expanded_len;
 
     /* work from end to start, since we're expanding in-place. */
-    src = (ptr + original_len) - 3;
+    src = (ptr + samples * 3) - 3;
     dst = ((Uint32 *) (ptr + expanded_len)) - 1;
     for (i = 0; i < samples; i++) {
         /* There's probably a faster way to do all this. */
-        const Sint32 converted = ((Sint32) ( (((Uint32) src[2]) << 24) |
-                                             (((Uint32) src[1]) << 16) |
-                                             (((Uint32) src[0]) << 8) )) >> 8;
-        const double scaled = (((double) converted) * DIVBY8388608);
+        *(dst--) = Sint24ToSint32(src);
         src -= 3;
-        *(dst--) = (Sint32) (scaled * 2147483647.0);
     }
 
     return 0;
@@ -444,97 +521,41 @@ ConvertSint24ToSint32(Uint8 ** audio_buf, Uint32 * audio_len)
 static const Uint8 extensible_pcm_guid[16] = { 1, 0, 0, 0, 0, 0, 16, 0, 128, 0, 0, 170, 0, 56, 155, 113 };
 static const Uint8 extensible_ieee_guid[16] = { 3, 0, 0, 0, 0, 0, 16, 0, 128, 0, 0, 170, 0, 56, 155, 113 };
 
-SDL_AudioSpec *
-SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
-               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+/* Fill in the spec from a format chunk and get an ADPCM decoder ready.
+   Returns the encoding the data is in, or -1 on error. */
+static int
+ReadWaveFormat(WaveFMT * format, Uint32 fmtlen, SDL_AudioSpec * spec,
+               struct MS_ADPCM_decoder *ms_adpcm,
+               struct IMA_ADPCM_decoder *ima_adpcm)
 {
-    int was_error;
-    Chunk chunk;
-    int lenread;
-    int IEEE_float_encoded, MS_ADPCM_encoded, IMA_ADPCM_encoded;
-    int samplesize;
-
-    /* WAV magic header */
-    Uint32 RIFFchunk;
-    Uint32 wavelen = 0;
-    Uint32 WAVEmagic;
-    Uint32 headerDiff = 0;
-
-    /* FMT chunk */
-    WaveFMT *format = NULL;
     WaveExtensibleFMT *ext = NULL;
+    int encoding;
+    int was_error = 0;
 
-    SDL_zero(chunk);
-
-    /* Make sure we are passed a valid data source */
-    was_error = 0;
-    if (src == NULL) {
-        was_error = 1;
-        goto done;
-    }
-
-    /* Check the magic header */
-    RIFFchunk = SDL_ReadLE32(src);
-    wavelen = SDL_ReadLE32(src);
-    if (wavelen == WAVE) {      /* The RIFFchunk has already been read */
-        WAVEmagic = wavelen;
-        wavelen = RIFFchunk;
-        RIFFchunk = RIFF;
-    } else {
-        WAVEmagic = SDL_ReadLE32(src);
-    }
-    if ((RIFFchunk != RIFF) || (WAVEmagic != WAVE)) {
-        SDL_SetError("Unrecognized file type (not WAVE)");
-        was_error = 1;
-        goto done;
+    if (fmtlen < sizeof(*format)) {
+        SDL_SetError("WAVE format chunk is too short");
+        return (-1);
     }
-    headerDiff += sizeof(Uint32);       /* for WAVE */
 
-    /* Read the audio data format chunk */
-    chunk.data = NULL;
-    do {
-        SDL_free(chunk.data);
-        chunk.data = NULL;
-        lenread = ReadChunk(src, &chunk);
-        if (lenread < 0) {
-            was_error = 1;
-            goto done;
-        }
-        /* 2 Uint32's for chunk header+len, plus the lenread */
-        headerDiff += lenread + 2 * sizeof(Uint32);
-    } while ((chunk.magic == FACT) || (chunk.magic == LIST) || (chunk.magic == BEXT) || (chunk.magic == JUNK));
-
-    /* Decode the audio data format */
-    format = (WaveFMT *) chunk.data;
-    if (chunk.magic != FMT) {
-        SDL_SetError("Complex WAVE files not supported");
-        was_error = 1;
-        goto done;
-    }
-    IEEE_float_encoded = MS_ADPCM_encoded = IMA_ADPCM_encoded = 0;
-    switch (SDL_SwapLE16(format->encoding)) {
+    encoding = SDL_SwapLE16(format->encoding);
+    switch (encoding) {
     case PCM_CODE:
         /* We can understand this */
         break;
     case IEEE_FLOAT_CODE:
-        IEEE_float_encoded = 1;
         /* We can understand this */
         break;
     case MS_ADPCM_CODE:
         /* Try to understand this */
-        if (InitMS_ADPCM(format) < 0) {
-            was_error = 1;
-            goto done;
+        if (InitMS_ADPCM(ms_adpcm, format, fmtlen) < 0) {
+            return (-1);
         }
-        MS_ADPCM_encoded = 1;
         break;
     case IMA_ADPCM_CODE:
         /* Try to understand this */
-        if (InitIMA_ADPCM(format) < 0) {
-            was_error = 1;
-            goto done;
+        if (InitIMA_ADPCM(ima_adpcm, format, fmtlen) < 0) {
+            return (-1);
         }
-        IMA_ADPCM_encoded = 1;
         break;
     case EXTENSIBLE_CODE:
         /* note that this ignores channel masks, smaller valid bit counts
@@ -542,32 +563,29 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
            to get things that didn't really _need_ WAVE_FORMAT_EXTENSIBLE
            to be useful working when they use this format flag. */
         ext = (WaveExtensibleFMT *) format;
-        if (SDL_SwapLE16(ext->size) < 22) {
+        if (fmtlen < sizeof(*ext) || SDL_SwapLE16(ext->size) < 22) {
             SDL_SetError("bogus extended .wav header");
-            was_error = 1;
-            goto done;
+            return (-1);
         }
+        encoding = PCM_CODE;
         if (SDL_memcmp(ext->subformat, extensible_pcm_guid, 16) == 0) {
             break;  /* cool. */
         } else if (SDL_memcmp(ext->subformat, extensible_ieee_guid, 16) == 0) {
-            IEEE_float_encoded = 1;
+            encoding = IEEE_FLOAT_CODE;
             break;
         }
         break;
     case MP3_CODE:
         SDL_SetError("MPEG Layer 3 data not supported");
-        was_error = 1;
-        goto done;
+        return (-1);
     default:
-        SDL_SetError("Unknown WAVE data format: 0x%.4x",
-                     SDL_SwapLE16(format->encoding));
-        was_error = 1;
-        goto done;
+        SDL_SetError("Unknown WAVE data format: 0x%.4x", encoding);
+        return (-1);
     }
     SDL_zerop(spec);
     spec->freq = SDL_SwapLE32(format->frequency);
 
-    if (IEEE_float_encoded) {
+    if (encoding == IEEE_FLOAT_CODE) {
         if ((SDL_SwapLE16(format->bitspersample)) != 32) {
             was_error = 1;
         } else {
@@ -576,7 +594,7 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     } else {
         switch (SDL_SwapLE16(format->bitspersample)) {
         case 4:
-            if (MS_ADPCM_encoded || IMA_ADPCM_encoded) {
+            if (encoding == MS_ADPCM_CODE || encoding == IMA_ADPCM_CODE) {
                 spec->format = AUDIO_S16;
             } else {
                 was_error = 1;
@@ -603,10 +621,85 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     if (was_error) {
         SDL_SetError("Unknown %d-bit PCM data format",
                      SDL_SwapLE16(format->bitspersample));
-        goto done;
+        return (-1);
     }
     spec->channels = (Uint8) SDL_SwapLE16(format->channels);
     spec->samples = 4096;       /* Good default buffer size */
+    return encoding;
+}
+
+SDL_AudioSpec *
+SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
+               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    int was_error;
+    Chunk chunk;
+    int lenread;
+    int encoding;
+    int samplesize;
+
+    /* WAV magic header */
+    Uint32 RIFFchunk;
+    Uint32 wavelen = 0;
+    Uint32 WAVEmagic;
+    Uint32 headerDiff = 0;
+
+    /* FMT chunk */
+    WaveFMT *format = NULL;
+
+    SDL_zero(chunk);
+
+    /* Make sure we are passed a valid data source */
+    was_error = 0;
+    if (src == NULL) {
+        was_error = 1;
+        goto done;
+    }
+
+    /* Check the magic header */
+    RIFFchunk = SDL_ReadLE32(src);
+    wavelen = SDL_ReadLE32(src);
+    if (wavelen == WAVE) {      /* The RIFFchunk has already been read */
+        WAVEmagic = wavelen;
+        wavelen = RIFFchunk;
+        RIFFchunk = RIFF;
+    } else {
+        WAVEmagic = SDL_ReadLE32(src);
+    }
+    if ((RIFFchunk != RIFF) || (WAVEmagic != WAVE)) {
+        SDL_SetError("Unrecognized file type (not WAVE)");
+        was_error = 1;
+        goto done;
+    }
+    headerDiff += sizeof(Uint32);       /* for WAVE */
+
+    /* Read the audio data format chunk */
+    chunk.data = NULL;
+    do {
+        SDL_free(chunk.data);
+        chunk.data = NULL;
+        lenread = ReadChunk(src, &chunk);
+        if (lenread < 0) {
+            was_error = 1;
+            goto done;
+        }
+        /* 2 Uint32's for chunk header+len, plus the lenread */
+        headerDiff += lenread + 2 * sizeof(Uint32);
+    } while ((chunk.magic == FACT) || (chunk.magic == LIST) || (chunk.magic == BEXT) || (chunk.magic == JUNK));
+
+    /* Decode the audio data format */
+    format = (WaveFMT *) chunk.data;
+    if (chunk.magic != FMT) {
+        SDL_SetError("Complex WAVE files not supported");
+        was_error = 1;
+        goto done;
+    }
+    encoding = ReadWaveFormat(format, chunk.length, spec,
+                              &MS_ADPCM_state, &IMA_ADPCM_state);
+    if (encoding < 0) {
+        was_error = 1;
+        goto done;
+    }
 
     /* Read the audio data chunk */
     *audio_buf = NULL;
@@ -625,14 +718,14 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     } while (chunk.magic != DATA);
     headerDiff += 2 * sizeof(Uint32);   /* for the data chunk and len */
 
-    if (MS_ADPCM_encoded) {
-        if (MS_ADPCM_decode(audio_buf, audio_len) < 0) {
+    if (encoding == MS_ADPCM_CODE) {
+        if (MS_ADPCM_decode(&MS_ADPCM_state, audio_buf, audio_len) < 0) {
             was_error = 1;
             goto done;
         }
     }
-    if (IMA_ADPCM_encoded) {
-        if (IMA_ADPCM_decode(audio_buf, audio_len) < 0) {
+    if (encoding == IMA_ADPCM_CODE) {
+        if (IMA_ADPCM_decode(&IMA_ADPCM_state, audio_buf, audio_len) < 0) {
             was_error = 1;
             goto done;
         }
@@ -674,6 +767,350 @@ SDL_FreeWAV(Uint8 * audio_buf)
     SDL_free(audio_buf);
 }
 
+/* Streaming WAVE decoding */
+
+struct _SDL_WAVDecoder
+{
+    SDL_RWops *src;
+    int freesrc;
+    SDL_AudioSpec spec;
+    int encoding;
+    Uint16 bitspersample;
+    Uint32 frame_size;          /* Bytes per decoded frame */
+    Uint32 block_size;          /* Bytes per encoded block (one frame for PCM) */
+    Uint32 block_frames;        /* Frames per encoded block */
+    Sint64 data_start;          /* Offset of the data chunk, or -1 if unknown */
+    Uint32 frames;              /* Decodable frames in the data chunk */
+    Uint32 position;            /* Next frame to decode */
+    Uint8 *block;               /* One encoded ADPCM block */
+    Uint8 *decoded;             /* That block decoded */
+    Uint32 decoded_block;       /* Which block is in decoded, or ~0 */
+    Uint8 *buffer;              /* For SDL_WAVDecoderPutStream() */
+    struct MS_ADPCM_decoder ms_adpcm;
+    struct IMA_ADPCM_decoder ima_adpcm;
+};
+
+#define WAV_DECODER_BUFFER_SIZE  (16 * 1024)
+
+SDL_WAVDecoder *
+SDL_NewWAVDecoder(SDL_RWops * src, int freesrc, SDL_AudioSpec * spec)
+{
+    SDL_WAVDecoder *decoder = NULL;
+    WaveFMT *format = NULL;
+    Uint32 fmtlen = 0;
+    Uint32 header[3];
+    Uint32 magic, length;
+    Sint64 size;
+
+    if (!src) {
+        SDL_InvalidParamError("src");
+        return NULL;
+    }
+    if (!spec) {
+        SDL_InvalidParamError("spec");
+        goto error;
+    }
+
+    decoder = (SDL_WAVDecoder *) SDL_calloc(1, sizeof(*decoder));
+    if (!decoder) {
+        SDL_OutOfMemory();
+        goto error;
+    }
+
+    /* Check the magic header */
+    if (SDL_RWread(src, header, sizeof(Uint32), 2) != 2) {
+        SDL_SetError("Unrecognized file type (not WAVE)");
+        goto error;
+    }
+    if (SDL_SwapLE32(header[1]) == WAVE) {      /* The RIFFchunk has already been read */
+        header[2] = header[1];
+        header[0] = SDL_SwapLE32(RIFF);
+    } else if (SDL_RWread(src, &header[2], sizeof(Uint32), 1) != 1) {
+        SDL_SetError("Unrecognized file type (not WAVE)");
+        goto error;
+    }
+    if (SDL_SwapLE32(header[0]) != RIFF || SDL_SwapLE32(header[2]) != WAVE) {
+        SDL_SetError("Unrecognized file type (not WAVE)");
+        goto error;
+    }
+
+    /* Keep the format chunk and skip everything else up to the data */
+    for (;;) {
+        if (SDL_RWread(src, header, sizeof(Uint32), 2) != 2) {
+            SDL_SetError("No WAVE data chunk found");
+            goto error;
+        }
+        magic = SDL_SwapLE32(header[0]);
+        length = SDL_SwapLE32(header[1]);
+        if (magic == DATA) {
+            break;
+        }
+        if (magic == FMT && !format) {
+            format = (WaveFMT *) SDL_malloc(length);
+            if (!format) {
+                SDL_OutOfMemory();
+                goto error;
+            }
+            if (SDL_RWread(src, format, length, 1) != 1) {
+                SDL_Error(SDL_EFREAD);
+                goto error;
+            }
+            fmtlen = length;
+        } else if (SDL_RWseek(src, length, RW_SEEK_CUR) < 0) {
+            goto error;
+        }
+    }
+    if (!format) {
+        SDL_SetError("Complex WAVE files not supported");
+        goto error;
+    }
+
+    decoder->encoding = ReadWaveFormat(format, fmtlen, &decoder->spec,
+                                       &decoder->ms_adpcm, &decoder->ima_adpcm);
+    if (decoder->encoding < 0) {
+        goto error;
+    }
+    if (decoder->spec.channels == 0) {
+        SDL_SetError("WAVE data has no channels");
+        goto error;
+    }
+    decoder->bitspersample = SDL_SwapLE16(format->bitspersample);
+    decoder->frame_size = (SDL_AUDIO_BITSIZE(decoder->spec.format) / 8) * decoder->spec.channels;
+    switch (decoder->encoding) {
+    case MS_ADPCM_CODE:
+        decoder->block_size = decoder->ms_adpcm.wavefmt.blockalign;
+        decoder->block_frames = decoder->ms_adpcm.wSamplesPerBlock;
+        break;
+    case IMA_ADPCM_CODE:
+        decoder->block_size = decoder->ima_adpcm.wavefmt.blockalign;
+        decoder->block_frames = decoder->ima_adpcm.wSamplesPerBlock;
+        break;
+    default:
+        decoder->block_size = (decoder->bitspersample / 8) * decoder->spec.channels;
+        decoder->block_frames = 1;
+        break;
+    }
+
+    /* Streamed files may not know their length, so trust the file size */
+    decoder->data_start = SDL_RWtell(src);
+    size = SDL_RWsize(src);
+    if (decoder->data_start >= 0 && size >= decoder->data_start &&
+        (Uint64) (size - decoder->data_start) < length) {
+        length = (Uint32) (size - decoder->data_start);
+    }
+    decoder->frames = (length / decoder->block_size) * decoder->block_frames;
+    decoder->decoded_block = ~0U;
+
+    if (decoder->block_frames > 1) {
+        decoder->block = (Uint8 *) SDL_malloc(decoder->block_size + decoder->block_frames * decoder->frame_size);
+        if (!decoder->block) {
+            SDL_OutOfMemory();
+            goto error;
+        }
+        decoder->decoded = decoder->block + decoder->block_size;
+    }
+
+    SDL_free(format);
+    decoder->src = src;
+    decoder->freesrc = freesrc;
+    *spec = decoder->spec;
+    return decoder;
+
+error:
+    SDL_free(format);
+    if (decoder) {
+        SDL_free(decoder->block);
+        SDL_free(decoder);
+    }
+    if (freesrc) {
+        SDL_RWclose(src);
+    }
+    return NULL;
+}
+
+int
+SDL_WAVDecoderRead(SDL_WAVDecoder * decoder, void *buf, int len)
+{
+    Uint8 *dst = (Uint8 *) buf;
+    Uint32 frames, done = 0;
+
+    if (!decoder) {
+        return SDL_InvalidParamError("decoder");
+    }
+    if (!buf) {
+        return SDL_InvalidParamError("buf");
+    }
+    if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    frames = (Uint32) len / decoder->frame_size;
+    if (frames > (decoder->frames - decoder->position)) {
+        frames = decoder->frames - decoder->position;
+    }
+
+    if (decoder->block_frames == 1) {
+        if (decoder->bitspersample == 24) {
+            /* Read into the end of the buffer and expand forward, which
+               never writes over a sample that hasn't been read yet */
+            const Uint32 samples = frames * decoder->spec.channels;
+            const Uint8 *src = dst + samples;
+            Uint32 i;
+
+            done = (Uint32) SDL_RWread(decoder->src, dst + samples, decoder->block_size, frames);
+            for (i = 0; i < done * decoder->spec.channels; ++i) {
+                const Sint32 sample = Sint24ToSint32(src);
+                SDL_memcpy(dst + i * sizeof(sample), &sample, sizeof(sample));
+                src += 3;
+            }
+        } else {
+            done = (Uint32) SDL_RWread(decoder->src, dst, decoder->block_size, frames);
+        }
+        if (done < frames) {
+            /* The file is shorter than it said it was */
+            decoder->frames = decoder->position + done;
+        }
+    } else {
+        while (done < frames) {
+            const Uint32 block = decoder->position / decoder->block_frames;
+            const Uint32 offset = decoder->position % decoder->block_frames;
+            Uint32 count = SDL_min(decoder->block_frames - offset, frames - done);
+
+            if (block != decoder->decoded_block) {
+                int result = 0;
+
+                if (SDL_RWread(decoder->src, decoder->block, decoder->block_size, 1) != 1) {
+                    decoder->frames = decoder->position;
+                    break;
+                }
+                if (decoder->encoding == MS_ADPCM_CODE) {
+                    result = MS_ADPCM_decodeblock(&decoder->ms_adpcm, decoder->block, decoder->decoded);
+                } else {
+                    IMA_ADPCM_decodeblock(&decoder->ima_adpcm, decoder->block, decoder->decoded);
+                }
+                if (result < 0) {
+                    /* Don't leave the source between blocks */
+                    SDL_RWseek(decoder->src, -(Sint64) decoder->block_size, RW_SEEK_CUR);
+                    if (done == 0) {
+                        return -1;
+                    }
+                    break;
+                }
+                decoder->decoded_block = block;
+            }
+            SDL_memcpy(dst + done * decoder->frame_size,
+                       decoder->decoded + offset * decoder->frame_size,
+                       count * decoder->frame_size);
+            done += count;
+            decoder->position += count;
+        }
+        return (int) (done * decoder->frame_size);
+    }
+
+    decoder->position += done;
+    return (int) (done * decoder->frame_size);
+}
+
+int
+SDL_WAVDecoderSeek(SDL_WAVDecoder * decoder, Uint32 frame)
+{
+    Uint32 block;
+
+    if (!decoder) {
+        return SDL_InvalidParamError("decoder");
+    }
+    if (frame > decoder->frames) {
+        return SDL_SetError("Seek past the end of the WAVE data");
+    }
+    if (decoder->data_start < 0) {
+        return SDL_SetError("WAVE source can't seek");
+    }
+
+    block = frame / decoder->block_frames;
+    if (block != decoder->decoded_block) {
+        if (SDL_RWseek(decoder->src, decoder->data_start + (Sint64) block * decoder->block_size, RW_SEEK_SET) < 0) {
+            return -1;
+        }
+    } else if (SDL_RWseek(decoder->src, decoder->data_start + (Sint64) (block + 1) * decoder->block_size, RW_SEEK_SET) < 0) {
+        return -1;
+    }
+    decoder->position = frame;
+    return 0;
+}
+
+Uint32
+SDL_WAVDecoderTell(SDL_WAVDecoder * decoder)
+{
+    if (!decoder) {
+        SDL_InvalidParamError("decoder");
+        return 0;
+    }
+    return decoder->position;
+}
+
+Uint32
+SDL_WAVDecoderFrames(SDL_WAVDecoder * decoder)
+{
+    if (!decoder) {
+        SDL_InvalidParamError("decoder");
+        return 0;
+    }
+    return decoder->frames;
+}
+
+int
+SDL_WAVDecoderPutStream(SDL_WAVDecoder * decoder, SDL_AudioStream * stream, int len)
+{
+    int total = 0;
+
+    if (!decoder) {
+        return SDL_InvalidParamError("decoder");
+    }
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    if (!decoder->buffer) {
+        decoder->buffer = (Uint8 *) SDL_malloc(WAV_DECODER_BUFFER_SIZE);
+        if (!decoder->buffer) {
+            return SDL_OutOfMemory();
+        }
+    }
+
+    while (total < len) {
+        const int amount = SDL_min(len - total, WAV_DECODER_BUFFER_SIZE);
+        const int decoded = SDL_WAVDecoderRead(decoder, decoder->buffer, amount);
+
+        if (decoded < 0) {
+            return total ? total : -1;
+        }
+        if (decoded == 0) {
+            break;
+        }
+        if (SDL_AudioStreamPut(stream, decoder->buffer, decoded) < 0) {
+            return -1;
+        }
+        total += decoded;
+    }
+    return total;
+}
+
+void
+SDL_FreeWAVDecoder(SDL_WAVDecoder * decoder)
+{
+    if (decoder) {
+        if (decoder->freesrc) {
+            SDL_RWclose(decoder->src);
+        }
+        SDL_free(decoder->buffer);
+        SDL_free(decoder->block);
+        SDL_free(decoder);
+    }
+}
+
 static int
 ReadChunk(SDL_RWops * src, Chunk * chunk)
 {
@@ -31,6 +31,7 @@
 
 #include "SDL_evdev.h"
 #include "SDL_evdev_kbd.h"
+#include "SDL_evdev_poll.h"
 
 #include <sys/stat.h>
 #include <unistd.h>
@@ -61,6 +62,7 @@ typedef struct SDL_evdevlist_item
 {
     char *path;
     int fd;
+    SDL_EVDEV_poll_item poll;
 
     /* TODO: use this for every device, not just touchscreen */
     int out_of_sync;
@@ -134,8 +136,12 @@ SDL_EVDEV_Init(void)
             return SDL_OutOfMemory();
         }
 
+        /* Without epoll we just read every device each time */
+        SDL_EVDEV_poll_init();
+
 #if SDL_USE_LIBUDEV
         if (SDL_UDEV_Init() < 0) {
+            SDL_EVDEV_poll_quit();
             SDL_free(_this);
             _this = NULL;
             return -1;
@@ -144,6 +150,7 @@ SDL_EVDEV_Init(void)
         /* Set up the udev callback */
         if (SDL_UDEV_AddCallback(SDL_EVDEV_udev_callback) < 0) {
             SDL_UDEV_Quit();
+            SDL_EVDEV_poll_quit();
             SDL_free(_this);
             _this = NULL;
             return -1;
@@ -189,6 +196,8 @@ SDL_EVDEV_Quit(void)
         SDL_assert(_this->last == NULL);
         SDL_assert(_this->num_devices == 0);
 
+        SDL_EVDEV_poll_quit();
+
         SDL_free(_this);
         _this = NULL;
     }
@@ -219,16 +228,65 @@ static void SDL_EVDEV_udev_callback(SDL_UDEV_deviceevent udev_event, int udev_cl
 }
 #endif /* SDL_USE_LIBUDEV */
 
+int
+SDL_EVDEV_GetFDs(int *fds, int maxfds)
+{
+    SDL_evdevlist_item *item;
+    int numfds = 0;
+
+    if (!_this) {
+        return 0;
+    }
+
+    /* The epoll set covers udev and every device we could register */
+    if (SDL_EVDEV_poll_get_fd() >= 0) {
+        if (numfds >= maxfds) {
+            return -1;
+        }
+        fds[numfds++] = SDL_EVDEV_poll_get_fd();
+
+        for (item = _this->first; item != NULL; item = item->next) {
+            if (!item->poll.registered) {
+                if (numfds >= maxfds) {
+                    return -1;
+                }
+                fds[numfds++] = item->fd;
+            }
+        }
+        return numfds;
+    }
+
+#if SDL_USE_LIBUDEV
+    if (SDL_UDEV_GetFD() >= 0) {
+        if (numfds >= maxfds) {
+            return -1;
+        }
+        fds[numfds++] = SDL_UDEV_GetFD();
+    }
+#endif
+
+    for (item = _this->first; item != NULL; item = item->next) {
+        if (numfds >= maxfds) {
+            return -1;  /* can't wait on all of them, caller will have to poll. */
+        }
+        fds[numfds++] = item->fd;
+    }
+
+    return numfds;
+}
+
 void 
 SDL_EVDEV_Poll(void)
 {
     struct input_event events[32];
+    Uint64 timestamps[SDL_arraysize(events)];
     int i, j, len;
     SDL_evdevlist_item *item;
     SDL_Scancode scan_code;
     int mouse_button;
     SDL_Mouse *mouse;
     float norm_x, norm_y;
+    Uint64 timestamp_ns = 0;
 
     if (!_this) {
         return;
@@ -240,10 +298,19 @@ SDL_EVDEV_Poll(void)
 
     mouse = SDL_GetMouse();
 
+    /* Events we send are stamped with the kernel's time for the input */
+    SDL_SetEventTimestampSource(&timestamp_ns);
+
     for (item = _this->first; item != NULL; item = item->next) {
-        while ((len = read(item->fd, events, (sizeof events))) > 0) {
-            len /= sizeof(events[0]);
+        if (!SDL_EVDEV_poll_ready(&item->poll)) {
+            continue;  /* nothing new, don't bother reading it */
+        }
+
+        /* Either straight from the device, or what the input thread read from it */
+        while ((len = SDL_EVDEV_poll_read(&item->poll, events, timestamps, SDL_arraysize(events))) > 0) {
             for (i = 0; i < len; ++i) {
+                timestamp_ns = timestamps[i];
+
                 /* special handling for touchscreen, that should eventually be
                    used for all devices */
                 if (item->out_of_sync && item->is_touchscreen &&
@@ -386,6 +453,8 @@ SDL_EVDEV_Poll(void)
             }
         }    
     }
+
+    SDL_SetEventTimestampSource(NULL);
 }
 
 static SDL_Scancode
@@ -653,6 +722,8 @@ SDL_EVDEV_device_added(const char *dev_path, int udev_class)
         _this->last = item;
     }
 
+    SDL_EVDEV_poll_add(&item->poll, item->fd, SDL_TRUE);
+
     SDL_EVDEV_sync_device(item);
 
     return _this->num_devices++;
@@ -680,6 +751,7 @@ SDL_EVDEV_device_removed(const char *dev_path)
             if (item->is_touchscreen) {
                 SDL_EVDEV_destroy_touchscreen(item);
             }
+            SDL_EVDEV_poll_remove(&item->poll);
             close(item->fd);
             SDL_free(item->path);
             SDL_free(item);
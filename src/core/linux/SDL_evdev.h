@@ -31,6 +31,8 @@
 extern int SDL_EVDEV_Init(void);
 extern void SDL_EVDEV_Quit(void);
 extern void SDL_EVDEV_Poll(void);
+/* Fills in the fds to wait on for input, returns -1 if there are more than (maxfds). */
+extern int SDL_EVDEV_GetFDs(int *fds, int maxfds);
 
 #endif /* SDL_INPUT_LINUXEV */
 
@@ -0,0 +1,514 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#ifdef SDL_INPUT_LINUXEV
+
+#include "SDL_atomic.h"
+#include "SDL_error.h"
+#include "SDL_hints.h"
+#include "SDL_mutex.h"
+#include "SDL_thread.h"
+#include "SDL_timer.h"
+#include "SDL_evdev_poll.h"
+#include "../../thread/SDL_systhread.h"
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+
+#define SDL_EVDEV_POLL_MAX_EVENTS   64
+#define SDL_EVDEV_POLL_QUEUE_SIZE   1024    /* input events queued per device */
+
+static SDL_SpinLock poll_lock;
+static int poll_refcount;
+static int poll_fd = -1;
+static Uint32 poll_generation;
+
+/* The input thread, if SDL_HINT_LINUX_INPUT_THREAD asked for it. It holds
+   thread_lock while it reads devices into their queues, so taking that lock
+   and bumping thread_removals is how an item is safely taken away from it.
+   thread_pending_fd is in the pumping set, and is readable while anything
+   is queued, so waiting on that set still wakes up for input. */
+static SDL_Thread *input_thread;
+static SDL_mutex *thread_lock;
+static int thread_fd = -1;
+static int thread_wakeup_fd = -1;
+static int thread_pending_fd = -1;
+static SDL_atomic_t thread_quit;
+static Uint32 thread_removals;
+static int thread_queued;
+static SDL_bool thread_signaled;
+
+/* Asks for CLOCK_MONOTONIC input timestamps and returns the clock the fd's
+   events will be stamped with. */
+static int
+SDL_EVDEV_poll_set_clock(int fd)
+{
+#ifdef EVIOCSCLOCKID
+    int clock = CLOCK_MONOTONIC;
+
+    if (ioctl(fd, EVIOCSCLOCKID, &clock) == 0) {
+        return CLOCK_MONOTONIC;
+    }
+#endif
+    return CLOCK_REALTIME;  /* what evdev uses until told otherwise */
+}
+
+/* Returns what to add to that clock's time to get SDL_GetTicksNS() time. */
+static Sint64
+SDL_EVDEV_poll_clock_offset(int clock)
+{
+    struct timespec now;
+    Sint64 now_ns;
+
+    if (clock_gettime((clockid_t) clock, &now) < 0) {
+        return 0;
+    }
+    now_ns = (Sint64) now.tv_sec * 1000000000 + now.tv_nsec;
+    return (Sint64) SDL_GetTicksNS() - now_ns;
+}
+
+/* Returns the time of an input event in SDL_GetTicksNS() time, or 0. */
+static Uint64
+SDL_EVDEV_poll_event_time(const struct input_event *event, Sint64 offset)
+{
+    Sint64 timestamp_ns;
+
+#ifdef input_event_sec
+    timestamp_ns = (Sint64) event->input_event_sec * 1000000000 + (Sint64) event->input_event_usec * 1000;
+#else
+    timestamp_ns = (Sint64) event->time.tv_sec * 1000000000 + (Sint64) event->time.tv_usec * 1000;
+#endif
+    timestamp_ns += offset;
+
+    /* Input from before SDL started, or with a timestamp we can't use */
+    if (timestamp_ns <= 0) {
+        return 0;
+    }
+    return (Uint64) timestamp_ns;
+}
+
+/* Reads input straight from the device, returns -1 if it can't be read any more */
+static int
+SDL_EVDEV_poll_read_fd(SDL_EVDEV_poll_item *item, struct input_event *events, Uint64 *timestamps, int maxevents)
+{
+    Sint64 offset;
+    Uint64 now;
+    int i, len;
+
+    len = read(item->fd, events, maxevents * sizeof (*events));
+    if (len < 0) {
+        return (errno == EAGAIN || errno == EINTR) ? 0 : -1;
+    }
+    if (len == 0) {
+        return 0;
+    }
+    len /= sizeof (*events);
+
+    /* Input the kernel didn't give us a usable time for happened about now */
+    offset = SDL_EVDEV_poll_clock_offset(item->clock);
+    now = SDL_GetTicksNS();
+    for (i = 0; i < len; ++i) {
+        timestamps[i] = SDL_EVDEV_poll_event_time(&events[i], offset);
+        if (!timestamps[i]) {
+            timestamps[i] = now;
+        }
+    }
+    return len;
+}
+
+/* Makes the pumping set readable for queued input -- called with thread_lock held */
+static void
+SDL_EVDEV_poll_signal_pending(void)
+{
+    const Uint64 pending = 1;
+
+    if (thread_queued > 0 && !thread_signaled && thread_pending_fd >= 0) {
+        if (write(thread_pending_fd, &pending, sizeof (pending)) < 0) {
+            /* it's an eventfd, this only fails if the counter overflowed */
+        }
+        thread_signaled = SDL_TRUE;
+    }
+}
+
+/* And clears that once it's all been read -- called with thread_lock held */
+static void
+SDL_EVDEV_poll_clear_pending(void)
+{
+    Uint64 pending;
+
+    if (thread_queued == 0 && thread_signaled) {
+        if (read(thread_pending_fd, &pending, sizeof (pending)) < 0) {
+            /* it's non-blocking, and was already cleared */
+        }
+        thread_signaled = SDL_FALSE;
+    }
+}
+
+/* Reads everything the device has into its queue, returns SDL_FALSE if the
+   device can't be read any more -- called with thread_lock held */
+static SDL_bool
+SDL_EVDEV_poll_queue_input(SDL_EVDEV_poll_item *item)
+{
+    struct input_event events[32];
+    Uint64 timestamps[SDL_arraysize(events)];
+    SDL_EVDEV_poll_event *queued;
+    int i, len;
+
+    while ((len = SDL_EVDEV_poll_read_fd(item, events, timestamps, SDL_arraysize(events))) > 0) {
+        for (i = 0; i < len; ++i) {
+            if (item->queue_count == SDL_EVDEV_POLL_QUEUE_SIZE) {
+                /* Nobody is reading it, so do what evdev does when its own
+                   buffer fills up: drop it all and say so. */
+                thread_queued -= item->queue_count;
+                item->queue_count = 0;
+
+                queued = &item->queue[item->queue_head];
+                SDL_zerop(queued);
+                queued->event.type = EV_SYN;
+                queued->event.code = SYN_DROPPED;
+                queued->timestamp_ns = timestamps[i];
+                ++item->queue_count;
+                ++thread_queued;
+            }
+
+            queued = &item->queue[(item->queue_head + item->queue_count) % SDL_EVDEV_POLL_QUEUE_SIZE];
+            queued->event = events[i];
+            queued->timestamp_ns = timestamps[i];
+            ++item->queue_count;
+            ++thread_queued;
+        }
+    }
+    return (len == 0);
+}
+
+static int SDLCALL
+SDL_EVDEV_poll_thread(void *unused)
+{
+    struct epoll_event events[SDL_EVDEV_POLL_MAX_EVENTS];
+    Uint32 removals;
+    int i, count;
+
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    while (!SDL_AtomicGet(&thread_quit)) {
+        SDL_LockMutex(thread_lock);
+        removals = thread_removals;
+        SDL_UnlockMutex(thread_lock);
+
+        count = epoll_wait(thread_fd, events, SDL_arraysize(events), -1);
+        if (count < 0 && errno != EINTR) {
+            break;
+        }
+
+        /* If anything was removed since the wait started, the events may
+           point at freed items. They're level triggered, so just wait again. */
+        SDL_LockMutex(thread_lock);
+        for (i = 0; i < count && thread_removals == removals; ++i) {
+            SDL_EVDEV_poll_item *item = (SDL_EVDEV_poll_item *) events[i].data.ptr;
+            if (item && item->registered) {
+                if (!SDL_EVDEV_poll_queue_input(item) || (events[i].events & (EPOLLHUP | EPOLLERR))) {
+                    /* The device went away. It stays readable, so stop watching it
+                       rather than spin on it; whoever pumps events still removes it. */
+                    epoll_ctl(thread_fd, EPOLL_CTL_DEL, item->fd, NULL);
+                    item->registered = SDL_FALSE;
+                }
+            }
+        }
+        SDL_EVDEV_poll_signal_pending();
+        SDL_UnlockMutex(thread_lock);
+    }
+    return 0;
+}
+
+static void
+SDL_EVDEV_poll_stop_thread(void)
+{
+    if (input_thread) {
+        const Uint64 wakeup = 1;
+
+        SDL_AtomicSet(&thread_quit, 1);
+        if (write(thread_wakeup_fd, &wakeup, sizeof (wakeup)) < 0) {
+            /* it's an eventfd, this only fails if the counter overflowed */
+        }
+        SDL_WaitThread(input_thread, NULL);
+        input_thread = NULL;
+    }
+    if (thread_pending_fd >= 0) {
+        close(thread_pending_fd);
+        thread_pending_fd = -1;
+    }
+    if (thread_wakeup_fd >= 0) {
+        close(thread_wakeup_fd);
+        thread_wakeup_fd = -1;
+    }
+    if (thread_fd >= 0) {
+        close(thread_fd);
+        thread_fd = -1;
+    }
+    if (thread_lock) {
+        SDL_DestroyMutex(thread_lock);
+        thread_lock = NULL;
+    }
+    thread_queued = 0;
+    thread_signaled = SDL_FALSE;
+}
+
+static void
+SDL_EVDEV_poll_start_thread(void)
+{
+    struct epoll_event event;
+
+    thread_lock = SDL_CreateMutex();
+    thread_fd = epoll_create1(EPOLL_CLOEXEC);
+    thread_wakeup_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    thread_pending_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (!thread_lock || thread_fd < 0 || thread_wakeup_fd < 0 || thread_pending_fd < 0) {
+        SDL_EVDEV_poll_stop_thread();
+        return;
+    }
+
+    /* The wakeup fd is the one without an item */
+    SDL_zero(event);
+    event.events = EPOLLIN;
+    event.data.ptr = NULL;
+    if (epoll_ctl(thread_fd, EPOLL_CTL_ADD, thread_wakeup_fd, &event) < 0) {
+        SDL_EVDEV_poll_stop_thread();
+        return;
+    }
+
+    /* So is the pending fd, in the pumping set */
+    if (poll_fd >= 0 && epoll_ctl(poll_fd, EPOLL_CTL_ADD, thread_pending_fd, &event) < 0) {
+        SDL_EVDEV_poll_stop_thread();
+        return;
+    }
+
+    SDL_AtomicSet(&thread_quit, 0);
+    input_thread = SDL_CreateThreadInternal(SDL_EVDEV_poll_thread, "SDLInput", 0, NULL);
+    if (!input_thread) {
+        SDL_EVDEV_poll_stop_thread();
+    }
+}
+
+int
+SDL_EVDEV_poll_init(void)
+{
+    int retval = 0;
+    SDL_bool start_thread = SDL_FALSE;
+
+    SDL_AtomicLock(&poll_lock);
+    if (poll_refcount == 0) {
+        poll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (poll_fd < 0) {
+            retval = SDL_SetError("epoll_create1() failed: %s", strerror(errno));
+        }
+        start_thread = SDL_GetHintBoolean(SDL_HINT_LINUX_INPUT_THREAD, SDL_FALSE);
+    }
+    ++poll_refcount;
+    SDL_AtomicUnlock(&poll_lock);
+
+    /* Nothing can be added until we return, so this doesn't need the lock */
+    if (start_thread) {
+        SDL_EVDEV_poll_start_thread();
+    }
+
+    return retval;
+}
+
+void
+SDL_EVDEV_poll_quit(void)
+{
+    SDL_bool stop_thread = SDL_FALSE;
+
+    SDL_AtomicLock(&poll_lock);
+    if (poll_refcount > 0 && --poll_refcount == 0) {
+        if (poll_fd >= 0) {
+            close(poll_fd);
+            poll_fd = -1;
+        }
+        stop_thread = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&poll_lock);
+
+    if (stop_thread) {
+        SDL_EVDEV_poll_stop_thread();
+    }
+}
+
+int
+SDL_EVDEV_poll_add(SDL_EVDEV_poll_item *item, int fd, SDL_bool is_input)
+{
+    struct epoll_event event;
+    SDL_EVDEV_poll_event *queue = NULL;
+    int retval = 0;
+
+    SDL_zero(event);
+    event.events = EPOLLIN;
+    event.data.ptr = item;
+
+    if (is_input && input_thread) {
+        /* If there's no memory for it, it's read when pumping instead */
+        queue = (SDL_EVDEV_poll_event *) SDL_malloc(SDL_EVDEV_POLL_QUEUE_SIZE * sizeof (*queue));
+    }
+
+    SDL_AtomicLock(&poll_lock);
+    item->fd = fd;
+    item->clock = is_input ? SDL_EVDEV_poll_set_clock(fd) : CLOCK_REALTIME;
+    item->ready = SDL_TRUE;
+    item->seen = poll_generation;
+    item->registered = SDL_FALSE;
+    item->threaded = SDL_FALSE;
+    item->queue = queue;
+    item->queue_head = 0;
+    item->queue_count = 0;
+    if (queue) {
+        if (epoll_ctl(thread_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            retval = SDL_SetError("epoll_ctl() failed: %s", strerror(errno));
+            item->queue = NULL;
+            SDL_free(queue);
+        } else {
+            item->registered = SDL_TRUE;
+            item->threaded = SDL_TRUE;
+        }
+    } else if (poll_fd < 0) {
+        retval = -1;  /* epoll isn't available, already reported by init */
+    } else if (epoll_ctl(poll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        retval = SDL_SetError("epoll_ctl() failed: %s", strerror(errno));
+    } else {
+        item->registered = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&poll_lock);
+
+    return retval;
+}
+
+void
+SDL_EVDEV_poll_remove(SDL_EVDEV_poll_item *item)
+{
+    if (item->threaded) {
+        /* Wait for the thread to be done with it, if it's reading it now,
+           and throw away whatever it has queued */
+        SDL_LockMutex(thread_lock);
+        if (item->registered) {
+            epoll_ctl(thread_fd, EPOLL_CTL_DEL, item->fd, NULL);
+        }
+        ++thread_removals;
+        thread_queued -= item->queue_count;
+        SDL_EVDEV_poll_clear_pending();
+        item->registered = SDL_FALSE;
+        item->threaded = SDL_FALSE;
+        SDL_UnlockMutex(thread_lock);
+
+        SDL_free(item->queue);
+        item->queue = NULL;
+        item->queue_count = 0;
+        return;
+    }
+
+    SDL_AtomicLock(&poll_lock);
+    if (item->registered) {
+        epoll_ctl(poll_fd, EPOLL_CTL_DEL, item->fd, NULL);
+        item->registered = SDL_FALSE;
+    }
+    SDL_AtomicUnlock(&poll_lock);
+}
+
+SDL_bool
+SDL_EVDEV_poll_ready(SDL_EVDEV_poll_item *item)
+{
+    struct epoll_event events[SDL_EVDEV_POLL_MAX_EVENTS];
+    SDL_bool ready;
+    int i, count;
+
+    if (item->threaded) {
+        SDL_LockMutex(thread_lock);
+        ready = (item->queue_count > 0);
+        SDL_UnlockMutex(thread_lock);
+        return ready;
+    }
+    if (!item->registered) {
+        return SDL_TRUE;
+    }
+
+    SDL_AtomicLock(&poll_lock);
+
+    /* Only wait again once this item has had the last wait's result, so
+       while everyone walks their devices once per pump (evdev, joysticks
+       and udev alike) there's a single epoll_wait() for all of them. */
+    if (item->seen == poll_generation) {
+        count = epoll_wait(poll_fd, events, SDL_arraysize(events), 0);
+        for (i = 0; i < count; ++i) {
+            /* The input thread's pending fd has no item, its devices say for themselves */
+            if (events[i].data.ptr) {
+                ((SDL_EVDEV_poll_item *) events[i].data.ptr)->ready = SDL_TRUE;
+            }
+        }
+        ++poll_generation;
+    }
+    item->seen = poll_generation;
+
+    ready = item->ready;
+    item->ready = SDL_FALSE;
+
+    SDL_AtomicUnlock(&poll_lock);
+
+    return ready;
+}
+
+int
+SDL_EVDEV_poll_read(SDL_EVDEV_poll_item *item, struct input_event *events, Uint64 *timestamps, int maxevents)
+{
+    int i, count;
+
+    if (!item->threaded) {
+        return SDL_EVDEV_poll_read_fd(item, events, timestamps, maxevents);
+    }
+
+    SDL_LockMutex(thread_lock);
+    count = SDL_min(item->queue_count, maxevents);
+    for (i = 0; i < count; ++i) {
+        events[i] = item->queue[item->queue_head].event;
+        timestamps[i] = item->queue[item->queue_head].timestamp_ns;
+        item->queue_head = (item->queue_head + 1) % SDL_EVDEV_POLL_QUEUE_SIZE;
+    }
+    item->queue_count -= count;
+    thread_queued -= count;
+    SDL_EVDEV_poll_clear_pending();
+    SDL_UnlockMutex(thread_lock);
+
+    return count;
+}
+
+int
+SDL_EVDEV_poll_get_fd(void)
+{
+    return poll_fd;
+}
+
+#endif /* SDL_INPUT_LINUXEV */
+
+/* vi: set ts=4 sw=4 expandtab: */
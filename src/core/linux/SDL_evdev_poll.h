@@ -0,0 +1,81 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+
+#include "../../SDL_internal.h"
+
+#ifndef SDL_evdev_poll_h_
+#define SDL_evdev_poll_h_
+
+#ifdef SDL_INPUT_LINUXEV
+
+#include <linux/input.h>
+
+/* One epoll set for every evdev, joystick and udev fd, so pumping input
+   costs one epoll_wait() and then reads only the devices that are ready.
+
+   With SDL_HINT_LINUX_INPUT_THREAD set, input devices go in a second set
+   instead, which a dedicated thread waits on. It only reads and timestamps
+   their input into a queue per device; the input is still handled, and its
+   events sent, on the thread that pumps events. */
+
+typedef struct SDL_EVDEV_poll_event
+{
+    struct input_event event;
+    Uint64 timestamp_ns;
+} SDL_EVDEV_poll_event;
+
+typedef struct SDL_EVDEV_poll_item
+{
+    int fd;
+    int clock;          /* the clock the kernel stamps input with */
+    SDL_bool registered;  /* cleared by the input thread if the device goes away */
+    SDL_bool threaded;    /* read by the input thread, into the queue */
+    SDL_bool ready;
+    Uint32 seen;        /* the last wait this item's readiness was taken from */
+    SDL_EVDEV_poll_event *queue;
+    int queue_head;
+    int queue_count;
+} SDL_EVDEV_poll_item;
+
+extern int SDL_EVDEV_poll_init(void);
+extern void SDL_EVDEV_poll_quit(void);
+/* If is_input is set, fd is an evdev device: its input gets kernel timestamps
+   and the input thread reads it, if it's running.
+   If this fails, the item is always reported ready, so callers still work. */
+extern int SDL_EVDEV_poll_add(SDL_EVDEV_poll_item *item, int fd, SDL_bool is_input);
+/* Must be called before the fd is closed. Once this returns, the input
+   thread is done with the item. */
+extern void SDL_EVDEV_poll_remove(SDL_EVDEV_poll_item *item);
+/* Returns whether the fd may have input to read, and clears that until the next wait. */
+extern SDL_bool SDL_EVDEV_poll_ready(SDL_EVDEV_poll_item *item);
+/* Reads up to maxevents input events from an is_input item, with the time each
+   happened in SDL_GetTicksNS() time. Returns the number read, 0 if there's none,
+   or -1 if the device can't be read any more. */
+extern int SDL_EVDEV_poll_read(SDL_EVDEV_poll_item *item, struct input_event *events, Uint64 *timestamps, int maxevents);
+/* Returns the epoll fd, which is readable when any registered fd is, or -1. */
+extern int SDL_EVDEV_poll_get_fd(void);
+
+#endif /* SDL_INPUT_LINUXEV */
+
+#endif /* SDL_evdev_poll_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -145,6 +145,12 @@ SDL_UDEV_Init(void)
         _this->udev_monitor_filter_add_match_subsystem_devtype(_this->udev_mon, "input", NULL);
         _this->udev_monitor_filter_add_match_subsystem_devtype(_this->udev_mon, "sound", NULL);
         _this->udev_monitor_enable_receiving(_this->udev_mon);
+
+#ifdef SDL_INPUT_LINUXEV
+        /* Hotplug events wake the same epoll set as the devices */
+        SDL_EVDEV_poll_init();
+        SDL_EVDEV_poll_add(&_this->poll, _this->udev_monitor_get_fd(_this->udev_mon), SDL_FALSE);
+#endif
         
         /* Do an initial scan of existing devices */
         SDL_UDEV_Scan();
@@ -170,6 +176,10 @@ SDL_UDEV_Quit(void)
     if (_this->ref_count < 1) {
         
         if (_this->udev_mon != NULL) {
+#ifdef SDL_INPUT_LINUXEV
+            SDL_EVDEV_poll_remove(&_this->poll);
+            SDL_EVDEV_poll_quit();
+#endif
             _this->udev_monitor_unref(_this->udev_mon);
             _this->udev_mon = NULL;
         }
@@ -470,6 +480,15 @@ device_event(SDL_UDEV_deviceevent type, struct udev_device *dev)
     }
 }
 
+int
+SDL_UDEV_GetFD(void)
+{
+    if (_this == NULL || _this->udev_mon == NULL) {
+        return -1;
+    }
+    return _this->udev_monitor_get_fd(_this->udev_mon);
+}
+
 void 
 SDL_UDEV_Poll(void)
 {
@@ -480,6 +499,12 @@ SDL_UDEV_Poll(void)
         return;
     }
 
+#ifdef SDL_INPUT_LINUXEV
+    if (_this->udev_mon != NULL && !SDL_EVDEV_poll_ready(&_this->poll)) {
+        return;  /* the monitor hasn't become readable */
+    }
+#endif
+
     while (SDL_UDEV_hotplug_update_available()) {
         dev = _this->udev_monitor_receive_device(_this->udev_mon);
         if (dev == NULL) {
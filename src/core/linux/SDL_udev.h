@@ -32,6 +32,7 @@
 
 #include "SDL_loadso.h"
 #include "SDL_events.h"
+#include "SDL_evdev_poll.h"
 #include <libudev.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -71,6 +72,9 @@ typedef struct SDL_UDEV_PrivateData
     struct udev *udev;
     struct udev_monitor *udev_mon;
     int ref_count;
+#ifdef SDL_INPUT_LINUXEV
+    SDL_EVDEV_poll_item poll;
+#endif
     SDL_UDEV_CallbackList *first, *last;
     
     /* Function pointers */
@@ -107,6 +111,7 @@ extern void SDL_UDEV_Quit(void);
 extern void SDL_UDEV_UnloadLibrary(void);
 extern int SDL_UDEV_LoadLibrary(void);
 extern void SDL_UDEV_Poll(void);
+extern int SDL_UDEV_GetFD(void);
 extern void SDL_UDEV_Scan(void);
 extern int SDL_UDEV_AddCallback(SDL_UDEV_Callback cb);
 extern void SDL_UDEV_DelCallback(SDL_UDEV_Callback cb);
@@ -22,6 +22,7 @@
 #include "../../SDL_internal.h"
 
 #include "SDL_assert.h"
+#include "SDL_error.h"
 #include "SDL_poll.h"
 
 #ifdef HAVE_POLL
@@ -84,4 +85,56 @@ SDL_IOReady(int fd, SDL_bool forWrite, int timeoutMS)
     return result;
 }
 
+int
+SDL_IOReadyMultiple(const int *fds, int numfds, int timeoutMS)
+{
+    int result;
+    int i;
+
+#ifdef HAVE_POLL
+    struct pollfd info[64];
+
+    if (numfds > SDL_arraysize(info)) {
+        return SDL_SetError("Too many file descriptors to wait on");
+    }
+
+    for (i = 0; i < numfds; i++) {
+        info[i].fd = fds[i];
+        info[i].events = POLLIN | POLLPRI;
+        info[i].revents = 0;
+    }
+    result = poll(info, numfds, timeoutMS);
+#else
+    fd_set rfdset;
+    struct timeval tv, *tvp = NULL;
+    int maxfd = -1;
+
+    FD_ZERO(&rfdset);
+    for (i = 0; i < numfds; i++) {
+        /* If this assert triggers we'll corrupt memory here */
+        SDL_assert(fds[i] >= 0 && fds[i] < FD_SETSIZE);
+        FD_SET(fds[i], &rfdset);
+        if (fds[i] > maxfd) {
+            maxfd = fds[i];
+        }
+    }
+
+    if (timeoutMS >= 0) {
+        tv.tv_sec = timeoutMS / 1000;
+        tv.tv_usec = (timeoutMS % 1000) * 1000;
+        tvp = &tv;
+    }
+
+    result = select(maxfd + 1, &rfdset, NULL, NULL, tvp);
+#endif /* HAVE_POLL */
+
+    /* Unlike SDL_IOReady(), we don't retry on EINTR: the caller probably
+       wants to look at whatever the signal did (like SDL_QUIT). */
+    if (result < 0 && errno == EINTR) {
+        result = 0;
+    }
+
+    return result;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -29,6 +29,10 @@
 
 extern int SDL_IOReady(int fd, SDL_bool forWrite, int timeoutMS);
 
+/* Wait until any of (fds) is readable, or (timeoutMS) passes (-1 waits forever).
+   Returns the number of ready fds, 0 on timeout or signal, -1 on error. */
+extern int SDL_IOReadyMultiple(const int *fds, int numfds, int timeoutMS);
+
 #endif /* SDL_poll_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,65 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef SDL_simd_h_
+#define SDL_simd_h_
+
+/* Which SIMD intrinsics SDL's own code can be built with.
+
+   SSE2, SSE3 and NEON are only used when the compiler already targets
+   them; the code still checks SDL_HasSSE2() and friends before using them.
+   AVX2 code is built whenever the compiler can target it for a single
+   function: mark those functions SDL_TARGETING_AVX2, and only call them
+   if SDL_HasAVX2().
+*/
+
+#include "SDL_cpuinfo.h"
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+
+#ifdef __SSE3__
+#define HAVE_SSE3_INTRINSICS 1
+#endif
+
+#if defined(__AVX2__) && HAVE_IMMINTRIN_H && !defined(SDL_DISABLE_IMMINTRIN_H)
+#define HAVE_AVX2_INTRINSICS 1
+#define SDL_TARGETING_AVX2
+#elif (defined(__i386__) || defined(__x86_64__)) && HAVE_IMMINTRIN_H && !defined(SDL_DISABLE_IMMINTRIN_H) && \
+      (defined(__clang__) || (__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define HAVE_AVX2_INTRINSICS 1
+#define SDL_TARGETING_AVX2 __attribute__((target("avx2")))
+#elif (defined(_M_IX86) || defined(_M_X64)) && defined(_MSC_VER) && (_MSC_VER >= 1800)
+#include <immintrin.h>
+#define HAVE_AVX2_INTRINSICS 1
+#define SDL_TARGETING_AVX2
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#endif /* SDL_simd_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -669,3 +669,40 @@
 #define SDL_WinRTGetDeviceFamily SDL_WinRTGetDeviceFamily_REAL
 #define SDL_log10 SDL_log10_REAL
 #define SDL_log10f SDL_log10f_REAL
+#define SDL_RenderFlush SDL_RenderFlush_REAL
+#define SDL_SoftStretchLinear SDL_SoftStretchLinear_REAL
+#define SDL_NewAudioStreamWithBuffer SDL_NewAudioStreamWithBuffer_REAL
+#define SDL_BindAudioStream SDL_BindAudioStream_REAL
+#define SDL_UnbindAudioStream SDL_UnbindAudioStream_REAL
+#define SDL_GetThreadCachedMemoryFunctions SDL_GetThreadCachedMemoryFunctions_REAL
+#define SDL_GetMemorySizeClassStats SDL_GetMemorySizeClassStats_REAL
+#define SDL_RWFromFileMapped SDL_RWFromFileMapped_REAL
+#define SDL_RWGetMappedData SDL_RWGetMappedData_REAL
+#define SDL_RWAdviseMapped SDL_RWAdviseMapped_REAL
+#define SDL_CreateAsyncIOQueue SDL_CreateAsyncIOQueue_REAL
+#define SDL_AsyncRead SDL_AsyncRead_REAL
+#define SDL_AsyncWrite SDL_AsyncWrite_REAL
+#define SDL_AsyncLoadFile SDL_AsyncLoadFile_REAL
+#define SDL_GetAsyncIOResult SDL_GetAsyncIOResult_REAL
+#define SDL_WaitAsyncIOResult SDL_WaitAsyncIOResult_REAL
+#define SDL_DestroyAsyncIOQueue SDL_DestroyAsyncIOQueue_REAL
+#define SDL_SetTraceEnabled SDL_SetTraceEnabled_REAL
+#define SDL_GetTraceEnabled SDL_GetTraceEnabled_REAL
+#define SDL_TraceBegin SDL_TraceBegin_REAL
+#define SDL_TraceEnd SDL_TraceEnd_REAL
+#define SDL_GetTraceEvents SDL_GetTraceEvents_REAL
+#define SDL_GetTraceCounters SDL_GetTraceCounters_REAL
+#define SDL_ResetTraceCounters SDL_ResetTraceCounters_REAL
+#define SDL_SaveTraceJSON_RW SDL_SaveTraceJSON_RW_REAL
+#define SDL_LinuxGetInputFD SDL_LinuxGetInputFD_REAL
+#define SDL_GetTicksNS SDL_GetTicksNS_REAL
+#define SDL_PeepEventsTimestamps SDL_PeepEventsTimestamps_REAL
+#define SDL_NewWAVDecoder SDL_NewWAVDecoder_REAL
+#define SDL_WAVDecoderRead SDL_WAVDecoderRead_REAL
+#define SDL_WAVDecoderSeek SDL_WAVDecoderSeek_REAL
+#define SDL_WAVDecoderTell SDL_WAVDecoderTell_REAL
+#define SDL_WAVDecoderFrames SDL_WAVDecoderFrames_REAL
+#define SDL_WAVDecoderPutStream SDL_WAVDecoderPutStream_REAL
+#define SDL_FreeWAVDecoder SDL_FreeWAVDecoder_REAL
+#define SDL_LoadBMPFormat_RW SDL_LoadBMPFormat_RW_REAL
+#define SDL_GetWindowSurfaceDamage SDL_GetWindowSurfaceDamage_REAL
@@ -707,3 +707,42 @@ SDL_DYNAPI_PROC(SDL_bool,SDL_IsAndroidTV,(void),(),return)
 #endif
 SDL_DYNAPI_PROC(double,SDL_log10,(double a),(a),return)
 SDL_DYNAPI_PROC(float,SDL_log10f,(float a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_RenderFlush,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SoftStretchLinear,(SDL_Surface *a, const SDL_Rect *b, SDL_Surface *c, const SDL_Rect *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_NewAudioStreamWithBuffer,(const SDL_AudioFormat a, const Uint8 b, const int c, const SDL_AudioFormat d, const Uint8 e, const int f, const int g, void *h, const int i),(a,b,c,d,e,f,g,h,i),return)
+SDL_DYNAPI_PROC(int,SDL_BindAudioStream,(SDL_AudioDeviceID a, SDL_AudioStream *b, float c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_UnbindAudioStream,(SDL_AudioDeviceID a, SDL_AudioStream *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetThreadCachedMemoryFunctions,(SDL_malloc_func *a, SDL_calloc_func *b, SDL_realloc_func *c, SDL_free_func *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_GetMemorySizeClassStats,(SDL_MemorySizeClassStats *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_RWops*,SDL_RWFromFileMapped,(const char *a),(a),return)
+SDL_DYNAPI_PROC(const void*,SDL_RWGetMappedData,(SDL_RWops *a, size_t *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_RWAdviseMapped,(SDL_RWops *a, Sint64 b, Sint64 c, SDL_RWMapAdvice d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_AsyncIOQueue*,SDL_CreateAsyncIOQueue,(int a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_AsyncRead,(SDL_AsyncIOQueue *a, SDL_RWops *b, void *c, Sint64 d, size_t e, void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_AsyncWrite,(SDL_AsyncIOQueue *a, SDL_RWops *b, const void *c, Sint64 d, size_t e, void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_AsyncLoadFile,(SDL_AsyncIOQueue *a, const char *b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetAsyncIOResult,(SDL_AsyncIOQueue *a, SDL_AsyncIOOutcome *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_WaitAsyncIOResult,(SDL_AsyncIOQueue *a, SDL_AsyncIOOutcome *b, Sint32 c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyAsyncIOQueue,(SDL_AsyncIOQueue *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_SetTraceEnabled,(SDL_bool a),(a),)
+SDL_DYNAPI_PROC(SDL_bool,SDL_GetTraceEnabled,(void),(),return)
+SDL_DYNAPI_PROC(Uint64,SDL_TraceBegin,(void),(),return)
+SDL_DYNAPI_PROC(void,SDL_TraceEnd,(const char *a, Uint64 b),(a,b),)
+SDL_DYNAPI_PROC(int,SDL_GetTraceEvents,(SDL_TraceEvent *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetTraceCounters,(SDL_TraceCounter *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ResetTraceCounters,(void),(),)
+SDL_DYNAPI_PROC(int,SDL_SaveTraceJSON_RW,(SDL_RWops *a, int b),(a,b),return)
+#ifdef __LINUX__
+SDL_DYNAPI_PROC(int,SDL_LinuxGetInputFD,(void),(),return)
+#endif
+SDL_DYNAPI_PROC(Uint64,SDL_GetTicksNS,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_PeepEventsTimestamps,(SDL_Event *a, Uint64 *b, int c, SDL_eventaction d, Uint32 e, Uint32 f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(SDL_WAVDecoder*,SDL_NewWAVDecoder,(SDL_RWops *a, int b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVDecoderRead,(SDL_WAVDecoder *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WAVDecoderSeek,(SDL_WAVDecoder *a, Uint32 b),(a,b),return)
+SDL_DYNAPI_PROC(Uint32,SDL_WAVDecoderTell,(SDL_WAVDecoder *a),(a),return)
+SDL_DYNAPI_PROC(Uint32,SDL_WAVDecoderFrames,(SDL_WAVDecoder *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_WAVDecoderPutStream,(SDL_WAVDecoder *a, SDL_AudioStream *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_FreeWAVDecoder,(SDL_WAVDecoder *a),(a),)
+SDL_DYNAPI_PROC(SDL_Surface*,SDL_LoadBMPFormat_RW,(SDL_RWops *a, int b, Uint32 c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetWindowSurfaceDamage,(SDL_Window *a, SDL_Rect *b, int c),(a,b,c),return)
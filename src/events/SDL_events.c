@@ -26,18 +26,40 @@
 #include "SDL_events.h"
 #include "SDL_thread.h"
 #include "SDL_events_c.h"
+#include "../SDL_trace_c.h"
 #include "../timer/SDL_timer_c.h"
 #if !SDL_JOYSTICK_DISABLED
 #include "../joystick/SDL_joystick_c.h"
 #endif
 #include "../video/SDL_sysvideo.h"
 #include "SDL_syswm.h"
+#ifdef SDL_INPUT_LINUXEV
+#include "../core/linux/SDL_evdev_poll.h"
+#endif
+
+/* SDL_WaitEventTimeout() blocks in poll() on the video backend's file
+   descriptors plus a pipe that other threads write to when they add events.
+   Elsewhere it waits on a condition variable. */
+#if !SDL_THREADS_DISABLED && (defined(__LINUX__) || defined(__FREEBSD__) || defined(__NETBSD__) || defined(__OPENBSD__))
+#define SDL_EVENT_WAKEUP_FD 1
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../core/unix/SDL_poll.h"
+#endif
 
 /*#define SDL_DEBUG_EVENTS 1*/
 
 /* An arbitrary limit so we don't have unbounded growth */
 #define SDL_MAX_QUEUED_EVENTS   65535
 
+/* How long SDL_WaitEventTimeout() sleeps between pumps when there's input we
+   can't be woken up for (a backend without wait fds, joysticks, etc). */
+#define SDL_EVENT_POLL_INTERVAL 10
+
+/* The most file descriptors SDL_WaitEventTimeout() will poll() at once. */
+#define SDL_MAX_EVENT_WAIT_FDS  64
+
 typedef struct SDL_EventWatcher {
     SDL_EventFilter callback;
     void *userdata;
@@ -63,6 +85,7 @@ typedef struct _SDL_EventEntry
 {
     SDL_Event event;
     SDL_SysWMmsg msg;
+    Uint64 timestamp_ns;
     struct _SDL_EventEntry *prev;
     struct _SDL_EventEntry *next;
 } SDL_EventEntry;
@@ -73,18 +96,62 @@ typedef struct _SDL_SysWMEntry
     struct _SDL_SysWMEntry *next;
 } SDL_SysWMEntry;
 
+/* SDL_PushEvent() doesn't take the queue lock for most events: producers
+   append to a bounded lock-free ring (the same multiple-producer queue that
+   test/testatomic.c exercises) and whoever next locks the queue to look at it
+   moves those events over to the linked list, in order. The list keeps the
+   type-range, peek and removal semantics SDL_PeepEvents() needs. */
+#define SDL_EVENT_RING_SIZE 1024    /* must be a power of two */
+#define SDL_EVENT_RING_MASK (SDL_EVENT_RING_SIZE - 1)
+
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_Event event;
+    Uint64 timestamp_ns;
+} SDL_EventRingEntry;
+
+static struct
+{
+    SDL_EventRingEntry entries[SDL_EVENT_RING_SIZE];
+
+    char cache_pad1[SDL_CACHELINE_SIZE];
+    SDL_atomic_t enqueue_pos;
+    char cache_pad2[SDL_CACHELINE_SIZE - sizeof (SDL_atomic_t)];
+
+    unsigned dequeue_pos;           /* only touched with SDL_EventQ.lock held */
+    SDL_atomic_t initialized;
+    SDL_SpinLock init_lock;
+} SDL_EventRing;
+
 static struct
 {
     SDL_mutex *lock;
     SDL_atomic_t active;
-    SDL_atomic_t count;
-    int max_events_seen;
+    SDL_atomic_t count;             /* events in the ring and the list, including ones being added */
+    SDL_atomic_t max_events_seen;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
     SDL_SysWMEntry *wmmsg_used;
     SDL_SysWMEntry *wmmsg_free;
-} SDL_EventQ = { NULL, { 1 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
+    SDL_atomic_t waiters;           /* threads blocked in SDL_WaitEventTimeout() */
+    SDL_mutex *wakeup_lock;
+    SDL_cond *wakeup_cond;
+#if SDL_EVENT_WAKEUP_FD
+    SDL_atomic_t wakeup_pending;    /* a byte is in the pipe, don't bother writing another. */
+    int wakeup_fds[2];
+#endif
+} SDL_EventQ = { NULL, { 1 }, { 0 }, { 0 }, NULL, NULL, NULL, NULL, NULL, { 0 }, NULL, NULL
+#if SDL_EVENT_WAKEUP_FD
+    , { 0 }, { -1, -1 }
+#endif
+};
+
+/* SDL_Event has no room for a nanosecond timestamp, so while
+   SDL_HINT_EVENT_TIMESTAMPS_NS is set the queue keeps it next to each event,
+   for SDL_PeepEventsTimestamps(). Otherwise it's 0. */
+static SDL_bool SDL_event_timestamps_ns = SDL_FALSE;
 
 
 #ifdef SDL_DEBUG_EVENTS
@@ -311,6 +378,272 @@ SDL_DebugPrintEvent(const SDL_Event *event)
 
 
 
+/* Wakeup support for SDL_WaitEventTimeout() */
+
+static int
+SDL_CreateEventWakeup(void)
+{
+    if (!SDL_EventQ.wakeup_lock) {
+        SDL_EventQ.wakeup_lock = SDL_CreateMutex();
+        if (SDL_EventQ.wakeup_lock == NULL) {
+            return -1;
+        }
+    }
+
+    if (!SDL_EventQ.wakeup_cond) {
+        SDL_EventQ.wakeup_cond = SDL_CreateCond();
+        if (SDL_EventQ.wakeup_cond == NULL) {
+            return -1;
+        }
+    }
+
+#if SDL_EVENT_WAKEUP_FD
+    /* If we can't get a pipe, we just fall back to the condition variable. */
+    if (SDL_EventQ.wakeup_fds[0] < 0) {
+        int fds[2];
+        if (pipe(fds) == 0) {
+            int i;
+            for (i = 0; i < 2; i++) {
+                fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK);
+                fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+            }
+            SDL_AtomicSet(&SDL_EventQ.wakeup_pending, 0);
+            SDL_EventQ.wakeup_fds[0] = fds[0];
+            SDL_EventQ.wakeup_fds[1] = fds[1];
+        }
+    }
+#endif
+
+    return 0;
+}
+
+static void
+SDL_DestroyEventWakeup(void)
+{
+#if SDL_EVENT_WAKEUP_FD
+    if (SDL_EventQ.wakeup_fds[0] >= 0) {
+        close(SDL_EventQ.wakeup_fds[0]);
+        close(SDL_EventQ.wakeup_fds[1]);
+        SDL_EventQ.wakeup_fds[0] = SDL_EventQ.wakeup_fds[1] = -1;
+    }
+#endif
+    if (SDL_EventQ.wakeup_cond) {
+        SDL_DestroyCond(SDL_EventQ.wakeup_cond);
+        SDL_EventQ.wakeup_cond = NULL;
+    }
+    if (SDL_EventQ.wakeup_lock) {
+        SDL_DestroyMutex(SDL_EventQ.wakeup_lock);
+        SDL_EventQ.wakeup_lock = NULL;
+    }
+}
+
+/* Called after adding events, so a thread in SDL_WaitEventTimeout() sees them right away. */
+static void
+SDL_WakeEventWaiters(void)
+{
+    if (SDL_AtomicGet(&SDL_EventQ.waiters) == 0) {
+        return;  /* nobody is blocked, the common case. */
+    }
+
+#if SDL_EVENT_WAKEUP_FD
+    if (SDL_EventQ.wakeup_fds[1] >= 0) {
+        if (SDL_AtomicCAS(&SDL_EventQ.wakeup_pending, 0, 1)) {
+            const char byte = 0;
+            if (write(SDL_EventQ.wakeup_fds[1], &byte, 1) < 0) {
+                /* The pipe is full, so it's readable anyhow. */
+            }
+        }
+        return;
+    }
+#endif
+
+    if (SDL_EventQ.wakeup_cond) {
+        SDL_LockMutex(SDL_EventQ.wakeup_lock);
+        SDL_CondBroadcast(SDL_EventQ.wakeup_cond);
+        SDL_UnlockMutex(SDL_EventQ.wakeup_lock);
+    }
+}
+
+/* Take the smaller of two timeouts, where -1 means forever. */
+static int
+SDL_MinEventTimeout(const int a, const int b)
+{
+    if (a < 0) {
+        return b;
+    } else if (b < 0) {
+        return a;
+    }
+    return SDL_min(a, b);
+}
+
+/* Block until another thread adds an event, there's new input to pump, or
+   (timeout) milliseconds pass (-1 to wait forever). May return early. */
+static void
+SDL_WaitForEvents(int timeout)
+{
+    SDL_VideoDevice *_this = SDL_GetVideoDevice();
+#if SDL_EVENT_WAKEUP_FD
+    int fds[SDL_MAX_EVENT_WAIT_FDS];
+    int numfds = 0;
+#endif
+#if SDL_EVENT_WAKEUP_FD && defined(SDL_INPUT_LINUXEV)
+    SDL_bool joysticks_pumped = SDL_FALSE;
+#endif
+
+#if !SDL_JOYSTICK_DISABLED
+    /* !!! FIXME: not every joystick can wake us up (hotplug without udev,
+       !!! FIXME:  Steam controllers), so keep polling them too. */
+    if (SDL_WasInit(SDL_INIT_JOYSTICK) &&
+        (!SDL_disabled_events[SDL_JOYAXISMOTION >> 8] || SDL_JoystickEventState(SDL_QUERY))) {
+        timeout = SDL_MinEventTimeout(timeout, SDL_EVENT_POLL_INTERVAL);
+#if SDL_EVENT_WAKEUP_FD && defined(SDL_INPUT_LINUXEV)
+        joysticks_pumped = SDL_TRUE;
+#endif
+    }
+#endif
+
+    if (_this) {
+        int backend_timeout = SDL_EVENT_POLL_INTERVAL;
+#if SDL_EVENT_WAKEUP_FD
+        if (_this->GetEventWaitFDs && (SDL_EventQ.wakeup_fds[0] >= 0)) {
+            numfds = _this->GetEventWaitFDs(_this, &fds[1], SDL_arraysize(fds) - 1, &backend_timeout);
+            if (numfds < 0) {
+                numfds = 0;
+                backend_timeout = SDL_EVENT_POLL_INTERVAL;
+            }
+        }
+#endif
+        timeout = SDL_MinEventTimeout(timeout, backend_timeout);
+    }
+
+#if SDL_EVENT_WAKEUP_FD && defined(SDL_INPUT_LINUXEV)
+    /* Linux joysticks share the evdev epoll set, which is only safe to wait
+       on when SDL_PumpEvents() reads them, or it would stay readable. */
+    if (joysticks_pumped && (SDL_EVDEV_poll_get_fd() >= 0) &&
+        (numfds < (int) SDL_arraysize(fds) - 1)) {
+        int i;
+        for (i = 1; i <= numfds; ++i) {
+            if (fds[i] == SDL_EVDEV_poll_get_fd()) {
+                break;
+            }
+        }
+        if (i > numfds) {
+            fds[++numfds] = SDL_EVDEV_poll_get_fd();
+        }
+    }
+#endif
+
+    if (timeout == 0) {
+        return;
+    }
+
+    (void) SDL_AtomicIncRef(&SDL_EventQ.waiters);
+
+    /* Now that we're registered, anyone adding an event will wake us, so
+       we only have to check for events that got in before that. */
+    if (SDL_AtomicGet(&SDL_EventQ.count) == 0) {
+#if SDL_EVENT_WAKEUP_FD
+        if (SDL_EventQ.wakeup_fds[0] >= 0) {
+            char buf[16];
+            fds[0] = SDL_EventQ.wakeup_fds[0];
+            if (SDL_IOReadyMultiple(fds, numfds + 1, timeout) > 0) {
+                while (read(SDL_EventQ.wakeup_fds[0], buf, sizeof (buf)) > 0) {
+                    /* drain it. */
+                }
+                SDL_AtomicSet(&SDL_EventQ.wakeup_pending, 0);
+            }
+        } else
+#endif
+        if (SDL_EventQ.wakeup_cond) {
+            SDL_LockMutex(SDL_EventQ.wakeup_lock);
+            if (SDL_AtomicGet(&SDL_EventQ.count) == 0) {
+                SDL_CondWaitTimeout(SDL_EventQ.wakeup_cond, SDL_EventQ.wakeup_lock,
+                                    (timeout < 0) ? SDL_MUTEX_MAXWAIT : (Uint32) timeout);
+            }
+            SDL_UnlockMutex(SDL_EventQ.wakeup_lock);
+        } else {
+            SDL_Delay(SDL_MinEventTimeout(timeout, SDL_EVENT_POLL_INTERVAL));
+        }
+    }
+
+    (void) SDL_AtomicDecRef(&SDL_EventQ.waiters);
+}
+
+/* Mark every slot of the ring free -- called with the queue locked, or before anyone can push */
+static void
+SDL_ResetEventRing(void)
+{
+    int i;
+
+    for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+        SDL_AtomicSet(&SDL_EventRing.entries[i].sequence, i);
+    }
+    SDL_AtomicSet(&SDL_EventRing.enqueue_pos, 0);
+    SDL_EventRing.dequeue_pos = 0;
+}
+
+/* Events can be pushed before SDL_StartEventLoop(), so set the ring up on first use */
+static void
+SDL_InitEventRing(void)
+{
+    if (!SDL_AtomicGet(&SDL_EventRing.initialized)) {
+        SDL_AtomicLock(&SDL_EventRing.init_lock);
+        if (!SDL_AtomicGet(&SDL_EventRing.initialized)) {
+            SDL_ResetEventRing();
+            SDL_AtomicSet(&SDL_EventRing.initialized, 1);
+        }
+        SDL_AtomicUnlock(&SDL_EventRing.init_lock);
+    }
+}
+
+static void SDLCALL
+SDL_EventTimestampsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    if (hint && *hint && *hint != '0' && SDL_strcasecmp(hint, "false") != 0) {
+        SDL_event_timestamps_ns = SDL_TRUE;
+    } else {
+        SDL_event_timestamps_ns = SDL_FALSE;
+    }
+}
+
+/* The time a queued event happened, for SDL_PeepEventsTimestamps() */
+static Uint64
+SDL_GetQueuedEventTimestamp(const SDL_Event * event, Uint64 timestamp_ns)
+{
+    return timestamp_ns ? timestamp_ns : ((Uint64) event->common.timestamp * 1000000);
+}
+
+/* Add an event to the ring without locking, returns SDL_FALSE if it's full */
+static SDL_bool
+SDL_EnqueueEventRing(const SDL_Event *event, Uint64 timestamp_ns)
+{
+    unsigned queue_pos;
+
+    SDL_InitEventRing();
+
+    queue_pos = (unsigned) SDL_AtomicGet(&SDL_EventRing.enqueue_pos);
+    for ( ; ; ) {
+        SDL_EventRingEntry *entry = &SDL_EventRing.entries[queue_pos & SDL_EVENT_RING_MASK];
+        const int delta = (int) ((unsigned) SDL_AtomicGet(&entry->sequence) - queue_pos);
+
+        if (delta == 0) {
+            /* The slot is free, try to claim it */
+            if (SDL_AtomicCAS(&SDL_EventRing.enqueue_pos, (int) queue_pos, (int) (queue_pos + 1))) {
+                entry->event = *event;
+                entry->timestamp_ns = timestamp_ns;
+                /* Publish it to the consumer */
+                SDL_AtomicSet(&entry->sequence, (int) (queue_pos + 1));
+                return SDL_TRUE;
+            }
+        } else if (delta < 0) {
+            /* The ring is full, the consumer hasn't caught up yet */
+            return SDL_FALSE;
+        }
+        /* Someone else claimed the slot first, try the next one */
+        queue_pos = (unsigned) SDL_AtomicGet(&SDL_EventRing.enqueue_pos);
+    }
+}
+
 /* Public functions */
 
 void
@@ -327,11 +660,17 @@ SDL_StopEventLoop(void)
 
     SDL_AtomicSet(&SDL_EventQ.active, 0);
 
+    SDL_DelHintCallback(SDL_HINT_EVENT_TIMESTAMPS_NS, SDL_EventTimestampsChanged, NULL);
+    SDL_event_timestamps_ns = SDL_FALSE;
+
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d\n",
-                SDL_EventQ.max_events_seen);
+                SDL_AtomicGet(&SDL_EventQ.max_events_seen));
     }
 
+    /* Anything still in the ring goes away with the rest of the queue */
+    SDL_ResetEventRing();
+
     /* Clean out EventQ */
     for (entry = SDL_EventQ.head; entry; ) {
         SDL_EventEntry *next = entry->next;
@@ -355,7 +694,7 @@ SDL_StopEventLoop(void)
     }
 
     SDL_AtomicSet(&SDL_EventQ.count, 0);
-    SDL_EventQ.max_events_seen = 0;
+    SDL_AtomicSet(&SDL_EventQ.max_events_seen, 0);
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
@@ -384,6 +723,8 @@ SDL_StopEventLoop(void)
         SDL_DestroyMutex(SDL_EventQ.lock);
         SDL_EventQ.lock = NULL;
     }
+
+    SDL_DestroyEventWakeup();
 }
 
 /* This function (and associated calls) may be called more than once */
@@ -411,8 +752,14 @@ SDL_StartEventLoop(void)
             return -1;
         }
     }
+
+    if (SDL_CreateEventWakeup() < 0) {
+        return -1;
+    }
 #endif /* !SDL_THREADS_DISABLED */
 
+    SDL_AddHintCallback(SDL_HINT_EVENT_TIMESTAMPS_NS, SDL_EventTimestampsChanged, NULL);
+
     /* Process most event types */
     SDL_EventState(SDL_TEXTINPUT, SDL_DISABLE);
     SDL_EventState(SDL_TEXTEDITING, SDL_DISABLE);
@@ -424,34 +771,45 @@ SDL_StartEventLoop(void)
 }
 
 
-/* Add an event to the event queue -- called with the queue locked */
-static int
-SDL_AddEvent(SDL_Event * event)
+/* Count one more event against SDL_MAX_QUEUED_EVENTS, before it's added anywhere */
+static SDL_bool
+SDL_ReserveEvent(void)
 {
-    SDL_EventEntry *entry;
-    const int initial_count = SDL_AtomicGet(&SDL_EventQ.count);
-    int final_count;
+    const int final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
+    int max_events_seen;
 
-    if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
-        SDL_SetError("Event queue is full (%d events)", initial_count);
-        return 0;
+    if (final_count > SDL_MAX_QUEUED_EVENTS) {
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        SDL_SetError("Event queue is full (%d events)", final_count - 1);
+        return SDL_FALSE;
     }
 
+    do {
+        max_events_seen = SDL_AtomicGet(&SDL_EventQ.max_events_seen);
+    } while (final_count > max_events_seen &&
+             !SDL_AtomicCAS(&SDL_EventQ.max_events_seen, max_events_seen, final_count));
+
+    return SDL_TRUE;
+}
+
+/* Add a reserved event to the end of the list -- called with the queue locked */
+static SDL_bool
+SDL_LinkEvent(const SDL_Event * event, Uint64 timestamp_ns)
+{
+    SDL_EventEntry *entry;
+
     if (SDL_EventQ.free == NULL) {
         entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
         if (!entry) {
-            return 0;
+            return SDL_FALSE;
         }
     } else {
         entry = SDL_EventQ.free;
         SDL_EventQ.free = entry->next;
     }
 
-    #ifdef SDL_DEBUG_EVENTS
-    SDL_DebugPrintEvent(event);
-    #endif
-
     entry->event = *event;
+    entry->timestamp_ns = timestamp_ns;
     if (event->type == SDL_SYSWMEVENT) {
         entry->msg = *event->syswm.msg;
         entry->event.syswm.msg = &entry->msg;
@@ -470,14 +828,146 @@ SDL_AddEvent(SDL_Event * event)
         entry->next = NULL;
     }
 
-    final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
+    return SDL_TRUE;
+}
+
+/* Move the events producers have finished adding to the ring onto the list,
+   returns SDL_FALSE if we ran out of memory -- called with the queue locked */
+static SDL_bool
+SDL_DrainEventRing(void)
+{
+    SDL_InitEventRing();
+
+    for ( ; ; ) {
+        const unsigned queue_pos = SDL_EventRing.dequeue_pos;
+        SDL_EventRingEntry *entry = &SDL_EventRing.entries[queue_pos & SDL_EVENT_RING_MASK];
+
+        if ((unsigned) SDL_AtomicGet(&entry->sequence) != (queue_pos + 1)) {
+            /* Empty, or the producer that claimed this slot is still writing it */
+            break;
+        }
+        if (!SDL_LinkEvent(&entry->event, entry->timestamp_ns)) {
+            /* Out of memory, leave it in the ring and try again next time */
+            return SDL_FALSE;
+        }
+        SDL_EventRing.dequeue_pos = queue_pos + 1;
+        /* Hand the slot back to the producers */
+        SDL_AtomicSet(&entry->sequence, (int) (queue_pos + SDL_EVENT_RING_SIZE));
+    }
+    return SDL_TRUE;
+}
+
+/* Take matching events straight out of the ring, once everything on the list
+   has been looked at; anything else is moved to the list so it keeps its
+   place -- called with the queue locked */
+static int
+SDL_GetEventsFromRing(SDL_Event * events, Uint64 * timestamps_ns, int numevents, Uint32 minType, Uint32 maxType)
+{
+    int used = 0;
+
+    SDL_InitEventRing();
+
+    while (used < numevents) {
+        const unsigned queue_pos = SDL_EventRing.dequeue_pos;
+        SDL_EventRingEntry *entry = &SDL_EventRing.entries[queue_pos & SDL_EVENT_RING_MASK];
+        Uint32 type;
+
+        if ((unsigned) SDL_AtomicGet(&entry->sequence) != (queue_pos + 1)) {
+            break;
+        }
+        type = entry->event.type;
+        if (minType <= type && type <= maxType) {
+            events[used] = entry->event;
+            if (timestamps_ns) {
+                timestamps_ns[used] = SDL_GetQueuedEventTimestamp(&entry->event, entry->timestamp_ns);
+            }
+            ++used;
+        } else if (!SDL_LinkEvent(&entry->event, entry->timestamp_ns)) {
+            break;
+        }
+        SDL_EventRing.dequeue_pos = queue_pos + 1;
+        SDL_AtomicSet(&entry->sequence, (int) (queue_pos + SDL_EVENT_RING_SIZE));
+    }
+
+    if (used > 0) {
+        SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) >= used);
+        SDL_AtomicAdd(&SDL_EventQ.count, -used);
+    }
+    return used;
+}
+
+/* Add an event to the event queue, returns 1 if it was added */
+static int
+SDL_AddEvent(SDL_Event * event, Uint64 timestamp_ns)
+{
+    SDL_bool added = SDL_FALSE;
+    unsigned enqueue_pos;
+
+    if (!SDL_ReserveEvent()) {
+        return 0;
+    }
+
+    #ifdef SDL_DEBUG_EVENTS
+    SDL_DebugPrintEvent(event);
+    #endif
+
+    /* SysWM messages have to be copied next to the event, so they go
+       straight on the list, as does anything that doesn't fit in the ring. */
+    if (event->type != SDL_SYSWMEVENT && SDL_EnqueueEventRing(event, timestamp_ns)) {
+        return 1;
+    }
+
+    /* Everything that got in the ring before this event has to be on the
+       list first, including slots other threads are still filling in,
+       or events from the same thread could come out of order. */
+    enqueue_pos = (unsigned) SDL_AtomicGet(&SDL_EventRing.enqueue_pos);
+    for ( ; ; ) {
+        SDL_bool waiting = SDL_FALSE;
+
+        if (SDL_EventQ.lock && SDL_LockMutex(SDL_EventQ.lock) < 0) {
+            SDL_SetError("Couldn't lock event queue");
+            break;
+        }
+        if (SDL_DrainEventRing()) {
+            if ((int) (enqueue_pos - SDL_EventRing.dequeue_pos) > 0) {
+                waiting = SDL_TRUE;
+            } else {
+                added = SDL_LinkEvent(event, timestamp_ns);
+            }
+        }
+        if (SDL_EventQ.lock) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+        }
+        if (!waiting) {
+            break;
+        }
+        /* Don't hold up everyone else on the queue while a producer finishes its slot */
+        SDL_Delay(0);
     }
 
+    if (!added) {
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        return 0;
+    }
     return 1;
 }
 
+/* Add events that happened at timestamp_ns, returns the number added */
+static int
+SDL_AddEvents(SDL_Event * events, int numevents, Uint64 timestamp_ns)
+{
+    int i, used = 0;
+
+    /* Adding only locks the queue if it has to */
+    for (i = 0; i < numevents; ++i) {
+        used += SDL_AddEvent(&events[i], timestamp_ns);
+    }
+    if (used > 0) {
+        SDL_WakeEventWaiters();
+    }
+    return used;
+}
+
 /* Remove an event from the queue -- called with the queue locked */
 static void
 SDL_CutEvent(SDL_EventEntry *entry)
@@ -506,10 +996,10 @@ SDL_CutEvent(SDL_EventEntry *entry)
 
 /* Lock the event queue, take a peep at it, and unlock it */
 int
-SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
-               Uint32 minType, Uint32 maxType)
+SDL_PeepEventsTimestamps(SDL_Event * events, Uint64 * timestamps_ns, int numevents,
+                         SDL_eventaction action, Uint32 minType, Uint32 maxType)
 {
-    int i, used;
+    int used;
 
     /* Don't look after we've quit */
     if (!SDL_AtomicGet(&SDL_EventQ.active)) {
@@ -519,70 +1009,93 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
         }
         return (-1);
     }
-    /* Lock the event queue */
     used = 0;
+    if (action == SDL_ADDEVENT) {
+        return SDL_AddEvents(events, numevents, SDL_event_timestamps_ns ? SDL_GetTicksNS() : 0);
+    }
+
+    /* Nothing to look at, don't bother locking */
+    if (SDL_AtomicGet(&SDL_EventQ.count) == 0) {
+        return 0;
+    }
+
+    /* Lock the event queue */
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
-        if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
-            }
-        } else {
-            SDL_EventEntry *entry, *next;
-            SDL_SysWMEntry *wmmsg, *wmmsg_next;
-            Uint32 type;
-
-            if (action == SDL_GETEVENT) {
-                /* Clean out any used wmmsg data
-                   FIXME: Do we want to retain the data for some period of time?
-                 */
-                for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
-                    wmmsg_next = wmmsg->next;
-                    wmmsg->next = SDL_EventQ.wmmsg_free;
-                    SDL_EventQ.wmmsg_free = wmmsg;
-                }
-                SDL_EventQ.wmmsg_used = NULL;
+        SDL_EventEntry *entry, *next;
+        SDL_SysWMEntry *wmmsg, *wmmsg_next;
+        Uint32 type;
+        const SDL_bool from_ring = (action == SDL_GETEVENT && events != NULL);
+
+        if (!from_ring) {
+            SDL_DrainEventRing();
+        }
+
+        if (action == SDL_GETEVENT) {
+            /* Clean out any used wmmsg data
+               FIXME: Do we want to retain the data for some period of time?
+             */
+            for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; wmmsg = wmmsg_next) {
+                wmmsg_next = wmmsg->next;
+                wmmsg->next = SDL_EventQ.wmmsg_free;
+                SDL_EventQ.wmmsg_free = wmmsg;
             }
+            SDL_EventQ.wmmsg_used = NULL;
+        }
 
-            for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
-                next = entry->next;
-                type = entry->event.type;
-                if (minType <= type && type <= maxType) {
-                    if (events) {
-                        events[used] = entry->event;
-                        if (entry->event.type == SDL_SYSWMEVENT) {
-                            /* We need to copy the wmmsg somewhere safe.
-                               For now we'll guarantee it's valid at least until
-                               the next call to SDL_PeepEvents()
-                             */
-                            if (SDL_EventQ.wmmsg_free) {
-                                wmmsg = SDL_EventQ.wmmsg_free;
-                                SDL_EventQ.wmmsg_free = wmmsg->next;
-                            } else {
-                                wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
-                            }
-                            wmmsg->msg = *entry->event.syswm.msg;
-                            wmmsg->next = SDL_EventQ.wmmsg_used;
-                            SDL_EventQ.wmmsg_used = wmmsg;
-                            events[used].syswm.msg = &wmmsg->msg;
+        for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
+            next = entry->next;
+            type = entry->event.type;
+            if (minType <= type && type <= maxType) {
+                if (events) {
+                    events[used] = entry->event;
+                    if (entry->event.type == SDL_SYSWMEVENT) {
+                        /* We need to copy the wmmsg somewhere safe.
+                           For now we'll guarantee it's valid at least until
+                           the next call to SDL_PeepEvents()
+                         */
+                        if (SDL_EventQ.wmmsg_free) {
+                            wmmsg = SDL_EventQ.wmmsg_free;
+                            SDL_EventQ.wmmsg_free = wmmsg->next;
+                        } else {
+                            wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
                         }
+                        wmmsg->msg = *entry->event.syswm.msg;
+                        wmmsg->next = SDL_EventQ.wmmsg_used;
+                        SDL_EventQ.wmmsg_used = wmmsg;
+                        events[used].syswm.msg = &wmmsg->msg;
+                    }
+                    if (timestamps_ns) {
+                        timestamps_ns[used] = SDL_GetQueuedEventTimestamp(&entry->event, entry->timestamp_ns);
+                    }
 
-                        if (action == SDL_GETEVENT) {
-                            SDL_CutEvent(entry);
-                        }
+                    if (action == SDL_GETEVENT) {
+                        SDL_CutEvent(entry);
                     }
-                    ++used;
                 }
+                ++used;
             }
         }
+        if (from_ring && used < numevents) {
+            used += SDL_GetEventsFromRing(&events[used], timestamps_ns ? &timestamps_ns[used] : NULL,
+                                          numevents - used, minType, maxType);
+        }
         if (SDL_EventQ.lock) {
             SDL_UnlockMutex(SDL_EventQ.lock);
         }
     } else {
         return SDL_SetError("Couldn't lock event queue");
     }
+
     return (used);
 }
 
+int
+SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
+               Uint32 minType, Uint32 maxType)
+{
+    return SDL_PeepEventsTimestamps(events, NULL, numevents, action, minType, maxType);
+}
+
 SDL_bool
 SDL_HasEvent(Uint32 type)
 {
@@ -621,6 +1134,7 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
         Uint32 type;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -639,10 +1153,13 @@ void
 SDL_PumpEvents(void)
 {
     SDL_VideoDevice *_this = SDL_GetVideoDevice();
+    const Uint64 trace_start = SDL_TRACE_BEGIN();
 
     /* Get events from the video subsystem */
     if (_this) {
+        const Uint64 trace_pump = SDL_TRACE_BEGIN();
         _this->PumpEvents(_this);
+        SDL_TRACE_END("PumpEvents", trace_pump);
     }
 #if !SDL_JOYSTICK_DISABLED
     /* Check for joystick state change */
@@ -652,7 +1169,22 @@ SDL_PumpEvents(void)
 #endif
 
     SDL_SendPendingQuit();  /* in case we had a signal handler fire, etc. */
+
+    SDL_TRACE_END("SDL_PumpEvents", trace_start);
+}
+
+#if defined(__LINUX__)
+int
+SDL_LinuxGetInputFD(void)
+{
+#ifdef SDL_INPUT_LINUXEV
+    if (SDL_EVDEV_poll_get_fd() >= 0) {
+        return SDL_EVDEV_poll_get_fd();
+    }
+#endif
+    return SDL_SetError("No evdev input to wait on");
 }
+#endif /* __LINUX__ */
 
 /* Public functions */
 
@@ -686,11 +1218,18 @@ SDL_WaitEventTimeout(SDL_Event * event, int timeout)
                 /* Polling and no events, just return */
                 return 0;
             }
-            if (timeout > 0 && SDL_TICKS_PASSED(SDL_GetTicks(), expiration)) {
-                /* Timeout expired and no events */
-                return 0;
+            if (timeout < 0) {
+                SDL_WaitForEvents(-1);
+            } else {
+                const Uint32 now = SDL_GetTicks();
+                if (SDL_TICKS_PASSED(now, expiration)) {
+                    /* Timeout expired and no events */
+                    return 0;
+                }
+                /* Use the same tick count we just checked: reading it again could land
+                   past the expiration, and a negative wait blocks forever. */
+                SDL_WaitForEvents((int) (expiration - now));
             }
-            SDL_Delay(10);
             break;
         default:
             /* Has events */
@@ -699,11 +1238,44 @@ SDL_WaitEventTimeout(SDL_Event * event, int timeout)
     }
 }
 
+static SDL_SpinLock SDL_event_timestamp_lock;
+static SDL_TLSID SDL_event_timestamp_tls;
+
+void
+SDL_SetEventTimestampSource(const Uint64 *timestamp_ns)
+{
+    if (!SDL_event_timestamp_tls) {
+        if (!timestamp_ns) {
+            return;
+        }
+        SDL_AtomicLock(&SDL_event_timestamp_lock);
+        if (!SDL_event_timestamp_tls) {
+            SDL_event_timestamp_tls = SDL_TLSCreate();
+        }
+        SDL_AtomicUnlock(&SDL_event_timestamp_lock);
+    }
+    SDL_TLSSet(SDL_event_timestamp_tls, timestamp_ns, NULL);
+}
+
 int
 SDL_PushEvent(SDL_Event * event)
 {
+    Uint64 timestamp_ns = 0;
+
     event->common.timestamp = SDL_GetTicks();
 
+    if (SDL_event_timestamps_ns) {
+        if (SDL_event_timestamp_tls) {
+            const Uint64 *source = (const Uint64 *) SDL_TLSGet(SDL_event_timestamp_tls);
+            if (source) {
+                timestamp_ns = *source;
+            }
+        }
+        if (!timestamp_ns) {
+            timestamp_ns = SDL_GetTicksNS();
+        }
+    }
+
     if (SDL_EventOK.callback || SDL_event_watchers_count > 0) {
         if (!SDL_event_watchers_lock || SDL_LockMutex(SDL_event_watchers_lock) == 0) {
             if (SDL_EventOK.callback && !SDL_EventOK.callback(SDL_EventOK.userdata, event)) {
@@ -744,7 +1316,8 @@ SDL_PushEvent(SDL_Event * event)
         }
     }
 
-    if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
+    /* Don't add events after we've quit */
+    if (!SDL_AtomicGet(&SDL_EventQ.active) || SDL_AddEvents(event, 1, timestamp_ns) <= 0) {
         return -1;
     }
 
@@ -848,6 +1421,7 @@ SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -46,4 +46,11 @@ extern void SDL_QuitQuit(void);
 
 extern void SDL_SendPendingQuit(void);
 
+/* While *timestamp_ns is nonzero, events pushed on this thread are stamped
+   with it (on the SDL_GetTicksNS() clock) instead of the time they're queued,
+   if SDL_HINT_EVENT_TIMESTAMPS_NS asked for nanosecond timestamps.
+   Input readers point this at the time of the input they're handling, and
+   set it back to NULL when they're done. */
+extern void SDL_SetEventTimestampSource(const Uint64 *timestamp_ns);
+
 /* vi: set ts=4 sw=4 expandtab: */
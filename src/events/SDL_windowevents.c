@@ -110,6 +110,9 @@ SDL_SendWindowEvent(SDL_Window * window, Uint8 windowevent, int data1,
         window->flags |= SDL_WINDOW_HIDDEN;
         SDL_OnWindowHidden(window);
         break;
+    case SDL_WINDOWEVENT_EXPOSED:
+        SDL_OnWindowExposed(window);
+        break;
     case SDL_WINDOWEVENT_MOVED:
         if (SDL_WINDOWPOS_ISUNDEFINED(data1) ||
             SDL_WINDOWPOS_ISUNDEFINED(data2)) {
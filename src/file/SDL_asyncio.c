@@ -0,0 +1,422 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Asynchronous reads and writes on SDL_RWops, run on a pool of worker threads */
+
+#include "SDL_rwops.h"
+#include "SDL_thread.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_timer.h"
+
+#define SDL_ASYNCIO_MAX_THREADS 16
+
+typedef struct SDL_AsyncIORequest
+{
+    SDL_AsyncIOOutcome outcome;
+    char *file;         /* for SDL_ASYNCIO_LOADFILE */
+    struct SDL_AsyncIORequest *next;
+} SDL_AsyncIORequest;
+
+struct SDL_AsyncIOQueue
+{
+    SDL_mutex *lock;
+    SDL_cond *work_cond;    /* signaled when a request is queued */
+    SDL_cond *done_cond;    /* signaled when a request completes */
+    SDL_bool shutting_down;
+
+    /* Requests waiting for a worker, in submission order */
+    SDL_AsyncIORequest *pending;
+    SDL_AsyncIORequest *pending_tail;
+
+    /* Requests waiting to be collected, in completion order */
+    SDL_AsyncIORequest *completed;
+    SDL_AsyncIORequest *completed_tail;
+
+    /* Streams aren't thread-safe, so only one request per stream runs at once */
+    SDL_RWops *busy[SDL_ASYNCIO_MAX_THREADS];
+
+    int num_threads;
+    SDL_Thread *threads[SDL_ASYNCIO_MAX_THREADS];
+};
+
+static void
+SDL_RunAsyncIORequest(SDL_AsyncIORequest *request)
+{
+    SDL_AsyncIOOutcome *outcome = &request->outcome;
+    SDL_RWops *rwops = outcome->rwops;
+    size_t total = 0;
+
+    if (outcome->type == SDL_ASYNCIO_LOADFILE) {
+        outcome->buffer = SDL_LoadFile(request->file, &outcome->bytes_transferred);
+        outcome->bytes_requested = outcome->bytes_transferred;
+        outcome->result = outcome->buffer ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+        return;
+    }
+
+    if (outcome->offset >= 0 && SDL_RWseek(rwops, outcome->offset, RW_SEEK_SET) < 0) {
+        outcome->result = SDL_ASYNCIO_FAILURE;
+        return;
+    }
+
+    /* Short reads and writes are retried until the stream makes no progress */
+    while (total < outcome->bytes_requested) {
+        Uint8 *ptr = (Uint8 *) outcome->buffer + total;
+        const size_t remaining = outcome->bytes_requested - total;
+        size_t amount;
+
+        if (outcome->type == SDL_ASYNCIO_READ) {
+            amount = SDL_RWread(rwops, ptr, 1, remaining);
+        } else {
+            amount = SDL_RWwrite(rwops, ptr, 1, remaining);
+        }
+        if (amount == 0) {
+            break;
+        }
+        total += amount;
+    }
+
+    outcome->bytes_transferred = total;
+    if (outcome->type == SDL_ASYNCIO_WRITE && total < outcome->bytes_requested) {
+        outcome->result = SDL_ASYNCIO_FAILURE;
+    } else {
+        /* a short read just means the end of the stream */
+        outcome->result = SDL_ASYNCIO_COMPLETE;
+    }
+}
+
+static SDL_bool
+SDL_IsAsyncIOStreamBusy(SDL_AsyncIOQueue *queue, SDL_RWops *rwops)
+{
+    int i;
+    if (!rwops) {
+        return SDL_FALSE;
+    }
+    for (i = 0; i < SDL_ASYNCIO_MAX_THREADS; i++) {
+        if (queue->busy[i] == rwops) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+/* Call with the queue locked. Takes the oldest request whose stream is idle. */
+static SDL_AsyncIORequest *
+SDL_TakeAsyncIORequest(SDL_AsyncIOQueue *queue)
+{
+    SDL_AsyncIORequest *prev = NULL;
+    SDL_AsyncIORequest *request;
+
+    for (request = queue->pending; request; prev = request, request = request->next) {
+        if (!SDL_IsAsyncIOStreamBusy(queue, request->outcome.rwops)) {
+            if (prev) {
+                prev->next = request->next;
+            } else {
+                queue->pending = request->next;
+            }
+            if (queue->pending_tail == request) {
+                queue->pending_tail = prev;
+            }
+            request->next = NULL;
+            return request;
+        }
+    }
+    return NULL;
+}
+
+static int SDLCALL
+SDL_AsyncIOThread(void *data)
+{
+    SDL_AsyncIOQueue *queue = (SDL_AsyncIOQueue *) data;
+    SDL_AsyncIORequest *request;
+    SDL_RWops **busy = NULL;
+    int i;
+
+    SDL_LockMutex(queue->lock);
+    while (!queue->shutting_down) {
+        request = SDL_TakeAsyncIORequest(queue);
+        if (!request) {
+            SDL_CondWait(queue->work_cond, queue->lock);
+            continue;
+        }
+
+        /* At most one slot per worker is ever in use, so one is free */
+        if (request->outcome.rwops) {
+            for (i = 0; queue->busy[i]; i++) {
+            }
+            busy = &queue->busy[i];
+            *busy = request->outcome.rwops;
+        }
+        SDL_UnlockMutex(queue->lock);
+
+        SDL_RunAsyncIORequest(request);
+
+        SDL_LockMutex(queue->lock);
+        if (busy) {
+            *busy = NULL;
+            busy = NULL;
+        }
+        if (queue->completed_tail) {
+            queue->completed_tail->next = request;
+        } else {
+            queue->completed = request;
+        }
+        queue->completed_tail = request;
+        SDL_CondBroadcast(queue->done_cond);
+
+        /* Requests held back for this stream can run now */
+        if (queue->pending && request->outcome.rwops) {
+            SDL_CondSignal(queue->work_cond);
+        }
+    }
+    SDL_UnlockMutex(queue->lock);
+    return 0;
+}
+
+SDL_AsyncIOQueue *
+SDL_CreateAsyncIOQueue(int num_threads)
+{
+    SDL_AsyncIOQueue *queue;
+    int i;
+
+    if (num_threads <= 0) {
+        num_threads = SDL_GetCPUCount();
+    }
+    num_threads = SDL_max(1, SDL_min(num_threads, SDL_ASYNCIO_MAX_THREADS));
+
+    queue = (SDL_AsyncIOQueue *) SDL_calloc(1, sizeof (*queue));
+    if (!queue) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    queue->lock = SDL_CreateMutex();
+    queue->work_cond = SDL_CreateCond();
+    queue->done_cond = SDL_CreateCond();
+    if (!queue->lock || !queue->work_cond || !queue->done_cond) {
+        SDL_DestroyAsyncIOQueue(queue);
+        return NULL;
+    }
+
+    for (i = 0; i < num_threads; i++) {
+        char name[32];
+        SDL_snprintf(name, sizeof (name), "SDLAsyncIO%d", i);
+        queue->threads[i] = SDL_CreateThread(SDL_AsyncIOThread, name, queue);
+        if (!queue->threads[i]) {
+            break;
+        }
+    }
+    queue->num_threads = i;
+
+    if (queue->num_threads == 0) {
+        SDL_DestroyAsyncIOQueue(queue);
+        return NULL;
+    }
+    return queue;
+}
+
+static int
+SDL_QueueAsyncIORequest(SDL_AsyncIOQueue *queue, SDL_AsyncIOType type, SDL_RWops *rwops,
+                        void *buffer, Sint64 offset, size_t size, const char *file, void *userdata)
+{
+    SDL_AsyncIORequest *request;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    request = (SDL_AsyncIORequest *) SDL_calloc(1, sizeof (*request));
+    if (!request) {
+        return SDL_OutOfMemory();
+    }
+    if (file) {
+        request->file = SDL_strdup(file);
+        if (!request->file) {
+            SDL_free(request);
+            return SDL_OutOfMemory();
+        }
+    }
+    request->outcome.type = type;
+    request->outcome.rwops = rwops;
+    request->outcome.buffer = buffer;
+    request->outcome.offset = offset;
+    request->outcome.bytes_requested = size;
+    request->outcome.userdata = userdata;
+
+    SDL_LockMutex(queue->lock);
+    if (queue->pending_tail) {
+        queue->pending_tail->next = request;
+    } else {
+        queue->pending = request;
+    }
+    queue->pending_tail = request;
+    SDL_CondSignal(queue->work_cond);
+    SDL_UnlockMutex(queue->lock);
+    return 0;
+}
+
+int
+SDL_AsyncRead(SDL_AsyncIOQueue *queue, SDL_RWops *rwops, void *ptr, Sint64 offset, size_t size, void *userdata)
+{
+    if (!rwops) {
+        return SDL_InvalidParamError("rwops");
+    }
+    if (!ptr && size) {
+        return SDL_InvalidParamError("ptr");
+    }
+    return SDL_QueueAsyncIORequest(queue, SDL_ASYNCIO_READ, rwops, ptr, offset, size, NULL, userdata);
+}
+
+int
+SDL_AsyncWrite(SDL_AsyncIOQueue *queue, SDL_RWops *rwops, const void *ptr, Sint64 offset, size_t size, void *userdata)
+{
+    if (!rwops) {
+        return SDL_InvalidParamError("rwops");
+    }
+    if (!ptr && size) {
+        return SDL_InvalidParamError("ptr");
+    }
+    return SDL_QueueAsyncIORequest(queue, SDL_ASYNCIO_WRITE, rwops, (void *) ptr, offset, size, NULL, userdata);
+}
+
+int
+SDL_AsyncLoadFile(SDL_AsyncIOQueue *queue, const char *file, void *userdata)
+{
+    if (!file || !*file) {
+        return SDL_InvalidParamError("file");
+    }
+    return SDL_QueueAsyncIORequest(queue, SDL_ASYNCIO_LOADFILE, NULL, NULL, -1, 0, file, userdata);
+}
+
+/* Call with the queue locked. */
+static SDL_bool
+SDL_PopAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
+{
+    SDL_AsyncIORequest *request = queue->completed;
+
+    if (!request) {
+        return SDL_FALSE;
+    }
+    queue->completed = request->next;
+    if (!queue->completed) {
+        queue->completed_tail = NULL;
+    }
+
+    if (outcome) {
+        *outcome = request->outcome;
+    } else if (request->outcome.type == SDL_ASYNCIO_LOADFILE) {
+        SDL_free(request->outcome.buffer);
+    }
+    SDL_free(request->file);
+    SDL_free(request);
+    return SDL_TRUE;
+}
+
+int
+SDL_GetAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
+{
+    SDL_bool retval;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    SDL_LockMutex(queue->lock);
+    retval = SDL_PopAsyncIOResult(queue, outcome);
+    SDL_UnlockMutex(queue->lock);
+    return retval ? 1 : 0;
+}
+
+int
+SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome, Sint32 timeout)
+{
+    SDL_bool retval;
+    Uint32 start;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    start = SDL_GetTicks();
+    SDL_LockMutex(queue->lock);
+    for (;;) {
+        retval = SDL_PopAsyncIOResult(queue, outcome);
+        if (retval || timeout == 0) {
+            break;
+        }
+        if (timeout < 0) {
+            SDL_CondWait(queue->done_cond, queue->lock);
+        } else {
+            const Uint32 elapsed = SDL_GetTicks() - start;
+            if (elapsed >= (Uint32) timeout) {
+                break;
+            }
+            SDL_CondWaitTimeout(queue->done_cond, queue->lock, (Uint32) timeout - elapsed);
+        }
+    }
+    SDL_UnlockMutex(queue->lock);
+    return retval ? 1 : 0;
+}
+
+void
+SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
+{
+    SDL_AsyncIORequest *request;
+    int i;
+
+    if (!queue) {
+        return;
+    }
+
+    /* Requests that haven't started are dropped; running ones finish first */
+    if (queue->lock) {
+        SDL_LockMutex(queue->lock);
+        queue->shutting_down = SDL_TRUE;
+        SDL_CondBroadcast(queue->work_cond);
+        SDL_UnlockMutex(queue->lock);
+    }
+    for (i = 0; i < queue->num_threads; i++) {
+        SDL_WaitThread(queue->threads[i], NULL);
+    }
+
+    while (queue->pending) {
+        request = queue->pending;
+        queue->pending = request->next;
+        SDL_free(request->file);
+        SDL_free(request);
+    }
+    while (SDL_PopAsyncIOResult(queue, NULL)) {
+        /* frees any buffers nobody collected */
+    }
+
+    if (queue->done_cond) {
+        SDL_DestroyCond(queue->done_cond);
+    }
+    if (queue->work_cond) {
+        SDL_DestroyCond(queue->work_cond);
+    }
+    if (queue->lock) {
+        SDL_DestroyMutex(queue->lock);
+    }
+    SDL_free(queue);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -60,6 +60,19 @@
 #include "nacl_io/nacl_io.h"
 #endif
 
+#if defined(__WIN32__)
+#define HAVE_MAPPED_FILES 1
+#elif defined(__unix__) || defined(__APPLE__) || defined(__HAIKU__)
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#define HAVE_MAPPED_FILES 1
+#endif
+
 #ifdef __WIN32__
 
 /* Functions to read/write Win32 API file pointers */
@@ -504,6 +517,113 @@ mem_close(SDL_RWops * context)
     return 0;
 }
 
+#ifdef HAVE_MAPPED_FILES
+
+/* Functions to read memory-mapped files; these use the mem fields, and
+   the mapping covers base through stop (base is NULL for an empty file) */
+
+static int
+mapped_unmap(Uint8 *base, size_t size)
+{
+    if (!base) {
+        return 0;
+    }
+#ifdef __WIN32__
+    if (!UnmapViewOfFile(base)) {
+        return WIN_SetError("Couldn't unmap file");
+    }
+#else
+    if (munmap(base, size) < 0) {
+        return SDL_SetError("Couldn't unmap file: %s", strerror(errno));
+    }
+#endif
+    return 0;
+}
+
+static int SDLCALL
+mapped_close(SDL_RWops * context)
+{
+    int status = 0;
+    if (context) {
+        status = mapped_unmap(context->hidden.mem.base,
+                              (size_t) (context->hidden.mem.stop - context->hidden.mem.base));
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+
+static int
+mapped_open(const char *file, void **base, size_t *size)
+{
+#ifdef __WIN32__
+    UINT old_error_mode;
+    HANDLE h, mapping;
+    LARGE_INTEGER filesize;
+
+    /* Do not open a dialog box if failure */
+    old_error_mode = SetErrorMode(SEM_NOOPENFILEERRORBOX | SEM_FAILCRITICALERRORS);
+    {
+        LPTSTR tstr = WIN_UTF8ToString(file);
+        h = CreateFile(tstr, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                       FILE_ATTRIBUTE_NORMAL, NULL);
+        SDL_free(tstr);
+    }
+    SetErrorMode(old_error_mode);
+
+    if (h == INVALID_HANDLE_VALUE) {
+        return SDL_SetError("Couldn't open %s", file);
+    }
+    if (!GetFileSizeEx(h, &filesize) || (Uint64) filesize.QuadPart > (Uint64) (~(size_t) 0)) {
+        CloseHandle(h);
+        return SDL_SetError("Couldn't get the size of %s", file);
+    }
+    *size = (size_t) filesize.QuadPart;
+    if (*size == 0) {
+        CloseHandle(h);
+        return 0;  /* empty files can't be mapped, but are fine to read. */
+    }
+
+    /* The view keeps the file mapped after both handles are closed */
+    mapping = CreateFileMapping(h, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping) {
+        *base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+    }
+    CloseHandle(h);
+    if (!*base) {
+        return WIN_SetError("Couldn't map file");
+    }
+#else
+    struct stat st;
+    int fd;
+
+    fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        return SDL_SetError("Couldn't open %s: %s", file, strerror(errno));
+    }
+    if (fstat(fd, &st) < 0 || (Uint64) st.st_size > (Uint64) (~(size_t) 0)) {
+        close(fd);
+        return SDL_SetError("Couldn't get the size of %s", file);
+    }
+    *size = (size_t) st.st_size;
+    if (*size == 0) {
+        close(fd);
+        return 0;  /* empty files can't be mapped, but are fine to read. */
+    }
+
+    /* The mapping stays valid after the descriptor is closed */
+    *base = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (*base == MAP_FAILED) {
+        *base = NULL;
+        return SDL_SetError("Couldn't map %s: %s", file, strerror(errno));
+    }
+#endif
+    return 0;
+}
+
+#endif /* HAVE_MAPPED_FILES */
+
 
 /* Functions to create SDL_RWops structures from various data sources */
 
@@ -678,6 +798,104 @@ SDL_RWFromConstMem(const void *mem, int size)
     return rwops;
 }
 
+SDL_RWops *
+SDL_RWFromFileMapped(const char *file)
+{
+#ifdef HAVE_MAPPED_FILES
+    SDL_RWops *rwops = NULL;
+    void *base = NULL;
+    size_t size = 0;
+
+    if (!file || !*file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+
+    if (mapped_open(file, &base, &size) < 0) {
+        return NULL;
+    }
+
+    rwops = SDL_AllocRW();
+    if (rwops != NULL) {
+        rwops->size = mem_size;
+        rwops->seek = mem_seek;
+        rwops->read = mem_read;
+        rwops->write = mem_writeconst;
+        rwops->close = mapped_close;
+        rwops->hidden.mem.base = (Uint8 *) base;
+        rwops->hidden.mem.here = rwops->hidden.mem.base;
+        rwops->hidden.mem.stop = rwops->hidden.mem.base + size;
+        rwops->type = SDL_RWOPS_MAPPED;
+    } else {
+        mapped_unmap((Uint8 *) base, size);
+    }
+    return rwops;
+#else
+    SDL_Unsupported();
+    return NULL;
+#endif
+}
+
+const void *
+SDL_RWGetMappedData(SDL_RWops * context, size_t *size)
+{
+    if (!context || context->type != SDL_RWOPS_MAPPED) {
+        SDL_SetError("Not a memory-mapped SDL_RWops");
+        return NULL;
+    }
+    if (size) {
+        *size = (size_t) (context->hidden.mem.stop - context->hidden.mem.base);
+    }
+    return context->hidden.mem.base;
+}
+
+int
+SDL_RWAdviseMapped(SDL_RWops * context, Sint64 offset, Sint64 length, SDL_RWMapAdvice advice)
+{
+    Sint64 size;
+
+    if (!context || context->type != SDL_RWOPS_MAPPED) {
+        return SDL_SetError("Not a memory-mapped SDL_RWops");
+    }
+
+    size = (Sint64) (context->hidden.mem.stop - context->hidden.mem.base);
+    if (offset < 0 || offset > size) {
+        return SDL_InvalidParamError("offset");
+    }
+    if (length <= 0 || length > size - offset) {
+        length = size - offset;
+    }
+    if (length == 0) {
+        return 0;
+    }
+
+#if defined(HAVE_MAPPED_FILES) && !defined(__WIN32__) && defined(POSIX_MADV_NORMAL)
+    {
+        /* The range has to start on a page boundary */
+        const Sint64 pagesize = (Sint64) sysconf(_SC_PAGESIZE);
+        const Sint64 start = (pagesize > 0) ? (offset - (offset % pagesize)) : 0;
+        int flag;
+
+        switch (advice) {
+        case SDL_RWMAP_ADVICE_NORMAL: flag = POSIX_MADV_NORMAL; break;
+        case SDL_RWMAP_ADVICE_SEQUENTIAL: flag = POSIX_MADV_SEQUENTIAL; break;
+        case SDL_RWMAP_ADVICE_RANDOM: flag = POSIX_MADV_RANDOM; break;
+        case SDL_RWMAP_ADVICE_WILLNEED: flag = POSIX_MADV_WILLNEED; break;
+        case SDL_RWMAP_ADVICE_DONTNEED: flag = POSIX_MADV_DONTNEED; break;
+        default: return SDL_InvalidParamError("advice");
+        }
+
+        if (posix_madvise(context->hidden.mem.base + start, (size_t) (offset + length - start), flag) != 0) {
+            return SDL_SetError("posix_madvise() failed");
+        }
+    }
+#else
+    /* Advice is only a hint, so it's fine to ignore it here. */
+    (void) advice;
+#endif
+    return 0;
+}
+
 SDL_RWops *
 SDL_AllocRW(void)
 {
@@ -712,6 +930,25 @@ SDL_LoadFile_RW(SDL_RWops * src, size_t *datasize, int freesrc)
         return NULL;
     }
 
+    /* Mapped files are already in memory, so this is a single copy */
+    if (src->type == SDL_RWOPS_MAPPED) {
+        size_total = (size_t) (src->hidden.mem.stop - src->hidden.mem.here);
+        data = SDL_malloc(size_total + 1);
+        if (!data) {
+            SDL_OutOfMemory();
+            goto done;
+        }
+        if (size_total) {
+            SDL_memcpy(data, src->hidden.mem.here, size_total);
+            src->hidden.mem.here += size_total;
+        }
+        if (datasize) {
+            *datasize = size_total;
+        }
+        ((char *)data)[size_total] = '\0';
+        goto done;
+    }
+
     size = SDL_RWsize(src);
     if (size < 0) {
         size = FILE_CHUNK_SIZE;
@@ -78,6 +78,27 @@ typedef struct
 
 } SDL_ExtendedGameControllerBind;
 
+/* A binding compiled for the joystick input that triggers it */
+typedef struct
+{
+    SDL_ExtendedGameControllerBind *bind;
+
+    /* Axis input: the values this binding covers, low <= high */
+    int input_low;
+    int input_high;
+
+    /* Axis to axis: output_min + (value - input_min) / input_range * output_range */
+    SDL_bool scaled;
+    int input_min;
+    int input_range;
+    int output_min;
+    int output_range;
+
+    /* Axis to button: pressed at or past the threshold */
+    int threshold;
+    SDL_bool inverted;
+} SDL_CompiledGameControllerBind;
+
 /* our hard coded list of mapping support */
 typedef enum
 {
@@ -90,16 +111,25 @@ typedef struct _ControllerMapping_t
 {
     SDL_JoystickGUID guid;
     char *name;
-    char *mapping;
+    char *mapping;          /* points into the same allocation as name */
     SDL_ControllerMappingPriority priority;
     struct _ControllerMapping_t *next;
+    struct _ControllerMapping_t *next_hash;     /* next mapping in the same GUID bucket */
 } ControllerMapping_t;
 
 static SDL_JoystickGUID s_zeroGUID;
 static ControllerMapping_t *s_pSupportedControllers = NULL;
+static ControllerMapping_t *s_pSupportedControllersTail = NULL;
 static ControllerMapping_t *s_pXInputMapping = NULL;
 static ControllerMapping_t *s_pEmscriptenMapping = NULL;
 
+/* Mappings are looked up by GUID on every hotplug and SDL_IsGameController()
+   call, and once per line when loading a database, so they're hashed.
+   The list above keeps them in the order they were added. */
+static ControllerMapping_t **s_pMappingBuckets = NULL;
+static int s_nMappingBuckets = 0;   /* always a power of two */
+static int s_nMappings = 0;
+
 /* The SDL game controller structure */
 struct _SDL_GameController
 {
@@ -111,6 +141,14 @@ struct _SDL_GameController
     int num_bindings;
     SDL_ExtendedGameControllerBind *bindings;
     SDL_ExtendedGameControllerBind **last_match_axis;
+
+    /* The bindings compiled into tables indexed by the joystick input that
+       triggers them, so handling a joystick event doesn't walk all of them.
+       Each offsets array has one more entry than there are inputs. */
+    SDL_CompiledGameControllerBind *compiled_bindings;
+    int *axis_bindings;
+    int *button_bindings;
+    int *hat_bindings;
     Uint8 *last_hat_mask;
 
     struct _SDL_GameController *next; /* pointer to next game controller we have allocated */
@@ -243,70 +281,61 @@ static void HandleJoystickAxis(SDL_GameController *gamecontroller, int axis, int
 {
     int i;
     SDL_ExtendedGameControllerBind *last_match = gamecontroller->last_match_axis[axis];
-    SDL_ExtendedGameControllerBind *match = NULL;
+    SDL_CompiledGameControllerBind *match = NULL;
 
-    for (i = 0; i < gamecontroller->num_bindings; ++i) {
-        SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
-        if (binding->inputType == SDL_CONTROLLER_BINDTYPE_AXIS &&
-            axis == binding->input.axis.axis) {
-            if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
-                if (value >= binding->input.axis.axis_min &&
-                    value <= binding->input.axis.axis_max) {
-                    match = binding;
-                    break;
-                }
-            } else {
-                if (value >= binding->input.axis.axis_max &&
-                    value <= binding->input.axis.axis_min) {
-                    match = binding;
-                    break;
-                }
-            }
+    if (!gamecontroller->compiled_bindings) {
+        return;
+    }
+
+    for (i = gamecontroller->axis_bindings[axis]; i < gamecontroller->axis_bindings[axis + 1]; ++i) {
+        SDL_CompiledGameControllerBind *binding = &gamecontroller->compiled_bindings[i];
+        if (value >= binding->input_low && value <= binding->input_high) {
+            match = binding;
+            break;
         }
     }
 
-    if (last_match && (!match || !HasSameOutput(last_match, match))) {
+    if (last_match && (!match || !HasSameOutput(last_match, match->bind))) {
         /* Clear the last input that this axis generated */
         ResetOutput(gamecontroller, last_match);
     }
 
     if (match) {
-        if (match->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
-            if (match->input.axis.axis_min != match->output.axis.axis_min || match->input.axis.axis_max != match->output.axis.axis_max) {
-                float normalized_value = (float)(value - match->input.axis.axis_min) / (match->input.axis.axis_max - match->input.axis.axis_min);
-                value = match->output.axis.axis_min + (int)(normalized_value * (match->output.axis.axis_max - match->output.axis.axis_min));
+        if (match->bind->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
+            if (match->scaled) {
+                float normalized_value = (float)(value - match->input_min) / match->input_range;
+                value = match->output_min + (int)(normalized_value * match->output_range);
             }
-            SDL_PrivateGameControllerAxis(gamecontroller, match->output.axis.axis, (Sint16)value);
+            SDL_PrivateGameControllerAxis(gamecontroller, match->bind->output.axis.axis, (Sint16)value);
         } else {
             Uint8 state;
-            int threshold = match->input.axis.axis_min + (match->input.axis.axis_max - match->input.axis.axis_min) / 2;
-            if (match->input.axis.axis_max < match->input.axis.axis_min) {
-                state = (value <= threshold) ? SDL_PRESSED : SDL_RELEASED;
+            if (match->inverted) {
+                state = (value <= match->threshold) ? SDL_PRESSED : SDL_RELEASED;
             } else {
-                state = (value >= threshold) ? SDL_PRESSED : SDL_RELEASED;
+                state = (value >= match->threshold) ? SDL_PRESSED : SDL_RELEASED;
             }
-            SDL_PrivateGameControllerButton(gamecontroller, match->output.button, state);
+            SDL_PrivateGameControllerButton(gamecontroller, match->bind->output.button, state);
         }
     }
-    gamecontroller->last_match_axis[axis] = match;
+    gamecontroller->last_match_axis[axis] = match ? match->bind : NULL;
 }
 
 static void HandleJoystickButton(SDL_GameController *gamecontroller, int button, Uint8 state)
 {
-    int i;
+    SDL_ExtendedGameControllerBind *binding;
 
-    for (i = 0; i < gamecontroller->num_bindings; ++i) {
-        SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
-        if (binding->inputType == SDL_CONTROLLER_BINDTYPE_BUTTON &&
-            button == binding->input.button) {
-            if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
-                int value = state ? binding->output.axis.axis_max : binding->output.axis.axis_min;
-                SDL_PrivateGameControllerAxis(gamecontroller, binding->output.axis.axis, (Sint16)value);
-            } else {
-                SDL_PrivateGameControllerButton(gamecontroller, binding->output.button, state);
-            }
-            break;
-        }
+    /* Only the first binding for a button is used */
+    if (!gamecontroller->compiled_bindings ||
+        gamecontroller->button_bindings[button] == gamecontroller->button_bindings[button + 1]) {
+        return;
+    }
+
+    binding = gamecontroller->compiled_bindings[gamecontroller->button_bindings[button]].bind;
+    if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
+        int value = state ? binding->output.axis.axis_max : binding->output.axis.axis_min;
+        SDL_PrivateGameControllerAxis(gamecontroller, binding->output.axis.axis, (Sint16)value);
+    } else {
+        SDL_PrivateGameControllerButton(gamecontroller, binding->output.button, state);
     }
 }
 
@@ -316,19 +345,21 @@ static void HandleJoystickHat(SDL_GameController *gamecontroller, int hat, Uint8
     Uint8 last_mask = gamecontroller->last_hat_mask[hat];
     Uint8 changed_mask = (last_mask ^ value);
 
-    for (i = 0; i < gamecontroller->num_bindings; ++i) {
-        SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
-        if (binding->inputType == SDL_CONTROLLER_BINDTYPE_HAT && hat == binding->input.hat.hat) {
-            if ((changed_mask & binding->input.hat.hat_mask) != 0) {
-                if (value & binding->input.hat.hat_mask) {
-                    if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
-                        SDL_PrivateGameControllerAxis(gamecontroller, binding->output.axis.axis, (Sint16)binding->output.axis.axis_max);
-                    } else {
-                        SDL_PrivateGameControllerButton(gamecontroller, binding->output.button, SDL_PRESSED);
-                    }
+    if (!gamecontroller->compiled_bindings) {
+        return;
+    }
+
+    for (i = gamecontroller->hat_bindings[hat]; i < gamecontroller->hat_bindings[hat + 1]; ++i) {
+        SDL_ExtendedGameControllerBind *binding = gamecontroller->compiled_bindings[i].bind;
+        if ((changed_mask & binding->input.hat.hat_mask) != 0) {
+            if (value & binding->input.hat.hat_mask) {
+                if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
+                    SDL_PrivateGameControllerAxis(gamecontroller, binding->output.axis.axis, (Sint16)binding->output.axis.axis_max);
                 } else {
-                    ResetOutput(gamecontroller, binding);
+                    SDL_PrivateGameControllerButton(gamecontroller, binding->output.button, SDL_PRESSED);
                 }
+            } else {
+                ResetOutput(gamecontroller, binding);
             }
         }
     }
@@ -414,20 +445,82 @@ static int SDLCALL SDL_GameControllerEventWatcher(void *userdata, SDL_Event * ev
 }
 
 /*
- * Helper function to scan the mappings database for a controller with the specified GUID
+ * FNV-1a over the GUID bytes
+ */
+static Uint32 SDL_PrivateHashControllerGUID(const SDL_JoystickGUID *guid)
+{
+    Uint32 hash = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < sizeof(guid->data); ++i) {
+        hash ^= guid->data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/*
+ * Helper function to find the mapping for a controller with the specified GUID
  */
 static ControllerMapping_t *SDL_PrivateGetControllerMappingForGUID(SDL_JoystickGUID *guid)
 {
-    ControllerMapping_t *pSupportedController = s_pSupportedControllers;
+    ControllerMapping_t *pSupportedController;
+
+    if (!s_pMappingBuckets) {
+        return NULL;
+    }
+
+    pSupportedController = s_pMappingBuckets[SDL_PrivateHashControllerGUID(guid) & (s_nMappingBuckets - 1)];
     while (pSupportedController) {
         if (SDL_memcmp(guid, &pSupportedController->guid, sizeof(*guid)) == 0) {
             return pSupportedController;
         }
-        pSupportedController = pSupportedController->next;
+        pSupportedController = pSupportedController->next_hash;
     }
     return NULL;
 }
 
+/*
+ * Helper function to add a new mapping to the end of the list and the hash
+ */
+static int SDL_PrivateInsertControllerMapping(ControllerMapping_t *pControllerMapping)
+{
+    Uint32 bucket;
+
+    /* Keep about one mapping per bucket. If growing fails, the chains just get longer. */
+    if (s_nMappings >= s_nMappingBuckets) {
+        const int nBuckets = s_nMappingBuckets ? (s_nMappingBuckets * 2) : 64;
+        ControllerMapping_t **pBuckets = (ControllerMapping_t **)SDL_calloc(nBuckets, sizeof(*pBuckets));
+        if (pBuckets) {
+            ControllerMapping_t *pCurrMapping;
+            for (pCurrMapping = s_pSupportedControllers; pCurrMapping; pCurrMapping = pCurrMapping->next) {
+                bucket = SDL_PrivateHashControllerGUID(&pCurrMapping->guid) & (nBuckets - 1);
+                pCurrMapping->next_hash = pBuckets[bucket];
+                pBuckets[bucket] = pCurrMapping;
+            }
+            SDL_free(s_pMappingBuckets);
+            s_pMappingBuckets = pBuckets;
+            s_nMappingBuckets = nBuckets;
+        } else if (!s_pMappingBuckets) {
+            return SDL_OutOfMemory();
+        }
+    }
+
+    bucket = SDL_PrivateHashControllerGUID(&pControllerMapping->guid) & (s_nMappingBuckets - 1);
+    pControllerMapping->next_hash = s_pMappingBuckets[bucket];
+    s_pMappingBuckets[bucket] = pControllerMapping;
+    ++s_nMappings;
+
+    pControllerMapping->next = NULL;
+    if (s_pSupportedControllersTail) {
+        s_pSupportedControllersTail->next = pControllerMapping;
+    } else {
+        s_pSupportedControllers = pControllerMapping;
+    }
+    s_pSupportedControllersTail = pControllerMapping;
+    return 0;
+}
+
 static const char* map_StringForControllerAxis[] = {
     "leftx",
     "lefty",
@@ -662,6 +755,97 @@ SDL_PrivateGameControllerParseControllerConfigString(SDL_GameController *gamecon
 
 }
 
+/*
+ * Precompute what handling an event for this binding needs
+ */
+static void SDL_PrivateCompileBinding(SDL_CompiledGameControllerBind *compiled, SDL_ExtendedGameControllerBind *binding)
+{
+    SDL_zerop(compiled);
+    compiled->bind = binding;
+
+    if (binding->inputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
+        const int axis_min = binding->input.axis.axis_min;
+        const int axis_max = binding->input.axis.axis_max;
+
+        compiled->input_low = SDL_min(axis_min, axis_max);
+        compiled->input_high = SDL_max(axis_min, axis_max);
+
+        if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
+            compiled->scaled = (axis_min != binding->output.axis.axis_min || axis_max != binding->output.axis.axis_max) ? SDL_TRUE : SDL_FALSE;
+            compiled->input_min = axis_min;
+            compiled->input_range = axis_max - axis_min;
+            compiled->output_min = binding->output.axis.axis_min;
+            compiled->output_range = binding->output.axis.axis_max - binding->output.axis.axis_min;
+        }
+
+        compiled->threshold = axis_min + (axis_max - axis_min) / 2;
+        compiled->inverted = (axis_max < axis_min) ? SDL_TRUE : SDL_FALSE;
+    }
+}
+
+/*
+ * Build the tables of bindings by joystick input, in mapping order
+ */
+static void SDL_PrivateCompileBindings(SDL_GameController *gamecontroller)
+{
+    const int naxes = gamecontroller->joystick->naxes;
+    const int nbuttons = gamecontroller->joystick->nbuttons;
+    const int nhats = gamecontroller->joystick->nhats;
+    SDL_CompiledGameControllerBind *compiled;
+    int *offsets;
+    int i, input, count = 0;
+
+    SDL_free(gamecontroller->compiled_bindings);
+    gamecontroller->compiled_bindings = NULL;
+
+    compiled = (SDL_CompiledGameControllerBind *)SDL_malloc(gamecontroller->num_bindings * sizeof(*compiled) +
+                                                            (naxes + 1 + nbuttons + 1 + nhats + 1) * sizeof(*offsets));
+    if (!compiled) {
+        SDL_OutOfMemory();
+        return;
+    }
+    offsets = (int *)&compiled[gamecontroller->num_bindings];
+
+    /* Bindings for inputs the joystick doesn't have are never triggered */
+    gamecontroller->axis_bindings = offsets;
+    for (input = 0; input < naxes; ++input) {
+        gamecontroller->axis_bindings[input] = count;
+        for (i = 0; i < gamecontroller->num_bindings; ++i) {
+            SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
+            if (binding->inputType == SDL_CONTROLLER_BINDTYPE_AXIS && binding->input.axis.axis == input) {
+                SDL_PrivateCompileBinding(&compiled[count++], binding);
+            }
+        }
+    }
+    gamecontroller->axis_bindings[naxes] = count;
+
+    gamecontroller->button_bindings = gamecontroller->axis_bindings + naxes + 1;
+    for (input = 0; input < nbuttons; ++input) {
+        gamecontroller->button_bindings[input] = count;
+        for (i = 0; i < gamecontroller->num_bindings; ++i) {
+            SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
+            if (binding->inputType == SDL_CONTROLLER_BINDTYPE_BUTTON && binding->input.button == input) {
+                SDL_PrivateCompileBinding(&compiled[count++], binding);
+            }
+        }
+    }
+    gamecontroller->button_bindings[nbuttons] = count;
+
+    gamecontroller->hat_bindings = gamecontroller->button_bindings + nbuttons + 1;
+    for (input = 0; input < nhats; ++input) {
+        gamecontroller->hat_bindings[input] = count;
+        for (i = 0; i < gamecontroller->num_bindings; ++i) {
+            SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
+            if (binding->inputType == SDL_CONTROLLER_BINDTYPE_HAT && binding->input.hat.hat == input) {
+                SDL_PrivateCompileBinding(&compiled[count++], binding);
+            }
+        }
+    }
+    gamecontroller->hat_bindings[nhats] = count;
+
+    gamecontroller->compiled_bindings = compiled;
+}
+
 /*
  * Make a new button mapping struct
  */
@@ -689,23 +873,22 @@ static void SDL_PrivateLoadButtonMapping(SDL_GameController *gamecontroller, SDL
             }
         }
     }
+
+    /* The bindings may have moved, so this is redone on every refresh */
+    SDL_PrivateCompileBindings(gamecontroller);
 }
 
 
 /*
- * grab the guid string from a mapping string
+ * grab the guid string from a mapping string, truncated to fit
  */
-static char *SDL_PrivateGetControllerGUIDFromMappingString(const char *pMapping)
+static SDL_bool SDL_PrivateGetControllerGUIDFromMappingString(const char *pMapping, char *pchGUID, size_t size)
 {
     const char *pFirstComma = SDL_strchr(pMapping, ',');
     if (pFirstComma) {
-        char *pchGUID = SDL_malloc(pFirstComma - pMapping + 1);
-        if (!pchGUID) {
-            SDL_OutOfMemory();
-            return NULL;
-        }
-        SDL_memcpy(pchGUID, pMapping, pFirstComma - pMapping);
-        pchGUID[pFirstComma - pMapping] = '\0';
+        const size_t len = SDL_min((size_t)(pFirstComma - pMapping), size - 1);
+        SDL_memcpy(pchGUID, pMapping, len);
+        pchGUID[len] = '\0';
 
         /* Convert old style GUIDs to the new style in 2.0.5 */
 #if __WIN32__
@@ -725,18 +908,20 @@ static char *SDL_PrivateGetControllerGUIDFromMappingString(const char *pMapping)
             SDL_memcpy(&pchGUID[0], "03000000", 8);
         }
 #endif
-        return pchGUID;
+        return SDL_TRUE;
     }
-    return NULL;
+    return SDL_FALSE;
 }
 
 
 /*
- * grab the name string from a mapping string
+ * copy the name and the button mapping out of a mapping string, into one
+ * allocation: the name, then the mapping (everything after the 2nd comma)
  */
-static char *SDL_PrivateGetControllerNameFromMappingString(const char *pMapping)
+static char *SDL_PrivateGetControllerNameAndMappingFromMappingString(const char *pMapping, char **ppchMapping)
 {
     const char *pFirstComma, *pSecondComma;
+    size_t name_len, mapping_len;
     char *pchName;
 
     pFirstComma = SDL_strchr(pMapping, ',');
@@ -747,35 +932,20 @@ static char *SDL_PrivateGetControllerNameFromMappingString(const char *pMapping)
     if (!pSecondComma)
         return NULL;
 
-    pchName = SDL_malloc(pSecondComma - pFirstComma);
+    name_len = pSecondComma - pFirstComma - 1;
+    mapping_len = SDL_strlen(pSecondComma + 1);
+    pchName = SDL_malloc(name_len + 1 + mapping_len + 1);
     if (!pchName) {
         SDL_OutOfMemory();
         return NULL;
     }
-    SDL_memcpy(pchName, pFirstComma + 1, pSecondComma - pFirstComma);
-    pchName[pSecondComma - pFirstComma - 1] = 0;
+    SDL_memcpy(pchName, pFirstComma + 1, name_len);
+    pchName[name_len] = '\0';
+    *ppchMapping = pchName + name_len + 1;
+    SDL_memcpy(*ppchMapping, pSecondComma + 1, mapping_len + 1);
     return pchName;
 }
 
-
-/*
- * grab the button mapping string from a mapping string
- */
-static char *SDL_PrivateGetControllerMappingFromMappingString(const char *pMapping)
-{
-    const char *pFirstComma, *pSecondComma;
-
-    pFirstComma = SDL_strchr(pMapping, ',');
-    if (!pFirstComma)
-        return NULL;
-
-    pSecondComma = SDL_strchr(pFirstComma + 1, ',');
-    if (!pSecondComma)
-        return NULL;
-
-    return SDL_strdup(pSecondComma + 1); /* mapping is everything after the 3rd comma */
-}
-
 /*
  * Helper function to refresh a mapping
  */
@@ -807,62 +977,44 @@ SDL_PrivateAddMappingForGUID(SDL_JoystickGUID jGUID, const char *mappingString,
     char *pchMapping;
     ControllerMapping_t *pControllerMapping;
 
-    pchName = SDL_PrivateGetControllerNameFromMappingString(mappingString);
-    if (!pchName) {
-        SDL_SetError("Couldn't parse name from %s", mappingString);
-        return NULL;
+    pControllerMapping = SDL_PrivateGetControllerMappingForGUID(&jGUID);
+    if (pControllerMapping && pControllerMapping->priority > priority) {
+        /* Only overwrite the mapping if the priority is the same or higher. */
+        *existing = SDL_TRUE;
+        return pControllerMapping;
     }
 
-    pchMapping = SDL_PrivateGetControllerMappingFromMappingString(mappingString);
-    if (!pchMapping) {
-        SDL_free(pchName);
+    pchName = SDL_PrivateGetControllerNameAndMappingFromMappingString(mappingString, &pchMapping);
+    if (!pchName) {
         SDL_SetError("Couldn't parse %s", mappingString);
         return NULL;
     }
 
-    pControllerMapping = SDL_PrivateGetControllerMappingForGUID(&jGUID);
     if (pControllerMapping) {
-        /* Only overwrite the mapping if the priority is the same or higher. */
-        if (pControllerMapping->priority <= priority) {
-            /* Update existing mapping */
-            SDL_free(pControllerMapping->name);
-            pControllerMapping->name = pchName;
-            SDL_free(pControllerMapping->mapping);
-            pControllerMapping->mapping = pchMapping;
-            pControllerMapping->priority = priority;
-            /* refresh open controllers */
-            SDL_PrivateGameControllerRefreshMapping(pControllerMapping);
-        } else {
-            SDL_free(pchName);
-            SDL_free(pchMapping);
-        }
+        /* Update existing mapping */
+        SDL_free(pControllerMapping->name);
+        pControllerMapping->name = pchName;
+        pControllerMapping->mapping = pchMapping;
+        pControllerMapping->priority = priority;
+        /* refresh open controllers */
+        SDL_PrivateGameControllerRefreshMapping(pControllerMapping);
         *existing = SDL_TRUE;
     } else {
         pControllerMapping = SDL_malloc(sizeof(*pControllerMapping));
         if (!pControllerMapping) {
             SDL_free(pchName);
-            SDL_free(pchMapping);
             SDL_OutOfMemory();
             return NULL;
         }
         pControllerMapping->guid = jGUID;
         pControllerMapping->name = pchName;
         pControllerMapping->mapping = pchMapping;
-        pControllerMapping->next = NULL;
         pControllerMapping->priority = priority;
 
-        if (s_pSupportedControllers) {
-            /* Add the mapping to the end of the list */
-            ControllerMapping_t *pCurrMapping, *pPrevMapping;
-
-            for ( pPrevMapping = s_pSupportedControllers, pCurrMapping = pPrevMapping->next;
-                  pCurrMapping; 
-                  pPrevMapping = pCurrMapping, pCurrMapping = pCurrMapping->next ) {
-                continue;
-            }
-            pPrevMapping->next = pControllerMapping;
-        } else {
-            s_pSupportedControllers = pControllerMapping;
+        if (SDL_PrivateInsertControllerMapping(pControllerMapping) < 0) {
+            SDL_free(pchName);
+            SDL_free(pControllerMapping);
+            return NULL;
         }
         *existing = SDL_FALSE;
     }
@@ -1016,7 +1168,7 @@ SDL_GameControllerAddMappingsFromRW(SDL_RWops * rw, int freerw)
 static int
 SDL_PrivateGameControllerAddMapping(const char *mappingString, SDL_ControllerMappingPriority priority)
 {
-    char *pchGUID;
+    char pchGUID[64];
     SDL_JoystickGUID jGUID;
     SDL_bool is_xinput_mapping = SDL_FALSE;
     SDL_bool is_emscripten_mapping = SDL_FALSE;
@@ -1027,8 +1179,7 @@ SDL_PrivateGameControllerAddMapping(const char *mappingString, SDL_ControllerMap
         return SDL_InvalidParamError("mappingString");
     }
 
-    pchGUID = SDL_PrivateGetControllerGUIDFromMappingString(mappingString);
-    if (!pchGUID) {
+    if (!SDL_PrivateGetControllerGUIDFromMappingString(mappingString, pchGUID, sizeof(pchGUID))) {
         return SDL_SetError("Couldn't parse GUID from %s", mappingString);
     }
     if (!SDL_strcasecmp(pchGUID, "xinput")) {
@@ -1038,7 +1189,6 @@ SDL_PrivateGameControllerAddMapping(const char *mappingString, SDL_ControllerMap
         is_emscripten_mapping = SDL_TRUE;
     }
     jGUID = SDL_JoystickGetGUIDFromString(pchGUID);
-    SDL_free(pchGUID);
 
     pControllerMapping = SDL_PrivateAddMappingForGUID(jGUID, mappingString, &existing, priority);
     if (!pControllerMapping) {
@@ -1718,6 +1868,7 @@ SDL_GameControllerClose(SDL_GameController * gamecontroller)
     }
 
     SDL_free(gamecontroller->bindings);
+    SDL_free(gamecontroller->compiled_bindings);
     SDL_free(gamecontroller->last_match_axis);
     SDL_free(gamecontroller->last_hat_mask);
     SDL_free(gamecontroller);
@@ -1749,9 +1900,14 @@ SDL_GameControllerQuitMappings(void)
         pControllerMap = s_pSupportedControllers;
         s_pSupportedControllers = s_pSupportedControllers->next;
         SDL_free(pControllerMap->name);
-        SDL_free(pControllerMap->mapping);
         SDL_free(pControllerMap);
     }
+    s_pSupportedControllersTail = NULL;
+
+    SDL_free(s_pMappingBuckets);
+    s_pMappingBuckets = NULL;
+    s_nMappingBuckets = 0;
+    s_nMappings = 0;
 
     SDL_DelEventWatch(SDL_GameControllerEventWatcher, NULL);
 
@@ -32,6 +32,7 @@
 #include "../events/SDL_events_c.h"
 #endif
 #include "../video/SDL_sysvideo.h"
+#include "../SDL_trace_c.h"
 
 
 static SDL_bool SDL_joystick_allows_background_events = SDL_FALSE;
@@ -840,6 +841,7 @@ void
 SDL_JoystickUpdate(void)
 {
     SDL_Joystick *joystick;
+    Uint64 trace_start;
 
     SDL_LockJoysticks();
 
@@ -850,6 +852,7 @@ SDL_JoystickUpdate(void)
     }
 
     SDL_updating_joystick = SDL_TRUE;
+    trace_start = SDL_TRACE_BEGIN();
 
     /* Make sure the list is unlocked while dispatching events to prevent application deadlocks */
     SDL_UnlockJoysticks();
@@ -896,6 +899,8 @@ SDL_JoystickUpdate(void)
     SDL_SYS_JoystickDetect();
 
     SDL_UnlockJoysticks();
+
+    SDL_TRACE_END("SDL_JoystickUpdate", trace_start);
 }
 
 int
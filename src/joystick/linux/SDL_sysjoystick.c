@@ -508,6 +508,8 @@ static void SteamControllerDisconnectedCallback(int device_instance)
 int
 SDL_SYS_JoystickInit(void)
 {
+    int retval;
+
     /* First see if the user specified one or more joysticks to use */
     if (SDL_getenv("SDL_JOYSTICK_DEVICE") != NULL) {
         char *envcopy, *envpath, *delim;
@@ -528,10 +530,15 @@ SDL_SYS_JoystickInit(void)
                              SteamControllerDisconnectedCallback);
 
 #if SDL_USE_LIBUDEV
-    return JoystickInitWithUdev();
+    retval = JoystickInitWithUdev();
 #else 
-    return JoystickInitWithoutUdev();
+    retval = JoystickInitWithoutUdev();
 #endif
+    if (retval == 0) {
+        /* Opened joysticks share the evdev epoll set, without it we read them all */
+        SDL_EVDEV_poll_init();
+    }
+    return retval;
 }
 
 int
@@ -770,6 +777,7 @@ SDL_SYS_JoystickOpen(SDL_Joystick * joystick, int device_index)
 
         /* Set the joystick to non-blocking read mode */
         fcntl(fd, F_SETFL, O_NONBLOCK);
+        SDL_EVDEV_poll_add(&joystick->hwdata->poll, fd, SDL_TRUE);
 
         /* Get the number of buttons and axes on the joystick */
         ConfigJoystick(joystick, fd);
@@ -894,17 +902,27 @@ static SDL_INLINE void
 HandleInputEvents(SDL_Joystick * joystick)
 {
     struct input_event events[32];
+    Uint64 timestamps[SDL_arraysize(events)];
     int i, len;
     int code;
+    Uint64 timestamp_ns = 0;
 
     if (joystick->hwdata->fresh) {
         PollAllValues(joystick);
         joystick->hwdata->fresh = 0;
     }
 
-    while ((len = read(joystick->hwdata->fd, events, (sizeof events))) > 0) {
-        len /= sizeof(events[0]);
+    if (!SDL_EVDEV_poll_ready(&joystick->hwdata->poll)) {
+        return;  /* nothing new, don't bother reading it */
+    }
+
+    /* Events we send are stamped with the kernel's time for the input */
+    SDL_SetEventTimestampSource(&timestamp_ns);
+
+    /* Either straight from the device, or what the input thread read from it */
+    while ((len = SDL_EVDEV_poll_read(&joystick->hwdata->poll, events, timestamps, SDL_arraysize(events))) > 0) {
         for (i = 0; i < len; ++i) {
+            timestamp_ns = timestamps[i];
             code = events[i].code;
             switch (events[i].type) {
             case EV_KEY:
@@ -961,6 +979,8 @@ HandleInputEvents(SDL_Joystick * joystick)
             }
         }
     }
+
+    SDL_SetEventTimestampSource(NULL);
 }
 
 void
@@ -995,6 +1015,7 @@ SDL_SYS_JoystickClose(SDL_Joystick * joystick)
 {
     if (joystick->hwdata) {
         if (joystick->hwdata->fd >= 0) {
+            SDL_EVDEV_poll_remove(&joystick->hwdata->poll);
             close(joystick->hwdata->fd);
         }
         if (joystick->hwdata->item) {
@@ -1032,6 +1053,8 @@ SDL_SYS_JoystickQuit(void)
 #endif
 
     SDL_QuitSteamControllers();
+
+    SDL_EVDEV_poll_quit();
 }
 
 SDL_JoystickGUID SDL_SYS_JoystickGetDeviceGUID( int device_index )
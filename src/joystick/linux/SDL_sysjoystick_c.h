@@ -21,12 +21,15 @@
 
 #include <linux/input.h>
 
+#include "../../core/linux/SDL_evdev_poll.h"
+
 struct SDL_joylist_item;
 
 /* The private structure used to keep track of a joystick */
 struct joystick_hwdata
 {
     int fd;
+    SDL_EVDEV_poll_item poll;
     struct SDL_joylist_item *item;
     SDL_JoystickGUID guid;
     char *fname;                /* Used in haptic subsystem */
@@ -27,11 +27,16 @@
 #include "SDL_log.h"
 #include "SDL_render.h"
 #include "SDL_sysrender.h"
+#include "../SDL_trace_c.h"
 #include "software/SDL_render_sw_c.h"
 
 
 #define SDL_WINDOWRENDERDATA    "_SDL_WindowRenderData"
 
+/* Backends convert a draw command's vertices on the stack, so merged
+   commands stop growing at this many primitives */
+#define SDL_MAX_MERGED_DRAW_COUNT   4096
+
 #define CHECK_RENDERER_MAGIC(renderer, retval) \
     SDL_assert(renderer && renderer->magic == &renderer_magic); \
     if (!renderer || renderer->magic != &renderer_magic) { \
@@ -107,6 +112,335 @@ static char texture_magic;
 
 static int UpdateLogicalSize(SDL_Renderer *renderer);
 
+static int
+FlushRenderCommands(SDL_Renderer *renderer)
+{
+    Uint64 trace_start;
+    int retval;
+
+    SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
+
+    if (renderer->render_commands == NULL) {  /* nothing to do! */
+        SDL_assert(renderer->vertex_data_used == 0);
+        return 0;
+    }
+
+    trace_start = SDL_TRACE_BEGIN();
+    retval = renderer->RunCommandQueue(renderer, renderer->render_commands,
+                                       renderer->vertex_data, renderer->vertex_data_used);
+    SDL_TRACE_END("RunCommandQueue", trace_start);
+
+    /* Move the whole command queue to the unused pool so we can reuse the commands next time. */
+    renderer->render_commands_tail->next = renderer->render_commands_pool;
+    renderer->render_commands_pool = renderer->render_commands;
+    renderer->render_commands_tail = NULL;
+    renderer->render_commands = NULL;
+    renderer->vertex_data_used = 0;
+    renderer->render_command_generation++;
+    renderer->viewport_queued = SDL_FALSE;
+    renderer->cliprect_queued = SDL_FALSE;
+    return retval;
+}
+
+static int
+FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer = texture->renderer;
+    if (texture->last_command_generation == renderer->render_command_generation) {
+        /* the current command queue depends on this texture, flush the queue now before it changes */
+        return FlushRenderCommands(renderer);
+    }
+    return 0;
+}
+
+static void *
+AllocateRenderVertices(SDL_Renderer *renderer, const size_t numbytes, const size_t alignment, size_t *offset)
+{
+    const size_t padding = alignment ? ((alignment - (renderer->vertex_data_used % alignment)) % alignment) : 0;
+    const size_t needed = renderer->vertex_data_used + padding + numbytes;
+    void *retval;
+
+    if (renderer->vertex_data_allocation < needed) {
+        size_t newsize = renderer->vertex_data_allocation ? renderer->vertex_data_allocation * 2 : 1024;
+        void *ptr;
+
+        while (newsize < needed) {
+            newsize *= 2;
+        }
+        ptr = SDL_realloc(renderer->vertex_data, newsize);
+        if (ptr == NULL) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        renderer->vertex_data = ptr;
+        renderer->vertex_data_allocation = newsize;
+    }
+
+    renderer->vertex_data_used += padding;
+    if (offset) {
+        *offset = renderer->vertex_data_used;
+    }
+    retval = ((Uint8 *) renderer->vertex_data) + renderer->vertex_data_used;
+    renderer->vertex_data_used += numbytes;
+    return retval;
+}
+
+static SDL_RenderCommand *
+AllocateRenderCommand(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *retval = renderer->render_commands_pool;
+
+    if (retval != NULL) {
+        renderer->render_commands_pool = retval->next;
+    } else {
+        retval = (SDL_RenderCommand *) SDL_malloc(sizeof (*retval));
+        if (!retval) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+    }
+    SDL_zerop(retval);
+
+    if (renderer->render_commands_tail != NULL) {
+        renderer->render_commands_tail->next = retval;
+    } else {
+        renderer->render_commands = retval;
+    }
+    renderer->render_commands_tail = retval;
+    return retval;
+}
+
+static int
+QueueCmdSetViewport(SDL_Renderer *renderer)
+{
+    if (!renderer->viewport_queued ||
+        SDL_memcmp(&renderer->viewport, &renderer->last_queued_viewport, sizeof (SDL_Rect)) != 0) {
+        SDL_RenderCommand *cmd = AllocateRenderCommand(renderer);
+        if (cmd == NULL) {
+            return -1;
+        }
+        cmd->command = SDL_RENDERCMD_SETVIEWPORT;
+        cmd->data.viewport.rect = renderer->viewport;
+        renderer->last_queued_viewport = renderer->viewport;
+        renderer->viewport_queued = SDL_TRUE;
+    }
+    return 0;
+}
+
+static int
+QueueCmdSetClipRect(SDL_Renderer *renderer)
+{
+    if (!renderer->cliprect_queued ||
+        renderer->clipping_enabled != renderer->last_queued_cliprect_enabled ||
+        SDL_memcmp(&renderer->clip_rect, &renderer->last_queued_cliprect, sizeof (SDL_Rect)) != 0) {
+        SDL_RenderCommand *cmd = AllocateRenderCommand(renderer);
+        if (cmd == NULL) {
+            return -1;
+        }
+        cmd->command = SDL_RENDERCMD_SETCLIPRECT;
+        cmd->data.cliprect.enabled = renderer->clipping_enabled;
+        cmd->data.cliprect.rect = renderer->clip_rect;
+        renderer->last_queued_cliprect_enabled = renderer->clipping_enabled;
+        renderer->last_queued_cliprect = renderer->clip_rect;
+        renderer->cliprect_queued = SDL_TRUE;
+    }
+    return 0;
+}
+
+/* Reserve vertex space for a draw command. If the previous command in the
+   queue draws with exactly the same state, it is extended instead of adding
+   a new command, so the backend can submit both in one go, unless that
+   would take it past SDL_MAX_MERGED_DRAW_COUNT.
+ */
+static void *
+QueueCmdDraw(SDL_Renderer *renderer, const SDL_RenderCommandType cmdtype,
+             SDL_Texture *texture, Uint8 r, Uint8 g, Uint8 b, Uint8 a,
+             SDL_BlendMode blend, const size_t elemsize, const size_t count)
+{
+    SDL_RenderCommand *cmd;
+    size_t first = 0;
+    void *vertices;
+
+    if (QueueCmdSetViewport(renderer) < 0 || QueueCmdSetClipRect(renderer) < 0) {
+        return NULL;
+    }
+
+    cmd = renderer->render_commands_tail;
+    if (cmd && cmd->command == cmdtype &&
+        cmdtype != SDL_RENDERCMD_DRAW_LINES &&  /* line strips can't be joined */
+        cmd->data.draw.texture == texture &&
+        cmd->data.draw.r == r && cmd->data.draw.g == g &&
+        cmd->data.draw.b == b && cmd->data.draw.a == a &&
+        cmd->data.draw.blend == blend &&
+        cmd->data.draw.count + count <= SDL_MAX_MERGED_DRAW_COUNT &&
+        (cmd->data.draw.first + cmd->data.draw.count * elemsize) == renderer->vertex_data_used) {
+        vertices = AllocateRenderVertices(renderer, count * elemsize, 0, NULL);
+        if (vertices) {
+            cmd->data.draw.count += count;
+        }
+        return vertices;
+    }
+
+    vertices = AllocateRenderVertices(renderer, count * elemsize, sizeof (double), &first);
+    if (!vertices) {
+        return NULL;
+    }
+    cmd = AllocateRenderCommand(renderer);
+    if (!cmd) {
+        renderer->vertex_data_used = first;
+        return NULL;
+    }
+    cmd->command = cmdtype;
+    cmd->data.draw.first = first;
+    cmd->data.draw.count = count;
+    cmd->data.draw.r = r;
+    cmd->data.draw.g = g;
+    cmd->data.draw.b = b;
+    cmd->data.draw.a = a;
+    cmd->data.draw.blend = blend;
+    cmd->data.draw.texture = texture;
+    if (texture) {
+        texture->last_command_generation = renderer->render_command_generation;
+    }
+    return vertices;
+}
+
+/* These either queue the operation or pass it straight to the backend */
+
+static int
+RenderUpdateViewport(SDL_Renderer *renderer)
+{
+    if (renderer->batching) {
+        return 0;  /* the viewport is queued along with the next draw command */
+    }
+    return renderer->UpdateViewport(renderer);
+}
+
+static int
+RenderUpdateClipRect(SDL_Renderer *renderer)
+{
+    if (renderer->batching) {
+        return 0;  /* the clip rect is queued along with the next draw command */
+    }
+    return renderer->UpdateClipRect(renderer);
+}
+
+static int
+RenderClear(SDL_Renderer *renderer)
+{
+    if (renderer->batching) {
+        SDL_RenderCommand *cmd;
+
+        if (QueueCmdSetViewport(renderer) < 0 || QueueCmdSetClipRect(renderer) < 0) {
+            return -1;
+        }
+        cmd = AllocateRenderCommand(renderer);
+        if (!cmd) {
+            return -1;
+        }
+        cmd->command = SDL_RENDERCMD_CLEAR;
+        cmd->data.color.r = renderer->r;
+        cmd->data.color.g = renderer->g;
+        cmd->data.color.b = renderer->b;
+        cmd->data.color.a = renderer->a;
+        return 0;
+    }
+    return renderer->RenderClear(renderer);
+}
+
+static int
+RenderDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points, int count)
+{
+    if (renderer->batching) {
+        SDL_FPoint *verts = (SDL_FPoint *) QueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL,
+                                                        renderer->r, renderer->g, renderer->b, renderer->a,
+                                                        renderer->blendMode, sizeof (SDL_FPoint), count);
+        if (!verts) {
+            return -1;
+        }
+        SDL_memcpy(verts, points, count * sizeof (SDL_FPoint));
+        return 0;
+    }
+    return renderer->RenderDrawPoints(renderer, points, count);
+}
+
+static int
+RenderDrawLines(SDL_Renderer *renderer, const SDL_FPoint *points, int count)
+{
+    if (renderer->batching) {
+        SDL_FPoint *verts = (SDL_FPoint *) QueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_LINES, NULL,
+                                                        renderer->r, renderer->g, renderer->b, renderer->a,
+                                                        renderer->blendMode, sizeof (SDL_FPoint), count);
+        if (!verts) {
+            return -1;
+        }
+        SDL_memcpy(verts, points, count * sizeof (SDL_FPoint));
+        return 0;
+    }
+    return renderer->RenderDrawLines(renderer, points, count);
+}
+
+static int
+RenderFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, int count)
+{
+    if (renderer->batching) {
+        SDL_FRect *verts;
+
+        if (count == 0) {
+            return 0;
+        }
+        verts = (SDL_FRect *) QueueCmdDraw(renderer, SDL_RENDERCMD_FILL_RECTS, NULL,
+                                                      renderer->r, renderer->g, renderer->b, renderer->a,
+                                                      renderer->blendMode, sizeof (SDL_FRect), count);
+        if (!verts) {
+            return -1;
+        }
+        SDL_memcpy(verts, rects, count * sizeof (SDL_FRect));
+        return 0;
+    }
+    return renderer->RenderFillRects(renderer, rects, count);
+}
+
+static int
+RenderCopy(SDL_Renderer *renderer, SDL_Texture *texture,
+           const SDL_Rect *srcrect, const SDL_FRect *dstrect)
+{
+    if (renderer->batching) {
+        SDL_RenderCopyData *verts = (SDL_RenderCopyData *) QueueCmdDraw(renderer, SDL_RENDERCMD_COPY, texture,
+                                                                        texture->r, texture->g, texture->b, texture->a,
+                                                                        texture->blendMode, sizeof (SDL_RenderCopyData), 1);
+        if (!verts) {
+            return -1;
+        }
+        verts->srcrect = *srcrect;
+        verts->dstrect = *dstrect;
+        return 0;
+    }
+    return renderer->RenderCopy(renderer, texture, srcrect, dstrect);
+}
+
+static int
+RenderCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
+             const SDL_Rect *srcrect, const SDL_FRect *dstrect,
+             const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip)
+{
+    if (renderer->batching) {
+        SDL_RenderCopyExData *verts = (SDL_RenderCopyExData *) QueueCmdDraw(renderer, SDL_RENDERCMD_COPY_EX, texture,
+                                                                            texture->r, texture->g, texture->b, texture->a,
+                                                                            texture->blendMode, sizeof (SDL_RenderCopyExData), 1);
+        if (!verts) {
+            return -1;
+        }
+        verts->srcrect = *srcrect;
+        verts->dstrect = *dstrect;
+        verts->angle = angle;
+        verts->center = *center;
+        verts->flip = flip;
+        return 0;
+    }
+    return renderer->RenderCopyEx(renderer, texture, srcrect, dstrect, angle, center, flip);
+}
+
 int
 SDL_GetNumRenderDrivers(void)
 {
@@ -140,6 +474,9 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
     if (event->type == SDL_WINDOWEVENT) {
         SDL_Window *window = SDL_GetWindowFromID(event->window.windowID);
         if (window == renderer->window) {
+            /* Queued commands target the current output surface, which the backend may drop below */
+            FlushRenderCommands(renderer);
+
             if (renderer->WindowEvent) {
                 renderer->WindowEvent(renderer, &event->window);
             }
@@ -173,7 +510,7 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
                         renderer->viewport.y = 0;
                         renderer->viewport.w = w;
                         renderer->viewport.h = h;
-                        renderer->UpdateViewport(renderer);
+                        RenderUpdateViewport(renderer);
                     }
                 }
 
@@ -343,6 +680,9 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
     }
 
     if (renderer) {
+        renderer->batching = renderer->RunCommandQueue &&
+                             SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_TRUE);
+        renderer->render_command_generation = 1;
         renderer->magic = &renderer_magic;
         renderer->window = window;
         renderer->scale.x = 1.0f;
@@ -391,6 +731,12 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
     renderer = SW_CreateRendererForSurface(surface);
 
     if (renderer) {
+        /* The application owns the surface and may read it at any time, so
+           only batch when explicitly asked to.
+         */
+        renderer->batching = renderer->RunCommandQueue &&
+                             SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_FALSE);
+        renderer->render_command_generation = 1;
         renderer->magic = &renderer_magic;
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
@@ -898,6 +1244,8 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
 {
     SDL_Renderer *renderer;
     SDL_Rect full_rect;
+    Uint64 trace_start;
+    int retval;
 
     CHECK_TEXTURE_MAGIC(texture, -1);
 
@@ -918,14 +1266,23 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
 
     if ((rect->w == 0) || (rect->h == 0)) {
         return 0;  /* nothing to do. */
-    } else if (texture->yuv) {
-        return SDL_UpdateTextureYUV(texture, rect, pixels, pitch);
+    }
+
+    trace_start = SDL_TRACE_BEGIN();
+    if (texture->yuv) {
+        retval = SDL_UpdateTextureYUV(texture, rect, pixels, pitch);
     } else if (texture->native) {
-        return SDL_UpdateTextureNative(texture, rect, pixels, pitch);
+        retval = SDL_UpdateTextureNative(texture, rect, pixels, pitch);
     } else {
         renderer = texture->renderer;
-        return renderer->UpdateTexture(renderer, texture, rect, pixels, pitch);
+        if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+            retval = -1;
+        } else {
+            retval = renderer->UpdateTexture(renderer, texture, rect, pixels, pitch);
+        }
     }
+    SDL_TRACE_END("SDL_UpdateTexture", trace_start);
+    return retval;
 }
 
 static int
@@ -1033,6 +1390,9 @@ int SDL_UpdateYUVTexture(SDL_Texture * texture, const SDL_Rect * rect,
         renderer = texture->renderer;
         SDL_assert(renderer->UpdateTextureYUV);
         if (renderer->UpdateTextureYUV) {
+            if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+                return -1;
+            }
             return renderer->UpdateTextureYUV(renderer, texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
         } else {
             return SDL_Unsupported();
@@ -1086,6 +1446,9 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
         return SDL_LockTextureNative(texture, rect, pixels, pitch);
     } else {
         renderer = texture->renderer;
+        if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+            return -1;
+        }
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -1187,6 +1550,11 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         }
     }
 
+    /* Everything queued so far belongs to the old target */
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+
     if (texture && !renderer->target) {
         /* Make a backup of the viewport */
         renderer->viewport_backup = renderer->viewport;
@@ -1221,10 +1589,10 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         renderer->logical_w = renderer->logical_w_backup;
         renderer->logical_h = renderer->logical_h_backup;
     }
-    if (renderer->UpdateViewport(renderer) < 0) {
+    if (RenderUpdateViewport(renderer) < 0) {
         return -1;
     }
-    if (renderer->UpdateClipRect(renderer) < 0) {
+    if (RenderUpdateClipRect(renderer) < 0) {
         return -1;
     }
 
@@ -1411,7 +1779,7 @@ SDL_RenderSetViewport(SDL_Renderer * renderer, const SDL_Rect * rect)
             return -1;
         }
     }
-    return renderer->UpdateViewport(renderer);
+    return RenderUpdateViewport(renderer);
 }
 
 void
@@ -1442,7 +1810,7 @@ SDL_RenderSetClipRect(SDL_Renderer * renderer, const SDL_Rect * rect)
         renderer->clipping_enabled = SDL_FALSE;
         SDL_zero(renderer->clip_rect);
     }
-    return renderer->UpdateClipRect(renderer);
+    return RenderUpdateClipRect(renderer);
 }
 
 void
@@ -1552,7 +1920,7 @@ SDL_RenderClear(SDL_Renderer * renderer)
     if (renderer->hidden) {
         return 0;
     }
-    return renderer->RenderClear(renderer);
+    return RenderClear(renderer);
 }
 
 int
@@ -1584,7 +1952,7 @@ RenderDrawPointsWithRects(SDL_Renderer * renderer,
         frects[i].h = renderer->scale.y;
     }
 
-    status = renderer->RenderFillRects(renderer, frects, count);
+    status = RenderFillRects(renderer, frects, count);
 
     SDL_stack_free(frects);
 
@@ -1626,7 +1994,7 @@ SDL_RenderDrawPoints(SDL_Renderer * renderer,
         fpoints[i].y = points[i].y * renderer->scale.y;
     }
 
-    status = renderer->RenderDrawPoints(renderer, fpoints, count);
+    status = RenderDrawPoints(renderer, fpoints, count);
 
     SDL_stack_free(fpoints);
 
@@ -1687,11 +2055,11 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
             fpoints[0].y = points[i].y * renderer->scale.y;
             fpoints[1].x = points[i+1].x * renderer->scale.x;
             fpoints[1].y = points[i+1].y * renderer->scale.y;
-            status += renderer->RenderDrawLines(renderer, fpoints, 2);
+            status += RenderDrawLines(renderer, fpoints, 2);
         }
     }
 
-    status += renderer->RenderFillRects(renderer, frects, nrects);
+    status += RenderFillRects(renderer, frects, nrects);
 
     SDL_stack_free(frects);
 
@@ -1736,7 +2104,7 @@ SDL_RenderDrawLines(SDL_Renderer * renderer,
         fpoints[i].y = points[i].y * renderer->scale.y;
     }
 
-    status = renderer->RenderDrawLines(renderer, fpoints, count);
+    status = RenderDrawLines(renderer, fpoints, count);
 
     SDL_stack_free(fpoints);
 
@@ -1850,7 +2218,7 @@ SDL_RenderFillRects(SDL_Renderer * renderer,
         frects[i].h = rects[i].h * renderer->scale.y;
     }
 
-    status = renderer->RenderFillRects(renderer, frects, count);
+    status = RenderFillRects(renderer, frects, count);
 
     SDL_stack_free(frects);
 
@@ -1906,7 +2274,7 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     frect.w = real_dstrect.w * renderer->scale.x;
     frect.h = real_dstrect.h * renderer->scale.y;
 
-    return renderer->RenderCopy(renderer, texture, &real_srcrect, &frect);
+    return RenderCopy(renderer, texture, &real_srcrect, &frect);
 }
 
 
@@ -1978,7 +2346,7 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     fcenter.x = real_center.x * renderer->scale.x;
     fcenter.y = real_center.y * renderer->scale.y;
 
-    return renderer->RenderCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
+    return RenderCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
 }
 
 int
@@ -1993,6 +2361,10 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
         return SDL_Unsupported();
     }
 
+    if (FlushRenderCommands(renderer) < 0) {
+        return -1;
+    }
+
     if (!format) {
         format = SDL_GetWindowPixelFormat(renderer->window);
     }
@@ -2021,13 +2393,28 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
 void
 SDL_RenderPresent(SDL_Renderer * renderer)
 {
+    Uint64 trace_start;
+
     CHECK_RENDERER_MAGIC(renderer, );
 
+    trace_start = SDL_TRACE_BEGIN();
+    FlushRenderCommands(renderer);
+
     /* Don't draw while we're hidden */
-    if (renderer->hidden) {
-        return;
+    if (!renderer->hidden) {
+        const Uint64 trace_present = SDL_TRACE_BEGIN();
+        renderer->RenderPresent(renderer);
+        SDL_TRACE_END("RenderPresent", trace_present);
     }
-    renderer->RenderPresent(renderer);
+    SDL_TRACE_END("SDL_RenderPresent", trace_start);
+}
+
+int
+SDL_RenderFlush(SDL_Renderer * renderer)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    return FlushRenderCommands(renderer);
 }
 
 void
@@ -2040,6 +2427,8 @@ SDL_DestroyTexture(SDL_Texture * texture)
     renderer = texture->renderer;
     if (texture == renderer->target) {
         SDL_SetRenderTarget(renderer, NULL);
+    } else {
+        FlushRenderCommandsIfTextureNeeded(texture);
     }
 
     texture->magic = NULL;
@@ -2072,6 +2461,23 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
 
+    /* Drop any queued commands, nothing will ever be presented */
+    if (renderer->render_commands_tail != NULL) {
+        renderer->render_commands_tail->next = renderer->render_commands_pool;
+        renderer->render_commands_pool = renderer->render_commands;
+        renderer->render_commands_tail = NULL;
+        renderer->render_commands = NULL;
+    }
+    while (renderer->render_commands_pool) {
+        SDL_RenderCommand *next = renderer->render_commands_pool->next;
+        SDL_free(renderer->render_commands_pool);
+        renderer->render_commands_pool = next;
+    }
+    SDL_free(renderer->vertex_data);
+    renderer->vertex_data = NULL;
+    renderer->vertex_data_used = 0;
+    renderer->vertex_data_allocation = 0;
+
     /* Free existing textures for this renderer */
     while (renderer->textures) {
         SDL_Texture *tex = renderer->textures; (void) tex;
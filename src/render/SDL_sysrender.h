@@ -59,6 +59,9 @@ struct SDL_Texture
 
     SDL_Renderer *renderer;
 
+    /* The command queue generation that last referenced this texture */
+    Uint32 last_command_generation;
+
     /* Support for formats not supported directly by the renderer */
     SDL_Texture *native;
     SDL_SW_YUVTexture *yuv;
@@ -72,6 +75,62 @@ struct SDL_Texture
     SDL_Texture *next;
 };
 
+/* Draw commands recorded by the renderer when batching is enabled */
+typedef enum
+{
+    SDL_RENDERCMD_NO_OP,
+    SDL_RENDERCMD_SETVIEWPORT,
+    SDL_RENDERCMD_SETCLIPRECT,
+    SDL_RENDERCMD_CLEAR,
+    SDL_RENDERCMD_DRAW_POINTS,
+    SDL_RENDERCMD_DRAW_LINES,
+    SDL_RENDERCMD_FILL_RECTS,
+    SDL_RENDERCMD_COPY,
+    SDL_RENDERCMD_COPY_EX
+} SDL_RenderCommandType;
+
+/* Vertex data for SDL_RENDERCMD_COPY */
+typedef struct
+{
+    SDL_Rect srcrect;
+    SDL_FRect dstrect;
+} SDL_RenderCopyData;
+
+/* Vertex data for SDL_RENDERCMD_COPY_EX */
+typedef struct
+{
+    SDL_Rect srcrect;
+    SDL_FRect dstrect;
+    double angle;
+    SDL_FPoint center;
+    SDL_RendererFlip flip;
+} SDL_RenderCopyExData;
+
+typedef struct SDL_RenderCommand
+{
+    SDL_RenderCommandType command;
+    union {
+        struct {
+            SDL_Rect rect;
+        } viewport;
+        struct {
+            SDL_bool enabled;
+            SDL_Rect rect;
+        } cliprect;
+        struct {
+            Uint8 r, g, b, a;
+        } color;
+        struct {
+            size_t first;           /**< Byte offset of the first element in the vertex buffer */
+            size_t count;           /**< Number of points, rects or copies */
+            Uint8 r, g, b, a;       /**< Draw color, or texture modulation for copies */
+            SDL_BlendMode blend;
+            SDL_Texture *texture;
+        } draw;
+    } data;
+    struct SDL_RenderCommand *next;
+} SDL_RenderCommand;
+
 /* Define the SDL renderer structure */
 struct SDL_Renderer
 {
@@ -116,6 +175,13 @@ struct SDL_Renderer
     int (*RenderReadPixels) (SDL_Renderer * renderer, const SDL_Rect * rect,
                              Uint32 format, void * pixels, int pitch);
     void (*RenderPresent) (SDL_Renderer * renderer);
+
+    /* Execute a list of queued commands. Consecutive draws that share the same
+       texture, color and blend state have already been merged into a single
+       command, so the backend can submit each command in one go.
+     */
+    int (*RunCommandQueue) (SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                            void *vertices, size_t vertsize);
     void (*DestroyTexture) (SDL_Renderer * renderer, SDL_Texture * texture);
 
     void (*DestroyRenderer) (SDL_Renderer * renderer);
@@ -168,6 +234,22 @@ struct SDL_Renderer
     Uint8 r, g, b, a;                   /**< Color for drawing operations values */
     SDL_BlendMode blendMode;            /**< The drawing blend mode */
 
+    /* Whether draw calls are queued and handed to RunCommandQueue in batches */
+    SDL_bool batching;
+    SDL_RenderCommand *render_commands;
+    SDL_RenderCommand *render_commands_tail;
+    SDL_RenderCommand *render_commands_pool;
+    Uint32 render_command_generation;
+    SDL_bool viewport_queued;
+    SDL_Rect last_queued_viewport;
+    SDL_bool cliprect_queued;
+    SDL_bool last_queued_cliprect_enabled;
+    SDL_Rect last_queued_cliprect;
+
+    void *vertex_data;
+    size_t vertex_data_used;
+    size_t vertex_data_allocation;
+
     void *driverdata;
 };
 
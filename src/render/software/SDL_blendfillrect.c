@@ -218,6 +218,10 @@ SDL_BlendFillRect(SDL_Surface * dst, const SDL_Rect * rect,
         rect = &dst->clip_rect;
     }
 
+    if (dst->map->damage) {
+        SDL_AddSurfaceDamage(dst, rect);
+    }
+
     if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
@@ -326,6 +330,9 @@ SDL_BlendFillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
         if (!SDL_IntersectRect(&rects[i], &dst->clip_rect, &rect)) {
             continue;
         }
+        if (dst->map->damage) {
+            SDL_AddSurfaceDamage(dst, &rect);
+        }
         status = func(dst, &rect, blendMode, r, g, b, a);
     }
     return status;
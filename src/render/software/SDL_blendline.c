@@ -725,6 +725,15 @@ SDL_BlendLine(SDL_Surface * dst, int x1, int y1, int x2, int y2,
         return 0;
     }
 
+    if (dst->map->damage) {
+        SDL_Point ends[2];
+        ends[0].x = x1;
+        ends[0].y = y1;
+        ends[1].x = x2;
+        ends[1].y = y2;
+        SDL_AddSurfaceDamagePoints(dst, ends, 2);
+    }
+
     func(dst, x1, y1, x2, y2, blendMode, r, g, b, a, SDL_TRUE);
     return 0;
 }
@@ -748,6 +757,10 @@ SDL_BlendLines(SDL_Surface * dst, const SDL_Point * points, int count,
         return SDL_SetError("SDL_BlendLines(): Unsupported surface format");
     }
 
+    if (dst->map->damage) {
+        SDL_AddSurfaceDamagePoints(dst, points, count);
+    }
+
     for (i = 1; i < count; ++i) {
         x1 = points[i-1].x;
         y1 = points[i-1].y;
@@ -212,6 +212,15 @@ SDL_BlendPoint(SDL_Surface * dst, int x, int y, SDL_BlendMode blendMode, Uint8 r
         return 0;
     }
 
+    if (dst->map->damage) {
+        SDL_Rect rect;
+        rect.x = x;
+        rect.y = y;
+        rect.w = 1;
+        rect.h = 1;
+        SDL_AddSurfaceDamage(dst, &rect);
+    }
+
     if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
@@ -274,6 +283,10 @@ SDL_BlendPoints(SDL_Surface * dst, const SDL_Point * points, int count,
         return SDL_SetError("SDL_BlendPoints(): Unsupported surface format");
     }
 
+    if (dst->map->damage) {
+        SDL_AddSurfaceDamagePoints(dst, points, count);
+    }
+
     if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
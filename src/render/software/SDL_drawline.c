@@ -158,6 +158,15 @@ SDL_DrawLine(SDL_Surface * dst, int x1, int y1, int x2, int y2, Uint32 color)
         return 0;
     }
 
+    if (dst->map->damage) {
+        SDL_Point ends[2];
+        ends[0].x = x1;
+        ends[0].y = y1;
+        ends[1].x = x2;
+        ends[1].y = y2;
+        SDL_AddSurfaceDamagePoints(dst, ends, 2);
+    }
+
     func(dst, x1, y1, x2, y2, color, SDL_TRUE);
     return 0;
 }
@@ -181,6 +190,10 @@ SDL_DrawLines(SDL_Surface * dst, const SDL_Point * points, int count,
         return SDL_SetError("SDL_DrawLines(): Unsupported surface format");
     }
 
+    if (dst->map->damage) {
+        SDL_AddSurfaceDamagePoints(dst, points, count);
+    }
+
     for (i = 1; i < count; ++i) {
         x1 = points[i-1].x;
         y1 = points[i-1].y;
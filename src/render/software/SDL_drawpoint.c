@@ -45,6 +45,15 @@ SDL_DrawPoint(SDL_Surface * dst, int x, int y, Uint32 color)
         return 0;
     }
 
+    if (dst->map->damage) {
+        SDL_Rect rect;
+        rect.x = x;
+        rect.y = y;
+        rect.w = 1;
+        rect.h = 1;
+        SDL_AddSurfaceDamage(dst, &rect);
+    }
+
     switch (dst->format->BytesPerPixel) {
     case 1:
         DRAW_FASTSETPIXELXY1(x, y);
@@ -79,6 +88,10 @@ SDL_DrawPoints(SDL_Surface * dst, const SDL_Point * points, int count,
         return SDL_SetError("SDL_DrawPoints(): Unsupported surface format");
     }
 
+    if (dst->map->damage) {
+        SDL_AddSurfaceDamagePoints(dst, points, count);
+    }
+
     minx = dst->clip_rect.x;
     maxx = dst->clip_rect.x + dst->clip_rect.w - 1;
     miny = dst->clip_rect.y;
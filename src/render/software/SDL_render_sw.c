@@ -25,6 +25,10 @@
 #include "../SDL_sysrender.h"
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "../../thread/SDL_systhread.h"
+#include "../../video/SDL_blit.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -71,6 +75,8 @@ static int SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
 static int SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                Uint32 format, void * pixels, int pitch);
 static void SW_RenderPresent(SDL_Renderer * renderer);
+static int SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                              void *vertices, size_t vertsize);
 static void SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture);
 static void SW_DestroyRenderer(SDL_Renderer * renderer);
 
@@ -95,12 +101,124 @@ SDL_RenderDriver SW_RenderDriver = {
      0}
 };
 
+/* Bands are at least this many rows, so each one is worth waking a thread for */
+#define SW_MIN_BAND_HEIGHT  16
+
+/* A run of queued commands that is drawn in horizontal bands of the target,
+   one band at a time per thread.  Each band only touches its own rows, and
+   every pixel gets the same operations in the same order as it would in a
+   single-threaded draw, so the result is identical. */
+typedef struct
+{
+    SDL_Surface *surface;
+    const SDL_RenderCommand *first;
+    const SDL_RenderCommand *end;
+    const void *vertices;
+    SDL_Rect viewport;
+    SDL_Rect clip_rect;
+    SDL_bool clipping_enabled;
+    int band_height;
+    int num_bands;
+    SDL_atomic_t next_band;
+    SDL_atomic_t failed;
+} SW_BandJob;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    /* Worker threads, see SDL_HINT_RENDER_SOFTWARE_THREADS */
+    int num_threads;
+    SDL_Thread **threads;
+    SDL_sem *work_sem;
+    SDL_sem *done_sem;
+    SDL_bool quit;
+    SW_BandJob job;
 } SW_RenderData;
 
+static void SW_DrawBands(SW_BandJob *job);
+
+static int SDLCALL
+SW_DrawThread(void *_data)
+{
+    SW_RenderData *data = (SW_RenderData *) _data;
+
+    for ( ; ; ) {
+        SDL_SemWait(data->work_sem);
+        if (data->quit) {
+            break;
+        }
+        SW_DrawBands(&data->job);
+        SDL_SemPost(data->done_sem);
+    }
+    return 0;
+}
+
+static void
+SW_DestroyDrawThreads(SW_RenderData *data)
+{
+    int i;
+
+    if (data->threads) {
+        data->quit = SDL_TRUE;
+        for (i = 0; i < data->num_threads - 1; ++i) {
+            if (data->threads[i]) {
+                SDL_SemPost(data->work_sem);
+            }
+        }
+        for (i = 0; i < data->num_threads - 1; ++i) {
+            if (data->threads[i]) {
+                SDL_WaitThread(data->threads[i], NULL);
+            }
+        }
+        SDL_free(data->threads);
+        data->threads = NULL;
+    }
+    if (data->work_sem) {
+        SDL_DestroySemaphore(data->work_sem);
+        data->work_sem = NULL;
+    }
+    if (data->done_sem) {
+        SDL_DestroySemaphore(data->done_sem);
+        data->done_sem = NULL;
+    }
+    data->num_threads = 0;
+}
+
+static void
+SW_CreateDrawThreads(SW_RenderData *data)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    int num_threads = hint ? SDL_atoi(hint) : 0;
+    int i;
+
+    if (num_threads < 0) {
+        num_threads = SDL_GetCPUCount();
+    }
+    if (num_threads <= 1) {
+        return;
+    }
+
+    /* The rendering thread draws bands too, so start one thread less */
+    data->num_threads = num_threads;
+    data->threads = (SDL_Thread **) SDL_calloc(num_threads - 1, sizeof (SDL_Thread *));
+    data->work_sem = SDL_CreateSemaphore(0);
+    data->done_sem = SDL_CreateSemaphore(0);
+    if (!data->threads || !data->work_sem || !data->done_sem) {
+        SW_DestroyDrawThreads(data);
+        return;
+    }
+    for (i = 0; i < num_threads - 1; ++i) {
+        data->threads[i] = SDL_CreateThreadInternal(SW_DrawThread, "SDLSWRender", 0, data);
+        if (!data->threads[i]) {
+            /* Just draw on a single thread then */
+            SW_DestroyDrawThreads(data);
+            return;
+        }
+    }
+}
+
 
 static SDL_Surface *
 SW_ActivateRenderer(SDL_Renderer * renderer)
@@ -147,6 +265,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    SW_CreateDrawThreads(data);
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -168,6 +287,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->RenderCopyEx = SW_RenderCopyEx;
     renderer->RenderReadPixels = SW_RenderReadPixels;
     renderer->RenderPresent = SW_RenderPresent;
+    renderer->RunCommandQueue = SW_RunCommandQueue;
     renderer->DestroyTexture = SW_DestroyTexture;
     renderer->DestroyRenderer = SW_DestroyRenderer;
     renderer->info = SW_RenderDriver.info;
@@ -364,67 +484,94 @@ SW_UpdateViewport(SDL_Renderer * renderer)
     return 0;
 }
 
+static void
+SW_GetDrawClip(SDL_Surface * surface, const SDL_Rect * viewport,
+               SDL_bool clipping_enabled, const SDL_Rect * clip_rect,
+               SDL_Rect * result)
+{
+    SDL_Rect full_rect;
+
+    SDL_zerop(result);
+    full_rect.x = 0;
+    full_rect.y = 0;
+    full_rect.w = surface->w;
+    full_rect.h = surface->h;
+
+    if (clipping_enabled) {
+        SDL_Rect final_clip_rect;
+        final_clip_rect = *clip_rect;
+        final_clip_rect.x += viewport->x;
+        final_clip_rect.y += viewport->y;
+        SDL_IntersectRect(viewport, &final_clip_rect, &final_clip_rect);
+        SDL_IntersectRect(&final_clip_rect, &full_rect, result);
+    } else {
+        SDL_IntersectRect(viewport, &full_rect, result);
+    }
+}
+
+static void
+SW_SetDrawClip(SDL_Surface * surface, const SDL_Rect * viewport,
+               SDL_bool clipping_enabled, const SDL_Rect * clip_rect)
+{
+    SDL_Rect final_clip_rect;
+
+    SW_GetDrawClip(surface, viewport, clipping_enabled, clip_rect, &final_clip_rect);
+    SDL_SetClipRect(surface, &final_clip_rect);
+}
+
 static int
 SW_UpdateClipRect(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = data->surface;
     if (surface) {
-        if (renderer->clipping_enabled) {
-            SDL_Rect clip_rect;
-            clip_rect = renderer->clip_rect;
-            clip_rect.x += renderer->viewport.x;
-            clip_rect.y += renderer->viewport.y;
-            SDL_IntersectRect(&renderer->viewport, &clip_rect, &clip_rect);
-            SDL_SetClipRect(surface, &clip_rect);
-        } else {
-            SDL_SetClipRect(surface, &renderer->viewport);
-        }
+        SW_SetDrawClip(surface, &renderer->viewport,
+                       renderer->clipping_enabled, &renderer->clip_rect);
     }
     return 0;
 }
 
-static int
-SW_RenderClear(SDL_Renderer * renderer)
+static void
+SW_ClearSurface(SDL_Surface * surface, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    Uint32 color;
+    const Uint32 color = SDL_MapRGBA(surface->format, r, g, b, a);
     SDL_Rect clip_rect;
 
-    if (!surface) {
-        return -1;
-    }
-
-    color = SDL_MapRGBA(surface->format,
-                        renderer->r, renderer->g, renderer->b, renderer->a);
-
     /* By definition the clear ignores the clip rect */
     clip_rect = surface->clip_rect;
     SDL_SetClipRect(surface, NULL);
     SDL_FillRect(surface, NULL, color);
     SDL_SetClipRect(surface, &clip_rect);
-    return 0;
 }
 
 static int
-SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
-                    int count)
+SW_RenderClear(SDL_Renderer * renderer)
 {
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Point *final_points;
-    int i, status;
 
     if (!surface) {
         return -1;
     }
 
+    SW_ClearSurface(surface, renderer->r, renderer->g, renderer->b, renderer->a);
+    return 0;
+}
+
+static int
+SW_DrawPointsToSurface(SDL_Surface * surface, const SDL_Rect * viewport,
+                       const SDL_FPoint * points, int count,
+                       SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_Point *final_points;
+    int i, status;
+
     final_points = SDL_stack_alloc(SDL_Point, count);
     if (!final_points) {
         return SDL_OutOfMemory();
     }
-    if (renderer->viewport.x || renderer->viewport.y) {
-        int x = renderer->viewport.x;
-        int y = renderer->viewport.y;
+    if (viewport->x || viewport->y) {
+        int x = viewport->x;
+        int y = viewport->y;
 
         for (i = 0; i < count; ++i) {
             final_points[i].x = (int)(x + points[i].x);
@@ -438,17 +585,13 @@ SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
     }
 
     /* Draw the points! */
-    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
-        Uint32 color = SDL_MapRGBA(surface->format,
-                                   renderer->r, renderer->g, renderer->b,
-                                   renderer->a);
+    if (blendMode == SDL_BLENDMODE_NONE) {
+        Uint32 color = SDL_MapRGBA(surface->format, r, g, b, a);
 
         status = SDL_DrawPoints(surface, final_points, count, color);
     } else {
         status = SDL_BlendPoints(surface, final_points, count,
-                                renderer->blendMode,
-                                renderer->r, renderer->g, renderer->b,
-                                renderer->a);
+                                 blendMode, r, g, b, a);
     }
     SDL_stack_free(final_points);
 
@@ -456,24 +599,36 @@ SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
 }
 
 static int
-SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
-                   int count)
+SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
+                    int count)
 {
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Point *final_points;
-    int i, status;
 
     if (!surface) {
         return -1;
     }
 
+    return SW_DrawPointsToSurface(surface, &renderer->viewport, points, count,
+                                  renderer->blendMode,
+                                  renderer->r, renderer->g, renderer->b,
+                                  renderer->a);
+}
+
+static int
+SW_DrawLinesToSurface(SDL_Surface * surface, const SDL_Rect * viewport,
+                      const SDL_FPoint * points, int count,
+                      SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_Point *final_points;
+    int i, status;
+
     final_points = SDL_stack_alloc(SDL_Point, count);
     if (!final_points) {
         return SDL_OutOfMemory();
     }
-    if (renderer->viewport.x || renderer->viewport.y) {
-        int x = renderer->viewport.x;
-        int y = renderer->viewport.y;
+    if (viewport->x || viewport->y) {
+        int x = viewport->x;
+        int y = viewport->y;
 
         for (i = 0; i < count; ++i) {
             final_points[i].x = (int)(x + points[i].x);
@@ -487,17 +642,13 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
     }
 
     /* Draw the lines! */
-    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
-        Uint32 color = SDL_MapRGBA(surface->format,
-                                   renderer->r, renderer->g, renderer->b,
-                                   renderer->a);
+    if (blendMode == SDL_BLENDMODE_NONE) {
+        Uint32 color = SDL_MapRGBA(surface->format, r, g, b, a);
 
         status = SDL_DrawLines(surface, final_points, count, color);
     } else {
         status = SDL_BlendLines(surface, final_points, count,
-                                renderer->blendMode,
-                                renderer->r, renderer->g, renderer->b,
-                                renderer->a);
+                                blendMode, r, g, b, a);
     }
     SDL_stack_free(final_points);
 
@@ -505,23 +656,36 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
 }
 
 static int
-SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
+SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
+                   int count)
 {
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Rect *final_rects;
-    int i, status;
 
     if (!surface) {
         return -1;
     }
 
+    return SW_DrawLinesToSurface(surface, &renderer->viewport, points, count,
+                                 renderer->blendMode,
+                                 renderer->r, renderer->g, renderer->b,
+                                 renderer->a);
+}
+
+static int
+SW_FillRectsOnSurface(SDL_Surface * surface, const SDL_Rect * viewport,
+                      const SDL_FRect * rects, int count,
+                      SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_Rect *final_rects;
+    int i, status;
+
     final_rects = SDL_stack_alloc(SDL_Rect, count);
     if (!final_rects) {
         return SDL_OutOfMemory();
     }
-    if (renderer->viewport.x || renderer->viewport.y) {
-        int x = renderer->viewport.x;
-        int y = renderer->viewport.y;
+    if (viewport->x || viewport->y) {
+        int x = viewport->x;
+        int y = viewport->y;
 
         for (i = 0; i < count; ++i) {
             final_rects[i].x = (int)(x + rects[i].x);
@@ -538,16 +702,12 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
         }
     }
 
-    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
-        Uint32 color = SDL_MapRGBA(surface->format,
-                                   renderer->r, renderer->g, renderer->b,
-                                   renderer->a);
+    if (blendMode == SDL_BLENDMODE_NONE) {
+        Uint32 color = SDL_MapRGBA(surface->format, r, g, b, a);
         status = SDL_FillRects(surface, final_rects, count, color);
     } else {
         status = SDL_BlendFillRects(surface, final_rects, count,
-                                    renderer->blendMode,
-                                    renderer->r, renderer->g, renderer->b,
-                                    renderer->a);
+                                    blendMode, r, g, b, a);
     }
     SDL_stack_free(final_rects);
 
@@ -555,20 +715,41 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
 }
 
 static int
-SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
-              const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
 {
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-    SDL_Rect final_rect;
 
     if (!surface) {
         return -1;
     }
 
-    if (renderer->viewport.x || renderer->viewport.y) {
-        final_rect.x = (int)(renderer->viewport.x + dstrect->x);
-        final_rect.y = (int)(renderer->viewport.y + dstrect->y);
+    return SW_FillRectsOnSurface(surface, &renderer->viewport, rects, count,
+                                 renderer->blendMode,
+                                 renderer->r, renderer->g, renderer->b,
+                                 renderer->a);
+}
+
+static int
+GetScaleQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+
+    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
+        return 0;
+    } else {
+        return 1;
+    }
+}
+
+static int
+SW_CopyToSurface(SDL_Surface * surface, const SDL_Rect * viewport, SDL_Surface * src,
+                 const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    SDL_Rect final_rect;
+
+    if (viewport->x || viewport->y) {
+        final_rect.x = (int)(viewport->x + dstrect->x);
+        final_rect.y = (int)(viewport->y + dstrect->y);
     } else {
         final_rect.x = (int)dstrect->x;
         final_rect.y = (int)dstrect->y;
@@ -583,29 +764,30 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
          * to avoid potentially frequent RLE encoding/decoding.
          */
         SDL_SetSurfaceRLE(surface, 0);
-        return SDL_BlitScaled(src, srcrect, surface, &final_rect);
+        return SDL_PrivateUpperBlitScaled(src, srcrect, surface, &final_rect,
+                                          GetScaleQuality() ? SDL_TRUE : SDL_FALSE);
     }
 }
 
 static int
-GetScaleQuality(void)
+SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
+              const SDL_Rect * srcrect, const SDL_FRect * dstrect)
 {
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
 
-    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
-        return 0;
-    } else {
-        return 1;
+    if (!surface) {
+        return -1;
     }
+
+    return SW_CopyToSurface(surface, &renderer->viewport,
+                            (SDL_Surface *) texture->driverdata, srcrect, dstrect);
 }
 
 static int
-SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
-                const SDL_Rect * srcrect, const SDL_FRect * dstrect,
-                const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
+SW_CopyExToSurface(SDL_Surface * surface, const SDL_Rect * viewport, SDL_Surface * src,
+                   const SDL_Rect * srcrect, const SDL_FRect * dstrect,
+                   const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
     SDL_Rect final_rect, tmp_rect;
     SDL_Surface *src_clone, *src_rotated, *src_scaled;
     SDL_Surface *mask = NULL, *mask_rotated = NULL;
@@ -617,13 +799,14 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     int blitRequired = SDL_FALSE;
     int isOpaque = SDL_FALSE;
 
-    if (!surface) {
-        return -1;
+    /* Nothing to rotate or flip, this is just a (possibly scaled) copy */
+    if (angle == 0.0 && flip == SDL_FLIP_NONE) {
+        return SW_CopyToSurface(surface, viewport, src, srcrect, dstrect);
     }
 
-    if (renderer->viewport.x || renderer->viewport.y) {
-        final_rect.x = (int)(renderer->viewport.x + dstrect->x);
-        final_rect.y = (int)(renderer->viewport.y + dstrect->y);
+    if (viewport->x || viewport->y) {
+        final_rect.x = (int)(viewport->x + dstrect->x);
+        final_rect.y = (int)(viewport->y + dstrect->y);
     } else {
         final_rect.x = (int)dstrect->x;
         final_rect.y = (int)dstrect->y;
@@ -705,7 +888,8 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
             retval = -1;
         } else {
             SDL_SetSurfaceBlendMode(src_clone, SDL_BLENDMODE_NONE);
-            retval = SDL_BlitScaled(src_clone, srcrect, src_scaled, &scale_rect);
+            retval = SDL_PrivateUpperBlitScaled(src_clone, srcrect, src_scaled, &scale_rect,
+                                                GetScaleQuality() ? SDL_TRUE : SDL_FALSE);
             SDL_FreeSurface(src_clone);
             src_clone = src_scaled;
             src_scaled = NULL;
@@ -831,6 +1015,22 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     return retval;
 }
 
+static int
+SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
+                const SDL_Rect * srcrect, const SDL_FRect * dstrect,
+                const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+
+    if (!surface) {
+        return -1;
+    }
+
+    return SW_CopyExToSurface(surface, &renderer->viewport,
+                              (SDL_Surface *) texture->driverdata,
+                              srcrect, dstrect, angle, center, flip);
+}
+
 static int
 SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                     Uint32 format, void * pixels, int pitch)
@@ -872,6 +1072,331 @@ SW_RenderPresent(SDL_Renderer * renderer)
     }
 }
 
+static void
+SW_SetTextureDrawState(SDL_Surface * src, const SDL_RenderCommand * cmd)
+{
+    SDL_SetSurfaceColorMod(src, cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b);
+    SDL_SetSurfaceAlphaMod(src, cmd->data.draw.a);
+    SDL_SetSurfaceBlendMode(src, cmd->data.draw.blend);
+}
+
+static void
+SW_DrawBand(SW_BandJob *job, int band)
+{
+    SDL_Surface *surface = job->surface;
+    SDL_Surface clipped = *surface;   /* same pixels, band-local clip rect */
+    SDL_Rect viewport = job->viewport;
+    SDL_Rect clip_rect = job->clip_rect;
+    SDL_bool clipping_enabled = job->clipping_enabled;
+    const SDL_RenderCommand *cmd;
+    SDL_Rect band_rect, draw_clip;
+    int status = 0;
+
+    band_rect.x = 0;
+    band_rect.y = band * job->band_height;
+    band_rect.w = surface->w;
+    band_rect.h = SDL_min(job->band_height, surface->h - band_rect.y);
+
+    SW_GetDrawClip(surface, &viewport, clipping_enabled, &clip_rect, &draw_clip);
+    SDL_IntersectRect(&draw_clip, &band_rect, &clipped.clip_rect);
+
+    for (cmd = job->first; cmd != job->end; cmd = cmd->next) {
+        const Uint8 *verts = NULL;
+        int count = 0;
+
+        if (cmd->command >= SDL_RENDERCMD_DRAW_POINTS) {
+            verts = (const Uint8 *) job->vertices + cmd->data.draw.first;
+            count = (int) cmd->data.draw.count;
+        }
+
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT:
+                viewport = cmd->data.viewport.rect;
+                SW_GetDrawClip(surface, &viewport, clipping_enabled, &clip_rect, &draw_clip);
+                SDL_IntersectRect(&draw_clip, &band_rect, &clipped.clip_rect);
+                break;
+
+            case SDL_RENDERCMD_SETCLIPRECT:
+                clipping_enabled = cmd->data.cliprect.enabled;
+                clip_rect = cmd->data.cliprect.rect;
+                SW_GetDrawClip(surface, &viewport, clipping_enabled, &clip_rect, &draw_clip);
+                SDL_IntersectRect(&draw_clip, &band_rect, &clipped.clip_rect);
+                break;
+
+            case SDL_RENDERCMD_CLEAR: {
+                const Uint32 color = SDL_MapRGBA(surface->format, cmd->data.color.r, cmd->data.color.g,
+                                                 cmd->data.color.b, cmd->data.color.a);
+                /* By definition the clear ignores the clip rect */
+                draw_clip = clipped.clip_rect;
+                clipped.clip_rect = band_rect;
+                status |= SDL_FillRect(&clipped, NULL, color);
+                clipped.clip_rect = draw_clip;
+                break;
+            }
+
+            case SDL_RENDERCMD_FILL_RECTS:
+                status |= SW_FillRectsOnSurface(&clipped, &viewport, (const SDL_FRect *) verts, count,
+                                                cmd->data.draw.blend, cmd->data.draw.r,
+                                                cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+                break;
+
+            case SDL_RENDERCMD_COPY: {
+                SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+                const SDL_RenderCopyData *copy = (const SDL_RenderCopyData *) verts;
+                SDL_Rect final_rect;
+                int i;
+
+                for (i = 0; i < count; ++i) {
+                    final_rect.x = (int)(viewport.x + copy[i].dstrect.x);
+                    final_rect.y = (int)(viewport.y + copy[i].dstrect.y);
+                    status |= SDL_BlitClipped(src, &copy[i].srcrect, surface, &final_rect, &clipped.clip_rect);
+                }
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    if (status < 0) {
+        SDL_AtomicSet(&job->failed, 1);
+    }
+}
+
+static void
+SW_DrawBands(SW_BandJob *job)
+{
+    int band;
+
+    while ((band = SDL_AtomicAdd(&job->next_band, 1)) < job->num_bands) {
+        SW_DrawBand(job, band);
+    }
+}
+
+/* Prepare the command for drawing in bands.  Anything that isn't a clear,
+   a rect fill or an unscaled copy is drawn on the rendering thread, and so
+   is any copy that needs a texture in a different state than an earlier
+   copy in the same job. */
+static SDL_bool
+SW_PrepareBandCommand(SDL_Surface * surface, const SDL_RenderCommand *first,
+                      const SDL_RenderCommand *cmd, const void *vertices)
+{
+    switch (cmd->command) {
+        case SDL_RENDERCMD_NO_OP:
+        case SDL_RENDERCMD_SETVIEWPORT:
+        case SDL_RENDERCMD_SETCLIPRECT:
+        case SDL_RENDERCMD_CLEAR:
+        case SDL_RENDERCMD_FILL_RECTS:
+            return SDL_TRUE;
+
+        case SDL_RENDERCMD_COPY: {
+            SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+            const SDL_RenderCopyData *copy = (const SDL_RenderCopyData *) ((const Uint8 *) vertices + cmd->data.draw.first);
+            const SDL_RenderCommand *prev;
+            int i;
+
+            for (i = 0; i < (int) cmd->data.draw.count; ++i) {
+                if ((int)copy[i].dstrect.w != copy[i].srcrect.w ||
+                    (int)copy[i].dstrect.h != copy[i].srcrect.h) {
+                    return SDL_FALSE;
+                }
+            }
+            for (prev = first; prev != cmd; prev = prev->next) {
+                if (prev->command == SDL_RENDERCMD_COPY &&
+                    prev->data.draw.texture == cmd->data.draw.texture &&
+                    (prev->data.draw.r != cmd->data.draw.r ||
+                     prev->data.draw.g != cmd->data.draw.g ||
+                     prev->data.draw.b != cmd->data.draw.b ||
+                     prev->data.draw.a != cmd->data.draw.a ||
+                     prev->data.draw.blend != cmd->data.draw.blend)) {
+                    return SDL_FALSE;
+                }
+            }
+            SW_SetTextureDrawState(src, cmd);
+            return SDL_PrepareBlitClipped(src, surface);
+        }
+
+        default:
+            return SDL_FALSE;
+    }
+}
+
+/* Draw as many commands as possible, starting at (cmd), on all threads.
+   Returns the first command that wasn't drawn. */
+static SDL_RenderCommand *
+SW_RunBandJob(SW_RenderData *data, SDL_Surface * surface, SDL_RenderCommand *cmd,
+              void *vertices, SDL_Rect *viewport, SDL_bool *clipping_enabled,
+              SDL_Rect *clip_rect, int *status)
+{
+    SW_BandJob *job = &data->job;
+    SDL_RenderCommand *end = cmd;
+    int num_bands, i;
+
+    num_bands = data->num_threads * 4;
+    job->band_height = SDL_max((surface->h + num_bands - 1) / num_bands, SW_MIN_BAND_HEIGHT);
+    job->num_bands = (surface->h + job->band_height - 1) / job->band_height;
+    if (job->num_bands < 2) {
+        return cmd;
+    }
+
+    while (end && SW_PrepareBandCommand(surface, cmd, end, vertices)) {
+        end = end->next;
+    }
+    if (end == cmd) {
+        return cmd;
+    }
+
+    job->surface = surface;
+    job->first = cmd;
+    job->end = end;
+    job->vertices = vertices;
+    job->viewport = *viewport;
+    job->clip_rect = *clip_rect;
+    job->clipping_enabled = *clipping_enabled;
+    SDL_AtomicSet(&job->next_band, 0);
+    SDL_AtomicSet(&job->failed, 0);
+
+    for (i = 0; i < data->num_threads - 1; ++i) {
+        SDL_SemPost(data->work_sem);
+    }
+    SW_DrawBands(job);
+    for (i = 0; i < data->num_threads - 1; ++i) {
+        SDL_SemWait(data->done_sem);
+    }
+    if (SDL_AtomicGet(&job->failed)) {
+        *status = -1;
+    }
+
+    /* Catch up with the state changes the job made */
+    for ( ; cmd != end; cmd = cmd->next) {
+        if (cmd->command == SDL_RENDERCMD_SETVIEWPORT) {
+            *viewport = cmd->data.viewport.rect;
+        } else if (cmd->command == SDL_RENDERCMD_SETCLIPRECT) {
+            *clipping_enabled = cmd->data.cliprect.enabled;
+            *clip_rect = cmd->data.cliprect.rect;
+        }
+    }
+    SW_SetDrawClip(surface, viewport, *clipping_enabled, clip_rect);
+
+    return end;
+}
+
+static int
+SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd,
+                   void *vertices, size_t vertsize)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SDL_Rect viewport = renderer->viewport;
+    SDL_Rect clip_rect = renderer->clip_rect;
+    SDL_bool clipping_enabled = renderer->clipping_enabled;
+    int retval = 0;
+
+    if (!surface) {
+        return -1;
+    }
+
+    while (cmd) {
+        const Uint8 *verts = NULL;
+        int count = 0;
+        int status = 0;
+
+        if (data->num_threads > 1 &&
+            (cmd->command == SDL_RENDERCMD_CLEAR ||
+             cmd->command == SDL_RENDERCMD_FILL_RECTS ||
+             cmd->command == SDL_RENDERCMD_COPY)) {
+            SDL_RenderCommand *next = SW_RunBandJob(data, surface, cmd, vertices, &viewport,
+                                                    &clipping_enabled, &clip_rect, &status);
+            if (next != cmd) {
+                if (status < 0) {
+                    retval = -1;
+                }
+                cmd = next;
+                continue;
+            }
+        }
+
+        if (cmd->command >= SDL_RENDERCMD_DRAW_POINTS) {
+            /* Draw commands reference a range of the vertex buffer */
+            verts = (const Uint8 *) vertices + cmd->data.draw.first;
+            count = (int) cmd->data.draw.count;
+        }
+
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT:
+                viewport = cmd->data.viewport.rect;
+                SW_SetDrawClip(surface, &viewport, clipping_enabled, &clip_rect);
+                break;
+
+            case SDL_RENDERCMD_SETCLIPRECT:
+                clipping_enabled = cmd->data.cliprect.enabled;
+                clip_rect = cmd->data.cliprect.rect;
+                SW_SetDrawClip(surface, &viewport, clipping_enabled, &clip_rect);
+                break;
+
+            case SDL_RENDERCMD_CLEAR:
+                SW_ClearSurface(surface, cmd->data.color.r, cmd->data.color.g,
+                                cmd->data.color.b, cmd->data.color.a);
+                break;
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+                status = SW_DrawPointsToSurface(surface, &viewport, (const SDL_FPoint *) verts, count,
+                                                cmd->data.draw.blend, cmd->data.draw.r,
+                                                cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+                break;
+
+            case SDL_RENDERCMD_DRAW_LINES:
+                status = SW_DrawLinesToSurface(surface, &viewport, (const SDL_FPoint *) verts, count,
+                                               cmd->data.draw.blend, cmd->data.draw.r,
+                                               cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+                break;
+
+            case SDL_RENDERCMD_FILL_RECTS:
+                status = SW_FillRectsOnSurface(surface, &viewport, (const SDL_FRect *) verts, count,
+                                               cmd->data.draw.blend, cmd->data.draw.r,
+                                               cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+                break;
+
+            case SDL_RENDERCMD_COPY: {
+                SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+                const SDL_RenderCopyData *copy = (const SDL_RenderCopyData *) verts;
+                int i;
+
+                /* All copies in this command share the texture state */
+                SW_SetTextureDrawState(src, cmd);
+                for (i = 0; i < count; ++i) {
+                    status |= SW_CopyToSurface(surface, &viewport, src, &copy[i].srcrect, &copy[i].dstrect);
+                }
+                break;
+            }
+
+            case SDL_RENDERCMD_COPY_EX: {
+                SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+                const SDL_RenderCopyExData *copy = (const SDL_RenderCopyExData *) verts;
+                int i;
+
+                SW_SetTextureDrawState(src, cmd);
+                for (i = 0; i < count; ++i) {
+                    status |= SW_CopyExToSurface(surface, &viewport, src, &copy[i].srcrect, &copy[i].dstrect,
+                                                 copy[i].angle, &copy[i].center, copy[i].flip);
+                }
+                break;
+            }
+
+            case SDL_RENDERCMD_NO_OP:
+                break;
+        }
+
+        if (status < 0) {
+            retval = -1;
+        }
+        cmd = cmd->next;
+    }
+
+    return retval;
+}
+
 static void
 SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
@@ -885,6 +1410,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data) {
+        SW_DestroyDrawThreads(data);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -29,6 +29,7 @@
 
 #include "SDL_stdinc.h"
 #include "SDL_endian.h"
+#include "../cpuinfo/SDL_simd.h"
 
 #if defined(HAVE_ICONV) && defined(HAVE_ICONV_H)
 #include <iconv.h>
@@ -86,6 +87,13 @@ SDL_iconv(SDL_iconv_t cd,
     return retCode;
 }
 
+static size_t
+SDL_iconv_outputsize(SDL_iconv_t cd, size_t inbytesleft)
+{
+    /* We don't know the encodings, start with the input size */
+    return inbytesleft;
+}
+
 #else
 
 /* Lots of useful information on Unicode at:
@@ -244,6 +252,600 @@ SDL_iconv_open(const char *tocode, const char *fromcode)
     return (SDL_iconv_t) - 1;
 }
 
+/* Bulk conversion between UTF-8, UTF-16, UTF-32, ASCII and Latin-1
+
+   The general loop in SDL_iconv() converts one character at a time through
+   UCS-4, switching on both encodings for every character.  For the common
+   pairs it first hands the input to a converter specialized for that pair,
+   which copies runs of ASCII 16 characters at a time and converts other
+   well-formed characters directly.  The converter stops at anything it
+   doesn't handle (malformed or truncated input, characters that are
+   replaced or passed through unchecked, a full output buffer), and the
+   general loop converts that one character and reports any error, so the
+   results are the same either way.
+*/
+
+static size_t
+SDL_iconv_unitsize(int fmt)
+{
+    switch (fmt) {
+    case ENCODING_UTF16:
+    case ENCODING_UTF16BE:
+    case ENCODING_UTF16LE:
+    case ENCODING_UCS2BE:
+    case ENCODING_UCS2LE:
+        return 2;
+    case ENCODING_UTF32:
+    case ENCODING_UTF32BE:
+    case ENCODING_UTF32LE:
+    case ENCODING_UCS4BE:
+    case ENCODING_UCS4LE:
+        return 4;
+    default:
+        return 1;
+    }
+}
+
+/* Copy up to n leading ASCII characters, returning how many were copied */
+static size_t
+SDL_iconv_ascii_run(int src_fmt, int dst_fmt, const Uint8 *src, Uint8 *dst, size_t n)
+{
+    const size_t src_size = SDL_iconv_unitsize(src_fmt);
+    const size_t dst_size = SDL_iconv_unitsize(dst_fmt);
+    size_t i = 0;
+
+#if HAVE_SSE2_INTRINSICS
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i high16 = _mm_set1_epi16((short) (src_fmt == ENCODING_UTF16BE ? 0x80FF : 0xFF80));
+    const __m128i high32 = _mm_set1_epi32((int) (src_fmt == ENCODING_UTF32BE ? 0x80FFFFFF : 0xFFFFFF80));
+
+    for (; (i + 16) <= n; i += 16) {
+        const __m128i *s = (const __m128i *) (src + i * src_size);
+        __m128i *d = (__m128i *) (dst + i * dst_size);
+        __m128i v, a, b, c, e;
+
+        /* Pack the next 16 characters into bytes, stopping if any isn't ASCII */
+        switch (src_fmt) {
+        case ENCODING_ASCII:
+            v = _mm_and_si128(_mm_loadu_si128(s), _mm_set1_epi8(0x7F));
+            break;
+        case ENCODING_UTF16BE:
+        case ENCODING_UTF16LE:
+            a = _mm_loadu_si128(s);
+            b = _mm_loadu_si128(s + 1);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), high16), zero)) != 0xFFFF) {
+                goto scalar;
+            }
+            if (src_fmt == ENCODING_UTF16BE) {
+                a = _mm_srli_epi16(a, 8);
+                b = _mm_srli_epi16(b, 8);
+            }
+            v = _mm_packus_epi16(a, b);
+            break;
+        case ENCODING_UTF32BE:
+        case ENCODING_UTF32LE:
+            a = _mm_loadu_si128(s);
+            b = _mm_loadu_si128(s + 1);
+            c = _mm_loadu_si128(s + 2);
+            e = _mm_loadu_si128(s + 3);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, e)), high32), zero)) != 0xFFFF) {
+                goto scalar;
+            }
+            if (src_fmt == ENCODING_UTF32BE) {
+                a = _mm_srli_epi32(a, 24);
+                b = _mm_srli_epi32(b, 24);
+                c = _mm_srli_epi32(c, 24);
+                e = _mm_srli_epi32(e, 24);
+            }
+            v = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, e));
+            break;
+        default:
+            v = _mm_loadu_si128(s);
+            if (_mm_movemask_epi8(v) != 0) {
+                goto scalar;
+            }
+            break;
+        }
+
+        /* Widen the bytes to the output encoding */
+        switch (dst_fmt) {
+        case ENCODING_UTF16BE:
+            _mm_storeu_si128(d, _mm_unpacklo_epi8(zero, v));
+            _mm_storeu_si128(d + 1, _mm_unpackhi_epi8(zero, v));
+            break;
+        case ENCODING_UTF16LE:
+            _mm_storeu_si128(d, _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(d + 1, _mm_unpackhi_epi8(v, zero));
+            break;
+        case ENCODING_UTF32BE:
+            a = _mm_unpacklo_epi8(zero, v);
+            b = _mm_unpackhi_epi8(zero, v);
+            _mm_storeu_si128(d, _mm_unpacklo_epi16(zero, a));
+            _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(zero, a));
+            _mm_storeu_si128(d + 2, _mm_unpacklo_epi16(zero, b));
+            _mm_storeu_si128(d + 3, _mm_unpackhi_epi16(zero, b));
+            break;
+        case ENCODING_UTF32LE:
+            a = _mm_unpacklo_epi8(v, zero);
+            b = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_si128(d, _mm_unpacklo_epi16(a, zero));
+            _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(a, zero));
+            _mm_storeu_si128(d + 2, _mm_unpacklo_epi16(b, zero));
+            _mm_storeu_si128(d + 3, _mm_unpackhi_epi16(b, zero));
+            break;
+        default:
+            _mm_storeu_si128(d, v);
+            break;
+        }
+    }
+scalar:
+#elif HAVE_NEON_INTRINSICS
+    const uint8x16_t zero = vdupq_n_u8(0);
+    const uint8x16_t ascii = vdupq_n_u8(0x7F);
+
+    for (; (i + 16) <= n; i += 16) {
+        const Uint8 *s = src + i * src_size;
+        Uint8 *d = dst + i * dst_size;
+        uint8x16x2_t v2;
+        uint8x16x4_t v4;
+        uint8x16_t v, high;
+        uint64x2_t any;
+
+        /* Pack the next 16 characters into bytes, stopping if any isn't ASCII */
+        switch (src_fmt) {
+        case ENCODING_ASCII:
+            v = vandq_u8(vld1q_u8(s), ascii);
+            high = zero;
+            break;
+        case ENCODING_UTF16BE:
+            v2 = vld2q_u8(s);
+            v = v2.val[1];
+            high = v2.val[0];
+            break;
+        case ENCODING_UTF16LE:
+            v2 = vld2q_u8(s);
+            v = v2.val[0];
+            high = v2.val[1];
+            break;
+        case ENCODING_UTF32BE:
+            v4 = vld4q_u8(s);
+            v = v4.val[3];
+            high = vorrq_u8(vorrq_u8(v4.val[0], v4.val[1]), v4.val[2]);
+            break;
+        case ENCODING_UTF32LE:
+            v4 = vld4q_u8(s);
+            v = v4.val[0];
+            high = vorrq_u8(vorrq_u8(v4.val[1], v4.val[2]), v4.val[3]);
+            break;
+        default:
+            v = vld1q_u8(s);
+            high = zero;
+            break;
+        }
+        any = vreinterpretq_u64_u8(vorrq_u8(high, vbicq_u8(v, ascii)));
+        if ((vgetq_lane_u64(any, 0) | vgetq_lane_u64(any, 1)) != 0) {
+            break;
+        }
+
+        /* Widen the bytes to the output encoding */
+        switch (dst_fmt) {
+        case ENCODING_UTF16BE:
+            v2.val[0] = zero;
+            v2.val[1] = v;
+            vst2q_u8(d, v2);
+            break;
+        case ENCODING_UTF16LE:
+            v2.val[0] = v;
+            v2.val[1] = zero;
+            vst2q_u8(d, v2);
+            break;
+        case ENCODING_UTF32BE:
+            v4.val[0] = v4.val[1] = v4.val[2] = zero;
+            v4.val[3] = v;
+            vst4q_u8(d, v4);
+            break;
+        case ENCODING_UTF32LE:
+            v4.val[0] = v;
+            v4.val[1] = v4.val[2] = v4.val[3] = zero;
+            vst4q_u8(d, v4);
+            break;
+        default:
+            vst1q_u8(d, v);
+            break;
+        }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const Uint8 *s = src + i * src_size;
+        Uint8 *d = dst + i * dst_size;
+        Uint8 ch;
+
+        switch (src_fmt) {
+        case ENCODING_ASCII:
+            ch = s[0] & 0x7F;
+            break;
+        case ENCODING_UTF16BE:
+            if (s[0] != 0) {
+                return i;
+            }
+            ch = s[1];
+            break;
+        case ENCODING_UTF16LE:
+            if (s[1] != 0) {
+                return i;
+            }
+            ch = s[0];
+            break;
+        case ENCODING_UTF32BE:
+            if (s[0] != 0 || s[1] != 0 || s[2] != 0) {
+                return i;
+            }
+            ch = s[3];
+            break;
+        case ENCODING_UTF32LE:
+            if (s[3] != 0 || s[2] != 0 || s[1] != 0) {
+                return i;
+            }
+            ch = s[0];
+            break;
+        default:
+            ch = s[0];
+            break;
+        }
+        if (ch > 0x7F) {
+            return i;
+        }
+
+        switch (dst_fmt) {
+        case ENCODING_UTF16BE:
+            d[0] = 0;
+            d[1] = ch;
+            break;
+        case ENCODING_UTF16LE:
+            d[0] = ch;
+            d[1] = 0;
+            break;
+        case ENCODING_UTF32BE:
+            d[0] = d[1] = d[2] = 0;
+            d[3] = ch;
+            break;
+        case ENCODING_UTF32LE:
+            d[0] = ch;
+            d[1] = d[2] = d[3] = 0;
+            break;
+        default:
+            d[0] = ch;
+            break;
+        }
+    }
+    return n;
+}
+
+/* Decode a character that the general loop would pass through unchanged,
+   returning its length, or 0 to leave it to the general loop */
+SDL_FORCE_INLINE size_t
+SDL_iconv_decode_fast(const int fmt, const Uint8 *p, size_t len, Uint32 *pch)
+{
+    Uint32 ch;
+    Uint16 W1, W2;
+
+    switch (fmt) {
+    case ENCODING_ASCII:
+        *pch = (Uint32) (p[0] & 0x7F);
+        return 1;
+    case ENCODING_LATIN1:
+        *pch = (Uint32) p[0];
+        return 1;
+    case ENCODING_UTF8:
+        if (p[0] < 0x80) {
+            *pch = (Uint32) p[0];
+            return 1;
+        } else if (p[0] < 0xC2) {
+            return 0;
+        } else if (p[0] < 0xE0) {
+            if (len < 2 || (p[1] & 0xC0) != 0x80) {
+                return 0;
+            }
+            *pch = ((Uint32) (p[0] & 0x1F) << 6) | (Uint32) (p[1] & 0x3F);
+            return 2;
+        } else if (p[0] < 0xF0) {
+            if (len < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80) {
+                return 0;
+            }
+            ch = ((Uint32) (p[0] & 0x0F) << 12) | ((Uint32) (p[1] & 0x3F) << 6) | (Uint32) (p[2] & 0x3F);
+            if (ch < 0x800 || (ch >= 0xD800 && ch <= 0xDFFF) || ch >= 0xFFFE) {
+                return 0;
+            }
+            *pch = ch;
+            return 3;
+        } else if (p[0] < 0xF5) {
+            if (len < 4 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80) {
+                return 0;
+            }
+            ch = ((Uint32) (p[0] & 0x07) << 18) | ((Uint32) (p[1] & 0x3F) << 12) | ((Uint32) (p[2] & 0x3F) << 6) | (Uint32) (p[3] & 0x3F);
+            if (ch < 0x10000 || ch > 0x10FFFF) {
+                return 0;
+            }
+            *pch = ch;
+            return 4;
+        }
+        return 0;
+    case ENCODING_UTF16BE:
+    case ENCODING_UTF16LE:
+        if (len < 2) {
+            return 0;
+        }
+        W1 = (fmt == ENCODING_UTF16BE) ? (((Uint16) p[0] << 8) | p[1]) : (((Uint16) p[1] << 8) | p[0]);
+        if (W1 < 0xD800 || (W1 > 0xDFFF && W1 < 0xFFFE)) {
+            *pch = (Uint32) W1;
+            return 2;
+        }
+        if (W1 > 0xDBFF || len < 4) {
+            return 0;
+        }
+        W2 = (fmt == ENCODING_UTF16BE) ? (((Uint16) p[2] << 8) | p[3]) : (((Uint16) p[3] << 8) | p[2]);
+        if (W2 < 0xDC00 || W2 > 0xDFFF) {
+            return 0;
+        }
+        *pch = (((Uint32) (W1 & 0x3FF) << 10) | (Uint32) (W2 & 0x3FF)) + 0x10000;
+        return 4;
+    case ENCODING_UTF32BE:
+    case ENCODING_UTF32LE:
+        if (len < 4) {
+            return 0;
+        }
+        if (fmt == ENCODING_UTF32BE) {
+            ch = ((Uint32) p[0] << 24) | ((Uint32) p[1] << 16) | ((Uint32) p[2] << 8) | (Uint32) p[3];
+        } else {
+            ch = ((Uint32) p[3] << 24) | ((Uint32) p[2] << 16) | ((Uint32) p[1] << 8) | (Uint32) p[0];
+        }
+        if ((ch >= 0xD800 && ch <= 0xDFFF) || ch == 0xFFFE || ch == 0xFFFF || ch > 0x10FFFF) {
+            return 0;
+        }
+        *pch = ch;
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+/* Encode a character from SDL_iconv_decode_fast(), returning its length,
+   or 0 if it doesn't fit */
+SDL_FORCE_INLINE size_t
+SDL_iconv_encode_fast(const int fmt, Uint32 ch, Uint8 *p, size_t len)
+{
+    Uint16 W1, W2;
+
+    switch (fmt) {
+    case ENCODING_ASCII:
+    case ENCODING_LATIN1:
+        if (len < 1) {
+            return 0;
+        }
+        p[0] = (ch > ((fmt == ENCODING_ASCII) ? 0x7F : 0xFF)) ? UNKNOWN_ASCII : (Uint8) ch;
+        return 1;
+    case ENCODING_UTF8:
+        if (ch <= 0x7F) {
+            if (len < 1) {
+                return 0;
+            }
+            p[0] = (Uint8) ch;
+            return 1;
+        } else if (ch <= 0x7FF) {
+            if (len < 2) {
+                return 0;
+            }
+            p[0] = 0xC0 | (Uint8) ((ch >> 6) & 0x1F);
+            p[1] = 0x80 | (Uint8) (ch & 0x3F);
+            return 2;
+        } else if (ch <= 0xFFFF) {
+            if (len < 3) {
+                return 0;
+            }
+            p[0] = 0xE0 | (Uint8) ((ch >> 12) & 0x0F);
+            p[1] = 0x80 | (Uint8) ((ch >> 6) & 0x3F);
+            p[2] = 0x80 | (Uint8) (ch & 0x3F);
+            return 3;
+        }
+        if (len < 4) {
+            return 0;
+        }
+        p[0] = 0xF0 | (Uint8) ((ch >> 18) & 0x07);
+        p[1] = 0x80 | (Uint8) ((ch >> 12) & 0x3F);
+        p[2] = 0x80 | (Uint8) ((ch >> 6) & 0x3F);
+        p[3] = 0x80 | (Uint8) (ch & 0x3F);
+        return 4;
+    case ENCODING_UTF16BE:
+    case ENCODING_UTF16LE:
+        if (ch < 0x10000) {
+            if (len < 2) {
+                return 0;
+            }
+            W1 = (Uint16) ch;
+            if (fmt == ENCODING_UTF16BE) {
+                p[0] = (Uint8) (W1 >> 8);
+                p[1] = (Uint8) W1;
+            } else {
+                p[1] = (Uint8) (W1 >> 8);
+                p[0] = (Uint8) W1;
+            }
+            return 2;
+        }
+        if (len < 4) {
+            return 0;
+        }
+        ch = ch - 0x10000;
+        W1 = 0xD800 | (Uint16) ((ch >> 10) & 0x3FF);
+        W2 = 0xDC00 | (Uint16) (ch & 0x3FF);
+        if (fmt == ENCODING_UTF16BE) {
+            p[0] = (Uint8) (W1 >> 8);
+            p[1] = (Uint8) W1;
+            p[2] = (Uint8) (W2 >> 8);
+            p[3] = (Uint8) W2;
+        } else {
+            p[1] = (Uint8) (W1 >> 8);
+            p[0] = (Uint8) W1;
+            p[3] = (Uint8) (W2 >> 8);
+            p[2] = (Uint8) W2;
+        }
+        return 4;
+    case ENCODING_UTF32BE:
+        if (len < 4) {
+            return 0;
+        }
+        p[0] = (Uint8) (ch >> 24);
+        p[1] = (Uint8) (ch >> 16);
+        p[2] = (Uint8) (ch >> 8);
+        p[3] = (Uint8) ch;
+        return 4;
+    case ENCODING_UTF32LE:
+        if (len < 4) {
+            return 0;
+        }
+        p[3] = (Uint8) (ch >> 24);
+        p[2] = (Uint8) (ch >> 16);
+        p[1] = (Uint8) (ch >> 8);
+        p[0] = (Uint8) ch;
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+SDL_FORCE_INLINE size_t
+SDL_iconv_fast(const int src_fmt, const int dst_fmt,
+               const char **inbuf, size_t *inbytesleft,
+               char **outbuf, size_t *outbytesleft)
+{
+    const size_t src_size = SDL_iconv_unitsize(src_fmt);
+    const size_t dst_size = SDL_iconv_unitsize(dst_fmt);
+    const Uint8 *src = (const Uint8 *) *inbuf;
+    Uint8 *dst = (Uint8 *) *outbuf;
+    size_t srclen = *inbytesleft;
+    size_t dstlen = *outbytesleft;
+    size_t total = 0;
+
+    for (;;) {
+        size_t n = SDL_min(srclen / src_size, dstlen / dst_size);
+        size_t inlen, outlen;
+        Uint32 ch;
+
+        if (n > 0) {
+            n = SDL_iconv_ascii_run(src_fmt, dst_fmt, src, dst, n);
+            src += n * src_size;
+            srclen -= n * src_size;
+            dst += n * dst_size;
+            dstlen -= n * dst_size;
+            total += n;
+        }
+        if (srclen == 0) {
+            break;
+        }
+
+        inlen = SDL_iconv_decode_fast(src_fmt, src, srclen, &ch);
+        if (!inlen) {
+            break;
+        }
+        outlen = SDL_iconv_encode_fast(dst_fmt, ch, dst, dstlen);
+        if (!outlen) {
+            break;
+        }
+        src += inlen;
+        srclen -= inlen;
+        dst += outlen;
+        dstlen -= outlen;
+        ++total;
+    }
+
+    *inbuf = (const char *) src;
+    *inbytesleft = srclen;
+    *outbuf = (char *) dst;
+    *outbytesleft = dstlen;
+    return total;
+}
+
+/* Convert as much as possible with a specialized converter, returning the
+   number of characters converted */
+static size_t
+SDL_iconv_bulk(SDL_iconv_t cd,
+               const char **inbuf, size_t *inbytesleft,
+               char **outbuf, size_t *outbytesleft)
+{
+#define BULK_CONVERT(SRC, DST) \
+    case (((SRC) << 4) | (DST)): \
+        return SDL_iconv_fast(SRC, DST, inbuf, inbytesleft, outbuf, outbytesleft)
+#define BULK_CONVERT_FROM(SRC) \
+    BULK_CONVERT(SRC, ENCODING_UTF8); \
+    BULK_CONVERT(SRC, ENCODING_UTF16BE); \
+    BULK_CONVERT(SRC, ENCODING_UTF16LE); \
+    BULK_CONVERT(SRC, ENCODING_UTF32BE); \
+    BULK_CONVERT(SRC, ENCODING_UTF32LE)
+
+    switch ((cd->src_fmt << 4) | cd->dst_fmt) {
+    BULK_CONVERT_FROM(ENCODING_UTF8);
+    BULK_CONVERT_FROM(ENCODING_UTF16BE);
+    BULK_CONVERT_FROM(ENCODING_UTF16LE);
+    BULK_CONVERT_FROM(ENCODING_UTF32BE);
+    BULK_CONVERT_FROM(ENCODING_UTF32LE);
+    BULK_CONVERT_FROM(ENCODING_ASCII);
+    BULK_CONVERT_FROM(ENCODING_LATIN1);
+    BULK_CONVERT(ENCODING_UTF8, ENCODING_ASCII);
+    BULK_CONVERT(ENCODING_UTF8, ENCODING_LATIN1);
+    BULK_CONVERT(ENCODING_UTF16BE, ENCODING_ASCII);
+    BULK_CONVERT(ENCODING_UTF16BE, ENCODING_LATIN1);
+    BULK_CONVERT(ENCODING_UTF16LE, ENCODING_ASCII);
+    BULK_CONVERT(ENCODING_UTF16LE, ENCODING_LATIN1);
+    BULK_CONVERT(ENCODING_UTF32BE, ENCODING_ASCII);
+    BULK_CONVERT(ENCODING_UTF32BE, ENCODING_LATIN1);
+    BULK_CONVERT(ENCODING_UTF32LE, ENCODING_ASCII);
+    BULK_CONVERT(ENCODING_UTF32LE, ENCODING_LATIN1);
+    default:
+        return 0;
+    }
+#undef BULK_CONVERT_FROM
+#undef BULK_CONVERT
+}
+
+/* The most output SDL_iconv() can produce from inbytesleft bytes, so
+   SDL_iconv_string() can allocate its result once */
+static size_t
+SDL_iconv_outputsize(SDL_iconv_t cd, size_t inbytesleft)
+{
+    const size_t src_size = SDL_iconv_unitsize(cd->src_fmt);
+    const size_t units = inbytesleft / src_size;
+    size_t unit_output;
+
+    switch (cd->dst_fmt) {
+    case ENCODING_ASCII:
+    case ENCODING_LATIN1:
+        unit_output = 1;
+        break;
+    case ENCODING_UTF8:
+        /* A stray byte or UTF-16 code unit becomes a 3 byte U+FFFD */
+        unit_output = (src_size == 4) ? 4 : 3;
+        break;
+    case ENCODING_UTF16:
+    case ENCODING_UTF16BE:
+    case ENCODING_UTF16LE:
+        unit_output = (src_size == 4) ? 4 : 2;
+        break;
+    case ENCODING_UCS2BE:
+    case ENCODING_UCS2LE:
+        unit_output = 2;
+        break;
+    default:
+        unit_output = 4;
+        break;
+    }
+
+    /* Leave room for a byte order marker and a terminator */
+    if (units > ((((size_t) -1) - 8) / unit_output)) {
+        return inbytesleft;
+    }
+    return units * unit_output + 8;
+}
+
 size_t
 SDL_iconv(SDL_iconv_t cd,
           const char **inbuf, size_t * inbytesleft,
@@ -254,6 +856,7 @@ SDL_iconv(SDL_iconv_t cd,
     char *dst;
     size_t srclen, dstlen;
     Uint32 ch = 0;
+    size_t converted;
     size_t total;
 
     if (!inbuf || !*inbuf) {
@@ -342,6 +945,19 @@ SDL_iconv(SDL_iconv_t cd,
 
     total = 0;
     while (srclen > 0) {
+        /* Convert what we can in bulk, then one character at a time */
+        converted = SDL_iconv_bulk(cd, &src, &srclen, &dst, &dstlen);
+        if (converted) {
+            *inbuf = src;
+            *inbytesleft = srclen;
+            *outbuf = dst;
+            *outbytesleft = dstlen;
+            total += converted;
+            if (srclen == 0) {
+                break;
+            }
+        }
+
         /* Decode a character */
         switch (cd->src_fmt) {
         case ENCODING_ASCII:
@@ -865,6 +1481,7 @@ char *
 SDL_iconv_string(const char *tocode, const char *fromcode, const char *inbuf,
                  size_t inbytesleft)
 {
+    const size_t insize = inbytesleft;
     SDL_iconv_t cd;
     char *string;
     size_t stringsize;
@@ -887,7 +1504,10 @@ SDL_iconv_string(const char *tocode, const char *fromcode, const char *inbuf,
         return NULL;
     }
 
-    stringsize = inbytesleft > 4 ? inbytesleft : 4;
+    stringsize = SDL_iconv_outputsize(cd, inbytesleft);
+    if (stringsize < 4) {
+        stringsize = 4;
+    }
     string = SDL_malloc(stringsize);
     if (!string) {
         SDL_iconv_close(cd);
@@ -928,6 +1548,20 @@ SDL_iconv_string(const char *tocode, const char *fromcode, const char *inbuf,
     }
     SDL_iconv_close(cd);
 
+    /* Give back the space the output didn't need, keeping at least as much
+       as the input, which is what the result has always been sized to */
+    if (outbytesleft >= 4 && outbytesleft > stringsize / 2) {
+        size_t size = SDL_max((size_t) (outbuf - string) + 4, insize);
+        if (size < stringsize) {
+            char *shrunk;
+
+            SDL_memset(outbuf, 0, 4);
+            shrunk = SDL_realloc(string, size);
+            if (shrunk) {
+                string = shrunk;
+            }
+        }
+    }
     return string;
 }
 
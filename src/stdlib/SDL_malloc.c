@@ -5373,4 +5373,377 @@ void SDL_free(void *ptr)
     (void)SDL_AtomicDecRef(&s_mem.num_allocations);
 }
 
+/* Optional thread-caching allocator, see SDL_GetThreadCachedMemoryFunctions().
+
+   Small requests are rounded up to a size class. Each thread keeps a free
+   list per class, so most allocations and frees touch no lock at all.
+   When a thread's list gets too long, half of it moves to a shared list
+   for that class in one batch; an empty thread list refills from there,
+   and only goes to the underlying allocator when the shared list is empty
+   too. Every block is an allocation of its own from the underlying
+   allocator, so surplus blocks can be handed back to it individually. */
+
+#if defined(_MSC_VER)
+#define SDL_MEMCACHE_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define SDL_MEMCACHE_THREAD_LOCAL __thread
+#endif
+
+#ifdef SDL_MEMCACHE_THREAD_LOCAL
+
+#define SDL_MEMCACHE_NUM_CLASSES 12
+#define SDL_MEMCACHE_LARGE SDL_MEMCACHE_NUM_CLASSES
+#define SDL_MEMCACHE_THREAD_MAX 64      /* blocks a thread keeps per class */
+#define SDL_MEMCACHE_BATCH 32           /* blocks moved to or from the shared list at once */
+#define SDL_MEMCACHE_SHARED_MAX 1024    /* blocks the shared list keeps per class */
+
+static const size_t s_memcache_sizes[SDL_MEMCACHE_NUM_CLASSES] = {
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024
+};
+
+/* Sits in front of every block; 16 bytes keeps the caller's pointer aligned. */
+typedef union SDL_MemCacheHeader
+{
+    struct {
+        size_t sizeclass;  /* index into s_memcache_sizes, or SDL_MEMCACHE_LARGE */
+        size_t size;       /* usable bytes after the header */
+    } info;
+    union SDL_MemCacheHeader *next;  /* free list link while cached */
+    char align[16];
+} SDL_MemCacheHeader;
+
+typedef struct
+{
+    Uint64 allocations;
+    Uint64 frees;
+    Uint64 cache_hits;
+    Uint64 heap_allocations;
+} SDL_MemCacheCounters;
+
+typedef struct
+{
+    SDL_MemCacheHeader *head;
+    int count;
+    SDL_MemCacheCounters counters;  /* not yet added to the shared totals */
+} SDL_MemCacheThreadList;
+
+typedef struct
+{
+    SDL_SpinLock lock;
+    SDL_MemCacheHeader *head;
+    int count;
+    SDL_MemCacheCounters counters;
+} SDL_MemCacheSharedList;
+
+static SDL_MEMCACHE_THREAD_LOCAL SDL_MemCacheThreadList s_memcache_thread[SDL_MEMCACHE_NUM_CLASSES];
+static SDL_MemCacheSharedList s_memcache_shared[SDL_MEMCACHE_NUM_CLASSES];
+static SDL_MemCacheCounters s_memcache_large;
+static SDL_SpinLock s_memcache_large_lock;
+
+static int
+SDL_MemCacheClass(size_t size)
+{
+    int i;
+    for (i = 0; i < SDL_MEMCACHE_NUM_CLASSES; i++) {
+        if (size <= s_memcache_sizes[i]) {
+            return i;
+        }
+    }
+    return SDL_MEMCACHE_LARGE;
+}
+
+/* Call with the shared list locked. */
+static void
+SDL_MemCachePublishCounters(SDL_MemCacheSharedList *shared, SDL_MemCacheThreadList *local)
+{
+    shared->counters.allocations += local->counters.allocations;
+    shared->counters.frees += local->counters.frees;
+    shared->counters.cache_hits += local->counters.cache_hits;
+    shared->counters.heap_allocations += local->counters.heap_allocations;
+    SDL_zero(local->counters);
+}
+
+/* Move (count) blocks from the front of the thread's list to the shared list. */
+static void
+SDL_MemCacheFlush(const int sizeclass, int count)
+{
+    SDL_MemCacheThreadList *local = &s_memcache_thread[sizeclass];
+    SDL_MemCacheSharedList *shared = &s_memcache_shared[sizeclass];
+    SDL_MemCacheHeader *first = local->head;
+    SDL_MemCacheHeader *last = first;
+    SDL_MemCacheHeader *surplus = NULL;
+    int i;
+
+    if (count <= 0) {
+        return;
+    }
+    for (i = 1; i < count; i++) {
+        last = last->next;
+    }
+    local->head = last->next;
+    local->count -= count;
+
+    SDL_AtomicLock(&shared->lock);
+    SDL_MemCachePublishCounters(shared, local);
+    if (shared->count + count <= SDL_MEMCACHE_SHARED_MAX) {
+        last->next = shared->head;
+        shared->head = first;
+        shared->count += count;
+    } else {
+        surplus = first;
+        last->next = NULL;
+    }
+    SDL_AtomicUnlock(&shared->lock);
+
+    /* the shared list is full, so these go back to the heap. */
+    while (surplus) {
+        SDL_MemCacheHeader *next = surplus->next;
+        real_free(surplus);
+        surplus = next;
+    }
+}
+
+static SDL_MemCacheHeader *
+SDL_MemCacheRefill(const int sizeclass)
+{
+    SDL_MemCacheThreadList *local = &s_memcache_thread[sizeclass];
+    SDL_MemCacheSharedList *shared = &s_memcache_shared[sizeclass];
+    SDL_MemCacheHeader *block = NULL;
+    int i;
+
+    SDL_AtomicLock(&shared->lock);
+    SDL_MemCachePublishCounters(shared, local);
+    for (i = 0; (i < SDL_MEMCACHE_BATCH) && shared->head; i++) {
+        SDL_MemCacheHeader *next = shared->head->next;
+        shared->head->next = local->head;
+        local->head = shared->head;
+        local->count++;
+        shared->head = next;
+        shared->count--;
+    }
+    SDL_AtomicUnlock(&shared->lock);
+
+    if (local->head) {
+        block = local->head;
+        local->head = block->next;
+        local->count--;
+    } else {
+        block = (SDL_MemCacheHeader *) real_malloc(sizeof (SDL_MemCacheHeader) + s_memcache_sizes[sizeclass]);
+        local->counters.heap_allocations++;
+    }
+    return block;
+}
+
+static void * SDLCALL
+SDL_MemCacheMalloc(size_t size)
+{
+    const int sizeclass = SDL_MemCacheClass(size);
+    SDL_MemCacheHeader *block;
+
+    if (sizeclass == SDL_MEMCACHE_LARGE) {
+        if (size > (~(size_t) 0) - sizeof (SDL_MemCacheHeader)) {
+            return NULL;
+        }
+        block = (SDL_MemCacheHeader *) real_malloc(sizeof (SDL_MemCacheHeader) + size);
+        if (!block) {
+            return NULL;
+        }
+        SDL_AtomicLock(&s_memcache_large_lock);
+        s_memcache_large.allocations++;
+        s_memcache_large.heap_allocations++;
+        SDL_AtomicUnlock(&s_memcache_large_lock);
+    } else {
+        SDL_MemCacheThreadList *local = &s_memcache_thread[sizeclass];
+        block = local->head;
+        if (block) {
+            local->head = block->next;
+            local->count--;
+            local->counters.cache_hits++;
+        } else {
+            block = SDL_MemCacheRefill(sizeclass);
+            if (!block) {
+                return NULL;
+            }
+        }
+        local->counters.allocations++;
+        size = s_memcache_sizes[sizeclass];
+    }
+
+    block->info.sizeclass = (size_t) sizeclass;
+    block->info.size = size;
+    return block + 1;
+}
+
+static void SDLCALL
+SDL_MemCacheFree(void *ptr)
+{
+    SDL_MemCacheHeader *block;
+    int sizeclass;
+
+    if (!ptr) {
+        return;
+    }
+
+    block = ((SDL_MemCacheHeader *) ptr) - 1;
+    sizeclass = (int) block->info.sizeclass;
+    if (sizeclass == SDL_MEMCACHE_LARGE) {
+        SDL_AtomicLock(&s_memcache_large_lock);
+        s_memcache_large.frees++;
+        SDL_AtomicUnlock(&s_memcache_large_lock);
+        real_free(block);
+    } else {
+        /* blocks freed on another thread just join this thread's cache. */
+        SDL_MemCacheThreadList *local = &s_memcache_thread[sizeclass];
+        block->next = local->head;
+        local->head = block;
+        local->count++;
+        local->counters.frees++;
+        if (local->count > SDL_MEMCACHE_THREAD_MAX) {
+            SDL_MemCacheFlush(sizeclass, local->count / 2);
+        }
+    }
+}
+
+static void * SDLCALL
+SDL_MemCacheCalloc(size_t nmemb, size_t size)
+{
+    void *mem;
+
+    if (size && (nmemb > (~(size_t) 0) / size)) {
+        return NULL;
+    }
+    mem = SDL_MemCacheMalloc(nmemb * size);
+    if (mem) {
+        SDL_memset(mem, 0, nmemb * size);
+    }
+    return mem;
+}
+
+static void * SDLCALL
+SDL_MemCacheRealloc(void *ptr, size_t size)
+{
+    SDL_MemCacheHeader *block;
+    void *mem;
+
+    if (!ptr) {
+        return SDL_MemCacheMalloc(size);
+    }
+
+    block = ((SDL_MemCacheHeader *) ptr) - 1;
+    if (block->info.sizeclass != SDL_MEMCACHE_LARGE) {
+        if (SDL_MemCacheClass(size) == (int) block->info.sizeclass) {
+            return ptr;  /* still fits the same class. */
+        }
+    } else if (SDL_MemCacheClass(size) == SDL_MEMCACHE_LARGE) {
+        /* large to large can grow in place. */
+        if (size > (~(size_t) 0) - sizeof (SDL_MemCacheHeader)) {
+            return NULL;
+        }
+        block = (SDL_MemCacheHeader *) real_realloc(block, sizeof (SDL_MemCacheHeader) + size);
+        if (!block) {
+            return NULL;
+        }
+        block->info.size = size;
+        return block + 1;
+    }
+
+    mem = SDL_MemCacheMalloc(size);
+    if (mem) {
+        SDL_memcpy(mem, ptr, SDL_min(size, block->info.size));
+        SDL_MemCacheFree(ptr);
+    }
+    return mem;
+}
+
+void
+SDL_ReleaseThreadMemoryCache(void)
+{
+    int i;
+    for (i = 0; i < SDL_MEMCACHE_NUM_CLASSES; i++) {
+        SDL_MemCacheFlush(i, s_memcache_thread[i].count);
+    }
+}
+
+int
+SDL_GetThreadCachedMemoryFunctions(SDL_malloc_func *malloc_func,
+                                   SDL_calloc_func *calloc_func,
+                                   SDL_realloc_func *realloc_func,
+                                   SDL_free_func *free_func)
+{
+    if (malloc_func) {
+        *malloc_func = SDL_MemCacheMalloc;
+    }
+    if (calloc_func) {
+        *calloc_func = SDL_MemCacheCalloc;
+    }
+    if (realloc_func) {
+        *realloc_func = SDL_MemCacheRealloc;
+    }
+    if (free_func) {
+        *free_func = SDL_MemCacheFree;
+    }
+    return 0;
+}
+
+int
+SDL_GetMemorySizeClassStats(SDL_MemorySizeClassStats *stats, int maxstats)
+{
+    const int numstats = SDL_MEMCACHE_NUM_CLASSES + 1;
+    SDL_MemCacheCounters counters;
+    int i;
+
+    /* this thread's pending counts are exact to publish; other threads publish at batch boundaries. */
+    for (i = 0; (i < SDL_MEMCACHE_NUM_CLASSES) && (i < maxstats); i++) {
+        SDL_MemCacheSharedList *shared = &s_memcache_shared[i];
+        SDL_AtomicLock(&shared->lock);
+        SDL_MemCachePublishCounters(shared, &s_memcache_thread[i]);
+        counters = shared->counters;
+        SDL_AtomicUnlock(&shared->lock);
+
+        stats[i].size = s_memcache_sizes[i];
+        stats[i].allocations = counters.allocations;
+        stats[i].frees = counters.frees;
+        stats[i].cache_hits = counters.cache_hits;
+        stats[i].heap_allocations = counters.heap_allocations;
+    }
+
+    if (maxstats >= numstats) {
+        SDL_AtomicLock(&s_memcache_large_lock);
+        counters = s_memcache_large;
+        SDL_AtomicUnlock(&s_memcache_large_lock);
+
+        stats[SDL_MEMCACHE_LARGE].size = 0;
+        stats[SDL_MEMCACHE_LARGE].allocations = counters.allocations;
+        stats[SDL_MEMCACHE_LARGE].frees = counters.frees;
+        stats[SDL_MEMCACHE_LARGE].cache_hits = 0;
+        stats[SDL_MEMCACHE_LARGE].heap_allocations = counters.heap_allocations;
+    }
+
+    return numstats;
+}
+
+#else /* !SDL_MEMCACHE_THREAD_LOCAL */
+
+void
+SDL_ReleaseThreadMemoryCache(void)
+{
+}
+
+int
+SDL_GetThreadCachedMemoryFunctions(SDL_malloc_func *malloc_func,
+                                   SDL_calloc_func *calloc_func,
+                                   SDL_realloc_func *realloc_func,
+                                   SDL_free_func *free_func)
+{
+    return SDL_Unsupported();
+}
+
+int
+SDL_GetMemorySizeClassStats(SDL_MemorySizeClassStats *stats, int maxstats)
+{
+    return 0;
+}
+
+#endif /* SDL_MEMCACHE_THREAD_LOCAL */
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -295,6 +295,9 @@ SDL_RunThread(void *data)
             SDL_free(thread);
         }
     }
+
+    /* Hand any memory this thread cached back to the other threads */
+    SDL_ReleaseThreadMemoryCache();
 }
 
 #ifdef SDL_CreateThread
@@ -66,6 +66,9 @@ struct SDL_Thread
 /* This is the function called to run a thread */
 extern void SDL_RunThread(void *data);
 
+/* This is the function called when a thread exits to return its cached memory */
+extern void SDL_ReleaseThreadMemoryCache(void);
+
 /* This is the system-independent thread local storage structure */
 typedef struct {
     unsigned int limit;
@@ -22,6 +22,7 @@
 
 #include "SDL_timer.h"
 #include "SDL_timer_c.h"
+#include "SDL_assert.h"
 #include "SDL_atomic.h"
 #include "SDL_cpuinfo.h"
 #include "../thread/SDL_systhread.h"
@@ -34,9 +35,16 @@ typedef struct _SDL_Timer
     SDL_TimerCallback callback;
     void *param;
     Uint32 interval;
-    Uint32 scheduled;
+    Uint64 scheduled;               /* in performance counter ticks */
     SDL_atomic_t canceled;
     struct _SDL_Timer *next;
+    struct _SDL_Timer *next_canceled;   /* it might still be on the pending list */
+
+    /* Timer heap links - these are only touched by the timer thread */
+    SDL_bool queued;
+    struct _SDL_Timer *child;       /* first child */
+    struct _SDL_Timer *sibling;     /* next child of our parent */
+    struct _SDL_Timer *prev;        /* parent if we're the first child, else previous sibling */
 } SDL_Timer;
 
 typedef struct _SDL_TimerMap
@@ -46,13 +54,16 @@ typedef struct _SDL_TimerMap
     struct _SDL_TimerMap *next;
 } SDL_TimerMap;
 
-/* The timers are kept in a sorted list */
+/* The timers are kept in a heap ordered by scheduling time */
 typedef struct {
     /* Data used by the main thread */
     SDL_Thread *thread;
     SDL_atomic_t nextID;
-    SDL_TimerMap *timermap;
+    SDL_TimerMap **timermap;        /* hash table of timer IDs */
+    int timermap_size;              /* number of buckets, a power of two */
+    int timermap_count;
     SDL_mutex *timermap_lock;
+    Uint64 frequency;
 
     /* Padding to separate cache lines between threads */
     char cache_pad[SDL_CACHELINE_SIZE];
@@ -61,10 +72,11 @@ typedef struct {
     SDL_SpinLock lock;
     SDL_sem *sem;
     SDL_Timer *pending;
+    SDL_Timer *canceled;
     SDL_Timer *freelist;
     SDL_atomic_t active;
 
-    /* List of timers - this is only touched by the timer thread */
+    /* Heap of timers - this is only touched by the timer thread */
     SDL_Timer *timers;
 } SDL_TimerData;
 
@@ -73,28 +85,118 @@ static SDL_TimerData SDL_timer_data;
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
- * Timers are removed by simply setting a canceled flag
+ * The queue is a pairing heap linked through the timers themselves, so
+ * adding a timer is O(1) and taking the next one or removing a canceled
+ * one is O(log n) amortized, and the timer thread never allocates memory.
+ *
+ * Timers are canceled by setting a canceled flag and handing them to the
+ * timer thread, which takes them out of the heap. Whichever of
+ * SDL_RemoveTimer() or the timer thread sets the flag owns the timer and
+ * puts it on the freelist.
  */
 
-static void
-SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+#define SDL_TimerBefore(A, B)   ((Sint64)((A)->scheduled - (B)->scheduled) < 0)
+
+/* Make the later of two heaps the first child of the earlier one */
+static SDL_Timer *
+SDL_MeldTimers(SDL_Timer *a, SDL_Timer *b)
 {
-    SDL_Timer *prev, *curr;
+    if (SDL_TimerBefore(b, a)) {
+        SDL_Timer *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    b->prev = a;
+    b->sibling = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    return a;
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if ((Sint32)(timer->scheduled-curr->scheduled) < 0) {
-            break;
+/* Combine a list of sibling heaps into one: meld them in pairs from the
+   left, then meld the pairs together from the right. */
+static SDL_Timer *
+SDL_MergeTimerSiblings(SDL_Timer *first)
+{
+    SDL_Timer *pairs = NULL;
+    SDL_Timer *a, *b, *result;
+
+    while (first) {
+        a = first;
+        b = a->sibling;
+        if (b) {
+            first = b->sibling;
+            a = SDL_MeldTimers(a, b);
+        } else {
+            first = NULL;
+        }
+        /* Stack the melded pairs up, so we go back through them in reverse */
+        a->sibling = pairs;
+        pairs = a;
+    }
+
+    result = pairs;
+    if (result) {
+        pairs = result->sibling;
+        while (pairs) {
+            a = pairs;
+            pairs = pairs->sibling;
+            result = SDL_MeldTimers(result, a);
         }
+        result->prev = NULL;
+        result->sibling = NULL;
     }
+    return result;
+}
+
+static void
+SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    timer->child = NULL;
+    timer->sibling = NULL;
+    timer->prev = NULL;
+    timer->queued = SDL_TRUE;
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
+    if (data->timers) {
+        data->timers = SDL_MeldTimers(data->timers, timer);
     } else {
         data->timers = timer;
     }
-    timer->next = curr;
+}
+
+static void
+SDL_RemoveTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    SDL_Timer *children;
+
+    SDL_assert(timer->queued);
+
+    if (timer == data->timers) {
+        data->timers = SDL_MergeTimerSiblings(timer->child);
+    } else {
+        /* Cut this timer's subtree out of the heap... */
+        if (timer->prev->child == timer) {
+            timer->prev->child = timer->sibling;
+        } else {
+            timer->prev->sibling = timer->sibling;
+        }
+        if (timer->sibling) {
+            timer->sibling->prev = timer->prev;
+        }
+
+        /* ... and put its children back in */
+        children = SDL_MergeTimerSiblings(timer->child);
+        if (children) {
+            data->timers = SDL_MeldTimers(data->timers, children);
+        }
+    }
+
+    timer->child = NULL;
+    timer->sibling = NULL;
+    timer->prev = NULL;
+    timer->queued = SDL_FALSE;
 }
 
 static int SDLCALL
@@ -102,13 +204,15 @@ SDL_TimerThread(void *_data)
 {
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
+    SDL_Timer *canceled;
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
-    Uint32 tick, now, interval, delay;
+    Uint64 now, next;
+    Uint32 interval, delay;
 
     /* Threaded timer loop:
-     *  1. Queue timers added by other threads
+     *  1. Queue timers added by other threads, and remove canceled ones
      *  2. Handle any timers that should dispatch this cycle
      *  3. Wait until next dispatch time or new timer arrives
      */
@@ -116,9 +220,11 @@ SDL_TimerThread(void *_data)
         /* Pending and freelist maintenance */
         SDL_AtomicLock(&data->lock);
         {
-            /* Get any timers ready to be queued */
+            /* Get any timers ready to be queued or removed */
             pending = data->pending;
             data->pending = NULL;
+            canceled = data->canceled;
+            data->canceled = NULL;
 
             /* Make any unused timer structures available */
             if (freelist_head) {
@@ -128,50 +234,78 @@ SDL_TimerThread(void *_data)
         }
         SDL_AtomicUnlock(&data->lock);
 
-        /* Sort the pending timers into our list */
+        freelist_head = NULL;
+        freelist_tail = NULL;
+
+        /* Put the pending timers into our heap */
         while (pending) {
             current = pending;
             pending = pending->next;
             SDL_AddTimerInternal(data, current);
         }
-        freelist_head = NULL;
-        freelist_tail = NULL;
+
+        /* Take the canceled ones out, they go back on the freelist */
+        while (canceled) {
+            current = canceled;
+            canceled = canceled->next_canceled;
+            if (current->queued) {
+                SDL_RemoveTimerInternal(data, current);
+            }
+
+            if (!freelist_head) {
+                freelist_head = current;
+            }
+            if (freelist_tail) {
+                freelist_tail->next = current;
+            }
+            freelist_tail = current;
+            current->next = NULL;
+        }
 
         /* Check to see if we're still running, after maintenance */
         if (!SDL_AtomicGet(&data->active)) {
+            /* SDL_TimerQuit() frees the freelist, so give back what we took */
+            if (freelist_head) {
+                SDL_AtomicLock(&data->lock);
+                freelist_tail->next = data->freelist;
+                data->freelist = freelist_head;
+                SDL_AtomicUnlock(&data->lock);
+            }
             break;
         }
 
-        /* Initial delay if there are no timers */
-        delay = SDL_MUTEX_MAXWAIT;
-
-        tick = SDL_GetTicks();
+        now = SDL_GetPerformanceCounter();
 
-        /* Process all the pending timers for this tick */
+        /* Process all the timers that are due */
         while (data->timers) {
             current = data->timers;
 
-            if ((Sint32)(tick-current->scheduled) < 0) {
+            if ((Sint64)(current->scheduled - now) > 0) {
                 /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
                 break;
             }
 
             /* We're going to do something with this timer */
-            data->timers = current->next;
+            SDL_RemoveTimerInternal(data, current);
 
             if (SDL_AtomicGet(&current->canceled)) {
-                interval = 0;
-            } else {
-                interval = current->callback(current->interval, current->param);
+                /* SDL_RemoveTimer() has it, we'll free it when we see the cancel */
+                continue;
             }
 
+            interval = current->callback(current->interval, current->param);
+
             if (interval > 0) {
-                /* Reschedule this timer */
+                /* Reschedule this timer, without letting it drift */
                 current->interval = interval;
-                current->scheduled = tick + interval;
+                next = current->scheduled + ((interval * data->frequency) / 1000);
+                if ((Sint64)(next - now) <= 0) {
+                    /* We fell behind, don't fire a burst to catch up */
+                    next = now + ((interval * data->frequency) / 1000);
+                }
+                current->scheduled = next;
                 SDL_AddTimerInternal(data, current);
-            } else {
+            } else if (SDL_AtomicCAS(&current->canceled, 0, 1)) {
                 if (!freelist_head) {
                     freelist_head = current;
                 }
@@ -179,18 +313,21 @@ SDL_TimerThread(void *_data)
                     freelist_tail->next = current;
                 }
                 freelist_tail = current;
-
-                SDL_AtomicSet(&current->canceled, 1);
+                current->next = NULL;
             }
         }
 
-        /* Adjust the delay based on processing time */
-        now = SDL_GetTicks();
-        interval = (now - tick);
-        if (interval > delay) {
-            delay = 0;
+        /* Work out how long until the next timer, after processing time */
+        if (!data->timers) {
+            delay = SDL_MUTEX_MAXWAIT;
         } else {
-            delay -= interval;
+            now = SDL_GetPerformanceCounter();
+            if ((Sint64)(data->timers->scheduled - now) <= 0) {
+                continue;
+            }
+            /* Round up, so we never wake a fraction of a millisecond early
+               and spin until the timer is due. */
+            delay = (Uint32) SDL_min(((data->timers->scheduled - now) * 1000 + data->frequency - 1) / data->frequency, SDL_MUTEX_MAXWAIT - 1);
         }
 
         /* Note that each time a timer is added, this will return
@@ -221,6 +358,8 @@ SDL_TimerInit(void)
             return -1;
         }
 
+        data->frequency = SDL_GetPerformanceFrequency();
+
         SDL_AtomicSet(&data->active, 1);
 
         /* Timer threads use a callback into the app, so we can't set a limited stack size here. */
@@ -241,6 +380,7 @@ SDL_TimerQuit(void)
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    int i;
 
     if (SDL_AtomicCAS(&data->active, 1, 0)) {  /* active? Move to inactive. */
         /* Shutdown the timer thread */
@@ -254,9 +394,17 @@ SDL_TimerQuit(void)
         data->sem = NULL;
 
         /* Clean up the timer entries */
+        while (data->canceled) {
+            timer = data->canceled;
+            data->canceled = timer->next_canceled;
+            if (timer->queued) {
+                SDL_RemoveTimerInternal(data, timer);
+            }
+            SDL_free(timer);
+        }
         while (data->timers) {
             timer = data->timers;
-            data->timers = timer->next;
+            SDL_RemoveTimerInternal(data, timer);
             SDL_free(timer);
         }
         while (data->freelist) {
@@ -264,23 +412,63 @@ SDL_TimerQuit(void)
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
+        for (i = 0; i < data->timermap_size; ++i) {
+            while (data->timermap[i]) {
+                entry = data->timermap[i];
+                data->timermap[i] = entry->next;
+                SDL_free(entry);
+            }
         }
+        SDL_free(data->timermap);
+        data->timermap = NULL;
+        data->timermap_size = 0;
+        data->timermap_count = 0;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
     }
 }
 
+/* Add an entry to the timer ID hash table -- called with the timermap locked */
+static void
+SDL_AddTimerMapEntry(SDL_TimerData *data, SDL_TimerMap *entry)
+{
+    SDL_TimerMap **bucket;
+
+    /* Keep the chains short, but carry on with what we have if we can't grow */
+    if (data->timermap_count >= (data->timermap_size * 2)) {
+        const int size = data->timermap_size ? (data->timermap_size * 2) : 64;
+        SDL_TimerMap **timermap = (SDL_TimerMap **)SDL_calloc(size, sizeof(*timermap));
+        if (timermap) {
+            int i;
+            for (i = 0; i < data->timermap_size; ++i) {
+                while (data->timermap[i]) {
+                    SDL_TimerMap *moving = data->timermap[i];
+                    data->timermap[i] = moving->next;
+                    bucket = &timermap[moving->timerID & (size - 1)];
+                    moving->next = *bucket;
+                    *bucket = moving;
+                }
+            }
+            SDL_free(data->timermap);
+            data->timermap = timermap;
+            data->timermap_size = size;
+        }
+    }
+
+    bucket = &data->timermap[entry->timerID & (data->timermap_size - 1)];
+    entry->next = *bucket;
+    *bucket = entry;
+    ++data->timermap_count;
+}
+
 SDL_TimerID
 SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    SDL_TimerID timerID;
 
     SDL_AtomicLock(&data->lock);
     if (!SDL_AtomicGet(&data->active)) {
@@ -305,12 +493,6 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
             return 0;
         }
     }
-    timer->timerID = SDL_AtomicIncRef(&data->nextID);
-    timer->callback = callback;
-    timer->param = param;
-    timer->interval = interval;
-    timer->scheduled = SDL_GetTicks() + interval;
-    SDL_AtomicSet(&timer->canceled, 0);
 
     entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
     if (!entry) {
@@ -318,51 +500,70 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
         SDL_OutOfMemory();
         return 0;
     }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
 
-    SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
-    SDL_UnlockMutex(data->timermap_lock);
+    timerID = SDL_AtomicIncRef(&data->nextID);
+    timer->timerID = timerID;
+    timer->callback = callback;
+    timer->param = param;
+    timer->interval = interval;
+    timer->scheduled = SDL_GetPerformanceCounter() + ((interval * data->frequency) / 1000);
+    timer->queued = SDL_FALSE;
+    SDL_AtomicSet(&timer->canceled, 0);
 
-    /* Add the timer to the pending list for the timer thread */
+    /* Add the timer to the pending list for the timer thread, before the ID
+       can be canceled, so the thread sees it before any cancel request. */
     SDL_AtomicLock(&data->lock);
     timer->next = data->pending;
     data->pending = timer;
     SDL_AtomicUnlock(&data->lock);
 
+    entry->timer = timer;
+    entry->timerID = timerID;
+
+    SDL_LockMutex(data->timermap_lock);
+    SDL_AddTimerMapEntry(data, entry);
+    SDL_UnlockMutex(data->timermap_lock);
+
     /* Wake up the timer thread if necessary */
     SDL_SemPost(data->sem);
 
-    return entry->timerID;
+    return timerID;
 }
 
 SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_TimerMap *prev, *entry = NULL;
     SDL_bool canceled = SDL_FALSE;
 
     /* Find the timer */
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
+    if (data->timermap) {
+        prev = NULL;
+        for (entry = data->timermap[id & (data->timermap_size - 1)]; entry; prev = entry, entry = entry->next) {
+            if (entry->timerID == id) {
+                if (prev) {
+                    prev->next = entry->next;
+                } else {
+                    data->timermap[id & (data->timermap_size - 1)] = entry->next;
+                }
+                --data->timermap_count;
+                break;
             }
-            break;
         }
     }
     SDL_UnlockMutex(data->timermap_lock);
 
     if (entry) {
-        if (!SDL_AtomicGet(&entry->timer->canceled)) {
-            SDL_AtomicSet(&entry->timer->canceled, 1);
+        /* The timer may have finished and been reused for another ID */
+        if (entry->timer->timerID == id &&
+            SDL_AtomicCAS(&entry->timer->canceled, 0, 1)) {
+            /* Hand it to the timer thread to take out of the heap */
+            SDL_AtomicLock(&data->lock);
+            entry->timer->next_canceled = data->canceled;
+            data->canceled = entry->timer;
+            SDL_AtomicUnlock(&data->lock);
             canceled = SDL_TRUE;
         }
         SDL_free(entry);
@@ -370,4 +571,38 @@ SDL_RemoveTimer(SDL_TimerID id)
     return canceled;
 }
 
+/* SDL_GetTicksNS() counts on the performance counter from the point where
+   SDL_GetTicks() was zero, worked out the first time it's called. */
+static SDL_SpinLock ticks_ns_lock;
+static SDL_bool ticks_ns_started = SDL_FALSE;
+static Uint64 ticks_ns_start;
+static Uint64 ticks_ns_frequency;
+
+Uint64
+SDL_GetTicksNS(void)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 elapsed;
+
+    if (!ticks_ns_started) {
+        SDL_AtomicLock(&ticks_ns_lock);
+        if (!ticks_ns_started) {
+            const Uint32 ticks = SDL_GetTicks();
+
+            ticks_ns_frequency = SDL_GetPerformanceFrequency();
+            ticks_ns_start = now - ((ticks / 1000) * ticks_ns_frequency +
+                                    ((ticks % 1000) * ticks_ns_frequency) / 1000);
+            SDL_MemoryBarrierRelease();
+            ticks_ns_started = SDL_TRUE;
+        }
+        SDL_AtomicUnlock(&ticks_ns_lock);
+    }
+    SDL_MemoryBarrierAcquire();
+
+    /* Split off the whole seconds so the multiply can't overflow */
+    elapsed = now - ticks_ns_start;
+    return (elapsed / ticks_ns_frequency) * 1000000000 +
+           ((elapsed % ticks_ns_frequency) * 1000000000) / ticks_ns_frequency;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
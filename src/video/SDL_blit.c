@@ -99,6 +99,130 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
     return (okay ? 0 : -1);
 }
 
+/* Get a surface ready for SDL_BlitClipped(), which may run on several
+   threads at once afterwards.  This has to happen on one thread first,
+   since (re)building the blit mapping isn't thread-safe.
+   Returns SDL_FALSE if this blit can't be done with SDL_BlitClipped().
+ */
+SDL_bool
+SDL_PrepareBlitClipped(SDL_Surface * src, SDL_Surface * dst)
+{
+    if (src->locked || dst->locked || SDL_MUSTLOCK(dst)) {
+        return SDL_FALSE;
+    }
+
+    /* Same as SDL_UpperBlit(), we want the unscaled blit */
+    if (src->map->info.flags & SDL_COPY_NEAREST) {
+        src->map->info.flags &= ~SDL_COPY_NEAREST;
+        SDL_InvalidateMap(src->map);
+    }
+
+    if ((src->map->dst != dst) ||
+        (dst->format->palette &&
+         src->map->dst_palette_version != dst->format->palette->version) ||
+        (src->format->palette &&
+         src->map->src_palette_version != src->format->palette->version)) {
+        if (SDL_MapSurface(src, dst) < 0) {
+            return SDL_FALSE;
+        }
+    }
+
+    /* The RLE blitters only read the mapping, but a soft blit on a
+       surface that has to be locked would lock it from every thread. */
+    if (src->map->blit == SDL_SoftBlit && SDL_MUSTLOCK(src)) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* An unscaled blit like SDL_UpperBlit(), clipped against (clip) instead of
+   dst->clip_rect, that doesn't write to the shared blit mapping.
+   SDL_PrepareBlitClipped() must have succeeded for these surfaces.
+ */
+int
+SDL_BlitClipped(SDL_Surface * src, const SDL_Rect * srcrect,
+                SDL_Surface * dst, const SDL_Rect * dstrect,
+                const SDL_Rect * clip)
+{
+    SDL_Rect sr, dr;
+    int dx, dy;
+
+    /* clip the source rectangle to the source surface */
+    sr = *srcrect;
+    dr.x = dstrect->x;
+    dr.y = dstrect->y;
+    if (sr.x < 0) {
+        sr.w += sr.x;
+        dr.x -= sr.x;
+        sr.x = 0;
+    }
+    if (sr.w > src->w - sr.x) {
+        sr.w = src->w - sr.x;
+    }
+    if (sr.y < 0) {
+        sr.h += sr.y;
+        dr.y -= sr.y;
+        sr.y = 0;
+    }
+    if (sr.h > src->h - sr.y) {
+        sr.h = src->h - sr.y;
+    }
+
+    /* clip the destination rectangle against the clip rectangle */
+    dx = clip->x - dr.x;
+    if (dx > 0) {
+        sr.w -= dx;
+        dr.x += dx;
+        sr.x += dx;
+    }
+    dx = dr.x + sr.w - clip->x - clip->w;
+    if (dx > 0) {
+        sr.w -= dx;
+    }
+    dy = clip->y - dr.y;
+    if (dy > 0) {
+        sr.h -= dy;
+        dr.y += dy;
+        sr.y += dy;
+    }
+    dy = dr.y + sr.h - clip->y - clip->h;
+    if (dy > 0) {
+        sr.h -= dy;
+    }
+
+    if (sr.w <= 0 || sr.h <= 0) {
+        return 0;
+    }
+    dr.w = sr.w;
+    dr.h = sr.h;
+
+    if (dst->map->damage) {
+        SDL_AddSurfaceDamage(dst, &dr);
+    }
+
+    if (src->map->blit == SDL_SoftBlit) {
+        /* Same as SDL_SoftBlit(), but with our own copy of the blit info */
+        SDL_BlitInfo info = src->map->info;
+        SDL_BlitFunc RunBlit = (SDL_BlitFunc) src->map->data;
+
+        info.src = (Uint8 *) src->pixels + sr.y * src->pitch +
+            sr.x * info.src_fmt->BytesPerPixel;
+        info.src_w = sr.w;
+        info.src_h = sr.h;
+        info.src_pitch = src->pitch;
+        info.src_skip = info.src_pitch - info.src_w * info.src_fmt->BytesPerPixel;
+        info.dst = (Uint8 *) dst->pixels + dr.y * dst->pitch +
+            dr.x * info.dst_fmt->BytesPerPixel;
+        info.dst_w = dr.w;
+        info.dst_h = dr.h;
+        info.dst_pitch = dst->pitch;
+        info.dst_skip = info.dst_pitch - info.dst_w * info.dst_fmt->BytesPerPixel;
+        RunBlit(&info);
+        return 0;
+    }
+    return src->map->blit(src, &sr, dst, &dr);
+}
+
 #ifdef __MACOSX__
 #include <sys/sysctl.h>
 
@@ -160,6 +284,12 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
                     features |= SDL_CPU_ALTIVEC_NOPREFETCH;
                 }
             }
+            if (SDL_HasAVX2()) {
+                features |= SDL_CPU_AVX2;
+            }
+            if (SDL_HasNEON()) {
+                features |= SDL_CPU_NEON;
+            }
         }
     }
 
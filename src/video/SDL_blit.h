@@ -51,6 +51,8 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_AVX2                0x00000040
+#define SDL_CPU_NEON                0x00000080
 
 typedef struct
 {
@@ -82,6 +84,12 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* Filters and buffers for SDL_SoftStretchLinear(), see SDL_stretch.c */
+typedef struct SDL_StretchCache SDL_StretchCache;
+
+/* Areas of a window surface drawn since the last update, see SDL_surface.c */
+typedef struct SDL_Damage SDL_Damage;
+
 /* Blit mapping definition */
 typedef struct SDL_BlitMap
 {
@@ -90,6 +98,8 @@ typedef struct SDL_BlitMap
     SDL_blit blit;
     void *data;
     SDL_BlitInfo info;
+    SDL_StretchCache *stretch;
+    SDL_Damage *damage;
 
     /* the version count matches the destination; mismatch indicates
        an invalid mapping */
@@ -99,6 +109,31 @@ typedef struct SDL_BlitMap
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+extern SDL_bool SDL_PrepareBlitClipped(SDL_Surface * src, SDL_Surface * dst);
+extern int SDL_BlitClipped(SDL_Surface * src, const SDL_Rect * srcrect,
+                           SDL_Surface * dst, const SDL_Rect * dstrect,
+                           const SDL_Rect * clip);
+extern int SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+                                      SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear);
+extern int SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                                      SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear);
+extern int SDL_StretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                             SDL_Surface * dst, const SDL_Rect * dstrect, SDL_bool blend);
+extern void SDL_FreeStretchCache(SDL_StretchCache * cache);
+
+/* Damage tracking, used for window surfaces.  Drawing functions add the
+   area they write to a surface if its map has damage tracking enabled:
+       if (dst->map->damage) {
+           SDL_AddSurfaceDamage(dst, rect);
+       }
+ */
+#define SDL_MAX_DAMAGE_RECTS    8
+extern int SDL_TrackSurfaceDamage(SDL_Surface * surface);
+extern void SDL_AddSurfaceDamage(SDL_Surface * surface, const SDL_Rect * rect);
+extern void SDL_AddSurfaceDamagePoints(SDL_Surface * surface,
+                                       const SDL_Point * points, int count);
+extern int SDL_GetSurfaceDamage(SDL_Surface * surface, SDL_Rect * rects,
+                                int maxrects, SDL_bool clear);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
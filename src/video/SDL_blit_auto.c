@@ -26,6 +26,275 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
+#include "../cpuinfo/SDL_simd.h"
+
+/* The vectorized blitters work on whole pixels at once, so they assume
+   that the first byte in memory is the lowest byte of the pixel.
+   SDL_ChooseBlitFunc() only picks the AVX2 ones if SDL_HasAVX2(). */
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+#undef HAVE_AVX2_INTRINSICS
+#undef HAVE_NEON_INTRINSICS
+#endif
+
+/* The vectorized blitters below give exactly the same results as the
+   scalar ones.  Each one shuffles the source pixels into the layout of
+   the destination, with the alpha (or padding) channel in the top byte,
+   and then does the arithmetic on all channels of all pixels at once:
+
+    shuffle     - for each byte of the destination pixel, the source byte
+                  that goes there, or 0x80 if the source has no alpha
+    src_alpha   - OR'ed into the source pixels, 0xFF000000 if the source
+                  has no alpha channel
+    dst_mask    - AND'ed into the result, 0x00FFFFFF if the destination
+                  has no alpha channel
+    dst_rshift, dst_bshift - the position of red and blue in the destination
+
+   Products are divided by 255 with (x + 1 + (x >> 8)) >> 8, which is
+   exact for the product of any two bytes.
+ */
+
+#if HAVE_AVX2_INTRINSICS
+SDL_FORCE_INLINE SDL_TARGETING_AVX2 __m256i
+SDL_Blit_MulDiv255_AVX2(__m256i a, __m256i b)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+    __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+    lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(lo, one), _mm256_srli_epi16(lo, 8)), 8);
+    hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(hi, one), _mm256_srli_epi16(hi, 8)), 8);
+    return _mm256_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE SDL_TARGETING_AVX2 void
+SDL_Blit8888_AVX2(SDL_BlitInfo *info, const Uint32 shuffle, const Uint32 src_alpha,
+                  const Uint32 dst_mask, const int dst_rshift, const int dst_bshift,
+                  const int modulate, const int blend, const int scale)
+{
+    const int flags = info->flags;
+    const int blendop = (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD));
+    const __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i shuffle_mask = _mm256_setr_epi32((int)shuffle, (int)(shuffle + 0x04040404), (int)(shuffle + 0x08080808), (int)(shuffle + 0x0C0C0C0C),
+                                                   (int)shuffle, (int)(shuffle + 0x04040404), (int)(shuffle + 0x08080808), (int)(shuffle + 0x0C0C0C0C));
+    const __m256i alpha_to_rgba = _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+                                                   3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+    const __m256i alpha_mask = _mm256_set1_epi32((int)0xFF000000);
+    const __m256i all_ones = _mm256_set1_epi32(-1);
+    __m256i modulate_rgba = all_ones;
+    int incx = 0, incy = 0, posy = 0;
+
+    if (modulate) {
+        const Uint32 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+        const Uint32 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+        const Uint32 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+        const Uint32 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+        modulate_rgba = _mm256_set1_epi32((int)((modulateA << 24) | (modulateR << dst_rshift) |
+                                                (modulateG << 8) | (modulateB << dst_bshift)));
+    }
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        __m256i posx = _mm256_mullo_epi32(index, _mm256_set1_epi32(incx));
+        int n = info->dst_w;
+        if (scale) {
+            src = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        }
+        while (n > 0) {
+            const __m256i lanes = _mm256_cmpgt_epi32(_mm256_set1_epi32(n), index);
+            __m256i pixel, dstpixel;
+
+            if (scale) {
+                pixel = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *)src,
+                                                    _mm256_srli_epi32(posx, 16), lanes, 4);
+                posx = _mm256_add_epi32(posx, _mm256_set1_epi32(incx * 8));
+            } else {
+                pixel = (n >= 8) ? _mm256_loadu_si256((const __m256i *)src) : _mm256_maskload_epi32((const int *)src, lanes);
+                src += 8;
+            }
+            if (shuffle != 0x03020100) {
+                pixel = _mm256_shuffle_epi8(pixel, shuffle_mask);
+            }
+            if (src_alpha) {
+                pixel = _mm256_or_si256(pixel, _mm256_set1_epi32((int)src_alpha));
+            }
+            if (modulate) {
+                pixel = SDL_Blit_MulDiv255_AVX2(pixel, modulate_rgba);
+            }
+            if (blend) {
+                dstpixel = (n >= 8) ? _mm256_loadu_si256((const __m256i *)dst) : _mm256_maskload_epi32((const int *)dst, lanes);
+                if (blendop & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+                    pixel = SDL_Blit_MulDiv255_AVX2(pixel, _mm256_or_si256(_mm256_shuffle_epi8(pixel, alpha_to_rgba), alpha_mask));
+                }
+                switch (blendop) {
+                case SDL_COPY_BLEND:
+                    dstpixel = _mm256_add_epi8(pixel, SDL_Blit_MulDiv255_AVX2(_mm256_xor_si256(_mm256_shuffle_epi8(pixel, alpha_to_rgba), all_ones), dstpixel));
+                    break;
+                case SDL_COPY_ADD:
+                    dstpixel = _mm256_blendv_epi8(_mm256_adds_epu8(pixel, dstpixel), dstpixel, alpha_mask);
+                    break;
+                case SDL_COPY_MOD:
+                    dstpixel = _mm256_blendv_epi8(SDL_Blit_MulDiv255_AVX2(pixel, dstpixel), dstpixel, alpha_mask);
+                    break;
+                }
+                pixel = dstpixel;
+            }
+            if (dst_mask != 0xFFFFFFFF) {
+                pixel = _mm256_and_si256(pixel, _mm256_set1_epi32((int)dst_mask));
+            }
+            if (n >= 8) {
+                _mm256_storeu_si256((__m256i *)dst, pixel);
+            } else {
+                _mm256_maskstore_epi32((int *)dst, lanes, pixel);
+            }
+            dst += 8;
+            n -= 8;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+SDL_FORCE_INLINE uint8x16_t
+SDL_Blit_MulDiv255_NEON(uint8x16_t a, uint8x16_t b)
+{
+    const uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t lo = vmull_u8(vget_low_u8(a), vget_low_u8(b));
+    uint16x8_t hi = vmull_u8(vget_high_u8(a), vget_high_u8(b));
+    lo = vaddq_u16(vaddq_u16(lo, one), vshrq_n_u16(lo, 8));
+    hi = vaddq_u16(vaddq_u16(hi, one), vshrq_n_u16(hi, 8));
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+SDL_FORCE_INLINE void
+SDL_Blit8888_NEON(SDL_BlitInfo *info, const Uint32 shuffle, const Uint32 src_alpha,
+                  const Uint32 dst_mask, const int dst_rshift, const int dst_bshift,
+                  const int modulate, const int blend, const int scale)
+{
+    const int flags = info->flags;
+    const int blendop = (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD));
+    Uint32 modulate_rgba = 0xFFFFFFFF;
+    int incx = 0, incy = 0, posy = 0;
+    int i;
+
+    if (modulate) {
+        const Uint32 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+        const Uint32 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+        const Uint32 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+        const Uint32 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+        modulate_rgba = (modulateA << 24) | (modulateR << dst_rshift) |
+                        (modulateG << 8) | (modulateB << dst_bshift);
+    }
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int posx = 0;
+        int n = info->dst_w;
+        if (scale) {
+            src = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        }
+        while (n > 0) {
+            /* Partial and scaled runs of pixels go through these */
+            Uint32 srcbuf[16], dstbuf[16];
+            const int count = SDL_min(n, 16);
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            uint8x16x4_t in, pixel, dstpixel;
+
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                s = srcbuf;
+            } else if (count < 16) {
+                SDL_memcpy(srcbuf, src, count * sizeof (Uint32));
+                s = srcbuf;
+            }
+            if (count < 16) {
+                if (blend) {
+                    SDL_memcpy(dstbuf, dst, count * sizeof (Uint32));
+                }
+                d = dstbuf;
+            }
+
+            /* Each of these holds one byte of 16 pixels */
+            in = vld4q_u8((const Uint8 *)s);
+            for (i = 0; i < 4; ++i) {
+                const Uint32 from = (shuffle >> (i * 8)) & 0xFF;
+                pixel.val[i] = (from & 0x80) ? vdupq_n_u8((Uint8)(src_alpha >> (i * 8))) : in.val[from & 3];
+            }
+            if (modulate) {
+                for (i = 0; i < 4; ++i) {
+                    pixel.val[i] = SDL_Blit_MulDiv255_NEON(pixel.val[i], vdupq_n_u8((Uint8)(modulate_rgba >> (i * 8))));
+                }
+            }
+            if (blend) {
+                dstpixel = vld4q_u8((const Uint8 *)d);
+                if (blendop & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+                    for (i = 0; i < 3; ++i) {
+                        pixel.val[i] = SDL_Blit_MulDiv255_NEON(pixel.val[i], pixel.val[3]);
+                    }
+                }
+                switch (blendop) {
+                case SDL_COPY_BLEND:
+                    for (i = 0; i < 4; ++i) {
+                        dstpixel.val[i] = vaddq_u8(pixel.val[i], SDL_Blit_MulDiv255_NEON(vmvnq_u8(pixel.val[3]), dstpixel.val[i]));
+                    }
+                    break;
+                case SDL_COPY_ADD:
+                    for (i = 0; i < 3; ++i) {
+                        dstpixel.val[i] = vqaddq_u8(pixel.val[i], dstpixel.val[i]);
+                    }
+                    break;
+                case SDL_COPY_MOD:
+                    for (i = 0; i < 3; ++i) {
+                        dstpixel.val[i] = SDL_Blit_MulDiv255_NEON(pixel.val[i], dstpixel.val[i]);
+                    }
+                    break;
+                }
+                pixel = dstpixel;
+            }
+            for (i = 0; i < 4; ++i) {
+                if (!((dst_mask >> (i * 8)) & 0xFF)) {
+                    pixel.val[i] = vdupq_n_u8(0);
+                }
+            }
+            vst4q_u8((Uint8 *)d, pixel);
+
+            if (count < 16) {
+                SDL_memcpy(dst, dstbuf, count * sizeof (Uint32));
+            }
+            if (!scale) {
+                src += 16;
+            }
+            dst += 16;
+            n -= 16;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
 
 static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
 {
@@ -422,6 +691,82 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_RGB888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -822,6 +1167,82 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_RGB888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -1234,6 +1655,82 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_BGR888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -1634,6 +2131,82 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_BGR888_BGR888_Scale(SDL_BlitInfo *info)
 {
     int srcy, srcx;
@@ -2029,6 +2602,82 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80020100, 0xFF000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_BGR888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -2441,12 +3090,88 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
-static void SDL_Blit_ARGB8888_RGB888_Scale(SDL_BlitInfo *info)
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
 {
-    Uint32 pixel;
-    Uint32 R, G, B;
-    int srcy, srcx;
-    int posy, posx;
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x80000102, 0xFF000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
+static void SDL_Blit_ARGB8888_RGB888_Scale(SDL_BlitInfo *info)
+{
+    Uint32 pixel;
+    Uint32 R, G, B;
+    int srcy, srcx;
+    int posy, posx;
     int incy, incx;
 
     srcy = 0;
@@ -2841,6 +3566,82 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_ARGB8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -3241,6 +4042,82 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     int srcy, srcx;
@@ -3648,6 +4525,82 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_RGBA8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -4048,6 +5001,82 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_RGBA8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -4448,6 +5477,82 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -4860,6 +5965,82 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_ABGR8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -5260,6 +6441,82 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_ABGR8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -5660,6 +6917,82 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03020100, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -6072,6 +7405,82 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x03000102, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_BGRA8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -6472,6 +7881,82 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0x00FFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_BGRA8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -6872,6 +8357,82 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00030201, 0x00000000, 0x00FFFFFF, 0, 16, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -7284,7 +8845,101 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_TARGETING_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 0, 1, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 0, 1);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 0);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, 0x00010203, 0x00000000, 0xFFFFFFFF, 16, 0, 1, 1, 1);
+}
+
+#endif /* HAVE_NEON_INTRINSICS */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
@@ -7292,6 +8947,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
@@ -7299,6 +8972,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
@@ -7306,6 +8997,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
@@ -7313,6 +9022,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
@@ -7320,6 +9047,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
@@ -7327,6 +9072,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
@@ -7334,6 +9097,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
@@ -7341,6 +9122,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
@@ -7348,6 +9147,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
@@ -7355,6 +9172,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
@@ -7362,6 +9197,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
@@ -7369,6 +9222,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
@@ -7376,6 +9247,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
@@ -7383,6 +9272,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
@@ -7390,6 +9297,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
@@ -7397,6 +9322,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
@@ -7404,6 +9347,24 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
+#if HAVE_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_NEON_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
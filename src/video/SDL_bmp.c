@@ -37,6 +37,7 @@
 #include "SDL_assert.h"
 #include "SDL_endian.h"
 #include "SDL_pixels_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 #define SAVE_32BIT_BMP
 
@@ -83,8 +84,276 @@ static void CorrectAlphaChannel(SDL_Surface *surface)
     }
 }
 
+/* Read the color table into colors, which has room for ncolors entries */
+static void
+ReadPalette(SDL_RWops * src, Uint32 biSize, Uint32 biClrUsed, SDL_Color * colors, int ncolors)
+{
+    int i;
+
+    for (i = 0; i < (int) biClrUsed && i < ncolors; ++i) {
+        SDL_RWread(src, &colors[i].b, 1, 1);
+        SDL_RWread(src, &colors[i].g, 1, 1);
+        SDL_RWread(src, &colors[i].r, 1, 1);
+        if (biSize != 12) {
+            /* According to Microsoft documentation, the fourth element
+               is reserved and must be zero, so we shouldn't treat it as
+               alpha.
+            */
+            SDL_RWread(src, &colors[i].a, 1, 1);
+        }
+        colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+}
+
+/* Streams that are already in memory can be decoded in place.
+   Returns NULL if src isn't one, or if it doesn't hold minlen bytes. */
+static const Uint8 *
+MapPixels(SDL_RWops * src, Sint64 offset, size_t len, size_t minlen)
+{
+    size_t available;
+
+    if (src->type != SDL_RWOPS_MEMORY && src->type != SDL_RWOPS_MEMORY_RO &&
+        src->type != SDL_RWOPS_MAPPED) {
+        return NULL;
+    }
+    if (offset < 0 || offset > (Sint64) (src->hidden.mem.stop - src->hidden.mem.base)) {
+        return NULL;
+    }
+    available = (size_t) ((src->hidden.mem.stop - src->hidden.mem.base) - offset);
+    if (available < minlen) {
+        return NULL;
+    }
+    src->hidden.mem.here = src->hidden.mem.base + offset + SDL_min(len, available);
+    return src->hidden.mem.base + offset;
+}
+
+static void
+FlipRows(SDL_Surface * surface)
+{
+    Uint8 *top = (Uint8 *) surface->pixels;
+    Uint8 *bottom = top + (surface->h - 1) * surface->pitch;
+    Uint8 tmp[256];
+
+    while (top < bottom) {
+        int i, n;
+        for (i = 0; i < surface->pitch; i += n) {
+            n = SDL_min(surface->pitch - i, (int) sizeof (tmp));
+            SDL_memcpy(tmp, top + i, n);
+            SDL_memcpy(top + i, bottom + i, n);
+            SDL_memcpy(bottom + i, tmp, n);
+        }
+        top += surface->pitch;
+        bottom -= surface->pitch;
+    }
+}
+
+/* Pixels can be decoded straight into 32-bit formats with 8 bits per channel */
+static SDL_bool
+IsDirectFormat(Uint32 format)
+{
+    int bpp;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+
+    if (SDL_ISPIXELFORMAT_FOURCC(format) || SDL_ISPIXELFORMAT_INDEXED(format) ||
+        SDL_BITSPERPIXEL(format) != 32) {
+        return SDL_FALSE;
+    }
+    if (!SDL_PixelFormatEnumToMasks(format, &bpp, &Rmask, &Gmask, &Bmask, &Amask)) {
+        return SDL_FALSE;
+    }
+#define IS_BYTE_MASK(m) ((m) == 0x000000FF || (m) == 0x0000FF00 || (m) == 0x00FF0000 || (m) == 0xFF000000)
+    return (IS_BYTE_MASK(Rmask) && IS_BYTE_MASK(Gmask) && IS_BYTE_MASK(Bmask) &&
+            (Amask == 0 || IS_BYTE_MASK(Amask))) ? SDL_TRUE : SDL_FALSE;
+#undef IS_BYTE_MASK
+}
+
+/* The vectorized versions load whole pixels, so the lowest byte must come first in memory */
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+#undef HAVE_SSE2_INTRINSICS
+#undef HAVE_NEON_INTRINSICS
+#endif
+
+/* Expand a row of 1, 4 or 8 bit indices through a table of mapped colors */
+static void
+ExpandPaletteRow(const Uint8 * src, Uint32 * dst, int width, int bits, const Uint32 * lut)
+{
+    int i = 0;
+
+    switch (bits) {
+    case 1:
+        for (; i + 8 <= width; i += 8) {
+            const Uint8 pixel = *src++;
+            dst[i + 0] = lut[(pixel >> 7) & 1];
+            dst[i + 1] = lut[(pixel >> 6) & 1];
+            dst[i + 2] = lut[(pixel >> 5) & 1];
+            dst[i + 3] = lut[(pixel >> 4) & 1];
+            dst[i + 4] = lut[(pixel >> 3) & 1];
+            dst[i + 5] = lut[(pixel >> 2) & 1];
+            dst[i + 6] = lut[(pixel >> 1) & 1];
+            dst[i + 7] = lut[pixel & 1];
+        }
+        if (i < width) {
+            Uint8 pixel = *src;
+            for (; i < width; ++i) {
+                dst[i] = lut[pixel >> 7];
+                pixel <<= 1;
+            }
+        }
+        break;
+    case 4:
+        for (; i + 2 <= width; i += 2) {
+            const Uint8 pixel = *src++;
+            dst[i + 0] = lut[pixel >> 4];
+            dst[i + 1] = lut[pixel & 0x0F];
+        }
+        if (i < width) {
+            dst[i] = lut[*src >> 4];
+        }
+        break;
+    default:
+        for (; i + 4 <= width; i += 4) {
+            dst[i + 0] = lut[src[i + 0]];
+            dst[i + 1] = lut[src[i + 1]];
+            dst[i + 2] = lut[src[i + 2]];
+            dst[i + 3] = lut[src[i + 3]];
+        }
+        for (; i < width; ++i) {
+            dst[i] = lut[src[i]];
+        }
+        break;
+    }
+}
+
+/* Convert a row of 24-bit BGR pixels */
+static void
+Convert24Row(const Uint8 * src, Uint32 * dst, int width, const SDL_PixelFormat * fmt)
+{
+    const Uint32 Amask = fmt->Amask;
+    const int Rshift = fmt->Rshift;
+    const int Gshift = fmt->Gshift;
+    const int Bshift = fmt->Bshift;
+    int i = 0;
+
+#if HAVE_SSE2_INTRINSICS
+    if (Rshift == 16 && Gshift == 8 && Bshift == 0) {
+        /* Move pixel n up by n bytes, four pixels at a time */
+        const __m128i mask0 = _mm_set_epi32(0, 0, 0, 0x00FFFFFF);
+        const __m128i mask1 = _mm_set_epi32(0, 0, 0x00FFFFFF, 0);
+        const __m128i mask2 = _mm_set_epi32(0, 0x00FFFFFF, 0, 0);
+        const __m128i mask3 = _mm_set_epi32(0x00FFFFFF, 0, 0, 0);
+        const __m128i alpha = _mm_set1_epi32((int) Amask);
+
+        /* Each step loads 16 bytes and uses 12 of them */
+        for (; i + 6 <= width; i += 4) {
+            const __m128i bgr = _mm_loadu_si128((const __m128i *) (src + i * 3));
+            __m128i pixels = _mm_or_si128(_mm_and_si128(bgr, mask0), alpha);
+            pixels = _mm_or_si128(pixels, _mm_and_si128(_mm_slli_si128(bgr, 1), mask1));
+            pixels = _mm_or_si128(pixels, _mm_and_si128(_mm_slli_si128(bgr, 2), mask2));
+            pixels = _mm_or_si128(pixels, _mm_and_si128(_mm_slli_si128(bgr, 3), mask3));
+            _mm_storeu_si128((__m128i *) (dst + i), pixels);
+        }
+    }
+#elif HAVE_NEON_INTRINSICS
+    {
+        const int Apos = 6 - (Rshift + Gshift + Bshift) / 8;
+        const uint8x16_t alpha = vdupq_n_u8(Amask ? 0xFF : 0x00);
+
+        for (; i + 16 <= width; i += 16) {
+            const uint8x16x3_t bgr = vld3q_u8(src + i * 3);
+            uint8x16x4_t pixels;
+            pixels.val[Rshift / 8] = bgr.val[2];
+            pixels.val[Gshift / 8] = bgr.val[1];
+            pixels.val[Bshift / 8] = bgr.val[0];
+            pixels.val[Apos] = alpha;
+            vst4q_u8((Uint8 *) (dst + i), pixels);
+        }
+    }
+#endif
+
+    for (; i < width; ++i) {
+        const Uint8 *bgr = src + i * 3;
+        dst[i] = ((Uint32) bgr[2] << Rshift) | ((Uint32) bgr[1] << Gshift) |
+                 ((Uint32) bgr[0] << Bshift) | Amask;
+    }
+}
+
+/* Convert a row of 32-bit BGRA pixels, making them opaque if asked */
+static void
+Convert32Row(const Uint8 * src, Uint32 * dst, int width, const SDL_PixelFormat * fmt, SDL_bool opaque)
+{
+    const Uint32 Amask = fmt->Amask;
+    const int Rshift = fmt->Rshift;
+    const int Gshift = fmt->Gshift;
+    const int Bshift = fmt->Bshift;
+    const int Ashift = fmt->Ashift;
+    int i = 0;
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (Rshift == 16 && Gshift == 8 && Bshift == 0 && (Amask == 0xFF000000 || Amask == 0) && !opaque) {
+        /* Already in the right layout */
+        SDL_memcpy(dst, src, width * sizeof (Uint32));
+        if (Amask == 0) {
+            for (; i < width; ++i) {
+                dst[i] &= 0x00FFFFFF;
+            }
+        }
+        return;
+    }
+#endif
+
+#if HAVE_SSE2_INTRINSICS
+    if (Rshift == 0 && Gshift == 8 && Bshift == 16 && (Amask == 0xFF000000 || Amask == 0)) {
+        /* Swap red and blue */
+        const __m128i keep = _mm_set1_epi32((int) (0x0000FF00 | Amask));
+        const __m128i mask = _mm_set1_epi32(0x000000FF);
+        const __m128i alpha = _mm_set1_epi32(opaque ? (int) Amask : 0);
+
+        for (; i + 4 <= width; i += 4) {
+            const __m128i bgra = _mm_loadu_si128((const __m128i *) (src + i * 4));
+            __m128i pixels = _mm_or_si128(_mm_and_si128(bgra, keep), alpha);
+            pixels = _mm_or_si128(pixels, _mm_and_si128(_mm_srli_epi32(bgra, 16), mask));
+            pixels = _mm_or_si128(pixels, _mm_slli_epi32(_mm_and_si128(bgra, mask), 16));
+            _mm_storeu_si128((__m128i *) (dst + i), pixels);
+        }
+    }
+#elif HAVE_NEON_INTRINSICS
+    {
+        const int Apos = 6 - (Rshift + Gshift + Bshift) / 8;
+
+        for (; i + 16 <= width; i += 16) {
+            const uint8x16x4_t bgra = vld4q_u8(src + i * 4);
+            uint8x16x4_t pixels;
+            pixels.val[Rshift / 8] = bgra.val[2];
+            pixels.val[Gshift / 8] = bgra.val[1];
+            pixels.val[Bshift / 8] = bgra.val[0];
+            if (Amask == 0) {
+                pixels.val[Apos] = vdupq_n_u8(0x00);
+            } else if (opaque) {
+                pixels.val[Apos] = vdupq_n_u8(0xFF);
+            } else {
+                pixels.val[Apos] = bgra.val[3];
+            }
+            vst4q_u8((Uint8 *) (dst + i), pixels);
+        }
+    }
+#endif
+
+    for (; i < width; ++i) {
+        const Uint8 *bgra = src + i * 4;
+        const Uint32 a = opaque ? SDL_ALPHA_OPAQUE : bgra[3];
+        dst[i] = ((Uint32) bgra[2] << Rshift) | ((Uint32) bgra[1] << Gshift) |
+                 ((Uint32) bgra[0] << Bshift) | ((a << Ashift) & Amask);
+    }
+}
+
 SDL_Surface *
 SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
+{
+    return SDL_LoadBMPFormat_RW(src, freesrc, SDL_PIXELFORMAT_UNKNOWN);
+}
+
+SDL_Surface *
+SDL_LoadBMPFormat_RW(SDL_RWops * src, int freesrc, Uint32 format)
 {
     SDL_bool was_error;
     Sint64 fp_offset = 0;
@@ -96,13 +365,17 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
     Uint32 Bmask = 0;
     Uint32 Amask = 0;
     SDL_Palette *palette;
-    Uint8 *bits;
-    Uint8 *top, *end;
     SDL_bool topDown;
     int ExpandBMP;
     SDL_bool haveRGBMasks = SDL_FALSE;
     SDL_bool haveAlphaMask = SDL_FALSE;
     SDL_bool correctAlpha = SDL_FALSE;
+    SDL_bool direct = SDL_FALSE;
+    Uint32 lut[256];
+    int y, srcPitch;
+    size_t len, minlen;
+    const Uint8 *pixels = NULL;
+    Uint8 *buffer = NULL;
 
     /* The Win32 BMP file header (14 bytes) */
     char magic[2];
@@ -298,16 +571,46 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
         goto done;
     }
 
-    /* Create a compatible surface, note that the colors are RGB ordered */
-    surface =
-        SDL_CreateRGBSurface(0, biWidth, biHeight, biBitCount, Rmask, Gmask,
-                             Bmask, Amask);
+    /* Paletted, 24-bit and 32-bit pixels can be decoded straight into the
+       requested format; anything else is loaded as is and converted. */
+    if (format != SDL_PIXELFORMAT_UNKNOWN) {
+        if (biCompression == BI_RGB &&
+            (biBitCount == 8 || biBitCount == 24 || biBitCount == 32) &&
+            IsDirectFormat(format)) {
+            direct = SDL_TRUE;
+        } else if (SDL_MasksToPixelFormatEnum(biBitCount, Rmask, Gmask, Bmask, Amask) == format) {
+            format = SDL_PIXELFORMAT_UNKNOWN;
+        }
+    }
+
+    if (direct) {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, biWidth, biHeight, 32, format);
+    } else {
+        /* Create a compatible surface, note that the colors are RGB ordered */
+        surface =
+            SDL_CreateRGBSurface(0, biWidth, biHeight, biBitCount, Rmask, Gmask,
+                                 Bmask, Amask);
+    }
     if (surface == NULL) {
         was_error = SDL_TRUE;
         goto done;
     }
 
     /* Load the palette, if any */
+    if (direct && biBitCount == 8) {
+        SDL_Color colors[256];
+
+        if (biClrUsed == 0) {
+            biClrUsed = 1 << (ExpandBMP ? ExpandBMP : 8);
+        }
+        /* Colors past the end of the table are opaque white, like the ones
+           SDL_AllocPalette() gives SDL_LoadBMP_RW() surfaces */
+        SDL_memset(colors, 0xFF, sizeof(colors));
+        ReadPalette(src, biSize, biClrUsed, colors, SDL_arraysize(colors));
+        for (i = 0; i < (int) SDL_arraysize(lut); ++i) {
+            lut[i] = SDL_MapRGBA(surface->format, colors[i].r, colors[i].g, colors[i].b, colors[i].a);
+        }
+    }
     palette = (surface->format)->palette;
     if (palette) {
         SDL_assert(biBitCount <= 8);
@@ -328,124 +631,155 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
             }
             palette->ncolors = ncolors;
             palette->colors = colors;
-        } else if ((int) biClrUsed < palette->ncolors) {
-            palette->ncolors = biClrUsed;
-        }
-        if (biSize == 12) {
-            for (i = 0; i < (int) biClrUsed; ++i) {
-                SDL_RWread(src, &palette->colors[i].b, 1, 1);
-                SDL_RWread(src, &palette->colors[i].g, 1, 1);
-                SDL_RWread(src, &palette->colors[i].r, 1, 1);
-                palette->colors[i].a = SDL_ALPHA_OPAQUE;
-            }
-        } else {
-            for (i = 0; i < (int) biClrUsed; ++i) {
-                SDL_RWread(src, &palette->colors[i].b, 1, 1);
-                SDL_RWread(src, &palette->colors[i].g, 1, 1);
-                SDL_RWread(src, &palette->colors[i].r, 1, 1);
-                SDL_RWread(src, &palette->colors[i].a, 1, 1);
-
-                /* According to Microsoft documentation, the fourth element
-                   is reserved and must be zero, so we shouldn't treat it as
-                   alpha.
-                */
-                palette->colors[i].a = SDL_ALPHA_OPAQUE;
-            }
         }
+        /* A short color table leaves the rest of the palette white, so that
+           pixels past its end still have a color when converted */
+        ReadPalette(src, biSize, biClrUsed, palette->colors, palette->ncolors);
     }
 
     /* Read the surface pixels.  Note that the bmp image is upside down */
-    if (SDL_RWseek(src, fp_offset + bfOffBits, RW_SEEK_SET) < 0) {
-        SDL_Error(SDL_EFSEEK);
-        was_error = SDL_TRUE;
-        goto done;
-    }
-    top = (Uint8 *)surface->pixels;
-    end = (Uint8 *)surface->pixels+(surface->h*surface->pitch);
     switch (ExpandBMP) {
     case 1:
         bmpPitch = (biWidth + 7) >> 3;
-        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
         break;
     case 4:
         bmpPitch = (biWidth + 1) >> 1;
-        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
         break;
     default:
-        pad = ((surface->pitch % 4) ? (4 - (surface->pitch % 4)) : 0);
+        bmpPitch = direct ? surface->w * (biBitCount / 8) : surface->pitch;
         break;
     }
-    if (topDown) {
-        bits = top;
-    } else {
-        bits = end - surface->pitch;
+    pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
+    srcPitch = bmpPitch + pad;
+    if (surface->h == 0) {
+        goto done;
     }
-    while (bits >= top && bits < end) {
-        switch (ExpandBMP) {
-        case 1:
-        case 4:{
+
+    /* Take the whole pixel array at once, from memory if it's already
+       there. The padding after the last row may be missing. */
+    len = (size_t) srcPitch * surface->h;
+    minlen = len - pad;
+    pixels = MapPixels(src, fp_offset + bfOffBits, len, minlen);
+    if (!pixels) {
+        if (SDL_RWseek(src, fp_offset + bfOffBits, RW_SEEK_SET) < 0) {
+            SDL_Error(SDL_EFSEEK);
+            was_error = SDL_TRUE;
+            goto done;
+        }
+        if (!direct && !ExpandBMP) {
+            /* The rows are laid out just like the surface */
+            if (SDL_RWread(src, surface->pixels, surface->pitch, surface->h)
+                != (size_t) surface->h) {
+                SDL_Error(SDL_EFREAD);
+                was_error = SDL_TRUE;
+                goto done;
+            }
+            if (!topDown) {
+                FlipRows(surface);
+            }
+        } else {
+            buffer = (Uint8 *) SDL_malloc(len);
+            if (!buffer) {
+                SDL_OutOfMemory();
+                was_error = SDL_TRUE;
+                goto done;
+            }
+            if (SDL_RWread(src, buffer, 1, len) < minlen) {
+                SDL_Error(SDL_EFREAD);
+                was_error = SDL_TRUE;
+                goto done;
+            }
+            pixels = buffer;
+        }
+    }
+
+    if (pixels) {
+        SDL_bool opaque = SDL_FALSE;
+
+        if (direct && correctAlpha) {
+            /* Ignore the alpha channel if it's all zero, as CorrectAlphaChannel() does */
+            const Uint8 *alpha = pixels + 3;
+            const Uint8 *end = pixels + len;
+
+            opaque = SDL_TRUE;
+            while (alpha < end) {
+                if (*alpha != 0) {
+                    opaque = SDL_FALSE;
+                    break;
+                }
+                alpha += 4;
+            }
+        }
+
+        for (y = 0; y < surface->h; ++y) {
+            const Uint8 *row = pixels + (size_t) (topDown ? y : (surface->h - 1 - y)) * srcPitch;
+            Uint8 *bits = (Uint8 *) surface->pixels + y * surface->pitch;
+
+            if (direct) {
+                switch (biBitCount) {
+                case 8:
+                    ExpandPaletteRow(row, (Uint32 *) bits, surface->w, ExpandBMP ? ExpandBMP : 8, lut);
+                    break;
+                case 24:
+                    Convert24Row(row, (Uint32 *) bits, surface->w, surface->format);
+                    break;
+                default:
+                    Convert32Row(row, (Uint32 *) bits, surface->w, surface->format, opaque);
+                    break;
+                }
+            } else if (ExpandBMP) {
                 Uint8 pixel = 0;
                 int shift = (8 - ExpandBMP);
                 for (i = 0; i < surface->w; ++i) {
                     if (i % (8 / ExpandBMP) == 0) {
-                        if (!SDL_RWread(src, &pixel, 1, 1)) {
-                            SDL_SetError("Error reading from BMP");
-                            was_error = SDL_TRUE;
-                            goto done;
-                        }
+                        pixel = *row++;
                     }
                     *(bits + i) = (pixel >> shift);
                     pixel <<= ExpandBMP;
                 }
+            } else {
+                SDL_memcpy(bits, row, surface->pitch);
             }
-            break;
+        }
+    }
 
-        default:
-            if (SDL_RWread(src, bits, 1, surface->pitch)
-                != surface->pitch) {
-                SDL_Error(SDL_EFREAD);
-                was_error = SDL_TRUE;
-                goto done;
-            }
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
-            /* Byte-swap the pixels if needed. Note that the 24bpp
-               case has already been taken care of above. */
-            switch (biBitCount) {
-            case 15:
-            case 16:{
-                    Uint16 *pix = (Uint16 *) bits;
-                    for (i = 0; i < surface->w; i++)
-                        pix[i] = SDL_Swap16(pix[i]);
-                    break;
-                }
-
-            case 32:{
-                    Uint32 *pix = (Uint32 *) bits;
-                    for (i = 0; i < surface->w; i++)
-                        pix[i] = SDL_Swap32(pix[i]);
-                    break;
-                }
+    /* Byte-swap the pixels if needed. Note that the 24bpp
+       case has already been taken care of above. */
+    if (!direct) {
+        switch (biBitCount) {
+        case 15:
+        case 16:
+            for (y = 0; y < surface->h; ++y) {
+                Uint16 *pix = (Uint16 *) ((Uint8 *) surface->pixels + y * surface->pitch);
+                for (i = 0; i < surface->w; i++)
+                    pix[i] = SDL_Swap16(pix[i]);
             }
-#endif
             break;
-        }
-        /* Skip padding bytes, ugh */
-        if (pad) {
-            Uint8 padbyte;
-            for (i = 0; i < pad; ++i) {
-                SDL_RWread(src, &padbyte, 1, 1);
+
+        case 32:
+            for (y = 0; y < surface->h; ++y) {
+                Uint32 *pix = (Uint32 *) ((Uint8 *) surface->pixels + y * surface->pitch);
+                for (i = 0; i < surface->w; i++)
+                    pix[i] = SDL_Swap32(pix[i]);
             }
-        }
-        if (topDown) {
-            bits += surface->pitch;
-        } else {
-            bits -= surface->pitch;
+            break;
         }
     }
-    if (correctAlpha) {
+#endif
+    if (correctAlpha && !direct) {
         CorrectAlphaChannel(surface);
     }
   done:
+    SDL_free(buffer);
+    if (!was_error && format != SDL_PIXELFORMAT_UNKNOWN && !direct) {
+        SDL_Surface *converted = SDL_ConvertSurfaceFormat(surface, format, 0);
+        SDL_FreeSurface(surface);
+        surface = converted;
+        if (surface == NULL) {
+            was_error = SDL_TRUE;
+        }
+    }
     if (was_error) {
         if (src) {
             SDL_RWseek(src, fp_offset, RW_SEEK_SET);
@@ -0,0 +1,217 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_hints.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_thread.h"
+#include "SDL_convert_c.h"
+#include "../thread/SDL_systhread.h"
+
+/* Bands are at least this many pixels, so each one is worth waking a thread for */
+#define SDL_CONVERT_MIN_BAND_PIXELS (64 * 1024)
+
+/* A conversion split into horizontal bands, converted one band at a time
+   per thread.  Each band only writes its own rows, so the result is the
+   same as converting the whole image on one thread. */
+typedef struct
+{
+    SDL_ConvertBandFunc func;
+    void *data;
+    int height;
+    int band_height;
+    int num_bands;
+    SDL_atomic_t next_band;
+    SDL_atomic_t status;
+} SDL_ConvertJob;
+
+/* The worker threads, shared by all conversions.  Whoever sets convert_busy
+   owns them; a conversion that finds them busy runs on its own thread. */
+static SDL_atomic_t convert_busy;
+static int convert_num_threads;
+static SDL_Thread **convert_threads;
+static SDL_sem *convert_work_sem;
+static SDL_sem *convert_done_sem;
+static SDL_bool convert_quit;
+static SDL_ConvertJob convert_job;
+
+static void
+SDL_ConvertBands(SDL_ConvertJob *job)
+{
+    int band;
+
+    while ((band = SDL_AtomicAdd(&job->next_band, 1)) < job->num_bands) {
+        const int row = band * job->band_height;
+        const int status = job->func(job->data, row, SDL_min(job->band_height, job->height - row));
+        if (status != 0) {
+            SDL_AtomicCAS(&job->status, 0, status);
+        }
+    }
+}
+
+static int SDLCALL
+SDL_ConvertThread(void *unused)
+{
+    for ( ; ; ) {
+        SDL_SemWait(convert_work_sem);
+        if (convert_quit) {
+            break;
+        }
+        SDL_ConvertBands(&convert_job);
+        SDL_SemPost(convert_done_sem);
+    }
+    return 0;
+}
+
+static void
+SDL_DestroyConvertThreads(void)
+{
+    int i;
+
+    if (convert_threads) {
+        convert_quit = SDL_TRUE;
+        for (i = 0; i < convert_num_threads - 1; ++i) {
+            if (convert_threads[i]) {
+                SDL_SemPost(convert_work_sem);
+            }
+        }
+        for (i = 0; i < convert_num_threads - 1; ++i) {
+            if (convert_threads[i]) {
+                SDL_WaitThread(convert_threads[i], NULL);
+            }
+        }
+        SDL_free(convert_threads);
+        convert_threads = NULL;
+        convert_quit = SDL_FALSE;
+    }
+    if (convert_work_sem) {
+        SDL_DestroySemaphore(convert_work_sem);
+        convert_work_sem = NULL;
+    }
+    if (convert_done_sem) {
+        SDL_DestroySemaphore(convert_done_sem);
+        convert_done_sem = NULL;
+    }
+    convert_num_threads = 0;
+}
+
+static SDL_bool
+SDL_CreateConvertThreads(int num_threads)
+{
+    int i;
+
+    /* The converting thread does bands too, so start one thread less */
+    convert_num_threads = num_threads;
+    convert_threads = (SDL_Thread **) SDL_calloc(num_threads - 1, sizeof (SDL_Thread *));
+    convert_work_sem = SDL_CreateSemaphore(0);
+    convert_done_sem = SDL_CreateSemaphore(0);
+    if (!convert_threads || !convert_work_sem || !convert_done_sem) {
+        SDL_DestroyConvertThreads();
+        return SDL_FALSE;
+    }
+    for (i = 0; i < num_threads - 1; ++i) {
+        convert_threads[i] = SDL_CreateThreadInternal(SDL_ConvertThread, "SDLConvert", 0, NULL);
+        if (!convert_threads[i]) {
+            SDL_DestroyConvertThreads();
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+int
+SDL_GetConvertThreadCount(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_CONVERT_THREADS);
+    int num_threads = hint ? SDL_atoi(hint) : 0;
+
+    if (num_threads < 0) {
+        num_threads = SDL_GetCPUCount();
+    }
+    return SDL_max(num_threads, 1);
+}
+
+int
+SDL_ConvertInBands(int width, int height, int row_align,
+                   SDL_ConvertBandFunc func, void *data)
+{
+    SDL_ConvertJob *job = &convert_job;
+    const int num_threads = SDL_GetConvertThreadCount();
+    int band_height, num_bands, num_workers, i;
+
+    if (num_threads <= 1 || width <= 0 || height <= 0) {
+        return func(data, 0, height);
+    }
+
+    /* A few bands per thread, in case some are slower than others */
+    num_bands = num_threads * 4;
+    band_height = SDL_max((height + num_bands - 1) / num_bands,
+                          (SDL_CONVERT_MIN_BAND_PIXELS + width - 1) / width);
+    band_height = ((band_height + row_align - 1) / row_align) * row_align;
+    num_bands = (height + band_height - 1) / band_height;
+    if (num_bands < 2) {
+        return func(data, 0, height);
+    }
+
+    if (!SDL_AtomicCAS(&convert_busy, 0, 1)) {
+        return func(data, 0, height);
+    }
+    if (convert_num_threads != num_threads) {
+        SDL_DestroyConvertThreads();
+        if (!SDL_CreateConvertThreads(num_threads)) {
+            /* Just convert on this thread then */
+            SDL_AtomicSet(&convert_busy, 0);
+            return func(data, 0, height);
+        }
+    }
+
+    job->func = func;
+    job->data = data;
+    job->height = height;
+    job->band_height = band_height;
+    job->num_bands = num_bands;
+    SDL_AtomicSet(&job->next_band, 0);
+    SDL_AtomicSet(&job->status, 0);
+
+    num_workers = SDL_min(num_threads, num_bands) - 1;
+    for (i = 0; i < num_workers; ++i) {
+        SDL_SemPost(convert_work_sem);
+    }
+    SDL_ConvertBands(job);
+    for (i = 0; i < num_workers; ++i) {
+        SDL_SemWait(convert_done_sem);
+    }
+
+    SDL_AtomicSet(&convert_busy, 0);
+    return SDL_AtomicGet(&job->status);
+}
+
+void
+SDL_QuitConvertThreads(void)
+{
+    if (SDL_AtomicCAS(&convert_busy, 0, 1)) {
+        SDL_DestroyConvertThreads();
+        SDL_AtomicSet(&convert_busy, 0);
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
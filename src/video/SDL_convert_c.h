@@ -0,0 +1,46 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_convert_c_h_
+#define SDL_convert_c_h_
+
+#include "../SDL_internal.h"
+
+/* Converts (rows) rows of an image, starting at (row).  Returns 0 on success
+   or a non-zero value that SDL_ConvertInBands() passes back to its caller. */
+typedef int (SDLCALL * SDL_ConvertBandFunc)(void *data, int row, int rows);
+
+/* The number of threads SDL_ConvertInBands() may use, see SDL_HINT_CONVERT_THREADS */
+extern int SDL_GetConvertThreadCount(void);
+
+/* Calls (func) for horizontal bands covering all (height) rows of an image,
+   on several threads if SDL_HINT_CONVERT_THREADS allows it and the image is
+   big enough.  Every band but the last starts and ends on a multiple of
+   (row_align) rows.  Returns 0, or the first non-zero value returned by (func). */
+extern int SDL_ConvertInBands(int width, int height, int row_align,
+                              SDL_ConvertBandFunc func, void *data);
+
+/* Stops the threads used by SDL_ConvertInBands() */
+extern void SDL_QuitConvertThreads(void);
+
+#endif /* SDL_convert_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
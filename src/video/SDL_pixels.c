@@ -28,6 +28,7 @@
 #include "SDL_blit.h"
 #include "SDL_pixels_c.h"
 #include "SDL_RLEaccel_c.h"
+#include "../SDL_trace_c.h"
 
 
 /* Lookup tables to expand partial bytes to the full 0..255 range */
@@ -993,6 +994,8 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     SDL_PixelFormat *srcfmt;
     SDL_PixelFormat *dstfmt;
     SDL_BlitMap *map;
+    Uint64 trace_start;
+    int retval;
 
     /* Clear out any previous mapping */
     map = src->map;
@@ -1070,7 +1073,10 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     }
 
     /* Choose your blitters wisely */
-    return (SDL_CalculateBlit(src));
+    trace_start = SDL_TRACE_BEGIN();
+    retval = SDL_CalculateBlit(src);
+    SDL_TRACE_END("SDL_CalculateBlit", trace_start);
+    return retval;
 }
 
 void
@@ -1078,6 +1084,8 @@ SDL_FreeBlitMap(SDL_BlitMap * map)
 {
     if (map) {
         SDL_InvalidateMap(map);
+        SDL_FreeStretchCache(map->stretch);
+        SDL_free(map->damage);
         SDL_free(map);
     }
 }
@@ -28,6 +28,8 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "SDL_pixels_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 /* This isn't ready for general consumption yet - it should be folded
    into the general blitting mechanism.
@@ -252,6 +254,10 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
         dstrect = &full_dst;
     }
 
+    if (dst->map->damage) {
+        SDL_AddSurfaceDamage(dst, dstrect);
+    }
+
     /* Lock the destination if it's in hardware */
     dst_locked = 0;
     if (SDL_MUSTLOCK(dst)) {
@@ -350,4 +356,549 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     return (0);
 }
 
+/* Filtered stretching.
+
+   Each axis is resampled on its own: when it is enlarged, every
+   destination pixel is a linear interpolation of the two nearest source
+   pixels, and when it is shrunk, every destination pixel is the average of
+   the source pixels it covers (a box filter).  The horizontal pass filters
+   each source row into a row of 16-bit intermediate values, and the
+   vertical pass combines those rows into the destination.
+
+   The arithmetic is all integer, and the SIMD versions of the passes give
+   exactly the same results as the C versions.
+*/
+
+#define STRETCH_WEIGHT_BITS 14  /* the weights for a pixel add up to this */
+#define STRETCH_ROW_BITS    7   /* fractional bits of the intermediate values */
+#define STRETCH_H_SHIFT     (STRETCH_WEIGHT_BITS - STRETCH_ROW_BITS)
+#define STRETCH_V_SHIFT     (STRETCH_WEIGHT_BITS + STRETCH_ROW_BITS)
+
+typedef struct
+{
+    int src_len;
+    int dst_len;
+    int taps;           /* always even, so SIMD code can take two at a time */
+    int *index;         /* taps source pixels for each destination pixel */
+    Sint16 *weight;     /* and their weights */
+} SDL_StretchAxis;
+
+struct SDL_StretchCache
+{
+    SDL_StretchAxis x;
+    SDL_StretchAxis y;
+    Sint16 *rows;       /* y.taps horizontally filtered rows, used as a ring */
+    int *row_source;    /* the source row in each of them, or -1 */
+    const Sint16 **row_ptrs;
+    SDL_Surface *blit_row;  /* one filtered row, for blits that blend or modulate */
+};
+
+static int
+SDL_SetupStretchAxis(SDL_StretchAxis *axis, int src_len, int dst_len)
+{
+    const double scale = (double) src_len / dst_len;
+    int i, t;
+
+    axis->src_len = src_len;
+    axis->dst_len = dst_len;
+    if (dst_len >= src_len) {
+        axis->taps = 2;
+    } else {
+        axis->taps = ((int) SDL_ceil(scale) + 2) & ~1;
+    }
+    axis->index = (int *) SDL_malloc(dst_len * axis->taps * sizeof (int));
+    axis->weight = (Sint16 *) SDL_malloc(dst_len * axis->taps * sizeof (Sint16));
+    if (!axis->index || !axis->weight) {
+        return SDL_OutOfMemory();
+    }
+
+    for (i = 0; i < dst_len; ++i) {
+        int *index = &axis->index[i * axis->taps];
+        Sint16 *weight = &axis->weight[i * axis->taps];
+        int count = 0;
+
+        if (dst_len >= src_len) {
+            /* Linear, between the two source pixels nearest to our center */
+            const double center = (i + 0.5) * scale - 0.5;
+            int first = (int) SDL_floor(center);
+            int frac = (int) ((center - first) * (1 << STRETCH_WEIGHT_BITS) + 0.5);
+
+            if (first < 0) {
+                first = 0;
+                frac = 0;
+            } else if (first >= src_len - 1) {
+                first = src_len - 1;
+                frac = 0;
+            }
+            index[0] = first;
+            weight[0] = (Sint16) ((1 << STRETCH_WEIGHT_BITS) - frac);
+            index[1] = SDL_min(first + 1, src_len - 1);
+            weight[1] = (Sint16) frac;
+            count = 2;
+        } else {
+            /* Box, weighted by how much of each source pixel we cover */
+            const double start = i * scale;
+            const double end = (i + 1) * scale;
+            const int first = (int) SDL_floor(start);
+            const int last = SDL_min((int) SDL_ceil(end) - 1, src_len - 1);
+            int total = 0, biggest = 0;
+
+            for (t = first; t <= last; ++t) {
+                const double covered = SDL_min(end, t + 1) - SDL_max(start, t);
+                index[count] = t;
+                weight[count] = (Sint16) (covered / scale * (1 << STRETCH_WEIGHT_BITS) + 0.5);
+                total += weight[count];
+                if (weight[count] > weight[biggest]) {
+                    biggest = count;
+                }
+                ++count;
+            }
+            /* Make sure the weights add up exactly */
+            weight[biggest] += (Sint16) ((1 << STRETCH_WEIGHT_BITS) - total);
+        }
+
+        /* Pad with taps that don't contribute anything */
+        for (t = count; t < axis->taps; ++t) {
+            index[t] = index[count - 1];
+            weight[t] = 0;
+        }
+    }
+    return 0;
+}
+
+static void
+SDL_CleanupStretchAxis(SDL_StretchAxis *axis)
+{
+    SDL_free(axis->index);
+    SDL_free(axis->weight);
+    axis->index = NULL;
+    axis->weight = NULL;
+}
+
+void
+SDL_FreeStretchCache(SDL_StretchCache *cache)
+{
+    if (cache) {
+        SDL_CleanupStretchAxis(&cache->x);
+        SDL_CleanupStretchAxis(&cache->y);
+        SDL_free(cache->rows);
+        SDL_free(cache->row_source);
+        SDL_free((void *) cache->row_ptrs);
+        SDL_FreeSurface(cache->blit_row);
+        SDL_free(cache);
+    }
+}
+
+/* The filters and row buffers are kept with the source surface, since it
+   is usually stretched to the same size over and over again. */
+static SDL_StretchCache *
+SDL_GetStretchCache(SDL_BlitMap *map, int src_w, int src_h, int dst_w, int dst_h)
+{
+    SDL_StretchCache *cache = map->stretch;
+    int i;
+
+    if (cache &&
+        cache->x.src_len == src_w && cache->x.dst_len == dst_w &&
+        cache->y.src_len == src_h && cache->y.dst_len == dst_h) {
+        return cache;
+    }
+
+    SDL_FreeStretchCache(cache);
+    map->stretch = NULL;
+
+    cache = (SDL_StretchCache *) SDL_calloc(1, sizeof (*cache));
+    if (!cache) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    if (SDL_SetupStretchAxis(&cache->x, src_w, dst_w) < 0 ||
+        SDL_SetupStretchAxis(&cache->y, src_h, dst_h) < 0) {
+        SDL_FreeStretchCache(cache);
+        return NULL;
+    }
+    cache->rows = (Sint16 *) SDL_malloc(cache->y.taps * dst_w * 4 * sizeof (Sint16));
+    cache->row_source = (int *) SDL_malloc(cache->y.taps * sizeof (int));
+    cache->row_ptrs = (const Sint16 **) SDL_malloc(cache->y.taps * sizeof (Sint16 *));
+    if (!cache->rows || !cache->row_source || !cache->row_ptrs) {
+        SDL_FreeStretchCache(cache);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    for (i = 0; i < cache->y.taps; ++i) {
+        cache->row_source[i] = -1;
+    }
+
+    map->stretch = cache;
+    return cache;
+}
+
+typedef void (*SDL_StretchRowH)(const Uint8 *src, Sint16 *dst, const SDL_StretchAxis *axis);
+typedef void (*SDL_StretchRowV)(const Sint16 **rows, const Sint16 *weight, int taps, Uint8 *dst, int len);
+
+static void
+SDL_StretchRowH_C(const Uint8 *src, Sint16 *dst, const SDL_StretchAxis *axis)
+{
+    const int *index = axis->index;
+    const Sint16 *weight = axis->weight;
+    const int taps = axis->taps;
+    int i, t;
+
+    for (i = 0; i < axis->dst_len; ++i) {
+        int r = 1 << (STRETCH_H_SHIFT - 1);
+        int g = r, b = r, a = r;
+        for (t = 0; t < taps; ++t) {
+            const Uint8 *p = src + index[t] * 4;
+            r += weight[t] * p[0];
+            g += weight[t] * p[1];
+            b += weight[t] * p[2];
+            a += weight[t] * p[3];
+        }
+        dst[0] = (Sint16) (r >> STRETCH_H_SHIFT);
+        dst[1] = (Sint16) (g >> STRETCH_H_SHIFT);
+        dst[2] = (Sint16) (b >> STRETCH_H_SHIFT);
+        dst[3] = (Sint16) (a >> STRETCH_H_SHIFT);
+        dst += 4;
+        index += taps;
+        weight += taps;
+    }
+}
+
+/* Filter values [first, len) of the rows; the SIMD versions use this
+   for whatever is left over at the end */
+static void
+SDL_StretchRowVRange(const Sint16 **rows, const Sint16 *weight, int taps, Uint8 *dst, int first, int len)
+{
+    int i, t;
+
+    for (i = first; i < len; ++i) {
+        int value = 1 << (STRETCH_V_SHIFT - 1);
+        for (t = 0; t < taps; ++t) {
+            value += weight[t] * rows[t][i];
+        }
+        value >>= STRETCH_V_SHIFT;
+        dst[i] = (Uint8) SDL_min(value, 255);
+    }
+}
+
+static void
+SDL_StretchRowV_C(const Sint16 **rows, const Sint16 *weight, int taps, Uint8 *dst, int len)
+{
+    SDL_StretchRowVRange(rows, weight, taps, dst, 0, len);
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+SDL_StretchRowH_SSE2(const Uint8 *src, Sint16 *dst, const SDL_StretchAxis *axis)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(1 << (STRETCH_H_SHIFT - 1));
+    const int *index = axis->index;
+    const Sint16 *weight = axis->weight;
+    const int taps = axis->taps;
+    int i, t;
+
+    for (i = 0; i < axis->dst_len; ++i) {
+        __m128i sum = round;
+        for (t = 0; t < taps; t += 2) {
+            Uint32 p0, p1;
+            __m128i pixels, weights;
+            SDL_memcpy(&p0, src + index[t] * 4, 4);
+            SDL_memcpy(&p1, src + index[t + 1] * 4, 4);
+            /* Interleave the two pixels, so each channel is multiplied
+               with its weight and summed in a single step */
+            pixels = _mm_unpacklo_epi8(_mm_cvtsi32_si128(p0), _mm_cvtsi32_si128(p1));
+            pixels = _mm_unpacklo_epi8(pixels, zero);
+            weights = _mm_set1_epi32((int) ((Uint16) weight[t] | ((Uint32) (Uint16) weight[t + 1] << 16)));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(pixels, weights));
+        }
+        sum = _mm_srai_epi32(sum, STRETCH_H_SHIFT);
+        _mm_storel_epi64((__m128i *) dst, _mm_packs_epi32(sum, sum));
+        dst += 4;
+        index += taps;
+        weight += taps;
+    }
+}
+
+static void
+SDL_StretchRowV_SSE2(const Sint16 **rows, const Sint16 *weight, int taps, Uint8 *dst, int len)
+{
+    const __m128i round = _mm_set1_epi32(1 << (STRETCH_V_SHIFT - 1));
+    int i, t;
+
+    for (i = 0; i + 8 <= len; i += 8) {
+        __m128i lo = round, hi = round;
+        for (t = 0; t < taps; t += 2) {
+            const __m128i a = _mm_loadu_si128((const __m128i *) (rows[t] + i));
+            const __m128i b = _mm_loadu_si128((const __m128i *) (rows[t + 1] + i));
+            const __m128i weights = _mm_set1_epi32((int) ((Uint16) weight[t] | ((Uint32) (Uint16) weight[t + 1] << 16)));
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), weights));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), weights));
+        }
+        lo = _mm_packs_epi32(_mm_srai_epi32(lo, STRETCH_V_SHIFT), _mm_srai_epi32(hi, STRETCH_V_SHIFT));
+        _mm_storel_epi64((__m128i *) (dst + i), _mm_packus_epi16(lo, lo));
+    }
+    SDL_StretchRowVRange(rows, weight, taps, dst, i, len);
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void
+SDL_StretchRowH_NEON(const Uint8 *src, Sint16 *dst, const SDL_StretchAxis *axis)
+{
+    const int *index = axis->index;
+    const Sint16 *weight = axis->weight;
+    const int taps = axis->taps;
+    int i, t;
+
+    for (i = 0; i < axis->dst_len; ++i) {
+        int32x4_t sum = vdupq_n_s32(0);
+        for (t = 0; t < taps; ++t) {
+            Uint32 p;
+            int16x4_t pixel;
+            SDL_memcpy(&p, src + index[t] * 4, 4);
+            pixel = vreinterpret_s16_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(p)))));
+            sum = vmlal_n_s16(sum, pixel, weight[t]);
+        }
+        /* Rounding shift, the same as adding half and shifting */
+        vst1_s16(dst, vmovn_s32(vrshrq_n_s32(sum, STRETCH_H_SHIFT)));
+        dst += 4;
+        index += taps;
+        weight += taps;
+    }
+}
+
+static void
+SDL_StretchRowV_NEON(const Sint16 **rows, const Sint16 *weight, int taps, Uint8 *dst, int len)
+{
+    int i, t;
+
+    for (i = 0; i + 8 <= len; i += 8) {
+        int32x4_t lo = vdupq_n_s32(0), hi = vdupq_n_s32(0);
+        for (t = 0; t < taps; ++t) {
+            const int16x8_t row = vld1q_s16(rows[t] + i);
+            lo = vmlal_n_s16(lo, vget_low_s16(row), weight[t]);
+            hi = vmlal_n_s16(hi, vget_high_s16(row), weight[t]);
+        }
+        vst1_u8(dst + i, vqmovn_u16(vcombine_u16(vqmovun_s32(vrshrq_n_s32(lo, STRETCH_V_SHIFT)),
+                                                 vqmovun_s32(vrshrq_n_s32(hi, STRETCH_V_SHIFT)))));
+    }
+    SDL_StretchRowVRange(rows, weight, taps, dst, i, len);
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+/* Get the row that SDL_StretchLinear() filters into when blending, set up
+   to blit with the same blend mode and modulation as the source. */
+static SDL_Surface *
+SDL_GetStretchBlitRow(SDL_StretchCache *cache, SDL_Surface * src)
+{
+    SDL_Surface *row = cache->blit_row;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+
+    if (!row || row->format->format != src->format->format) {
+        SDL_FreeSurface(row);
+        row = SDL_CreateRGBSurfaceWithFormat(0, cache->x.dst_len, 1, 32, src->format->format);
+        cache->blit_row = row;
+        if (!row) {
+            return NULL;
+        }
+    }
+
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    SDL_SetSurfaceBlendMode(row, blendMode);
+    SDL_SetSurfaceColorMod(row, r, g, b);
+    SDL_SetSurfaceAlphaMod(row, a);
+    return row;
+}
+
+/* Filter srcrect into dstrect, which are both already valid.  Without
+   blending, the rows are written straight to dst, which has the same format
+   as src.  With it, each row is filtered into a buffer kept in the cache and
+   blitted from there, so dst can have any format.
+*/
+int
+SDL_StretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                  SDL_Surface * dst, const SDL_Rect * dstrect, SDL_bool blend)
+{
+    SDL_StretchRowH StretchRowH = SDL_StretchRowH_C;
+    SDL_StretchRowV StretchRowV = SDL_StretchRowV_C;
+    SDL_StretchCache *cache;
+    SDL_Surface *row = NULL;
+    SDL_Rect row_rect, dst_row;
+    int src_locked;
+    int dst_locked;
+    int row_len;
+    int y, t;
+    int retval = 0;
+
+    if (srcrect->w <= 0 || srcrect->h <= 0 || dstrect->w <= 0 || dstrect->h <= 0) {
+        return 0;
+    }
+
+    cache = SDL_GetStretchCache(src->map, srcrect->w, srcrect->h, dstrect->w, dstrect->h);
+    if (!cache) {
+        return -1;
+    }
+    if (blend) {
+        row = SDL_GetStretchBlitRow(cache, src);
+        if (!row) {
+            return -1;
+        }
+    }
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        StretchRowH = SDL_StretchRowH_SSE2;
+        StretchRowV = SDL_StretchRowV_SSE2;
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        StretchRowH = SDL_StretchRowH_NEON;
+        StretchRowV = SDL_StretchRowV_NEON;
+    }
+#endif
+
+    /* Blitting the rows locks the destination and adds its damage */
+    dst_locked = 0;
+    if (!blend) {
+        if (dst->map->damage) {
+            SDL_AddSurfaceDamage(dst, dstrect);
+        }
+
+        /* Lock the destination if it's in hardware */
+        if (SDL_MUSTLOCK(dst)) {
+            if (SDL_LockSurface(dst) < 0) {
+                return SDL_SetError("Unable to lock destination surface");
+            }
+            dst_locked = 1;
+        }
+    }
+    /* Lock the source if it's in hardware */
+    src_locked = 0;
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            if (dst_locked) {
+                SDL_UnlockSurface(dst);
+            }
+            return SDL_SetError("Unable to lock source surface");
+        }
+        src_locked = 1;
+    }
+
+    /* The source pixels may have changed since the last time */
+    for (t = 0; t < cache->y.taps; ++t) {
+        cache->row_source[t] = -1;
+    }
+
+    row_rect.x = 0;
+    row_rect.y = 0;
+    row_rect.w = dstrect->w;
+    row_rect.h = 1;
+    row_len = dstrect->w * 4;
+    for (y = 0; y < dstrect->h; ++y) {
+        const int *index = &cache->y.index[y * cache->y.taps];
+        Uint8 *dstp;
+
+        if (blend) {
+            dstp = (Uint8 *) row->pixels;
+        } else {
+            dstp = (Uint8 *) dst->pixels + (dstrect->y + y) * dst->pitch + dstrect->x * 4;
+        }
+
+        /* The source rows for a destination row are always fewer than the
+           ring has room for, and consecutive, so they can't collide */
+        for (t = 0; t < cache->y.taps; ++t) {
+            const int slot = index[t] % cache->y.taps;
+            Sint16 *ring_row = cache->rows + slot * row_len;
+            if (cache->row_source[slot] != index[t]) {
+                const Uint8 *srcp = (const Uint8 *) src->pixels + (srcrect->y + index[t]) * src->pitch + srcrect->x * 4;
+                StretchRowH(srcp, ring_row, &cache->x);
+                cache->row_source[slot] = index[t];
+            }
+            cache->row_ptrs[t] = ring_row;
+        }
+        StretchRowV(cache->row_ptrs, &cache->y.weight[y * cache->y.taps], cache->y.taps, dstp, row_len);
+
+        if (blend) {
+            dst_row.x = dstrect->x;
+            dst_row.y = dstrect->y + y;
+            dst_row.w = dstrect->w;
+            dst_row.h = 1;
+            if (SDL_LowerBlit(row, &row_rect, dst, &dst_row) < 0) {
+                retval = -1;
+                break;
+            }
+        }
+    }
+
+    /* We need to unlock the surfaces if they're locked */
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+
+    /* The row's blit map holds a reference to dst, don't keep it alive */
+    if (row) {
+        SDL_InvalidateMap(row->map);
+    }
+    return retval;
+}
+
+/* Perform a filtered stretch blit between two surfaces of the same 32-bit format.
+   NOTE:  This function is not safe to call from multiple threads with the same source!
+*/
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+
+    if (!src || !dst) {
+        return SDL_InvalidParamError("src");
+    }
+    if (src->format->format != dst->format->format) {
+        return SDL_SetError("Only works with same format surfaces");
+    }
+    if (src->format->BytesPerPixel != 4 || SDL_ISPIXELFORMAT_INDEXED(src->format->format) ||
+        SDL_PIXELLAYOUT(src->format->format) != SDL_PACKEDLAYOUT_8888) {
+        return SDL_SetError("Only works with 32-bit 8888 surfaces");
+    }
+
+    /* Verify the blit rectangles */
+    if (srcrect) {
+        if ((srcrect->x < 0) || (srcrect->y < 0) ||
+            ((srcrect->x + srcrect->w) > src->w) ||
+            ((srcrect->y + srcrect->h) > src->h)) {
+            return SDL_SetError("Invalid source blit rectangle");
+        }
+    } else {
+        full_src.x = 0;
+        full_src.y = 0;
+        full_src.w = src->w;
+        full_src.h = src->h;
+        srcrect = &full_src;
+    }
+    if (dstrect) {
+        if ((dstrect->x < 0) || (dstrect->y < 0) ||
+            ((dstrect->x + dstrect->w) > dst->w) ||
+            ((dstrect->y + dstrect->h) > dst->h)) {
+            return SDL_SetError("Invalid destination blit rectangle");
+        }
+    } else {
+        full_dst.x = 0;
+        full_dst.y = 0;
+        full_dst.w = dst->w;
+        full_dst.h = dst->h;
+        dstrect = &full_dst;
+    }
+
+    return SDL_StretchLinear(src, srcrect, dst, dstrect, SDL_FALSE);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
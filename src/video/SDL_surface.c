@@ -26,6 +26,8 @@
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "SDL_convert_c.h"
+#include "../SDL_trace_c.h"
 
 
 /* Check to make sure we can safely check multiplication of surface w and pitch and it won't overflow size_t */
@@ -559,6 +561,130 @@ SDL_GetClipRect(SDL_Surface * surface, SDL_Rect * rect)
     }
 }
 
+/*
+ * Damage tracking for window surfaces.  The damage is a short list of
+ * rectangles: a new one is merged with one in the list when their bounding
+ * box has no more pixels than the two of them, and when the list is full,
+ * with the one that makes the bounding box grow the least.
+ */
+struct SDL_Damage
+{
+    SDL_SpinLock lock;
+    int numrects;
+    SDL_Rect rects[SDL_MAX_DAMAGE_RECTS];
+};
+
+static Sint64
+SDL_GetRectArea(const SDL_Rect * rect)
+{
+    return (Sint64) rect->w * rect->h;
+}
+
+int
+SDL_TrackSurfaceDamage(SDL_Surface * surface)
+{
+    SDL_BlitMap *map = surface->map;
+
+    if (!map->damage) {
+        map->damage = (SDL_Damage *) SDL_calloc(1, sizeof(*map->damage));
+        if (!map->damage) {
+            return SDL_OutOfMemory();
+        }
+    }
+
+    /* Nothing has been shown yet */
+    SDL_AddSurfaceDamage(surface, NULL);
+    return 0;
+}
+
+void
+SDL_AddSurfaceDamage(SDL_Surface * surface, const SDL_Rect * rect)
+{
+    SDL_Damage *damage = surface->map->damage;
+    SDL_Rect full_rect, area, merged;
+    Sint64 growth, best_growth;
+    int i, best;
+
+    if (!damage) {
+        return;
+    }
+
+    full_rect.x = 0;
+    full_rect.y = 0;
+    full_rect.w = surface->w;
+    full_rect.h = surface->h;
+    if (!rect) {
+        area = full_rect;
+    } else if (!SDL_IntersectRect(rect, &full_rect, &area)) {
+        return;
+    }
+
+    SDL_AtomicLock(&damage->lock);
+again:
+    best = -1;
+    best_growth = 0;
+    for (i = 0; i < damage->numrects; ++i) {
+        SDL_UnionRect(&damage->rects[i], &area, &merged);
+        if (SDL_RectEquals(&merged, &damage->rects[i])) {
+            /* Already damaged */
+            SDL_AtomicUnlock(&damage->lock);
+            return;
+        }
+        growth = SDL_GetRectArea(&merged) - SDL_GetRectArea(&damage->rects[i]) - SDL_GetRectArea(&area);
+        if (growth <= 0) {
+            /* The merged rectangle may overlap others now */
+            area = merged;
+            damage->rects[i] = damage->rects[--damage->numrects];
+            goto again;
+        }
+        if (best < 0 || growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    if (damage->numrects == SDL_MAX_DAMAGE_RECTS) {
+        SDL_UnionRect(&damage->rects[best], &area, &area);
+        damage->rects[best] = damage->rects[--damage->numrects];
+        goto again;
+    }
+    damage->rects[damage->numrects++] = area;
+    SDL_AtomicUnlock(&damage->lock);
+}
+
+void
+SDL_AddSurfaceDamagePoints(SDL_Surface * surface, const SDL_Point * points, int count)
+{
+    SDL_Rect bounds;
+
+    /* Lines may cross the clip rectangle with both ends outside of it */
+    if (SDL_EnclosePoints(points, count, NULL, &bounds) &&
+        SDL_IntersectRect(&bounds, &surface->clip_rect, &bounds)) {
+        SDL_AddSurfaceDamage(surface, &bounds);
+    }
+}
+
+int
+SDL_GetSurfaceDamage(SDL_Surface * surface, SDL_Rect * rects, int maxrects, SDL_bool clear)
+{
+    SDL_Damage *damage = surface->map->damage;
+    int numrects;
+
+    if (!damage) {
+        return 0;
+    }
+
+    SDL_AtomicLock(&damage->lock);
+    numrects = damage->numrects;
+    if (rects) {
+        SDL_memcpy(rects, damage->rects, SDL_min(numrects, maxrects) * sizeof(*rects));
+    }
+    if (clear) {
+        damage->numrects = 0;
+    }
+    SDL_AtomicUnlock(&damage->lock);
+    return numrects;
+}
+
 /*
  * Set up a blit between two surfaces -- split into three parts:
  * The upper part, SDL_UpperBlit(), performs clipping and rectangle
@@ -574,6 +700,9 @@ int
 SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
               SDL_Surface * dst, SDL_Rect * dstrect)
 {
+    Uint64 trace_start;
+    int retval;
+
     /* Check to make sure the blit mapping is valid */
     if ((src->map->dst != dst) ||
         (dst->format->palette &&
@@ -589,7 +718,13 @@ SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
 /*              src, dst->flags, src->map->info.flags, dst, dst->flags, */
 /*              dst->map->info.flags, src->map->blit); */
     }
-    return (src->map->blit(src, srcrect, dst, dstrect));
+    if (dst->map->damage) {
+        SDL_AddSurfaceDamage(dst, dstrect);
+    }
+    trace_start = SDL_TRACE_BEGIN();
+    retval = src->map->blit(src, srcrect, dst, dstrect);
+    SDL_TRACE_END("SDL_LowerBlit", trace_start);
+    return retval;
 }
 
 
@@ -695,6 +830,13 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
               SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateUpperBlitScaled(src, srcrect, dst, dstrect, SDL_FALSE);
+}
+
+int
+SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+                           SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear)
 {
     double src_x0, src_y0, src_x1, src_y1;
     double dst_x0, dst_y0, dst_x1, dst_y1;
@@ -839,7 +981,7 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
         return 0;
     }
 
-    return SDL_LowerBlitScaled(src, &final_src, dst, &final_dst);
+    return SDL_PrivateLowerBlitScaled(src, &final_src, dst, &final_dst, linear);
 }
 
 /**
@@ -849,6 +991,30 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
                 SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateLowerBlitScaled(src, srcrect, dst, dstrect, SDL_FALSE);
+}
+
+/* Filter straight into the destination if nothing else needs doing,
+   otherwise a row at a time, blitting each with the source's blend mode
+   and modulation */
+static int
+SDL_LowerBlitScaledLinear(SDL_Surface * src, SDL_Rect * srcrect,
+                          SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    SDL_bool blend = SDL_FALSE;
+
+    if (src->format->format != dst->format->format ||
+        (src->map->info.flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
+                                 SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD))) {
+        blend = SDL_TRUE;
+    }
+    return SDL_StretchLinear(src, srcrect, dst, dstrect, blend);
+}
+
+int
+SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                           SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear)
 {
     static const Uint32 complex_copy_flags = (
         SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
@@ -856,6 +1022,15 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
         SDL_COPY_COLORKEY
     );
 
+    /* A color key can't be filtered, so that stays nearest */
+    if (linear &&
+        !(src->map->info.flags & SDL_COPY_COLORKEY) &&
+        src->format->BytesPerPixel == 4 &&
+        !SDL_ISPIXELFORMAT_INDEXED(src->format->format) &&
+        SDL_PIXELLAYOUT(src->format->format) == SDL_PACKEDLAYOUT_8888) {
+        return SDL_LowerBlitScaledLinear(src, srcrect, dst, dstrect);
+    }
+
     if (!(src->map->info.flags & SDL_COPY_NEAREST)) {
         src->map->info.flags |= SDL_COPY_NEAREST;
         SDL_InvalidateMap(src->map);
@@ -902,6 +1077,11 @@ SDL_UnlockSurface(SDL_Surface * surface)
         return;
     }
 
+    /* Anything may have been written while it was locked */
+    if (surface->map->damage) {
+        SDL_AddSurfaceDamage(surface, NULL);
+    }
+
     /* Update RLE encoded surface with new data */
     if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
         surface->flags &= ~SDL_RLEACCEL;        /* stop lying */
@@ -918,6 +1098,48 @@ SDL_DuplicateSurface(SDL_Surface * surface)
     return SDL_ConvertSurface(surface, surface->format, surface->flags);
 }
 
+typedef struct
+{
+    SDL_Surface *src;
+    SDL_Surface *dst;
+} SDL_ConvertBlitData;
+
+static int SDLCALL
+SDL_ConvertBlitBand(void *data, int row, int rows)
+{
+    SDL_ConvertBlitData *blit = (SDL_ConvertBlitData *) data;
+    SDL_Rect rect;
+
+    rect.x = 0;
+    rect.y = row;
+    rect.w = blit->src->w;
+    rect.h = rows;
+    return SDL_BlitClipped(blit->src, &rect, blit->dst, &rect, &rect);
+}
+
+/*
+ * Blit all of src to the same size dst, in bands on several threads if
+ * SDL_HINT_CONVERT_THREADS asks for it.
+ */
+static int
+SDL_ConvertBlit(SDL_Surface * src, SDL_Surface * dst)
+{
+    SDL_Rect rect;
+
+    if (SDL_GetConvertThreadCount() > 1 && SDL_PrepareBlitClipped(src, dst)) {
+        SDL_ConvertBlitData data;
+        data.src = src;
+        data.dst = dst;
+        return SDL_ConvertInBands(src->w, src->h, 1, SDL_ConvertBlitBand, &data);
+    }
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = src->w;
+    rect.h = src->h;
+    return SDL_LowerBlit(src, &rect, dst, &rect);
+}
+
 /*
  * Convert a surface into the specified pixel format.
  */
@@ -928,7 +1150,6 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     SDL_Surface *convert;
     Uint32 copy_flags;
     SDL_Color copy_color;
-    SDL_Rect bounds;
 
     if (!surface) {
         SDL_InvalidParamError("surface");
@@ -985,11 +1206,7 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     SDL_InvalidateMap(surface->map);
 
     /* Copy over the image data */
-    bounds.x = 0;
-    bounds.y = 0;
-    bounds.w = surface->w;
-    bounds.h = surface->h;
-    SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    SDL_ConvertBlit(surface, convert);
 
     /* Clean up the original surface, and update converted surface */
     convert->map->info.r = copy_color.r;
@@ -1142,7 +1359,6 @@ int SDL_ConvertPixels(int width, int height,
     SDL_Surface src_surface, dst_surface;
     SDL_PixelFormat src_fmt, dst_fmt;
     SDL_BlitMap src_blitmap, dst_blitmap;
-    SDL_Rect rect;
     void *nonconst_src = (void *) src;
 
     /* Check to make sure we are blitting somewhere, so we don't crash */
@@ -1184,12 +1400,7 @@ int SDL_ConvertPixels(int width, int height,
         return -1;
     }
 
-    /* Set up the rect and go! */
-    rect.x = 0;
-    rect.y = 0;
-    rect.w = width;
-    rect.h = height;
-    return SDL_LowerBlit(&src_surface, &rect, &dst_surface, &rect);
+    return SDL_ConvertBlit(&src_surface, &dst_surface);
 }
 
 /*
@@ -279,6 +279,12 @@ struct SDL_VideoDevice
      */
     void (*PumpEvents) (_THIS);
 
+    /* Fill in up to (maxfds) file descriptors that become readable when
+       PumpEvents has new input, and set (*timeout) to how many milliseconds
+       we may block before PumpEvents must run anyway (-1 for no limit).
+       Returns the number of fds, or -1 if we can't block on this backend. */
+    int (*GetEventWaitFDs) (_THIS, int *fds, int maxfds, int *timeout);
+
     /* Suspend the screensaver */
     void (*SuspendScreenSaver) (_THIS);
 
@@ -413,6 +419,7 @@ extern VideoBootStrap PSP_bootstrap;
 extern VideoBootStrap RPI_bootstrap;
 extern VideoBootStrap KMSDRM_bootstrap;
 extern VideoBootStrap DUMMY_bootstrap;
+extern VideoBootStrap OFFSCREEN_bootstrap;
 extern VideoBootStrap Wayland_bootstrap;
 extern VideoBootStrap NACL_bootstrap;
 extern VideoBootStrap VIVANTE_bootstrap;
@@ -433,6 +440,7 @@ extern SDL_bool SDL_HasWindows(void);
 
 extern void SDL_OnWindowShown(SDL_Window * window);
 extern void SDL_OnWindowHidden(SDL_Window * window);
+extern void SDL_OnWindowExposed(SDL_Window * window);
 extern void SDL_OnWindowResized(SDL_Window * window);
 extern void SDL_OnWindowMinimized(SDL_Window * window);
 extern void SDL_OnWindowRestored(SDL_Window * window);
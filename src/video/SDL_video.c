@@ -114,6 +114,9 @@ static VideoBootStrap *bootstrap[] = {
 #endif
 #if SDL_VIDEO_DRIVER_DUMMY
     &DUMMY_bootstrap,
+#endif
+#if SDL_VIDEO_DRIVER_OFFSCREEN
+    &OFFSCREEN_bootstrap,
 #endif
     NULL
 };
@@ -2226,6 +2229,10 @@ SDL_GetWindowSurface(SDL_Window * window)
         if (window->surface) {
             window->surface_valid = SDL_TRUE;
             window->surface->flags |= SDL_DONTFREE;
+            if (SDL_GetHintBoolean(SDL_HINT_FRAMEBUFFER_DAMAGE, SDL_FALSE)) {
+                /* Without it every update copies the whole window */
+                SDL_TrackSurfaceDamage(window->surface);
+            }
         }
     }
     return window->surface;
@@ -2238,6 +2245,24 @@ SDL_UpdateWindowSurface(SDL_Window * window)
 
     CHECK_WINDOW_MAGIC(window, -1);
 
+    if (window->surface_valid && window->surface->map->damage) {
+        SDL_Rect rects[SDL_MAX_DAMAGE_RECTS];
+        int i, numrects;
+
+        numrects = SDL_GetSurfaceDamage(window->surface, rects, SDL_arraysize(rects), SDL_TRUE);
+        if (numrects == 0) {
+            return 0;
+        }
+        if (SDL_UpdateWindowSurfaceRects(window, rects, numrects) < 0) {
+            /* Try again on the next update */
+            for (i = 0; i < numrects; ++i) {
+                SDL_AddSurfaceDamage(window->surface, &rects[i]);
+            }
+            return -1;
+        }
+        return 0;
+    }
+
     full_rect.x = 0;
     full_rect.y = 0;
     full_rect.w = window->w;
@@ -2258,6 +2283,30 @@ SDL_UpdateWindowSurfaceRects(SDL_Window * window, const SDL_Rect * rects,
     return _this->UpdateWindowFramebuffer(_this, window, rects, numrects);
 }
 
+int
+SDL_GetWindowSurfaceDamage(SDL_Window * window, SDL_Rect * rects, int maxrects)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    if (!window->surface_valid) {
+        return SDL_SetError("Window surface is invalid, please call SDL_GetWindowSurface() to get a new surface");
+    }
+    if (maxrects < 0) {
+        return SDL_InvalidParamError("maxrects");
+    }
+
+    if (window->surface->map->damage) {
+        return SDL_GetSurfaceDamage(window->surface, rects, maxrects, SDL_FALSE);
+    }
+    if (rects && maxrects > 0) {
+        rects->x = 0;
+        rects->y = 0;
+        rects->w = window->w;
+        rects->h = window->h;
+    }
+    return 1;
+}
+
 int
 SDL_SetWindowBrightness(SDL_Window * window, float brightness)
 {
@@ -2497,6 +2546,15 @@ SDL_OnWindowHidden(SDL_Window * window)
     SDL_UpdateFullscreenMode(window, SDL_FALSE);
 }
 
+void
+SDL_OnWindowExposed(SDL_Window * window)
+{
+    /* The window contents were lost and must all be copied again */
+    if (window->surface_valid && window->surface->map->damage) {
+        SDL_AddSurfaceDamage(window->surface, NULL);
+    }
+}
+
 void
 SDL_OnWindowResized(SDL_Window * window)
 {
@@ -23,6 +23,8 @@
 #include "SDL_endian.h"
 #include "SDL_video.h"
 #include "SDL_pixels_c.h"
+#include "SDL_convert_c.h"
+#include "../cpuinfo/SDL_simd.h"
 
 #include "yuv2rgb/yuv_rgb.h"
 
@@ -390,37 +392,71 @@ static SDL_bool yuv_rgb_std(
     return SDL_FALSE;
 }
 
+/* A YUV to RGB conversion, done in bands of rows by yuv_rgb_band() */
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    int width;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    int rgb_pitch;
+    YCbCrType yuv_type;
+} YUV2RGBJob;
+
+/* Bands of planar formats start on an even row.  Returns 1 if there's no fast path for these formats. */
+static int SDLCALL
+yuv_rgb_band(void *data, int row, int rows)
+{
+    const YUV2RGBJob *job = (const YUV2RGBJob *)data;
+    const int uv_row = IsPlanar2x2Format(job->src_format) ? (row / 2) : row;
+    const Uint8 *y = job->y + row * job->y_stride;
+    const Uint8 *u = job->u + uv_row * job->uv_stride;
+    const Uint8 *v = job->v + uv_row * job->uv_stride;
+    Uint8 *rgb = job->rgb + row * job->rgb_pitch;
+
+    if (yuv_rgb_sse(job->src_format, job->dst_format, job->width, rows, y, u, v, job->y_stride, job->uv_stride, rgb, job->rgb_pitch, job->yuv_type)) {
+        return 0;
+    }
+
+    if (yuv_rgb_std(job->src_format, job->dst_format, job->width, rows, y, u, v, job->y_stride, job->uv_stride, rgb, job->rgb_pitch, job->yuv_type)) {
+        return 0;
+    }
+    return 1;
+}
+
 int
 SDL_ConvertPixels_YUV_to_RGB(int width, int height,
          Uint32 src_format, const void *src, int src_pitch,
          Uint32 dst_format, void *dst, int dst_pitch)
 {
-	const Uint8 *y = NULL;
-    const Uint8 *u = NULL;
-    const Uint8 *v = NULL;
-    Uint32 y_stride = 0;
-    Uint32 uv_stride = 0;
-    YCbCrType yuv_type = YCBCR_601;
+    YUV2RGBJob job;
+    int ret;
 
-    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
+    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &job.y, &job.u, &job.v, &job.y_stride, &job.uv_stride) < 0) {
         return -1;
     }
 
-    if (GetYUVConversionType(width, height, &yuv_type) < 0) {
+    if (GetYUVConversionType(width, height, &job.yuv_type) < 0) {
         return -1;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
-        return 0;
-    }
-
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
-        return 0;
+    job.src_format = src_format;
+    job.dst_format = dst_format;
+    job.width = width;
+    job.rgb = (Uint8 *)dst;
+    job.rgb_pitch = dst_pitch;
+    ret = SDL_ConvertInBands(width, height, 2, yuv_rgb_band, &job);
+    if (ret <= 0) {
+        return ret;
     }
 
     /* No fast path for the RGB format, instead convert using an intermediate buffer */
     if (dst_format != SDL_PIXELFORMAT_ARGB8888) {
-        int ret;
         void *tmp;
         int tmp_pitch = (width * sizeof(Uint32));
 
@@ -453,330 +489,694 @@ struct RGB2YUVFactors
     float v[3]; /* Rfactor, Gfactor, Bfactor */
 };
 
-static int
-SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
-{
-    const int src_pitch_x_2    = src_pitch * 2;
-    const int height_half      = height / 2;
-    const int height_remainder = (height & 0x1);
-    const int width_half       = width / 2;
-    const int width_remainder  = (width & 0x1);
-    int i, j;
- 
-    static struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] =
+static const struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] =
+{
+    /* ITU-T T.871 (JPEG) */
     {
-        /* ITU-T T.871 (JPEG) */
-        {
-            0,
-            {  0.2990f,  0.5870f,  0.1140f },
-            { -0.1687f, -0.3313f,  0.5000f },
-            {  0.5000f, -0.4187f, -0.0813f },
-        },
-        /* ITU-R BT.601-7 */
-        {
-            16,
-            {  0.2568f,  0.5041f,  0.0979f },
-            { -0.1482f, -0.2910f,  0.4392f },
-            {  0.4392f, -0.3678f, -0.0714f },
-        },
-        /* ITU-R BT.709-6 */
-        {
-            16,
-            { 0.1826f,  0.6142f,  0.0620f },
-            {-0.1006f, -0.3386f,  0.4392f },
-            { 0.4392f, -0.3989f, -0.0403f },
-        },
-    };
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
-
-#define MAKE_Y(r, g, b) (Uint8)((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset)
-#define MAKE_U(r, g, b) (Uint8)((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128)
-#define MAKE_V(r, g, b) (Uint8)((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 128)
-
-#define READ_2x2_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-        const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18; \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10; \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2;  \
-
-#define READ_2x1_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];                                                    \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17;                                         \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;                                          \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;                                          \
-
-#define READ_1x2_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17;                                         \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;                                          \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;                                          \
-
-#define READ_1x1_PIXEL                                                                                          \
-        const Uint32 p = ((const Uint32 *)curr_row)[2 * i];                                                     \
-        const Uint32 r = (p & 0x00ff0000) >> 16;                                                                \
-        const Uint32 g = (p & 0x0000ff00) >> 8;                                                                 \
-        const Uint32 b = (p & 0x000000ff);                                                                      \
-
-#define READ_TWO_RGB_PIXELS                                                                                     \
-        const Uint32 p = ((const Uint32 *)curr_row)[2 * i];                                                     \
-        const Uint32 r = (p & 0x00ff0000) >> 16;                                                                \
-        const Uint32 g = (p & 0x0000ff00) >> 8;                                                                 \
-        const Uint32 b = (p & 0x000000ff);                                                                      \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 r1 = (p1 & 0x00ff0000) >> 16;                                                              \
-        const Uint32 g1 = (p1 & 0x0000ff00) >> 8;                                                               \
-        const Uint32 b1 = (p1 & 0x000000ff);                                                                    \
-        const Uint32 R = (r + r1)/2;                                                                            \
-        const Uint32 G = (g + g1)/2;                                                                            \
-        const Uint32 B = (b + b1)/2;                                                                            \
-
-#define READ_ONE_RGB_PIXEL  READ_1x1_PIXEL
-
-    switch (dst_format) 
+        0,
+        {  0.2990f,  0.5870f,  0.1140f },
+        { -0.1687f, -0.3313f,  0.5000f },
+        {  0.5000f, -0.4187f, -0.0813f },
+    },
+    /* ITU-R BT.601-7 */
+    {
+        16,
+        {  0.2568f,  0.5041f,  0.0979f },
+        { -0.1482f, -0.2910f,  0.4392f },
+        {  0.4392f, -0.3678f, -0.0714f },
+    },
+    /* ITU-R BT.709-6 */
+    {
+        16,
+        { 0.1826f,  0.6142f,  0.0620f },
+        {-0.1006f, -0.3386f,  0.4392f },
+        { 0.4392f, -0.3989f, -0.0403f },
+    },
+};
+
+/* The factors above in 1.15 fixed point, arranged by the byte of a 32-bit
+   pixel they apply to, from the lowest byte up; the alpha byte's are 0.
+   The vectorized versions below do exactly the same integer arithmetic as
+   the scalar ones, so all of them give identical results. */
+#define RGB2YUV_SHIFT   15
+#define RGB2YUV_ROUND   (1 << (RGB2YUV_SHIFT - 1))
+
+typedef struct
+{
+    Sint16 y[4];
+    Sint16 u[4];
+    Sint16 v[4];
+    int y_offset;
+    SDL_bool use_sse2;
+    SDL_bool use_avx2;
+    SDL_bool use_neon;
+} RGB2YUVConverter;
+
+static SDL_bool
+InitRGB2YUVConverter(RGB2YUVConverter *cvt, Uint32 src_format, int width, int height)
+{
+    const struct RGB2YUVFactors *factors = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+    int shift[3];   /* R, G, B */
+    int i;
+
+    switch (src_format) {
+    case SDL_PIXELFORMAT_RGB888:
+    case SDL_PIXELFORMAT_ARGB8888:
+        shift[0] = 16; shift[1] = 8; shift[2] = 0;
+        break;
+    case SDL_PIXELFORMAT_BGR888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        shift[0] = 0; shift[1] = 8; shift[2] = 16;
+        break;
+    case SDL_PIXELFORMAT_RGBX8888:
+    case SDL_PIXELFORMAT_RGBA8888:
+        shift[0] = 24; shift[1] = 16; shift[2] = 8;
+        break;
+    case SDL_PIXELFORMAT_BGRX8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+        shift[0] = 8; shift[1] = 16; shift[2] = 24;
+        break;
+    default:
+        return SDL_FALSE;
+    }
+
+    SDL_zerop(cvt);
+#define RGB2YUV_FIXED(f) (Sint16)((f) * (1 << RGB2YUV_SHIFT) + (((f) < 0.0f) ? -0.5f : 0.5f))
+    for (i = 0; i < 3; ++i) {
+        cvt->y[shift[i] / 8] = RGB2YUV_FIXED(factors->y[i]);
+        cvt->u[shift[i] / 8] = RGB2YUV_FIXED(factors->u[i]);
+        cvt->v[shift[i] / 8] = RGB2YUV_FIXED(factors->v[i]);
+    }
+#undef RGB2YUV_FIXED
+    cvt->y_offset = factors->y_offset;
+    cvt->use_sse2 = SDL_HasSSE2();
+    cvt->use_avx2 = SDL_HasAVX2();
+    cvt->use_neon = SDL_HasNEON();
+    return SDL_TRUE;
+}
+
+#define RGB2YUV_BYTE(p, k)  (int)(((p) >> ((k) * 8)) & 0xFF)
+
+static SDL_INLINE Uint8
+RGB2YUV_Pack(int sum, int offset)
+{
+    const int value = ((sum + RGB2YUV_ROUND) >> RGB2YUV_SHIFT) + offset;
+    return (Uint8)((value < 0) ? 0 : (value > 255) ? 255 : value);
+}
+
+static void
+RGB32_to_Y_std(const Uint32 *src, Uint8 *y, int y_step, int width, const RGB2YUVConverter *cvt)
+{
+    int i;
+    for (i = 0; i < width; ++i) {
+        const Uint32 p = src[i];
+        *y = RGB2YUV_Pack(cvt->y[0] * RGB2YUV_BYTE(p, 0) + cvt->y[1] * RGB2YUV_BYTE(p, 1) +
+                          cvt->y[2] * RGB2YUV_BYTE(p, 2) + cvt->y[3] * RGB2YUV_BYTE(p, 3), cvt->y_offset);
+        y += y_step;
+    }
+}
+
+/* U and V from the average of each 2x2 block of row0 and row1, repeating
+   the last column of an odd width. Pass the same row twice for 2x1 blocks. */
+static void
+RGB32_to_UV_std(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVConverter *cvt)
+{
+    int i, k;
+    for (i = 0; i < width; i += 2) {
+        const int next = (i + 1 < width) ? (i + 1) : i;
+        const Uint32 p1 = row0[i], p2 = row0[next], p3 = row1[i], p4 = row1[next];
+        int c[4];
+        for (k = 0; k < 4; ++k) {
+            c[k] = (RGB2YUV_BYTE(p1, k) + RGB2YUV_BYTE(p2, k) + RGB2YUV_BYTE(p3, k) + RGB2YUV_BYTE(p4, k)) >> 2;
+        }
+        *u = RGB2YUV_Pack(cvt->u[0] * c[0] + cvt->u[1] * c[1] + cvt->u[2] * c[2] + cvt->u[3] * c[3], 128);
+        *v = RGB2YUV_Pack(cvt->v[0] * c[0] + cvt->v[1] * c[1] + cvt->v[2] * c[2] + cvt->v[3] * c[3], 128);
+        u += uv_step;
+        v += uv_step;
+    }
+}
+
+/* The vectorized versions load whole pixels, so the lowest byte must come first in memory */
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+#undef HAVE_SSE2_INTRINSICS
+#undef HAVE_NEON_INTRINSICS
+#endif
+
+/* The AVX2 versions share the SSE2 helpers */
+#if !HAVE_SSE2_INTRINSICS
+#undef HAVE_AVX2_INTRINSICS
+#endif
+
+#if HAVE_SSE2_INTRINSICS
+/* The per-byte factors for two pixels */
+static SDL_INLINE __m128i
+RGB2YUV_Factors_SSE2(const Sint16 *f)
+{
+    return _mm_setr_epi16(f[0], f[1], f[2], f[3], f[0], f[1], f[2], f[3]);
+}
+
+/* Four 32-bit dot products of the factors with the pixels in lo and hi,
+   which hold two pixels each, unpacked to 16 bits per byte */
+static SDL_INLINE __m128i
+RGB2YUV_Dot4_SSE2(__m128i lo, __m128i hi, __m128i factors)
+{
+    const __m128 a = _mm_castsi128_ps(_mm_madd_epi16(lo, factors));
+    const __m128 b = _mm_castsi128_ps(_mm_madd_epi16(hi, factors));
+    const __m128i sum = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))),
+                                      _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+    return _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(RGB2YUV_ROUND)), RGB2YUV_SHIFT);
+}
+
+/* Sixteen pixels to sixteen Y values */
+static SDL_INLINE __m128i
+RGB32_to_Y16_SSE2(const Uint32 *src, __m128i factors, __m128i offset)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i y[4];
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        const __m128i px = _mm_loadu_si128((const __m128i *)(src + i * 4));
+        y[i] = RGB2YUV_Dot4_SSE2(_mm_unpacklo_epi8(px, zero), _mm_unpackhi_epi8(px, zero), factors);
+    }
+    return _mm_packus_epi16(_mm_add_epi16(_mm_packs_epi32(y[0], y[1]), offset),
+                            _mm_add_epi16(_mm_packs_epi32(y[2], y[3]), offset));
+}
+
+/* Sixteen pixels of each row to eight U and V values in the low halves */
+static SDL_INLINE void
+RGB32_to_UV8_SSE2(const Uint32 *row0, const Uint32 *row1, __m128i ufactors, __m128i vfactors, __m128i *u, __m128i *v)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(128);
+    __m128i avg[4], uv;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(row0 + i * 4));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(row1 + i * 4));
+        const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        /* add horizontal neighbours, leaving each 2x2 block's sums in a low half */
+        avg[i] = _mm_srli_epi16(_mm_unpacklo_epi64(_mm_add_epi16(lo, _mm_srli_si128(lo, 8)),
+                                                   _mm_add_epi16(hi, _mm_srli_si128(hi, 8))), 2);
+    }
+    uv = _mm_add_epi16(_mm_packs_epi32(RGB2YUV_Dot4_SSE2(avg[0], avg[1], ufactors),
+                                       RGB2YUV_Dot4_SSE2(avg[2], avg[3], ufactors)), bias);
+    *u = _mm_packus_epi16(uv, uv);
+    uv = _mm_add_epi16(_mm_packs_epi32(RGB2YUV_Dot4_SSE2(avg[0], avg[1], vfactors),
+                                       RGB2YUV_Dot4_SSE2(avg[2], avg[3], vfactors)), bias);
+    *v = _mm_packus_epi16(uv, uv);
+}
+
+/* Interleave sixteen Y values with eight chroma pairs into a packed 4:2:2 format */
+static SDL_INLINE void
+RGB2YUV_StorePacked16_SSE2(Uint8 *dst, __m128i y, __m128i u, __m128i v, Uint32 dst_format)
+{
+    switch (dst_format) {
+    case SDL_PIXELFORMAT_YUY2:
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(y, _mm_unpacklo_epi8(u, v)));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(y, _mm_unpacklo_epi8(u, v)));
+        break;
+    case SDL_PIXELFORMAT_UYVY:
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(_mm_unpacklo_epi8(u, v), y));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(_mm_unpacklo_epi8(u, v), y));
+        break;
+    default: /* SDL_PIXELFORMAT_YVYU */
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(y, _mm_unpacklo_epi8(v, u)));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(y, _mm_unpacklo_epi8(v, u)));
+        break;
+    }
+}
+
+static int
+RGB32_to_Y_SSE2(const Uint32 *src, Uint8 *y, int width, const RGB2YUVConverter *cvt)
+{
+    const __m128i factors = RGB2YUV_Factors_SSE2(cvt->y);
+    const __m128i offset = _mm_set1_epi16((short)cvt->y_offset);
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        _mm_storeu_si128((__m128i *)(y + i), RGB32_to_Y16_SSE2(src + i, factors, offset));
+    }
+    return i;
+}
+
+static int
+RGB32_to_UV_SSE2(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVConverter *cvt)
+{
+    const __m128i ufactors = RGB2YUV_Factors_SSE2(cvt->u);
+    const __m128i vfactors = RGB2YUV_Factors_SSE2(cvt->v);
+    __m128i U, V;
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        RGB32_to_UV8_SSE2(row0 + i, row1 + i, ufactors, vfactors, &U, &V);
+        if (uv_step == 1) {
+            _mm_storel_epi64((__m128i *)(u + i / 2), U);
+            _mm_storel_epi64((__m128i *)(v + i / 2), V);
+        } else if (u < v) {
+            _mm_storeu_si128((__m128i *)(u + i), _mm_unpacklo_epi8(U, V));
+        } else {
+            _mm_storeu_si128((__m128i *)(v + i), _mm_unpacklo_epi8(V, U));
+        }
+    }
+    return i;
+}
+
+static int
+RGB32_to_Packed_SSE2(const Uint32 *src, Uint8 *dst, int width, Uint32 dst_format, const RGB2YUVConverter *cvt)
+{
+    const __m128i yfactors = RGB2YUV_Factors_SSE2(cvt->y);
+    const __m128i ufactors = RGB2YUV_Factors_SSE2(cvt->u);
+    const __m128i vfactors = RGB2YUV_Factors_SSE2(cvt->v);
+    const __m128i offset = _mm_set1_epi16((short)cvt->y_offset);
+    __m128i U, V;
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        RGB32_to_UV8_SSE2(src + i, src + i, ufactors, vfactors, &U, &V);
+        RGB2YUV_StorePacked16_SSE2(dst + i * 2, RGB32_to_Y16_SSE2(src + i, yfactors, offset), U, V, dst_format);
+    }
+    return i;
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+/* The AVX2 versions work on 32 pixels at a time. Packing works within each
+   128-bit lane, so the results are put back in order with one permute. */
+
+SDL_TARGETING_AVX2 static SDL_INLINE __m256i
+RGB2YUV_Factors_AVX2(const Sint16 *f)
+{
+    return _mm256_setr_epi16(f[0], f[1], f[2], f[3], f[0], f[1], f[2], f[3],
+                             f[0], f[1], f[2], f[3], f[0], f[1], f[2], f[3]);
+}
+
+SDL_TARGETING_AVX2 static SDL_INLINE __m256i
+RGB2YUV_Dot8_AVX2(__m256i lo, __m256i hi, __m256i factors)
+{
+    const __m256 a = _mm256_castsi256_ps(_mm256_madd_epi16(lo, factors));
+    const __m256 b = _mm256_castsi256_ps(_mm256_madd_epi16(hi, factors));
+    const __m256i sum = _mm256_add_epi32(_mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))),
+                                         _mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+    return _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(RGB2YUV_ROUND)), RGB2YUV_SHIFT);
+}
+
+SDL_TARGETING_AVX2 static SDL_INLINE __m256i
+RGB32_to_Y32_AVX2(const Uint32 *src, __m256i factors, __m256i offset)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i y[4];
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        const __m256i px = _mm256_loadu_si256((const __m256i *)(src + i * 8));
+        y[i] = RGB2YUV_Dot8_AVX2(_mm256_unpacklo_epi8(px, zero), _mm256_unpackhi_epi8(px, zero), factors);
+    }
+    return _mm256_permutevar8x32_epi32(
+        _mm256_packus_epi16(_mm256_add_epi16(_mm256_packs_epi32(y[0], y[1]), offset),
+                            _mm256_add_epi16(_mm256_packs_epi32(y[2], y[3]), offset)),
+        _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+SDL_TARGETING_AVX2 static SDL_INLINE __m128i
+RGB2YUV_PackUV16_AVX2(__m256i avg[4], __m256i factors)
+{
+    const __m256i uv = _mm256_permutevar8x32_epi32(
+        _mm256_add_epi16(_mm256_packs_epi32(RGB2YUV_Dot8_AVX2(avg[0], avg[1], factors),
+                                            RGB2YUV_Dot8_AVX2(avg[2], avg[3], factors)),
+                         _mm256_set1_epi16(128)),
+        _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    return _mm_packus_epi16(_mm256_castsi256_si128(uv), _mm256_extracti128_si256(uv, 1));
+}
+
+SDL_TARGETING_AVX2 static SDL_INLINE void
+RGB32_to_UV16_AVX2(const Uint32 *row0, const Uint32 *row1, __m256i ufactors, __m256i vfactors, __m128i *u, __m128i *v)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i avg[4];
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        const __m256i a = _mm256_loadu_si256((const __m256i *)(row0 + i * 8));
+        const __m256i b = _mm256_loadu_si256((const __m256i *)(row1 + i * 8));
+        const __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+        const __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+        avg[i] = _mm256_srli_epi16(_mm256_unpacklo_epi64(_mm256_add_epi16(lo, _mm256_srli_si256(lo, 8)),
+                                                         _mm256_add_epi16(hi, _mm256_srli_si256(hi, 8))), 2);
+    }
+    *u = RGB2YUV_PackUV16_AVX2(avg, ufactors);
+    *v = RGB2YUV_PackUV16_AVX2(avg, vfactors);
+}
+
+SDL_TARGETING_AVX2 static int
+RGB32_to_Y_AVX2(const Uint32 *src, Uint8 *y, int width, const RGB2YUVConverter *cvt)
+{
+    const __m256i factors = RGB2YUV_Factors_AVX2(cvt->y);
+    const __m256i offset = _mm256_set1_epi16((short)cvt->y_offset);
+    int i;
+
+    for (i = 0; i + 32 <= width; i += 32) {
+        _mm256_storeu_si256((__m256i *)(y + i), RGB32_to_Y32_AVX2(src + i, factors, offset));
+    }
+    return i;
+}
+
+SDL_TARGETING_AVX2 static int
+RGB32_to_UV_AVX2(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVConverter *cvt)
+{
+    const __m256i ufactors = RGB2YUV_Factors_AVX2(cvt->u);
+    const __m256i vfactors = RGB2YUV_Factors_AVX2(cvt->v);
+    __m128i U, V;
+    int i;
+
+    for (i = 0; i + 32 <= width; i += 32) {
+        RGB32_to_UV16_AVX2(row0 + i, row1 + i, ufactors, vfactors, &U, &V);
+        if (uv_step == 1) {
+            _mm_storeu_si128((__m128i *)(u + i / 2), U);
+            _mm_storeu_si128((__m128i *)(v + i / 2), V);
+        } else if (u < v) {
+            _mm_storeu_si128((__m128i *)(u + i), _mm_unpacklo_epi8(U, V));
+            _mm_storeu_si128((__m128i *)(u + i + 16), _mm_unpackhi_epi8(U, V));
+        } else {
+            _mm_storeu_si128((__m128i *)(v + i), _mm_unpacklo_epi8(V, U));
+            _mm_storeu_si128((__m128i *)(v + i + 16), _mm_unpackhi_epi8(V, U));
+        }
+    }
+    return i;
+}
+
+SDL_TARGETING_AVX2 static int
+RGB32_to_Packed_AVX2(const Uint32 *src, Uint8 *dst, int width, Uint32 dst_format, const RGB2YUVConverter *cvt)
+{
+    const __m256i yfactors = RGB2YUV_Factors_AVX2(cvt->y);
+    const __m256i ufactors = RGB2YUV_Factors_AVX2(cvt->u);
+    const __m256i vfactors = RGB2YUV_Factors_AVX2(cvt->v);
+    const __m256i offset = _mm256_set1_epi16((short)cvt->y_offset);
+    __m256i Y;
+    __m128i U, V;
+    int i;
+
+    for (i = 0; i + 32 <= width; i += 32) {
+        Y = RGB32_to_Y32_AVX2(src + i, yfactors, offset);
+        RGB32_to_UV16_AVX2(src + i, src + i, ufactors, vfactors, &U, &V);
+        RGB2YUV_StorePacked16_SSE2(dst + i * 2, _mm256_castsi256_si128(Y), U, V, dst_format);
+        RGB2YUV_StorePacked16_SSE2(dst + i * 2 + 32, _mm256_extracti128_si256(Y, 1),
+                                   _mm_srli_si128(U, 8), _mm_srli_si128(V, 8), dst_format);
+    }
+    return i;
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+/* Four 32-bit dot products of the factors with four pixels, one byte per vector */
+static SDL_INLINE int16x4_t
+RGB2YUV_Dot4_NEON(int16x4_t c0, int16x4_t c1, int16x4_t c2, int16x4_t c3, const Sint16 *factors)
+{
+    int32x4_t sum = vmull_n_s16(c0, factors[0]);
+    sum = vmlal_n_s16(sum, c1, factors[1]);
+    sum = vmlal_n_s16(sum, c2, factors[2]);
+    sum = vmlal_n_s16(sum, c3, factors[3]);
+    return vqrshrn_n_s32(sum, RGB2YUV_SHIFT);
+}
+
+/* Eight values from eight pixels, split into 16-bit channels */
+static SDL_INLINE uint8x8_t
+RGB2YUV_Dot8_NEON(const int16x8_t c[4], const Sint16 *factors, int offset)
+{
+    const int16x8_t sum = vcombine_s16(
+        RGB2YUV_Dot4_NEON(vget_low_s16(c[0]), vget_low_s16(c[1]), vget_low_s16(c[2]), vget_low_s16(c[3]), factors),
+        RGB2YUV_Dot4_NEON(vget_high_s16(c[0]), vget_high_s16(c[1]), vget_high_s16(c[2]), vget_high_s16(c[3]), factors));
+    return vqmovun_s16(vaddq_s16(sum, vdupq_n_s16((int16_t)offset)));
+}
+
+static SDL_INLINE uint8x16_t
+RGB32_to_Y16_NEON(const Uint32 *src, const RGB2YUVConverter *cvt)
+{
+    const uint8x16x4_t px = vld4q_u8((const Uint8 *)src);
+    int16x8_t lo[4], hi[4];
+    int k;
+
+    for (k = 0; k < 4; ++k) {
+        lo[k] = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(px.val[k])));
+        hi[k] = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(px.val[k])));
+    }
+    return vcombine_u8(RGB2YUV_Dot8_NEON(lo, cvt->y, cvt->y_offset), RGB2YUV_Dot8_NEON(hi, cvt->y, cvt->y_offset));
+}
+
+static SDL_INLINE void
+RGB32_to_UV8_NEON(const Uint32 *row0, const Uint32 *row1, const RGB2YUVConverter *cvt, uint8x8_t *u, uint8x8_t *v)
+{
+    const uint8x16x4_t a = vld4q_u8((const Uint8 *)row0);
+    const uint8x16x4_t b = vld4q_u8((const Uint8 *)row1);
+    int16x8_t avg[4];
+    int k;
+
+    for (k = 0; k < 4; ++k) {
+        avg[k] = vreinterpretq_s16_u16(vshrq_n_u16(vpadalq_u8(vpaddlq_u8(a.val[k]), b.val[k]), 2));
+    }
+    *u = RGB2YUV_Dot8_NEON(avg, cvt->u, 128);
+    *v = RGB2YUV_Dot8_NEON(avg, cvt->v, 128);
+}
+
+static int
+RGB32_to_Y_NEON(const Uint32 *src, Uint8 *y, int width, const RGB2YUVConverter *cvt)
+{
+    int i;
+    for (i = 0; i + 16 <= width; i += 16) {
+        vst1q_u8(y + i, RGB32_to_Y16_NEON(src + i, cvt));
+    }
+    return i;
+}
+
+static int
+RGB32_to_UV_NEON(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVConverter *cvt)
+{
+    uint8x8x2_t uv;
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        RGB32_to_UV8_NEON(row0 + i, row1 + i, cvt, &uv.val[0], &uv.val[1]);
+        if (uv_step == 1) {
+            vst1_u8(u + i / 2, uv.val[0]);
+            vst1_u8(v + i / 2, uv.val[1]);
+        } else if (u < v) {
+            vst2_u8(u + i, uv);
+        } else {
+            const uint8x8_t tmp = uv.val[0];
+            uv.val[0] = uv.val[1];
+            uv.val[1] = tmp;
+            vst2_u8(v + i, uv);
+        }
+    }
+    return i;
+}
+
+static int
+RGB32_to_Packed_NEON(const Uint32 *src, Uint8 *dst, int width, Uint32 dst_format, const RGB2YUVConverter *cvt)
+{
+    uint8x8_t U, V;
+    uint8x8x2_t Y;
+    uint8x8x4_t out;
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        const uint8x16_t y = RGB32_to_Y16_NEON(src + i, cvt);
+        RGB32_to_UV8_NEON(src + i, src + i, cvt, &U, &V);
+        Y = vuzp_u8(vget_low_u8(y), vget_high_u8(y));   /* even and odd pixels */
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_YUY2:
+            out.val[0] = Y.val[0]; out.val[1] = U; out.val[2] = Y.val[1]; out.val[3] = V;
+            break;
+        case SDL_PIXELFORMAT_UYVY:
+            out.val[0] = U; out.val[1] = Y.val[0]; out.val[2] = V; out.val[3] = Y.val[1];
+            break;
+        default: /* SDL_PIXELFORMAT_YVYU */
+            out.val[0] = Y.val[0]; out.val[1] = V; out.val[2] = Y.val[1]; out.val[3] = U;
+            break;
+        }
+        vst4_u8(dst + i * 2, out);
+    }
+    return i;
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+static void
+RGB32_to_Y_row(const Uint32 *src, Uint8 *y, int width, const RGB2YUVConverter *cvt)
+{
+    int done = 0;
+#if HAVE_AVX2_INTRINSICS
+    if (cvt->use_avx2) {
+        done = RGB32_to_Y_AVX2(src, y, width, cvt);
+    }
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (cvt->use_sse2) {
+        done += RGB32_to_Y_SSE2(src + done, y + done, width - done, cvt);
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (cvt->use_neon) {
+        done = RGB32_to_Y_NEON(src, y, width, cvt);
+    }
+#endif
+    RGB32_to_Y_std(src + done, y + done, 1, width - done, cvt);
+}
+
+static void
+RGB32_to_UV_row(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVConverter *cvt)
+{
+    int done = 0;
+#if HAVE_AVX2_INTRINSICS
+    if (cvt->use_avx2) {
+        done = RGB32_to_UV_AVX2(row0, row1, u, v, uv_step, width, cvt);
+    }
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (cvt->use_sse2) {
+        done += RGB32_to_UV_SSE2(row0 + done, row1 + done, u + (done / 2) * uv_step, v + (done / 2) * uv_step, uv_step, width - done, cvt);
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (cvt->use_neon) {
+        done = RGB32_to_UV_NEON(row0, row1, u, v, uv_step, width, cvt);
+    }
+#endif
+    RGB32_to_UV_std(row0 + done, row1 + done, u + (done / 2) * uv_step, v + (done / 2) * uv_step, uv_step, width - done, cvt);
+}
+
+/* One row of a packed 4:2:2 format; y, u and v point into dst */
+static void
+RGB32_to_Packed_row(const Uint32 *src, Uint8 *dst, Uint8 *y, Uint8 *u, Uint8 *v, int width, Uint32 dst_format, const RGB2YUVConverter *cvt)
+{
+    int done = 0;
+#if HAVE_AVX2_INTRINSICS
+    if (cvt->use_avx2) {
+        done = RGB32_to_Packed_AVX2(src, dst, width, dst_format, cvt);
+    }
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (cvt->use_sse2) {
+        done += RGB32_to_Packed_SSE2(src + done, dst + done * 2, width - done, dst_format, cvt);
+    }
+#endif
+#if HAVE_NEON_INTRINSICS
+    if (cvt->use_neon) {
+        done = RGB32_to_Packed_NEON(src, dst, width, dst_format, cvt);
+    }
+#endif
+    RGB32_to_Y_std(src + done, y + done * 2, 2, width - done, cvt);
+    RGB32_to_UV_std(src + done, src + done, u + done * 2, v + done * 2, 4, width - done, cvt);
+    if (width & 1) {
+        /* the last pixel fills both Y values of its pair */
+        y[width * 2] = y[(width - 1) * 2];
+    }
+}
+
+/* An RGB to YUV conversion, done in bands of rows by RGB32_to_YUV_Band() */
+typedef struct
+{
+    const RGB2YUVConverter *cvt;
+    int width;
+    const Uint8 *src;
+    int src_pitch;
+    Uint32 dst_format;
+    Uint8 *dst;
+    int dst_pitch;
+    Uint8 *y;
+    Uint8 *u;
+    Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+} RGB2YUVJob;
+
+/* Bands of planar formats start on an even row */
+static int SDLCALL
+RGB32_to_YUV_Band(void *data, int row, int rows)
+{
+    const RGB2YUVJob *job = (const RGB2YUVJob *)data;
+    const RGB2YUVConverter *cvt = job->cvt;
+    const int width = job->width;
+    const int src_pitch = job->src_pitch;
+    const Uint8 *src = job->src + row * src_pitch;
+    int j;
+
+    if (IsPlanar2x2Format(job->dst_format)) {
+        const int uv_step = (job->dst_format == SDL_PIXELFORMAT_NV12 || job->dst_format == SDL_PIXELFORMAT_NV21) ? 2 : 1;
+        Uint8 *plane_y = job->y + row * job->y_stride;
+        Uint8 *plane_u = job->u + (row / 2) * job->uv_stride;
+        Uint8 *plane_v = job->v + (row / 2) * job->uv_stride;
+
+        /* Both rows of Y and their row of U and V, so each source row is read while it's in cache */
+        for (j = 0; j < rows; j += 2) {
+            const Uint32 *row0 = (const Uint32 *)src;
+            const Uint32 *row1 = (j + 1 < rows) ? (const Uint32 *)(src + src_pitch) : row0;
+
+            RGB32_to_Y_row(row0, plane_y, width, cvt);
+            if (j + 1 < rows) {
+                RGB32_to_Y_row(row1, plane_y + job->y_stride, width, cvt);
+            }
+            RGB32_to_UV_row(row0, row1, plane_u, plane_v, uv_step, width, cvt);
+
+            src += src_pitch * 2;
+            plane_y += job->y_stride * 2;
+            plane_u += job->uv_stride;
+            plane_v += job->uv_stride;
+        }
+    } else {
+        for (j = row; j < row + rows; ++j) {
+            RGB32_to_Packed_row((const Uint32 *)src, job->dst + j * job->dst_pitch,
+                                job->y + j * job->y_stride, job->u + j * job->uv_stride, job->v + j * job->uv_stride,
+                                width, job->dst_format, cvt);
+            src += src_pitch;
+        }
+    }
+    return 0;
+}
+
+static int
+SDL_ConvertPixels_RGB32_to_YUV(int width, int height, const RGB2YUVConverter *cvt, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+{
+    RGB2YUVJob job;
+
+    switch (dst_format)
     {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
-        {
-            const Uint8 *curr_row, *next_row;
-            
-            Uint8 *plane_y;
-            Uint8 *plane_u;
-            Uint8 *plane_v;
-            Uint8 *plane_interleaved_uv;
-            Uint32 y_stride, uv_stride, y_skip, uv_skip;
-
-            GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
-	                     (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
-                         &y_stride, &uv_stride);
-            plane_interleaved_uv = (plane_y + height * y_stride);
-            y_skip = (y_stride - width);
-
-            curr_row = (const Uint8*)src;
-
-            /* Write Y plane */
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width; i++) {
-                    const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-                    const Uint32 r = (p1 & 0x00ff0000) >> 16;
-                    const Uint32 g = (p1 & 0x0000ff00) >> 8;
-                    const Uint32 b = (p1 & 0x000000ff);
-                    *plane_y++ = MAKE_Y(r, g, b);
-                }
-                plane_y += y_skip;
-                curr_row += src_pitch;
-            }
-
-            curr_row = (const Uint8*)src;
-            next_row = (const Uint8*)src;
-            next_row += src_pitch;
-
-            if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV)
-            {
-                /* Write UV planes, not interleaved */
-                uv_skip = (uv_stride - (width + 1)/2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    plane_u += uv_skip;
-                    plane_v += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    plane_u += uv_skip;
-                    plane_v += uv_skip;
-                }
-            }
-            else if (dst_format == SDL_PIXELFORMAT_NV12)
-            {
-                uv_skip = (uv_stride - ((width + 1)/2)*2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    plane_interleaved_uv += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                }
-            } 
-            else /* dst_format == SDL_PIXELFORMAT_NV21 */
-            {
-                uv_skip = (uv_stride - ((width + 1)/2)*2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    plane_interleaved_uv += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                }
-            }
-        }
         break;
 
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
         {
-            const Uint8 *curr_row = (const Uint8*) src;
-            Uint8 *plane           = (Uint8*) dst;
             const int row_size = (4 * ((width + 1) / 2));
-            int plane_skip;
 
             if (dst_pitch < row_size) {
                 return SDL_SetError("Destination pitch is too small, expected at least %d\n", row_size);
             }
-            plane_skip = (dst_pitch - row_size);
-
-            /* Write YUV plane, packed */
-            if (dst_format == SDL_PIXELFORMAT_YUY2) 
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* Y U Y1 V */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                        *plane++ = MAKE_V(R, G, B);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* Y U Y V */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
-            } 
-            else if (dst_format == SDL_PIXELFORMAT_UYVY)
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* U Y V Y1 */
-                        *plane++ = MAKE_U(R, G, B);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* U Y V Y */
-                        *plane++ = MAKE_U(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
-            }
-            else if (dst_format == SDL_PIXELFORMAT_YVYU)
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* Y V Y1 U */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                        *plane++ = MAKE_U(R, G, B);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* Y V Y U */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
-            }
         }
         break;
 
     default:
         return SDL_SetError("Unsupported YUV destination format: %s", SDL_GetPixelFormatName(dst_format));
     }
-#undef MAKE_Y
-#undef MAKE_U
-#undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
-#undef READ_1x1_PIXEL
-#undef READ_TWO_RGB_PIXELS
-#undef READ_ONE_RGB_PIXEL
-    return 0;
+
+    if (GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                     (const Uint8 **)&job.y, (const Uint8 **)&job.u, (const Uint8 **)&job.v,
+                     &job.y_stride, &job.uv_stride) < 0) {
+        return -1;
+    }
+    job.cvt = cvt;
+    job.width = width;
+    job.src = (const Uint8 *)src;
+    job.src_pitch = src_pitch;
+    job.dst_format = dst_format;
+    job.dst = (Uint8 *)dst;
+    job.dst_pitch = dst_pitch;
+    return SDL_ConvertInBands(width, height, 2, RGB32_to_YUV_Band, &job);
 }
 
 int
@@ -807,13 +1207,17 @@ SDL_ConvertPixels_RGB_to_YUV(int width, int height,
     }
 #endif
 
-    /* ARGB8888 to FOURCC */
-    if (src_format == SDL_PIXELFORMAT_ARGB8888) {
-        return SDL_ConvertPixels_ARGB8888_to_YUV(width, height, src, src_pitch, dst_format, dst, dst_pitch);
+    /* 32-bit RGB to FOURCC */
+    {
+        RGB2YUVConverter cvt;
+        if (InitRGB2YUVConverter(&cvt, src_format, width, height)) {
+            return SDL_ConvertPixels_RGB32_to_YUV(width, height, &cvt, src, src_pitch, dst_format, dst, dst_pitch);
+        }
     }
 
-    /* not ARGB8888 to FOURCC : need an intermediate conversion */
+    /* other RGB to FOURCC : need an intermediate conversion */
     {
+        RGB2YUVConverter cvt;
         int ret;
         void *tmp;
         int tmp_pitch = (width * sizeof(Uint32));
@@ -831,7 +1235,8 @@ SDL_ConvertPixels_RGB_to_YUV(int width, int height,
         }
 
         /* convert tmp/ARGB8888 to dst/FOURCC */
-        ret = SDL_ConvertPixels_ARGB8888_to_YUV(width, height, tmp, tmp_pitch, dst_format, dst, dst_pitch);
+        InitRGB2YUVConverter(&cvt, SDL_PIXELFORMAT_ARGB8888, width, height);
+        ret = SDL_ConvertPixels_RGB32_to_YUV(width, height, &cvt, tmp, tmp_pitch, dst_format, dst, dst_pitch);
         SDL_free(tmp);
         return ret;
     }
@@ -38,5 +38,15 @@ void KMSDRM_PumpEvents(_THIS)
 
 }
 
+int KMSDRM_GetEventWaitFDs(_THIS, int *fds, int maxfds, int *timeout)
+{
+    *timeout = -1;
+#ifdef SDL_INPUT_LINUXEV
+    return SDL_EVDEV_GetFDs(fds, maxfds);
+#else
+    return 0;
+#endif
+}
+
 #endif /* SDL_VIDEO_DRIVER_KMSDRM */
 
@@ -25,6 +25,7 @@
 #define SDL_kmsdrmevents_h_
 
 extern void KMSDRM_PumpEvents(_THIS);
+extern int KMSDRM_GetEventWaitFDs(_THIS, int *fds, int maxfds, int *timeout);
 extern void KMSDRM_EventInit(_THIS);
 extern void KMSDRM_EventQuit(_THIS);
 
@@ -149,6 +149,7 @@ KMSDRM_Create(int devindex)
 #endif
 
     device->PumpEvents = KMSDRM_PumpEvents;
+    device->GetEventWaitFDs = KMSDRM_GetEventWaitFDs;
 
     return device;
 
@@ -0,0 +1,206 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_DRIVER_OFFSCREEN
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "../SDL_sysvideo.h"
+#include "SDL_offscreenframebuffer_c.h"
+
+
+static size_t
+OFFSCREEN_AlignToPage(size_t size)
+{
+    const size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    return (size + page - 1) / page * page;
+}
+
+int
+SDL_OFFSCREEN_MapSharedMemory(SDL_WindowData * data, size_t size)
+{
+    void *header;
+
+    /* Readers may still have the old size mapped, so it never shrinks */
+    size = OFFSCREEN_AlignToPage(size);
+    if (size <= data->size) {
+        return 0;
+    }
+    if (ftruncate(data->memfd, (off_t) size) < 0) {
+        return SDL_SetError("Couldn't resize shared memory: %s", strerror(errno));
+    }
+    header = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, data->memfd, 0);
+    if (header == MAP_FAILED) {
+        return SDL_SetError("Couldn't map shared memory: %s", strerror(errno));
+    }
+    if (data->header) {
+        munmap(data->header, data->size);
+    }
+    data->header = (SDL_OffscreenHeader *) header;
+    data->size = size;
+    return 0;
+}
+
+int SDL_OFFSCREEN_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * format, void ** pixels, int *pitch)
+{
+    SDL_WindowData *data = (SDL_WindowData *) window->driverdata;
+    SDL_OffscreenHeader *header;
+    SDL_Surface *surface;
+    const Uint32 surface_format = SDL_PIXELFORMAT_RGB888;
+    size_t header_size, frame_size;
+    int w, h;
+    int bpp;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+    Uint32 i;
+
+    /* Free the old framebuffer surface */
+    SDL_FreeSurface(data->surface);
+    data->surface = NULL;
+
+    /* Create a new one, which the frames are copied from */
+    SDL_PixelFormatEnumToMasks(surface_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+    SDL_GetWindowSize(window, &w, &h);
+    surface = SDL_CreateRGBSurface(0, w, h, bpp, Rmask, Gmask, Bmask, Amask);
+    if (!surface) {
+        return -1;
+    }
+
+    /* Make room for the frames, each starting on a new page */
+    header_size = OFFSCREEN_AlignToPage(sizeof(*header));
+    frame_size = OFFSCREEN_AlignToPage((size_t) surface->pitch * h);
+    if (SDL_OFFSCREEN_MapSharedMemory(data, header_size + data->header->num_frames * frame_size) < 0) {
+        SDL_FreeSurface(surface);
+        return -1;
+    }
+
+    /* Invalidate the frames before they move, in case they're being read */
+    header = data->header;
+    for (i = 0; i < header->num_frames; ++i) {
+        header->frames[i].sequence = 0;
+    }
+    SDL_MemoryBarrierRelease();
+    for (i = 0; i < header->num_frames; ++i) {
+        SDL_OffscreenFrame *frame = &header->frames[i];
+
+        frame->format = surface_format;
+        frame->timestamp = 0;
+        frame->offset = header_size + i * frame_size;
+        frame->w = w;
+        frame->h = h;
+        frame->pitch = surface->pitch;
+        SDL_zero(frame->damage);
+
+        /* None of the frames have been written yet */
+        data->stale[i].x = 0;
+        data->stale[i].y = 0;
+        data->stale[i].w = w;
+        data->stale[i].h = h;
+    }
+
+    /* Save the info and return! */
+    data->surface = surface;
+    *format = surface_format;
+    *pixels = surface->pixels;
+    *pitch = surface->pitch;
+    return 0;
+}
+
+int SDL_OFFSCREEN_UpdateWindowFramebuffer(_THIS, SDL_Window * window, const SDL_Rect * rects, int numrects)
+{
+    SDL_WindowData *data = (SDL_WindowData *) window->driverdata;
+    SDL_Surface *surface = data->surface;
+    SDL_OffscreenHeader *header = data->header;
+    SDL_OffscreenFrame *frame;
+    SDL_Rect full_rect, damage, clipped;
+    SDL_Rect *stale;
+    struct timespec now;
+    const Uint64 one = 1;
+    const Uint8 *src;
+    Uint8 *dst;
+    Uint32 i;
+    int n, y;
+
+    if (!surface) {
+        return SDL_SetError("Couldn't find offscreen surface for window");
+    }
+
+    full_rect.x = 0;
+    full_rect.y = 0;
+    full_rect.w = surface->w;
+    full_rect.h = surface->h;
+    SDL_zero(damage);
+    for (n = 0; n < numrects; ++n) {
+        if (SDL_IntersectRect(&rects[n], &full_rect, &clipped)) {
+            SDL_UnionRect(&damage, &clipped, &damage);
+        }
+    }
+
+    /* The frame written next is the oldest, so it misses the changes made
+       since any of the frames were written; only those are copied */
+    for (i = 0; i < header->num_frames; ++i) {
+        SDL_UnionRect(&data->stale[i], &damage, &data->stale[i]);
+    }
+    ++data->sequence;
+    i = (data->sequence - 1) % header->num_frames;
+    frame = &header->frames[i];
+    stale = &data->stale[i];
+
+    frame->sequence = 0;
+    SDL_MemoryBarrierRelease();
+    src = (const Uint8 *) surface->pixels + stale->y * surface->pitch + stale->x * surface->format->BytesPerPixel;
+    dst = (Uint8 *) header + frame->offset + stale->y * surface->pitch + stale->x * surface->format->BytesPerPixel;
+    for (y = 0; y < stale->h; ++y) {
+        SDL_memcpy(dst, src, stale->w * surface->format->BytesPerPixel);
+        src += surface->pitch;
+        dst += surface->pitch;
+    }
+    SDL_zerop(stale);
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    frame->timestamp = (Uint64) now.tv_sec * 1000000000 + now.tv_nsec;
+    frame->damage = damage;
+    SDL_MemoryBarrierRelease();
+    frame->sequence = data->sequence;
+    header->sequence = data->sequence;
+
+    /* Let the reader know; this only fails if it hasn't read for ages */
+    if (write(data->eventfd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+        return SDL_SetError("Couldn't signal eventfd: %s", strerror(errno));
+    }
+    return 0;
+}
+
+void SDL_OFFSCREEN_DestroyWindowFramebuffer(_THIS, SDL_Window * window)
+{
+    SDL_WindowData *data = (SDL_WindowData *) window->driverdata;
+
+    SDL_FreeSurface(data->surface);
+    data->surface = NULL;
+}
+
+#endif /* SDL_VIDEO_DRIVER_OFFSCREEN */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,263 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_DRIVER_OFFSCREEN
+
+/* Offscreen SDL video driver: like the dummy driver, except that each window
+ * is presented into a ring of frames in shared memory, where another process
+ * can capture, encode or compare them without copying.  The shared memory
+ * and an eventfd signaled for each frame are available through
+ * SDL_GetWindowWMInfo(), see SDL_OffscreenHeader in SDL_syswm.h.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "SDL_video.h"
+#include "SDL_hints.h"
+#include "SDL_syswm.h"
+#include "../SDL_sysvideo.h"
+#include "../../events/SDL_events_c.h"
+
+#include "SDL_offscreenvideo.h"
+#include "SDL_offscreenframebuffer_c.h"
+
+#define OFFSCREENVID_DRIVER_NAME "offscreen"
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+/* Initialization/Query functions */
+static int OFFSCREEN_VideoInit(_THIS);
+static int OFFSCREEN_SetDisplayMode(_THIS, SDL_VideoDisplay * display, SDL_DisplayMode * mode);
+static void OFFSCREEN_VideoQuit(_THIS);
+static void OFFSCREEN_PumpEvents(_THIS);
+static int OFFSCREEN_CreateWindow(_THIS, SDL_Window * window);
+static void OFFSCREEN_DestroyWindow(_THIS, SDL_Window * window);
+static SDL_bool OFFSCREEN_GetWindowWMInfo(_THIS, SDL_Window * window, struct SDL_SysWMinfo *info);
+
+/* OFFSCREEN driver bootstrap functions */
+
+static int
+OFFSCREEN_Available(void)
+{
+    const char *envr = SDL_getenv("SDL_VIDEODRIVER");
+    if ((envr) && (SDL_strcmp(envr, OFFSCREENVID_DRIVER_NAME) == 0)) {
+        return (1);
+    }
+
+    return (0);
+}
+
+static void
+OFFSCREEN_DeleteDevice(SDL_VideoDevice * device)
+{
+    SDL_free(device);
+}
+
+static SDL_VideoDevice *
+OFFSCREEN_CreateDevice(int devindex)
+{
+    SDL_VideoDevice *device;
+
+    /* Initialize all variables that we clean on shutdown */
+    device = (SDL_VideoDevice *) SDL_calloc(1, sizeof(SDL_VideoDevice));
+    if (!device) {
+        SDL_OutOfMemory();
+        return (0);
+    }
+    /* There's no texture support, only the window framebuffer */
+    device->is_dummy = SDL_TRUE;
+
+    /* Set the function pointers */
+    device->VideoInit = OFFSCREEN_VideoInit;
+    device->VideoQuit = OFFSCREEN_VideoQuit;
+    device->SetDisplayMode = OFFSCREEN_SetDisplayMode;
+    device->PumpEvents = OFFSCREEN_PumpEvents;
+    device->CreateSDLWindow = OFFSCREEN_CreateWindow;
+    device->DestroyWindow = OFFSCREEN_DestroyWindow;
+    device->GetWindowWMInfo = OFFSCREEN_GetWindowWMInfo;
+    device->CreateWindowFramebuffer = SDL_OFFSCREEN_CreateWindowFramebuffer;
+    device->UpdateWindowFramebuffer = SDL_OFFSCREEN_UpdateWindowFramebuffer;
+    device->DestroyWindowFramebuffer = SDL_OFFSCREEN_DestroyWindowFramebuffer;
+
+    device->free = OFFSCREEN_DeleteDevice;
+
+    return device;
+}
+
+VideoBootStrap OFFSCREEN_bootstrap = {
+    OFFSCREENVID_DRIVER_NAME, "SDL offscreen shared memory video driver",
+    OFFSCREEN_Available, OFFSCREEN_CreateDevice
+};
+
+
+int
+OFFSCREEN_VideoInit(_THIS)
+{
+    SDL_DisplayMode mode;
+
+    /* Use a fake 32-bpp desktop mode */
+    mode.format = SDL_PIXELFORMAT_RGB888;
+    mode.w = 1024;
+    mode.h = 768;
+    mode.refresh_rate = 0;
+    mode.driverdata = NULL;
+    if (SDL_AddBasicVideoDisplay(&mode) < 0) {
+        return -1;
+    }
+
+    SDL_zero(mode);
+    SDL_AddDisplayMode(&_this->displays[0], &mode);
+
+    /* We're done! */
+    return 0;
+}
+
+static int
+OFFSCREEN_SetDisplayMode(_THIS, SDL_VideoDisplay * display, SDL_DisplayMode * mode)
+{
+    return 0;
+}
+
+void
+OFFSCREEN_VideoQuit(_THIS)
+{
+}
+
+static void
+OFFSCREEN_PumpEvents(_THIS)
+{
+    /* There's no event stream */
+}
+
+static int
+OFFSCREEN_CreateSharedMemory(void)
+{
+    int fd = -1;
+
+#ifdef __NR_memfd_create
+    fd = (int) syscall(__NR_memfd_create, "SDL offscreen window", MFD_CLOEXEC);
+#endif
+    if (fd < 0) {
+        /* Linux before 3.17 doesn't have memfd_create() */
+        char path[] = "/dev/shm/SDL-offscreen-XXXXXX";
+
+        fd = mkstemp(path);
+        if (fd >= 0) {
+            unlink(path);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+    }
+    return fd;
+}
+
+static int
+OFFSCREEN_CreateWindow(_THIS, SDL_Window * window)
+{
+    SDL_WindowData *data;
+    const char *hint;
+    int num_frames = 3;
+
+    hint = SDL_GetHint(SDL_HINT_VIDEO_OFFSCREEN_FRAMES);
+    if (hint && *hint) {
+        num_frames = SDL_atoi(hint);
+        num_frames = SDL_max(num_frames, 2);
+        num_frames = SDL_min(num_frames, SDL_OFFSCREEN_MAX_FRAMES);
+    }
+
+    data = (SDL_WindowData *) SDL_calloc(1, sizeof(*data));
+    if (!data) {
+        return SDL_OutOfMemory();
+    }
+    data->memfd = OFFSCREEN_CreateSharedMemory();
+    if (data->memfd < 0) {
+        SDL_SetError("Couldn't create shared memory: %s", strerror(errno));
+        SDL_free(data);
+        return -1;
+    }
+    data->eventfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (data->eventfd < 0) {
+        SDL_SetError("Couldn't create eventfd: %s", strerror(errno));
+        close(data->memfd);
+        SDL_free(data);
+        return -1;
+    }
+
+    /* The frames are added when the window surface is created */
+    if (SDL_OFFSCREEN_MapSharedMemory(data, sizeof(*data->header)) < 0) {
+        close(data->eventfd);
+        close(data->memfd);
+        SDL_free(data);
+        return -1;
+    }
+    data->header->magic = SDL_OFFSCREEN_MAGIC;
+    data->header->version = SDL_OFFSCREEN_VERSION;
+    data->header->num_frames = (Uint32) num_frames;
+
+    window->driverdata = data;
+    return 0;
+}
+
+static void
+OFFSCREEN_DestroyWindow(_THIS, SDL_Window * window)
+{
+    SDL_WindowData *data = (SDL_WindowData *) window->driverdata;
+
+    if (data) {
+        SDL_FreeSurface(data->surface);
+        munmap(data->header, data->size);
+        close(data->eventfd);
+        close(data->memfd);
+        SDL_free(data);
+        window->driverdata = NULL;
+    }
+}
+
+static SDL_bool
+OFFSCREEN_GetWindowWMInfo(_THIS, SDL_Window * window, struct SDL_SysWMinfo *info)
+{
+    SDL_WindowData *data = (SDL_WindowData *) window->driverdata;
+
+    if (info->version.major == SDL_MAJOR_VERSION &&
+        info->version.minor == SDL_MINOR_VERSION) {
+        info->subsystem = SDL_SYSWM_OFFSCREEN;
+        info->info.offscreen.memfd = data->memfd;
+        info->info.offscreen.eventfd = data->eventfd;
+        return SDL_TRUE;
+    } else {
+        SDL_SetError("Application not compiled with SDL %d.%d",
+                     SDL_MAJOR_VERSION, SDL_MINOR_VERSION);
+        return SDL_FALSE;
+    }
+}
+
+#endif /* SDL_VIDEO_DRIVER_OFFSCREEN */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -41,5 +41,15 @@ void RPI_PumpEvents(_THIS)
     
 }
 
+int RPI_GetEventWaitFDs(_THIS, int *fds, int maxfds, int *timeout)
+{
+    *timeout = -1;
+#ifdef SDL_INPUT_LINUXEV
+    return SDL_EVDEV_GetFDs(fds, maxfds);
+#else
+    return 0;
+#endif
+}
+
 #endif /* SDL_VIDEO_DRIVER_RPI */
 
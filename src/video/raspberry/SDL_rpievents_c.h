@@ -25,6 +25,7 @@
 #include "SDL_rpivideo.h"
 
 void RPI_PumpEvents(_THIS);
+int RPI_GetEventWaitFDs(_THIS, int *fds, int maxfds, int *timeout);
 void RPI_EventInit(_THIS);
 void RPI_EventQuit(_THIS);
 
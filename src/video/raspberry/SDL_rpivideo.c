@@ -143,6 +143,7 @@ RPI_Create()
     device->GL_DefaultProfileConfig = RPI_GLES_DefaultProfileConfig;
 
     device->PumpEvents = RPI_PumpEvents;
+    device->GetEventWaitFDs = RPI_GetEventWaitFDs;
 
     return device;
 }
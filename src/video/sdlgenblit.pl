@@ -58,6 +58,23 @@ my %format_type = (
     "BGRA8888" => "Uint32",
 );
 
+# The channel stored in each byte of the pixel, lowest byte first
+# (X is padding). The vectorized blitters use this to shuffle pixels.
+my %format_channels = (
+    "RGB888" => "BGRX",
+    "BGR888" => "RGBX",
+    "ARGB8888" => "BGRA",
+    "RGBA8888" => "ABGR",
+    "ABGR8888" => "RGBA",
+    "BGRA8888" => "ARGB",
+);
+
+# The vectorized variants of the blitters, and the CPU feature each needs
+my @simd_variants = (
+    [ "AVX2", "SDL_CPU_AVX2", "HAVE_AVX2_INTRINSICS" ],
+    [ "NEON", "SDL_CPU_NEON", "HAVE_NEON_INTRINSICS" ],
+);
+
 my %get_rgba_string_ignore_alpha = (
     "RGB888" => "_R = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _B = (Uint8)_pixel;",
     "BGR888" => "_B = (Uint8)(_pixel >> 16); _G = (Uint8)(_pixel >> 8); _R = (Uint8)_pixel;",
@@ -149,6 +166,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $simd = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -160,6 +178,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $simd ) {
+        print FILE "_$simd";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -436,10 +457,395 @@ sub output_copyinc
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
+#include "../cpuinfo/SDL_simd.h"
+
+__EOF__
+    output_simdkernels();
+}
+
+sub output_simdkernels
+{
+    print FILE <<'__EOF__';
+/* The vectorized blitters work on whole pixels at once, so they assume
+   that the first byte in memory is the lowest byte of the pixel.
+   SDL_ChooseBlitFunc() only picks the AVX2 ones if SDL_HasAVX2(). */
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+#undef HAVE_AVX2_INTRINSICS
+#undef HAVE_NEON_INTRINSICS
+#endif
+
+/* The vectorized blitters below give exactly the same results as the
+   scalar ones.  Each one shuffles the source pixels into the layout of
+   the destination, with the alpha (or padding) channel in the top byte,
+   and then does the arithmetic on all channels of all pixels at once:
+
+    shuffle     - for each byte of the destination pixel, the source byte
+                  that goes there, or 0x80 if the source has no alpha
+    src_alpha   - OR'ed into the source pixels, 0xFF000000 if the source
+                  has no alpha channel
+    dst_mask    - AND'ed into the result, 0x00FFFFFF if the destination
+                  has no alpha channel
+    dst_rshift, dst_bshift - the position of red and blue in the destination
+
+   Products are divided by 255 with (x + 1 + (x >> 8)) >> 8, which is
+   exact for the product of any two bytes.
+ */
+
+#if HAVE_AVX2_INTRINSICS
+SDL_FORCE_INLINE SDL_TARGETING_AVX2 __m256i
+SDL_Blit_MulDiv255_AVX2(__m256i a, __m256i b)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+    __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+    lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(lo, one), _mm256_srli_epi16(lo, 8)), 8);
+    hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(hi, one), _mm256_srli_epi16(hi, 8)), 8);
+    return _mm256_packus_epi16(lo, hi);
+}
+
+SDL_FORCE_INLINE SDL_TARGETING_AVX2 void
+SDL_Blit8888_AVX2(SDL_BlitInfo *info, const Uint32 shuffle, const Uint32 src_alpha,
+                  const Uint32 dst_mask, const int dst_rshift, const int dst_bshift,
+                  const int modulate, const int blend, const int scale)
+{
+    const int flags = info->flags;
+    const int blendop = (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD));
+    const __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i shuffle_mask = _mm256_setr_epi32((int)shuffle, (int)(shuffle + 0x04040404), (int)(shuffle + 0x08080808), (int)(shuffle + 0x0C0C0C0C),
+                                                   (int)shuffle, (int)(shuffle + 0x04040404), (int)(shuffle + 0x08080808), (int)(shuffle + 0x0C0C0C0C));
+    const __m256i alpha_to_rgba = _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+                                                   3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+    const __m256i alpha_mask = _mm256_set1_epi32((int)0xFF000000);
+    const __m256i all_ones = _mm256_set1_epi32(-1);
+    __m256i modulate_rgba = all_ones;
+    int incx = 0, incy = 0, posy = 0;
+
+    if (modulate) {
+        const Uint32 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+        const Uint32 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+        const Uint32 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+        const Uint32 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+        modulate_rgba = _mm256_set1_epi32((int)((modulateA << 24) | (modulateR << dst_rshift) |
+                                                (modulateG << 8) | (modulateB << dst_bshift)));
+    }
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        __m256i posx = _mm256_mullo_epi32(index, _mm256_set1_epi32(incx));
+        int n = info->dst_w;
+        if (scale) {
+            src = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        }
+        while (n > 0) {
+            const __m256i lanes = _mm256_cmpgt_epi32(_mm256_set1_epi32(n), index);
+            __m256i pixel, dstpixel;
+
+            if (scale) {
+                pixel = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *)src,
+                                                    _mm256_srli_epi32(posx, 16), lanes, 4);
+                posx = _mm256_add_epi32(posx, _mm256_set1_epi32(incx * 8));
+            } else {
+                pixel = (n >= 8) ? _mm256_loadu_si256((const __m256i *)src) : _mm256_maskload_epi32((const int *)src, lanes);
+                src += 8;
+            }
+            if (shuffle != 0x03020100) {
+                pixel = _mm256_shuffle_epi8(pixel, shuffle_mask);
+            }
+            if (src_alpha) {
+                pixel = _mm256_or_si256(pixel, _mm256_set1_epi32((int)src_alpha));
+            }
+            if (modulate) {
+                pixel = SDL_Blit_MulDiv255_AVX2(pixel, modulate_rgba);
+            }
+            if (blend) {
+                dstpixel = (n >= 8) ? _mm256_loadu_si256((const __m256i *)dst) : _mm256_maskload_epi32((const int *)dst, lanes);
+                if (blendop & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+                    pixel = SDL_Blit_MulDiv255_AVX2(pixel, _mm256_or_si256(_mm256_shuffle_epi8(pixel, alpha_to_rgba), alpha_mask));
+                }
+                switch (blendop) {
+                case SDL_COPY_BLEND:
+                    dstpixel = _mm256_add_epi8(pixel, SDL_Blit_MulDiv255_AVX2(_mm256_xor_si256(_mm256_shuffle_epi8(pixel, alpha_to_rgba), all_ones), dstpixel));
+                    break;
+                case SDL_COPY_ADD:
+                    dstpixel = _mm256_blendv_epi8(_mm256_adds_epu8(pixel, dstpixel), dstpixel, alpha_mask);
+                    break;
+                case SDL_COPY_MOD:
+                    dstpixel = _mm256_blendv_epi8(SDL_Blit_MulDiv255_AVX2(pixel, dstpixel), dstpixel, alpha_mask);
+                    break;
+                }
+                pixel = dstpixel;
+            }
+            if (dst_mask != 0xFFFFFFFF) {
+                pixel = _mm256_and_si256(pixel, _mm256_set1_epi32((int)dst_mask));
+            }
+            if (n >= 8) {
+                _mm256_storeu_si256((__m256i *)dst, pixel);
+            } else {
+                _mm256_maskstore_epi32((int *)dst, lanes, pixel);
+            }
+            dst += 8;
+            n -= 8;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+SDL_FORCE_INLINE uint8x16_t
+SDL_Blit_MulDiv255_NEON(uint8x16_t a, uint8x16_t b)
+{
+    const uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t lo = vmull_u8(vget_low_u8(a), vget_low_u8(b));
+    uint16x8_t hi = vmull_u8(vget_high_u8(a), vget_high_u8(b));
+    lo = vaddq_u16(vaddq_u16(lo, one), vshrq_n_u16(lo, 8));
+    hi = vaddq_u16(vaddq_u16(hi, one), vshrq_n_u16(hi, 8));
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+SDL_FORCE_INLINE void
+SDL_Blit8888_NEON(SDL_BlitInfo *info, const Uint32 shuffle, const Uint32 src_alpha,
+                  const Uint32 dst_mask, const int dst_rshift, const int dst_bshift,
+                  const int modulate, const int blend, const int scale)
+{
+    const int flags = info->flags;
+    const int blendop = (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD));
+    Uint32 modulate_rgba = 0xFFFFFFFF;
+    int incx = 0, incy = 0, posy = 0;
+    int i;
+
+    if (modulate) {
+        const Uint32 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+        const Uint32 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+        const Uint32 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+        const Uint32 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+        modulate_rgba = (modulateA << 24) | (modulateR << dst_rshift) |
+                        (modulateG << 8) | (modulateB << dst_bshift);
+    }
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int posx = 0;
+        int n = info->dst_w;
+        if (scale) {
+            src = (const Uint32 *)(info->src + ((posy >> 16) * info->src_pitch));
+        }
+        while (n > 0) {
+            /* Partial and scaled runs of pixels go through these */
+            Uint32 srcbuf[16], dstbuf[16];
+            const int count = SDL_min(n, 16);
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            uint8x16x4_t in, pixel, dstpixel;
+
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    srcbuf[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                s = srcbuf;
+            } else if (count < 16) {
+                SDL_memcpy(srcbuf, src, count * sizeof (Uint32));
+                s = srcbuf;
+            }
+            if (count < 16) {
+                if (blend) {
+                    SDL_memcpy(dstbuf, dst, count * sizeof (Uint32));
+                }
+                d = dstbuf;
+            }
+
+            /* Each of these holds one byte of 16 pixels */
+            in = vld4q_u8((const Uint8 *)s);
+            for (i = 0; i < 4; ++i) {
+                const Uint32 from = (shuffle >> (i * 8)) & 0xFF;
+                pixel.val[i] = (from & 0x80) ? vdupq_n_u8((Uint8)(src_alpha >> (i * 8))) : in.val[from & 3];
+            }
+            if (modulate) {
+                for (i = 0; i < 4; ++i) {
+                    pixel.val[i] = SDL_Blit_MulDiv255_NEON(pixel.val[i], vdupq_n_u8((Uint8)(modulate_rgba >> (i * 8))));
+                }
+            }
+            if (blend) {
+                dstpixel = vld4q_u8((const Uint8 *)d);
+                if (blendop & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+                    for (i = 0; i < 3; ++i) {
+                        pixel.val[i] = SDL_Blit_MulDiv255_NEON(pixel.val[i], pixel.val[3]);
+                    }
+                }
+                switch (blendop) {
+                case SDL_COPY_BLEND:
+                    for (i = 0; i < 4; ++i) {
+                        dstpixel.val[i] = vaddq_u8(pixel.val[i], SDL_Blit_MulDiv255_NEON(vmvnq_u8(pixel.val[3]), dstpixel.val[i]));
+                    }
+                    break;
+                case SDL_COPY_ADD:
+                    for (i = 0; i < 3; ++i) {
+                        dstpixel.val[i] = vqaddq_u8(pixel.val[i], dstpixel.val[i]);
+                    }
+                    break;
+                case SDL_COPY_MOD:
+                    for (i = 0; i < 3; ++i) {
+                        dstpixel.val[i] = SDL_Blit_MulDiv255_NEON(pixel.val[i], dstpixel.val[i]);
+                    }
+                    break;
+                }
+                pixel = dstpixel;
+            }
+            for (i = 0; i < 4; ++i) {
+                if (!((dst_mask >> (i * 8)) & 0xFF)) {
+                    pixel.val[i] = vdupq_n_u8(0);
+                }
+            }
+            vst4q_u8((Uint8 *)d, pixel);
+
+            if (count < 16) {
+                SDL_memcpy(dst, dstbuf, count * sizeof (Uint32));
+            }
+            if (!scale) {
+                src += 16;
+            }
+            dst += 16;
+            n -= 16;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
 
 __EOF__
 }
 
+sub get_simd_params
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+
+    my $src_channels = $format_channels{$src};
+    my $dst_channels = $format_channels{$dst};
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+
+    die "$dst: the vectorized blitters need alpha in the top byte\n" if (substr($dst_channels, 3, 1) !~ /[AX]/);
+
+    my $rshift = index($dst_channels, "R") * 8;
+    my $bshift = index($dst_channels, "B") * 8;
+
+    # Nice and easy...
+    if ( $src eq $dst && !$modulate && !$blend ) {
+        return ("0x03020100", "0x00000000", "0xFFFFFFFF", $rshift, $bshift);
+    }
+
+    my $shuffle = 0;
+    my $src_alpha = 0;
+    for (my $i = 0; $i < 4; ++$i) {
+        my $channel = substr($dst_channels, $i, 1);
+        $channel = "A" if ($channel eq "X");
+        my $from = index($src_channels, $channel);
+        if ($from < 0) {
+            $from = 0x80;
+            $src_alpha |= 0xFF << ($i * 8);
+        }
+        $shuffle |= $from << ($i * 8);
+    }
+    my $dst_mask = $dst_has_alpha ? 0xFFFFFFFF : 0x00FFFFFF;
+
+    return (sprintf("0x%08X", $shuffle), sprintf("0x%08X", $src_alpha), sprintf("0x%08X", $dst_mask),
+            $rshift, $bshift);
+}
+
+sub output_simdfunc
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $simd = shift;
+
+    my ($shuffle, $src_alpha, $dst_mask, $rshift, $bshift) = get_simd_params($src, $dst, $modulate, $blend);
+    my $targeting = ($simd eq "AVX2") ? " SDL_TARGETING_AVX2" : "";
+
+    output_copyfuncname("static void$targeting", $src, $dst, $modulate, $blend, $scale, 1, "\n", $simd);
+    print FILE <<__EOF__;
+{
+    SDL_Blit8888_${simd}(info, $shuffle, $src_alpha, $dst_mask, $rshift, $bshift, $modulate, $blend, $scale);
+}
+
+__EOF__
+}
+
+sub output_copyfuncentries
+{
+    my $src = shift;
+    my $dst = shift;
+    my $cpu = shift;
+    my $simd = shift;
+
+    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+        for (my $blend = 0; $blend <= 1; ++$blend) {
+            for (my $scale = 0; $scale <= 1; ++$scale) {
+                if ( $modulate || $blend || $scale ) {
+                    print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
+                    my $flags = "";
+                    my $flag = "";
+                    if ( $modulate ) {
+                        $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
+                        if ( $flags eq "" ) {
+                            $flags = $flag;
+                        } else {
+                            $flags = "$flags | $flag";
+                        }
+                    }
+                    if ( $blend ) {
+                        $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD";
+                        if ( $flags eq "" ) {
+                            $flags = $flag;
+                        } else {
+                            $flags = "$flags | $flag";
+                        }
+                    }
+                    if ( $scale ) {
+                        $flag = "SDL_COPY_NEAREST";
+                        if ( $flags eq "" ) {
+                            $flags = $flag;
+                        } else {
+                            $flags = "$flags | $flag";
+                        }
+                    }
+                    if ( $flags eq "" ) {
+                        $flags = "0";
+                    }
+                    print FILE "($flags), $cpu,";
+                    output_copyfuncname("", $src, $dst, $modulate, $blend, $scale, 0, " },\n", $simd);
+                }
+            }
+        }
+    }
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
@@ -449,46 +855,14 @@ __EOF__
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
             my $dst = $dst_formats[$j];
-            for (my $modulate = 0; $modulate <= 1; ++$modulate) {
-                for (my $blend = 0; $blend <= 1; ++$blend) {
-                    for (my $scale = 0; $scale <= 1; ++$scale) {
-                        if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
-                            my $flags = "";
-                            my $flag = "";
-                            if ( $modulate ) {
-                                $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $scale ) {
-                                $flag = "SDL_COPY_NEAREST";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $flags eq "" ) {
-                                $flags = "0";
-                            }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
-                        }
-                    }
-                }
+            # The first match wins, so the vectorized blitters go first
+            foreach my $variant (@simd_variants) {
+                my ($simd, $cpu, $guard) = @$variant;
+                print FILE "#if $guard\n";
+                output_copyfuncentries($src, $dst, $cpu, $simd);
+                print FILE "#endif\n";
             }
+            output_copyfuncentries($src, $dst, "SDL_CPU_ANY", "");
         }
     }
     print FILE <<__EOF__;
@@ -512,6 +886,21 @@ sub output_copyfunc_c
             }
         }
     }
+
+    foreach my $variant (@simd_variants) {
+        my ($simd, $cpu, $guard) = @$variant;
+        print FILE "#if $guard\n";
+        for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+            for (my $blend = 0; $blend <= 1; ++$blend) {
+                for (my $scale = 0; $scale <= 1; ++$scale) {
+                    if ( $modulate || $blend || $scale ) {
+                        output_simdfunc($src, $dst, $modulate, $blend, $scale, $simd);
+                    }
+                }
+            }
+        }
+        print FILE "#endif /* $guard */\n\n";
+    }
 }
 
 open_file("SDL_blit_auto.h");
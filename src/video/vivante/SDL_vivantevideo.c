@@ -110,6 +110,7 @@ VIVANTE_Create()
 #endif
 
     device->PumpEvents = VIVANTE_PumpEvents;
+    device->GetEventWaitFDs = VIVANTE_GetEventWaitFDs;
 
     return device;
 }
@@ -404,6 +405,16 @@ void VIVANTE_PumpEvents(_THIS)
 #endif
 }
 
+int VIVANTE_GetEventWaitFDs(_THIS, int *fds, int maxfds, int *timeout)
+{
+    *timeout = -1;
+#ifdef SDL_INPUT_LINUXEV
+    return SDL_EVDEV_GetFDs(fds, maxfds);
+#else
+    return 0;
+#endif
+}
+
 #endif /* SDL_VIDEO_DRIVER_VIVANTE */
 
 /* vi: set ts=4 sw=4 expandtab: */
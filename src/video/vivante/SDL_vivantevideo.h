@@ -85,6 +85,7 @@ SDL_bool VIVANTE_GetWindowWMInfo(_THIS, SDL_Window * window,
 
 /* Event functions */
 void VIVANTE_PumpEvents(_THIS);
+int VIVANTE_GetEventWaitFDs(_THIS, int *fds, int maxfds, int *timeout);
 
 #endif /* SDL_vivantevideo_h_ */
 
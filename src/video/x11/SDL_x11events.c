@@ -1459,6 +1459,61 @@ X11_PumpEvents(_THIS)
     X11_HandleFocusChanges(_this);
 }
 
+/* Don't sleep past (deadline), the next time X11_PumpEvents() has timed work to do. */
+static void
+X11_LimitEventWait(int *timeout, const Uint32 now, const Uint32 deadline)
+{
+    const int remaining = SDL_TICKS_PASSED(now, deadline) ? 0 : (int) (deadline - now);
+    if ((*timeout < 0) || (remaining < *timeout)) {
+        *timeout = remaining;
+    }
+}
+
+int
+X11_GetEventWaitFDs(_THIS, int *fds, int maxfds, int *timeout)
+{
+    SDL_VideoData *videodata = (SDL_VideoData *) _this->driverdata;
+    Display *display = videodata->display;
+    const Uint32 now = SDL_GetTicks();
+    int i;
+
+    if (maxfds < 1) {
+        return -1;
+    }
+
+    *timeout = -1;
+
+    /* Make sure the server has everything we asked for before we block,
+       and don't block at all if Xlib has already read events off the wire. */
+    X11_XFlush(display);
+    if (X11_XEventsQueued(display, QueuedAlready)) {
+        *timeout = 0;
+    }
+
+#ifdef SDL_USE_IME
+    /* The IME talks to us over D-Bus, which we don't wait on. */
+    if (SDL_GetEventState(SDL_TEXTINPUT) == SDL_ENABLE) {
+        X11_LimitEventWait(timeout, now, now + 10);
+    }
+#endif
+
+    if (_this->suspend_screensaver) {
+        X11_LimitEventWait(timeout, now, videodata->screensaver_activity + 30000);
+    }
+
+    if (videodata->windowlist) {
+        for (i = 0; i < videodata->numwindows; ++i) {
+            SDL_WindowData *data = videodata->windowlist[i];
+            if (data && data->pending_focus != PENDING_FOCUS_NONE) {
+                X11_LimitEventWait(timeout, now, data->pending_focus_time);
+            }
+        }
+    }
+
+    fds[0] = ConnectionNumber(display);
+    return 1;
+}
+
 
 void
 X11_SuspendScreenSaver(_THIS)
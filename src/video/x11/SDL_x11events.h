@@ -24,6 +24,7 @@
 #define SDL_x11events_h_
 
 extern void X11_PumpEvents(_THIS);
+extern int X11_GetEventWaitFDs(_THIS, int *fds, int maxfds, int *timeout);
 extern void X11_SuspendScreenSaver(_THIS);
 
 #endif /* SDL_x11events_h_ */
@@ -0,0 +1,168 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Load thousands of small files through an SDL_AsyncIOQueue and report
+   throughput and per-request latency, compared to loading them one by one.
+   Usage: testasyncio [--threads N] [--files N] [--size BYTES] */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static int
+CompareTimes(const void *a, const void *b)
+{
+    const double x = *(const double *) a;
+    const double y = *(const double *) b;
+    return (x < y) ? -1 : (x > y) ? 1 : 0;
+}
+
+static void
+MakeFileName(char *name, size_t maxlen, int i)
+{
+    SDL_snprintf(name, maxlen, "testasyncio_%d.dat", i);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int num_threads = 0;
+    int num_files = 2000;
+    int file_size = 4096;
+    char name[64];
+    Uint8 *data;
+    double *submitted, *latency;
+    double freq, elapsed;
+    Uint64 start;
+    SDL_AsyncIOQueue *queue;
+    SDL_AsyncIOOutcome outcome;
+    int i, failures = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i + 1 < argc; i += 2) {
+        if (SDL_strcmp(argv[i], "--threads") == 0) {
+            num_threads = SDL_atoi(argv[i + 1]);
+        } else if (SDL_strcmp(argv[i], "--files") == 0) {
+            num_files = SDL_atoi(argv[i + 1]);
+        } else if (SDL_strcmp(argv[i], "--size") == 0) {
+            file_size = SDL_atoi(argv[i + 1]);
+        } else {
+            break;
+        }
+    }
+    if (i < argc || num_files <= 0 || file_size <= 0) {
+        SDL_Log("USAGE: %s [--threads N] [--files N] [--size BYTES]\n", argv[0]);
+        return (1);
+    }
+
+    /* Load the SDL library */
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    data = (Uint8 *) SDL_malloc(file_size);
+    submitted = (double *) SDL_malloc(num_files * sizeof (double));
+    latency = (double *) SDL_malloc(num_files * sizeof (double));
+    if (!data || !submitted || !latency) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_Quit();
+        return (1);
+    }
+    SDL_memset(data, 'x', file_size);
+
+    SDL_Log("Writing %d files of %d bytes\n", num_files, file_size);
+    for (i = 0; i < num_files; i++) {
+        SDL_RWops *rw;
+        MakeFileName(name, sizeof (name), i);
+        rw = SDL_RWFromFile(name, "wb");
+        if (!rw || SDL_RWwrite(rw, data, file_size, 1) != 1) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't write %s: %s\n", name, SDL_GetError());
+            num_files = i;
+            failures++;
+        }
+        if (rw) {
+            SDL_RWclose(rw);
+        }
+    }
+
+    freq = (double) SDL_GetPerformanceFrequency();
+
+    /* Synchronous baseline */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_files; i++) {
+        void *file;
+        MakeFileName(name, sizeof (name), i);
+        file = SDL_LoadFile(name, NULL);
+        if (!file) {
+            failures++;
+        }
+        SDL_free(file);
+    }
+    elapsed = (SDL_GetPerformanceCounter() - start) / freq;
+    SDL_Log("SDL_LoadFile:      %.3f seconds, %.0f files/second\n", elapsed, num_files / elapsed);
+
+    queue = SDL_CreateAsyncIOQueue(num_threads);
+    if (!queue) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create queue: %s\n", SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+
+    /* Queue everything at once, then collect as the main loop would */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_files; i++) {
+        MakeFileName(name, sizeof (name), i);
+        submitted[i] = (SDL_GetPerformanceCounter() - start) / freq;
+        if (SDL_AsyncLoadFile(queue, name, (void *) (intptr_t) i) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't queue %s: %s\n", name, SDL_GetError());
+            failures++;
+            latency[i] = 0.0;
+        }
+    }
+    for (i = 0; i < num_files; i++) {
+        if (SDL_WaitAsyncIOResult(queue, &outcome, -1) != 1) {
+            break;
+        }
+        if (outcome.result != SDL_ASYNCIO_COMPLETE || outcome.bytes_transferred != (size_t) file_size) {
+            failures++;
+        }
+        latency[(intptr_t) outcome.userdata] = (SDL_GetPerformanceCounter() - start) / freq - submitted[(intptr_t) outcome.userdata];
+        SDL_free(outcome.buffer);
+    }
+    elapsed = (SDL_GetPerformanceCounter() - start) / freq;
+    SDL_DestroyAsyncIOQueue(queue);
+
+    SDL_qsort(latency, num_files, sizeof (double), CompareTimes);
+    SDL_Log("SDL_AsyncLoadFile: %.3f seconds, %.0f files/second\n", elapsed, num_files / elapsed);
+    SDL_Log("latency: median %.3f ms, 99th percentile %.3f ms, max %.3f ms\n",
+            latency[num_files / 2] * 1000.0, latency[(num_files * 99) / 100] * 1000.0,
+            latency[num_files - 1] * 1000.0);
+
+    for (i = 0; i < num_files; i++) {
+        MakeFileName(name, sizeof (name), i);
+        remove(name);
+    }
+
+    if (failures) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d requests failed\n", failures);
+    }
+
+    SDL_free(latency);
+    SDL_free(submitted);
+    SDL_free(data);
+    SDL_Quit();
+    return (failures ? 1 : 0);
+}
@@ -968,6 +968,392 @@ int audio_openCloseAudioDeviceConnected()
 }
 
 
+/* Memory function wrappers counting allocations made while they are installed */
+static SDL_malloc_func _audio_realMalloc;
+static SDL_calloc_func _audio_realCalloc;
+static SDL_realloc_func _audio_realRealloc;
+static SDL_free_func _audio_realFree;
+static int _audio_allocationCount;
+
+static void * SDLCALL _audio_countingMalloc(size_t size)
+{
+   _audio_allocationCount++;
+   return _audio_realMalloc(size);
+}
+
+static void * SDLCALL _audio_countingCalloc(size_t nmemb, size_t size)
+{
+   _audio_allocationCount++;
+   return _audio_realCalloc(nmemb, size);
+}
+
+static void * SDLCALL _audio_countingRealloc(void *ptr, size_t size)
+{
+   _audio_allocationCount++;
+   return _audio_realRealloc(ptr, size);
+}
+
+/**
+ * \brief Checks that streams with a caller-provided buffer don't allocate after creation.
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewAudioStreamWithBuffer
+ */
+int audio_fixedAudioStream()
+{
+   static Sint16 input[2 * 4410];
+   static Uint8 ring[64 * 1024];
+   static Uint8 output[64 * 1024];
+   SDL_AudioStream *stream;
+   int result;
+   int i, got, total, available;
+
+   for (i = 0; i < (int) SDL_arraysize(input); i++) {
+     input[i] = (Sint16) SDLTest_RandomSint16();
+   }
+
+   /* Passthrough keeps the data intact */
+   stream = SDL_NewAudioStreamWithBuffer(AUDIO_S16SYS, 2, 44100, AUDIO_S16SYS, 2, 44100, 4096, ring, 1000);
+   SDLTest_AssertPass("Call to SDL_NewAudioStreamWithBuffer(), passthrough");
+   SDLTest_AssertCheck(stream != NULL, "Validate stream is not NULL");
+   if (stream == NULL) {
+     return TEST_ABORTED;
+   }
+   total = 0;
+   for (i = 0; i < 10; i++) {
+     result = SDL_AudioStreamPut(stream, (Uint8 *) input + (i * 400), 400);
+     SDLTest_AssertCheck(result == 0, "Verify put %i result; expected: 0, got: %i", i, result);
+     got = SDL_AudioStreamGet(stream, output + total, 396);
+     SDLTest_AssertCheck(got == 396, "Verify get %i result; expected: 396, got: %i", i, got);
+     total += got;
+   }
+   total += SDL_AudioStreamGet(stream, output + total, 40);
+   SDLTest_AssertCheck(total == 4000, "Verify total bytes; expected: 4000, got: %i", total);
+   SDLTest_AssertCheck(SDL_memcmp(input, output, total) == 0, "Verify passthrough data is unchanged");
+   result = SDL_AudioStreamPut(stream, input, 1004);
+   SDLTest_AssertCheck(result == -1, "Verify put larger than the buffer fails; expected: -1, got: %i", result);
+   SDL_FreeAudioStream(stream);
+
+   /* Resampling with format and channel conversion */
+   stream = SDL_NewAudioStreamWithBuffer(AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 1, 48000, 1024, NULL, sizeof (ring));
+   SDLTest_AssertPass("Call to SDL_NewAudioStreamWithBuffer(), resampling");
+   SDLTest_AssertCheck(stream != NULL, "Validate stream is not NULL");
+   if (stream == NULL) {
+     return TEST_ABORTED;
+   }
+
+   SDL_GetMemoryFunctions(&_audio_realMalloc, &_audio_realCalloc, &_audio_realRealloc, &_audio_realFree);
+   SDL_SetMemoryFunctions(_audio_countingMalloc, _audio_countingCalloc, _audio_countingRealloc, _audio_realFree);
+   _audio_allocationCount = 0;
+
+   total = 0;
+   for (i = 0; i < 20; i++) {
+     /* odd chunk sizes, some larger than max_put_len, some smaller than the staging buffer */
+     const int len = ((i % 5) * 700 + 4) & ~3;
+     result = SDL_AudioStreamPut(stream, input, len);
+     if (result != 0) {
+       break;
+     }
+     total += SDL_AudioStreamGet(stream, output, sizeof (output));
+   }
+   if (result == 0) {
+     result = SDL_AudioStreamFlush(stream);
+   }
+   total += SDL_AudioStreamGet(stream, output, sizeof (output));
+   available = SDL_AudioStreamAvailable(stream);
+   SDL_AudioStreamPut(stream, input, 2000);
+   SDL_AudioStreamClear(stream);
+
+   /* check results only after restoring the allocator; logging may allocate */
+   SDL_SetMemoryFunctions(_audio_realMalloc, _audio_realCalloc, _audio_realRealloc, _audio_realFree);
+   SDLTest_AssertCheck(_audio_allocationCount == 0, "Verify no allocations after creation; expected: 0, got: %i", _audio_allocationCount);
+   SDLTest_AssertCheck(result == 0, "Verify puts and flush succeeded; expected: 0, got: %i", result);
+   SDLTest_AssertCheck(total > 0, "Verify converted output; expected: >0, got: %i", total);
+   SDLTest_AssertCheck(available == 0, "Verify stream is drained; expected: 0, got: %i", available);
+
+   SDL_FreeAudioStream(stream);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * \brief Mixes bound audio streams into a device through the disk audio driver.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BindAudioStream
+ * \sa https://wiki.libsdl.org/SDL_UnbindAudioStream
+ */
+int audio_bindAudioStreams()
+{
+   static float input[2][2 * 4096];
+   const Sint16 expected = (Sint16) (((0.5f * 0.5f) + -0.1f) * 32767.0f);
+   SDL_AudioSpec desired;
+   SDL_AudioDeviceID id;
+   SDL_AudioStream *streams[2];
+   SDL_AudioStream *wrong;
+   SDL_RWops *rw;
+   Sint16 sample;
+   int result;
+   int i, count, waited;
+
+   SDL_AudioQuit();
+   result = SDL_AudioInit("disk");
+   SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+   if (result != 0) {
+     SDLTest_Log("Disk audio driver not available: %s", SDL_GetError());
+     _audioSetUp(NULL);
+     return TEST_SKIPPED;
+   }
+
+   SDL_zero(desired);
+   desired.freq = 22050;
+   desired.format = AUDIO_S16SYS;
+   desired.channels = 2;
+   desired.samples = 1024;
+   id = SDL_OpenAudioDevice(NULL, 0, &desired, NULL, 0);
+   SDLTest_AssertCheck(id > 0, "Validate device ID; expected: >0, got: %i", id);
+   if (id == 0) {
+     SDL_AudioQuit();
+     _audioSetUp(NULL);
+     return TEST_ABORTED;
+   }
+
+   for (i = 0; i < (int) SDL_arraysize(input[0]); i++) {
+     input[0][i] = 0.5f;
+     input[1][i] = -0.1f;
+   }
+   for (i = 0; i < 2; i++) {
+     streams[i] = SDL_NewAudioStream(AUDIO_F32SYS, 2, 22050, AUDIO_F32SYS, 2, 22050);
+     SDLTest_AssertCheck(streams[i] != NULL, "Validate stream %i is not NULL", i);
+     if (streams[i] == NULL) {
+       return TEST_ABORTED;
+     }
+     result = SDL_AudioStreamPut(streams[i], input[i], sizeof (input[i]));
+     SDLTest_AssertCheck(result == 0, "Verify put into stream %i; expected: 0, got: %i", i, result);
+   }
+
+   /* Negative cases */
+   wrong = SDL_NewAudioStream(AUDIO_F32SYS, 2, 22050, AUDIO_S16SYS, 2, 22050);
+   result = SDL_BindAudioStream(id, wrong, 1.0f);
+   SDLTest_AssertCheck(result == -1, "Verify binding a non-float stream fails; expected: -1, got: %i", result);
+   result = SDL_UnbindAudioStream(id, wrong);
+   SDLTest_AssertCheck(result == -1, "Verify unbinding an unbound stream fails; expected: -1, got: %i", result);
+   SDL_FreeAudioStream(wrong);
+
+   result = SDL_BindAudioStream(id, streams[0], 1.0f);
+   SDLTest_AssertCheck(result == 0, "Verify binding stream 0; expected: 0, got: %i", result);
+   result = SDL_BindAudioStream(id, streams[0], 0.5f);
+   SDLTest_AssertCheck(result == 0, "Verify changing gain of stream 0; expected: 0, got: %i", result);
+   result = SDL_BindAudioStream(id, streams[1], 1.0f);
+   SDLTest_AssertCheck(result == 0, "Verify binding stream 1; expected: 0, got: %i", result);
+
+   /* Play until both streams are drained */
+   SDL_PauseAudioDevice(id, 0);
+   for (waited = 0; waited < 5000; waited += 10) {
+     SDL_LockAudioDevice(id);
+     count = SDL_AudioStreamAvailable(streams[0]) + SDL_AudioStreamAvailable(streams[1]);
+     SDL_UnlockAudioDevice(id);
+     if (count == 0) {
+       break;
+     }
+     SDL_Delay(10);
+   }
+   SDLTest_AssertCheck(count == 0, "Verify bound streams were drained; got %i bytes left", count);
+
+   for (i = 0; i < 2; i++) {
+     result = SDL_UnbindAudioStream(id, streams[i]);
+     SDLTest_AssertCheck(result == 0, "Verify unbinding stream %i; expected: 0, got: %i", i, result);
+     SDL_FreeAudioStream(streams[i]);
+   }
+   SDL_CloseAudioDevice(id);
+
+   /* Every frame pulled from the streams is the weighted sum, everything else is silence */
+   count = 0;
+   rw = SDL_RWFromFile("sdlaudio.raw", "rb");
+   SDLTest_AssertCheck(rw != NULL, "Verify disk audio output file can be opened");
+   if (rw != NULL) {
+     while (SDL_RWread(rw, &sample, sizeof (sample), 1) == 1) {
+       if (sample == expected) {
+         count++;
+       } else if (sample != 0) {
+         break;
+       }
+     }
+     SDL_RWclose(rw);
+   }
+   SDLTest_AssertCheck(count == (int) SDL_arraysize(input[0]), "Verify mixed samples; expected: %i, got: %i", (int) SDL_arraysize(input[0]), count);
+
+   SDL_AudioQuit();
+   _audioSetUp(NULL);
+
+   return TEST_COMPLETED;
+}
+
+
+/* Writes a WAVE file with a LIST chunk before the format chunk, returning its size */
+static Uint32
+_audio_writeWAV(Uint8 *file, Uint16 encoding, Uint16 channels, Uint32 freq, Uint16 bits, Uint16 blockalign,
+                const Uint8 *extra, Uint16 extralen, const Uint8 *data, Uint32 datalen)
+{
+   Uint8 *p = file;
+#define PUT16(v) { *p++ = (Uint8) ((v) & 0xFF); *p++ = (Uint8) (((v) >> 8) & 0xFF); }
+#define PUT32(v) { PUT16((v) & 0xFFFF); PUT16(((v) >> 16) & 0xFFFF); }
+   SDL_memcpy(p, "RIFF", 4); p += 4;
+   PUT32(4 + (8 + 4) + (8 + 16 + extralen) + (8 + datalen));
+   SDL_memcpy(p, "WAVE", 4); p += 4;
+   SDL_memcpy(p, "LIST", 4); p += 4;
+   PUT32(4);
+   SDL_memcpy(p, "INFO", 4); p += 4;
+   SDL_memcpy(p, "fmt ", 4); p += 4;
+   PUT32(16 + extralen);
+   PUT16(encoding);
+   PUT16(channels);
+   PUT32(freq);
+   PUT32(freq * blockalign);
+   PUT16(blockalign);
+   PUT16(bits);
+   SDL_memcpy(p, extra, extralen); p += extralen;
+   SDL_memcpy(p, "data", 4); p += 4;
+   PUT32(datalen);
+   SDL_memcpy(p, data, datalen); p += datalen;
+#undef PUT32
+#undef PUT16
+   return (Uint32) (p - file);
+}
+
+/**
+ * \brief Decodes PCM, 24-bit and ADPCM WAVE data incrementally and checks it against SDL_LoadWAV_RW.
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewWAVDecoder
+ * \sa https://wiki.libsdl.org/SDL_WAVDecoderRead
+ * \sa https://wiki.libsdl.org/SDL_WAVDecoderSeek
+ */
+int audio_wavDecoder()
+{
+   static Uint8 data[32 * 1024];
+   static Uint8 file[sizeof (data) + 256];
+   static Uint8 output[128 * 1024];
+   const Uint8 ima_extra[] = { 2, 0, 0xF9, 0x01 };     /* 505 samples per block */
+   const Uint8 ms_extra[] = {
+      32, 0, 0xF4, 0x01, 7, 0,                          /* 500 samples per block, 7 coefficients */
+      0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+      0xC0, 0x00, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xCC, 0x01, 0x30, 0xFF,
+      0x88, 0x01, 0x18, 0xFF
+   };
+   const struct {
+      const char *name;
+      Uint16 encoding, channels, bits, blockalign;
+      const Uint8 *extra;
+      Uint16 extralen;
+   } cases[] = {
+      { "16-bit PCM", 0x0001, 2, 16, 4, NULL, 0 },
+      { "24-bit PCM", 0x0001, 1, 24, 3, NULL, 0 },
+      { "IMA ADPCM", 0x0011, 2, 4, 512, ima_extra, sizeof (ima_extra) },
+      { "MS ADPCM", 0x0002, 1, 4, 256, ms_extra, sizeof (ms_extra) }
+   };
+   int c;
+
+   for (c = 0; c < (int) SDL_arraysize(cases); c++) {
+      SDL_AudioSpec spec, loadspec;
+      SDL_WAVDecoder *decoder;
+      SDL_AudioStream *stream;
+      Uint8 *loaded = NULL;
+      Uint32 loadedlen = 0, filelen, framesize, frames, frame, datalen, i;
+      int result, total;
+
+      /* Random data with valid block headers for the ADPCM formats, and a
+         few bytes of a truncated block at the end */
+      datalen = (sizeof (data) - 10) - ((sizeof (data) - 10) % cases[c].blockalign) + 10;
+      for (i = 0; i < datalen; i++) {
+         data[i] = (Uint8) SDLTest_RandomIntegerInRange(0, 255);
+      }
+      for (i = 0; i + cases[c].blockalign <= datalen; i += cases[c].blockalign) {
+         if (cases[c].encoding == 0x0011) {
+            data[i + 2] = data[i + 6] = (Uint8) SDLTest_RandomIntegerInRange(0, 88);
+            data[i + 3] = data[i + 7] = 0;
+         } else if (cases[c].encoding == 0x0002) {
+            data[i] = (Uint8) SDLTest_RandomIntegerInRange(0, 6);
+         }
+      }
+      filelen = _audio_writeWAV(file, cases[c].encoding, cases[c].channels, 22050, cases[c].bits,
+                                cases[c].blockalign, cases[c].extra, cases[c].extralen, data, datalen);
+
+      if (SDL_LoadWAV_RW(SDL_RWFromConstMem(file, filelen), 1, &loadspec, &loaded, &loadedlen) == NULL) {
+         SDLTest_AssertCheck(SDL_FALSE, "%s: SDL_LoadWAV_RW failed: %s", cases[c].name, SDL_GetError());
+         continue;
+      }
+
+      decoder = SDL_NewWAVDecoder(SDL_RWFromConstMem(file, filelen), 1, &spec);
+      SDLTest_AssertPass("Call to SDL_NewWAVDecoder() for %s", cases[c].name);
+      SDLTest_AssertCheck(decoder != NULL, "Validate decoder is not NULL: %s", decoder ? "" : SDL_GetError());
+      if (decoder == NULL) {
+         SDL_FreeWAV(loaded);
+         return TEST_ABORTED;
+      }
+      SDLTest_AssertCheck(spec.format == loadspec.format && spec.channels == loadspec.channels && spec.freq == loadspec.freq,
+                          "Verify spec matches SDL_LoadWAV_RW; expected: 0x%.4x/%i/%i, got: 0x%.4x/%i/%i",
+                          loadspec.format, loadspec.channels, loadspec.freq, spec.format, spec.channels, spec.freq);
+      framesize = (SDL_AUDIO_BITSIZE(spec.format) / 8) * spec.channels;
+      frames = SDL_WAVDecoderFrames(decoder);
+      SDLTest_AssertCheck(frames * framesize == loadedlen, "Verify frame count; expected: %i, got: %i", (int) (loadedlen / framesize), (int) frames);
+
+      /* Read everything in pieces that don't line up with frames or blocks */
+      total = 0;
+      do {
+         result = SDL_WAVDecoderRead(decoder, output + total, SDL_min(1001, (int) sizeof (output) - total));
+         if (result > 0) {
+            total += result;
+         }
+      } while (result > 0);
+      SDLTest_AssertCheck(result == 0, "Verify reading ends with 0; got: %i", result);
+      SDLTest_AssertCheck(total == (int) loadedlen, "Verify decoded length; expected: %i, got: %i", (int) loadedlen, total);
+      SDLTest_AssertCheck(SDL_memcmp(output, loaded, SDL_min(total, (int) loadedlen)) == 0, "Verify decoded data matches SDL_LoadWAV_RW");
+      SDLTest_AssertCheck(SDL_WAVDecoderTell(decoder) == frames, "Verify position at the end; expected: %i, got: %i", (int) frames, (int) SDL_WAVDecoderTell(decoder));
+
+      /* Seek into the middle of a block and back */
+      frame = frames / 3 + 1;
+      result = SDL_WAVDecoderSeek(decoder, frame);
+      SDLTest_AssertCheck(result == 0, "Verify seek to frame %i; expected: 0, got: %i", (int) frame, result);
+      result = SDL_WAVDecoderRead(decoder, output, 100 * framesize);
+      SDLTest_AssertCheck(result == (int) (100 * framesize) && SDL_memcmp(output, loaded + frame * framesize, 100 * framesize) == 0,
+                          "Verify data after seeking to frame %i", (int) frame);
+      result = SDL_WAVDecoderSeek(decoder, frame + 1);
+      SDLTest_AssertCheck(result == 0, "Verify seek to frame %i; expected: 0, got: %i", (int) frame + 1, result);
+      result = SDL_WAVDecoderRead(decoder, output, 10 * framesize);
+      SDLTest_AssertCheck(result == (int) (10 * framesize) && SDL_memcmp(output, loaded + (frame + 1) * framesize, 10 * framesize) == 0,
+                          "Verify data after seeking to frame %i", (int) frame + 1);
+      result = SDL_WAVDecoderSeek(decoder, frames + 1);
+      SDLTest_AssertCheck(result == -1, "Verify seeking past the end fails; expected: -1, got: %i", result);
+
+      /* Feed an audio stream from the start */
+      stream = SDL_NewAudioStream(spec.format, spec.channels, spec.freq, spec.format, spec.channels, spec.freq);
+      SDLTest_AssertCheck(stream != NULL, "Validate stream is not NULL");
+      if (stream != NULL) {
+         SDL_WAVDecoderSeek(decoder, 0);
+         total = 0;
+         while ((result = SDL_WAVDecoderPutStream(decoder, stream, 20000)) > 0) {
+            total += result;
+         }
+         SDLTest_AssertCheck(total == (int) loadedlen, "Verify bytes put into the stream; expected: %i, got: %i", (int) loadedlen, total);
+         SDL_AudioStreamFlush(stream);
+         total = SDL_AudioStreamGet(stream, output, sizeof (output));
+         SDLTest_AssertCheck(total == (int) loadedlen && SDL_memcmp(output, loaded, loadedlen) == 0, "Verify stream output matches SDL_LoadWAV_RW");
+         SDL_FreeAudioStream(stream);
+      }
+
+      SDL_FreeWAVDecoder(decoder);
+      SDL_FreeWAV(loaded);
+   }
+
+   /* Negative cases */
+   SDLTest_AssertCheck(SDL_NewWAVDecoder(NULL, 0, NULL) == NULL, "Verify NULL source fails");
+   SDLTest_AssertCheck(SDL_NewWAVDecoder(SDL_RWFromConstMem(data, 64), 1, NULL) == NULL, "Verify NULL spec fails");
+   {
+      SDL_AudioSpec spec;
+      SDLTest_AssertCheck(SDL_NewWAVDecoder(SDL_RWFromConstMem(data, 64), 1, &spec) == NULL, "Verify non-WAVE data fails");
+   }
+
+   return TEST_COMPLETED;
+}
+
 
 /* ================= Test Case References ================== */
 
@@ -1022,11 +1408,21 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_fixedAudioStream, "audio_fixedAudioStream", "Checks that streams with a caller-provided buffer don't allocate after creation.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest17 =
+        { (SDLTest_TestCaseFp)audio_bindAudioStreams, "audio_bindAudioStreams", "Mixes bound audio streams into a device through the disk audio driver.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest18 =
+        { (SDLTest_TestCaseFp)audio_wavDecoder, "audio_wavDecoder", "Decodes WAVE data incrementally and checks it against SDL_LoadWAV_RW.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, &audioTest17,
+    &audioTest18, NULL
 };
 
 /* Audio test suite (global) */
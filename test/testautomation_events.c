@@ -175,6 +175,134 @@ events_addDelEventWatchWithUserdata(void *arg)
 }
 
 
+/* Thread that pushes a user event after a short delay */
+int SDLCALL _events_delayedPushThread(void *data)
+{
+   SDL_Event event;
+
+   SDL_Delay(50);
+   SDL_zero(event);
+   event.type = SDL_USEREVENT;
+   event.user.code = *(int *)data;
+   SDL_PushEvent(&event);
+
+   return 0;
+}
+
+/**
+ * @brief Blocks in SDL_WaitEventTimeout until another thread pushes an event, and times out without one
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_WaitEventTimeout
+ */
+int
+events_waitEventTimeoutWakeup(void *arg)
+{
+   SDL_Event event;
+   SDL_Thread *thread;
+   int code = SDLTest_RandomSint32();
+   Uint32 start, elapsed;
+   int result;
+
+   /* Nothing queued: should time out */
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+   start = SDL_GetTicks();
+   result = SDL_WaitEventTimeout(&event, 100);
+   elapsed = SDL_GetTicks() - start;
+   SDLTest_AssertPass("Call to SDL_WaitEventTimeout() with nothing queued");
+   if (result == 0) {
+      SDLTest_AssertCheck(elapsed >= 100, "Check that we waited for the timeout, expected: >= 100 ms, got: %d ms", (int) elapsed);
+   }
+
+   /* Another thread pushes an event while we're blocked */
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+   thread = SDL_CreateThread(_events_delayedPushThread, "PushThread", &code);
+   SDLTest_AssertCheck(thread != NULL, "Check that SDL_CreateThread() succeeded");
+   if (thread == NULL) {
+      return TEST_ABORTED;
+   }
+
+   start = SDL_GetTicks();
+   do {
+      result = SDL_WaitEventTimeout(&event, 5000);
+   } while (result == 1 && event.type != SDL_USEREVENT);
+   elapsed = SDL_GetTicks() - start;
+   SDL_WaitThread(thread, NULL);
+
+   SDLTest_AssertPass("Call to SDL_WaitEventTimeout() with an event pushed from another thread");
+   SDLTest_AssertCheck(result == 1, "Check result from SDL_WaitEventTimeout, expected: 1, got: %d", result);
+   SDLTest_AssertCheck(event.user.code == code, "Check event code, expected: %d, got: %d", code, event.user.code);
+   SDLTest_AssertCheck(elapsed < 5000, "Check that we were woken before the timeout, got: %d ms", (int) elapsed);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks the nanosecond timestamps SDL_PeepEventsTimestamps() returns.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PeepEventsTimestamps
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_HINT_EVENT_TIMESTAMPS_NS
+ */
+int
+events_timestampNS(void *arg)
+{
+   SDL_Event event;
+   Uint64 before, after, timestamp;
+   char *originalValue;
+   Sint32 code = SDLTest_RandomSint32();
+   int result;
+
+   originalValue = (char *)SDL_GetHint(SDL_HINT_EVENT_TIMESTAMPS_NS);
+   if (originalValue != NULL) {
+      originalValue = SDL_strdup(originalValue);
+   }
+
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+   /* With the hint set, events keep the time they were queued */
+   SDL_SetHint(SDL_HINT_EVENT_TIMESTAMPS_NS, "1");
+   SDL_zero(event);
+   event.type = SDL_USEREVENT;
+   event.user.code = code;
+   before = SDL_GetTicksNS();
+   SDL_PushEvent(&event);
+   after = SDL_GetTicksNS();
+   SDLTest_AssertPass("Call to SDL_PushEvent() with nanosecond timestamps");
+
+   SDL_zero(event);
+   timestamp = 0;
+   result = SDL_PeepEventsTimestamps(&event, &timestamp, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+   SDLTest_AssertPass("Call to SDL_PeepEventsTimestamps()");
+   SDLTest_AssertCheck(result == 1, "Check result from SDL_PeepEventsTimestamps, expected: 1, got: %d", result);
+   SDLTest_AssertCheck(event.user.code == code, "Check event code, expected: %d, got: %d", code, event.user.code);
+   SDLTest_AssertCheck(timestamp >= before && timestamp <= after,
+                       "Check timestamp, expected: %" SDL_PRIu64 " - %" SDL_PRIu64 ", got: %" SDL_PRIu64, before, after, timestamp);
+
+   /* Without it, they only have milliseconds */
+   SDL_SetHint(SDL_HINT_EVENT_TIMESTAMPS_NS, "0");
+   SDL_zero(event);
+   event.type = SDL_USEREVENT;
+   event.user.code = code;
+   SDL_PushEvent(&event);
+   SDLTest_AssertPass("Call to SDL_PushEvent() without nanosecond timestamps");
+
+   SDL_zero(event);
+   timestamp = 0;
+   result = SDL_PeepEventsTimestamps(&event, &timestamp, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+   SDLTest_AssertCheck(result == 1, "Check result from SDL_PeepEventsTimestamps, expected: 1, got: %d", result);
+   SDLTest_AssertCheck(timestamp == (Uint64) event.user.timestamp * 1000000,
+                       "Check millisecond timestamp, expected: %" SDL_PRIu64 ", got: %" SDL_PRIu64, (Uint64) event.user.timestamp * 1000000, timestamp);
+
+   /* Setting a hint to NULL leaves it as it is, so clear all hints if it wasn't set before */
+   if (originalValue != NULL) {
+      SDL_SetHint(SDL_HINT_EVENT_TIMESTAMPS_NS, originalValue);
+      SDL_free(originalValue);
+   } else {
+      SDL_ClearHints();
+   }
+
+   return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -187,9 +315,15 @@ static const SDLTest_TestCaseReference eventsTest2 =
 static const SDLTest_TestCaseReference eventsTest3 =
         { (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference eventsTest4 =
+        { (SDLTest_TestCaseFp)events_waitEventTimeoutWakeup, "events_waitEventTimeoutWakeup", "Wakes SDL_WaitEventTimeout from another thread, and times it out", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference eventsTest5 =
+        { (SDLTest_TestCaseFp)events_timestampNS, "events_timestampNS", "Checks nanosecond event timestamps", TEST_ENABLED };
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] =  {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, &eventsTest5, NULL
 };
 
 /* Events test suite (global) */
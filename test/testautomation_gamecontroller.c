@@ -0,0 +1,350 @@
+/**
+ * Game controller test suite
+ */
+
+#include <stdio.h>
+
+#include "SDL.h"
+#include "SDL_test.h"
+
+#if defined(__LINUX__) && defined(SDL_JOYSTICK_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/uinput.h>
+#define HAVE_UINPUT_JOYSTICK 1
+#endif
+
+/* Fixture */
+
+static char *_originalBackgroundEvents = NULL;
+
+void
+_gamecontrollerSetUp(void *arg)
+{
+    const char *value;
+    int ret;
+
+    /* There's no window to have focus, so take joystick events regardless */
+    value = SDL_GetHint(SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS);
+    _originalBackgroundEvents = value ? SDL_strdup(value) : NULL;
+    SDL_SetHint(SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS, "1");
+
+    ret = SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER);
+    SDLTest_AssertPass("Call to SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER)");
+    SDLTest_AssertCheck(ret == 0, "Check result from SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER)");
+    if (ret != 0) {
+        SDLTest_LogError("%s", SDL_GetError());
+    }
+}
+
+void
+_gamecontrollerTearDown(void *arg)
+{
+    SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
+    SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER)");
+
+    /* Setting a hint to NULL leaves it as it is, so clear all hints if it wasn't set before */
+    if (_originalBackgroundEvents != NULL) {
+        SDL_SetHint(SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS, _originalBackgroundEvents);
+        SDL_free(_originalBackgroundEvents);
+        _originalBackgroundEvents = NULL;
+    } else {
+        SDL_ClearHints();
+    }
+}
+
+#if HAVE_UINPUT_JOYSTICK
+
+/* Helper functions */
+
+#define UINPUT_JOYSTICK_NAME "SDL Test Controller"
+
+/* The controller state, as seen through its events */
+typedef struct
+{
+    Sint16 axes[SDL_CONTROLLER_AXIS_MAX];
+    Uint8 buttons[SDL_CONTROLLER_BUTTON_MAX];
+} _ControllerEventState;
+
+/**
+ * @brief Creates a uinput joystick with 4 axes, 3 buttons and a hat, or returns -1
+ */
+int
+_createUinputJoystick(void)
+{
+    static const int axes[] = { ABS_X, ABS_Y, ABS_Z, ABS_RX };
+    struct uinput_user_dev dev;
+    int fd, i;
+
+    fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK);
+    if (fd < 0) {
+        return -1;
+    }
+
+    ioctl(fd, UI_SET_EVBIT, EV_KEY);
+    ioctl(fd, UI_SET_EVBIT, EV_ABS);
+    ioctl(fd, UI_SET_EVBIT, EV_SYN);
+    ioctl(fd, UI_SET_KEYBIT, BTN_A);
+    ioctl(fd, UI_SET_KEYBIT, BTN_B);
+    ioctl(fd, UI_SET_KEYBIT, BTN_C);
+
+    SDL_zero(dev);
+    SDL_strlcpy(dev.name, UINPUT_JOYSTICK_NAME, sizeof(dev.name));
+    dev.id.bustype = BUS_VIRTUAL;
+    dev.id.vendor = 0x1234;
+    dev.id.product = 0x5679;
+    dev.id.version = 1;
+    for (i = 0; i < SDL_arraysize(axes); i++) {
+        ioctl(fd, UI_SET_ABSBIT, axes[i]);
+        dev.absmin[axes[i]] = SDL_JOYSTICK_AXIS_MIN;
+        dev.absmax[axes[i]] = SDL_JOYSTICK_AXIS_MAX;
+    }
+    ioctl(fd, UI_SET_ABSBIT, ABS_HAT0X);
+    ioctl(fd, UI_SET_ABSBIT, ABS_HAT0Y);
+    dev.absmin[ABS_HAT0X] = dev.absmin[ABS_HAT0Y] = -1;
+    dev.absmax[ABS_HAT0X] = dev.absmax[ABS_HAT0Y] = 1;
+
+    if (write(fd, &dev, sizeof(dev)) != sizeof(dev) || ioctl(fd, UI_DEV_CREATE) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Sends one input event from the uinput joystick
+ */
+void
+_emitUinputEvent(int fd, int type, int code, int value)
+{
+    struct input_event event;
+
+    SDL_zero(event);
+    event.type = type;
+    event.code = code;
+    event.value = value;
+    if (write(fd, &event, sizeof(event)) != sizeof(event)) {
+        SDLTest_LogError("Couldn't write to the uinput joystick");
+    }
+}
+
+/**
+ * @brief Waits for the uinput joystick to show up, returns its device index or -1
+ */
+int
+_findUinputJoystick(void)
+{
+    Uint32 start = SDL_GetTicks();
+    int i;
+
+    do {
+        SDL_JoystickUpdate();
+        for (i = 0; i < SDL_NumJoysticks(); i++) {
+            const char *name = SDL_JoystickNameForIndex(i);
+            if (name && SDL_strcmp(name, UINPUT_JOYSTICK_NAME) == 0) {
+                return i;
+            }
+        }
+        SDL_Delay(10);
+    } while (!SDL_TICKS_PASSED(SDL_GetTicks(), start + 2000));
+
+    return -1;
+}
+
+/**
+ * @brief Updates the joysticks and applies the controller events this sends to the state
+ */
+void
+_updateControllerEventState(_ControllerEventState *state)
+{
+    SDL_Event event;
+
+    /* Give the kernel a moment to pass on what was written */
+    SDL_Delay(10);
+    SDL_GameControllerUpdate();
+    while (SDL_PollEvent(&event)) {
+        switch (event.type) {
+        case SDL_CONTROLLERAXISMOTION:
+            state->axes[event.caxis.axis] = event.caxis.value;
+            break;
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+            state->buttons[event.cbutton.button] = event.cbutton.state;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Checks a controller axis value sent in events
+ */
+void
+_checkControllerAxis(_ControllerEventState *state, SDL_GameControllerAxis axis, Sint16 expected)
+{
+    SDLTest_AssertCheck(state->axes[axis] == expected,
+        "Check %s axis, expected: %d, got: %d",
+        SDL_GameControllerGetStringForAxis(axis), (int)expected, (int)state->axes[axis]);
+}
+
+/**
+ * @brief Checks a controller button state sent in events and returned by SDL_GameControllerGetButton
+ */
+void
+_checkControllerButton(SDL_GameController *gamecontroller, _ControllerEventState *state, SDL_GameControllerButton button, Uint8 expected)
+{
+    Uint8 value = SDL_GameControllerGetButton(gamecontroller, button);
+
+    SDLTest_AssertCheck(state->buttons[button] == expected,
+        "Check %s button events, expected: %d, got: %d",
+        SDL_GameControllerGetStringForButton(button), (int)expected, (int)state->buttons[button]);
+    SDLTest_AssertCheck(value == expected,
+        "Check SDL_GameControllerGetButton(%s), expected: %d, got: %d",
+        SDL_GameControllerGetStringForButton(button), (int)expected, (int)value);
+}
+
+#endif /* HAVE_UINPUT_JOYSTICK */
+
+/* Test case functions */
+
+/**
+ * @brief Feed a uinput joystick through a mapping with half-axis, inverted, axis to button, button to axis and hat bindings
+ *
+ * Needs write access to /dev/uinput, and is skipped without it.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_GameControllerAddMapping
+ */
+int
+gamecontroller_testBindings(void *arg)
+{
+#if HAVE_UINPUT_JOYSTICK
+    SDL_GameController *gamecontroller;
+    _ControllerEventState state;
+    char guid[33];
+    char mapping[512];
+    int device_index;
+    int uinput;
+    int result;
+
+    uinput = _createUinputJoystick();
+    if (uinput < 0) {
+        SDLTest_Log("Couldn't create a uinput joystick, skipping the test");
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertPass("Created a uinput joystick");
+
+    /* Without udev, or permission to open the device node, it never shows up */
+    device_index = _findUinputJoystick();
+    if (device_index < 0) {
+        SDLTest_Log("The uinput joystick didn't show up, skipping the test");
+        ioctl(uinput, UI_DEV_DESTROY);
+        close(uinput);
+        return TEST_SKIPPED;
+    }
+
+    SDL_JoystickGetGUIDString(SDL_JoystickGetDeviceGUID(device_index), guid, sizeof(guid));
+    SDL_snprintf(mapping, sizeof(mapping),
+        "%s,SDL Test Controller,"
+        "leftx:a0,lefty:a1~,lefttrigger:-a2,righttrigger:+a2,a:+a3,b:-a3,"
+        "+rightx:b0,x:b1,start:b2,"
+        "dpup:h0.1,dpright:h0.2,dpdown:h0.4,dpleft:h0.8,", guid);
+    result = SDL_GameControllerAddMapping(mapping);
+    SDLTest_AssertPass("Call to SDL_GameControllerAddMapping()");
+    SDLTest_AssertCheck(result >= 0, "Check result from SDL_GameControllerAddMapping(), expected: >=0, got: %d", result);
+    SDLTest_AssertCheck(SDL_IsGameController(device_index) == SDL_TRUE, "Check SDL_IsGameController()");
+
+    gamecontroller = SDL_GameControllerOpen(device_index);
+    SDLTest_AssertPass("Call to SDL_GameControllerOpen()");
+    SDLTest_AssertCheck(gamecontroller != NULL, "Check result from SDL_GameControllerOpen() is not NULL");
+    if (gamecontroller == NULL) {
+        SDLTest_LogError("%s", SDL_GetError());
+        ioctl(uinput, UI_DEV_DESTROY);
+        close(uinput);
+        return TEST_ABORTED;
+    }
+
+    SDL_zero(state);
+    _updateControllerEventState(&state);
+
+    /* Full axis, inverted full axis, negative half of an axis, positive half
+       of an axis to a button, button to half an axis, and two hat directions */
+    _emitUinputEvent(uinput, EV_ABS, ABS_X, 10000);
+    _emitUinputEvent(uinput, EV_ABS, ABS_Y, SDL_JOYSTICK_AXIS_MIN);
+    _emitUinputEvent(uinput, EV_ABS, ABS_Z, -16384);
+    _emitUinputEvent(uinput, EV_ABS, ABS_RX, 30000);
+    _emitUinputEvent(uinput, EV_KEY, BTN_A, 1);
+    _emitUinputEvent(uinput, EV_KEY, BTN_B, 1);
+    _emitUinputEvent(uinput, EV_ABS, ABS_HAT0X, 1);
+    _emitUinputEvent(uinput, EV_ABS, ABS_HAT0Y, -1);
+    _emitUinputEvent(uinput, EV_SYN, SYN_REPORT, 0);
+    _updateControllerEventState(&state);
+    SDLTest_AssertPass("Set the uinput joystick inputs");
+
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_LEFTX, 10000);
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_LEFTY, SDL_JOYSTICK_AXIS_MAX);
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_TRIGGERLEFT, 16383);
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_TRIGGERRIGHT, 0);
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_RIGHTX, SDL_JOYSTICK_AXIS_MAX);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_A, SDL_PRESSED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_B, SDL_RELEASED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_X, SDL_PRESSED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_START, SDL_RELEASED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_DPAD_UP, SDL_PRESSED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_DPAD_RIGHT, SDL_PRESSED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_DPAD_DOWN, SDL_RELEASED);
+
+    /* Move the axes and the hat onto their other bindings, and swap buttons */
+    _emitUinputEvent(uinput, EV_ABS, ABS_Z, SDL_JOYSTICK_AXIS_MAX);
+    _emitUinputEvent(uinput, EV_ABS, ABS_RX, -30000);
+    _emitUinputEvent(uinput, EV_KEY, BTN_A, 0);
+    _emitUinputEvent(uinput, EV_KEY, BTN_C, 1);
+    _emitUinputEvent(uinput, EV_ABS, ABS_HAT0X, 0);
+    _emitUinputEvent(uinput, EV_ABS, ABS_HAT0Y, 1);
+    _emitUinputEvent(uinput, EV_SYN, SYN_REPORT, 0);
+    _updateControllerEventState(&state);
+    SDLTest_AssertPass("Change the uinput joystick inputs");
+
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_LEFTX, 10000);
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_LEFTY, SDL_JOYSTICK_AXIS_MAX);
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_TRIGGERLEFT, 0);
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_TRIGGERRIGHT, SDL_JOYSTICK_AXIS_MAX);
+    _checkControllerAxis(&state, SDL_CONTROLLER_AXIS_RIGHTX, 0);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_A, SDL_RELEASED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_B, SDL_PRESSED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_X, SDL_PRESSED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_START, SDL_PRESSED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_DPAD_UP, SDL_RELEASED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_DPAD_RIGHT, SDL_RELEASED);
+    _checkControllerButton(gamecontroller, &state, SDL_CONTROLLER_BUTTON_DPAD_DOWN, SDL_PRESSED);
+
+    SDL_GameControllerClose(gamecontroller);
+    SDLTest_AssertPass("Call to SDL_GameControllerClose()");
+
+    ioctl(uinput, UI_DEV_DESTROY);
+    close(uinput);
+
+    return TEST_COMPLETED;
+#else
+    SDLTest_Log("This test needs the Linux joystick driver, skipping it");
+    return TEST_SKIPPED;
+#endif
+}
+
+/* ================= Test References ================== */
+
+/* Game controller test cases */
+static const SDLTest_TestCaseReference gamecontrollerTest1 =
+        { (SDLTest_TestCaseFp)gamecontroller_testBindings, "gamecontroller_testBindings", "Feed a uinput joystick through a mapping and check the controller state", TEST_ENABLED };
+
+/* Sequence of Game controller test cases */
+static const SDLTest_TestCaseReference *gamecontrollerTests[] =  {
+    &gamecontrollerTest1, NULL
+};
+
+/* Game controller test suite (global) */
+SDLTest_TestSuiteReference gamecontrollerTestSuite = {
+    "GameController",
+    _gamecontrollerSetUp,
+    gamecontrollerTests,
+    _gamecontrollerTearDown
+};
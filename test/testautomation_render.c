@@ -766,6 +766,370 @@ render_testBlitBlend (void *arg)
 }
 
 
+/**
+ * @brief Draws a scene mixing every kind of draw call and state change. Helper function.
+ */
+static void
+_drawBatchingScene(SDL_Renderer *r, SDL_Texture *tface, SDL_Surface *face)
+{
+   static const SDL_BlendMode modes[] = { SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD };
+   SDL_Surface *update;
+   SDL_Rect rect;
+   SDL_Point points[16];
+   int i;
+
+   SDL_SetRenderDrawColor(r, 13, 73, 200, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(r);
+
+   /* Runs of fill rects with the same and with changing state */
+   for (i = 0; i < 16; i++) {
+      rect.x = (i * 7) % TESTRENDER_SCREEN_W;
+      rect.y = (i * 5) % TESTRENDER_SCREEN_H;
+      rect.w = 10 + i;
+      rect.h = 8;
+      SDL_SetRenderDrawBlendMode(r, modes[i / 4]);
+      SDL_SetRenderDrawColor(r, 20 * i, 255 - 10 * i, 128, 100 + 8 * i);
+      SDL_RenderFillRect(r, &rect);
+   }
+
+   /* Points and lines */
+   for (i = 0; i < SDL_arraysize(points); i++) {
+      points[i].x = (i * 11) % TESTRENDER_SCREEN_W;
+      points[i].y = (i * 17) % TESTRENDER_SCREEN_H;
+   }
+   SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND);
+   SDL_SetRenderDrawColor(r, 255, 255, 0, 128);
+   SDL_RenderDrawPoints(r, points, SDL_arraysize(points));
+   SDL_RenderDrawLines(r, points, SDL_arraysize(points));
+
+   /* More single points than one merged command takes */
+   SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+   SDL_SetRenderDrawColor(r, 255, 0, 128, SDL_ALPHA_OPAQUE);
+   for (i = 0; i < 10000; i++) {
+      SDL_RenderDrawPoint(r, (i * 7) % TESTRENDER_SCREEN_W, (i * 13) % TESTRENDER_SCREEN_H);
+   }
+
+   /* Copies of the same texture that can be merged, then with changing modulation */
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < 8; i++) {
+      rect.x = i * 9;
+      rect.y = i * 4;
+      rect.w = face->w / 2;
+      rect.h = face->h / 2;
+      SDL_RenderCopy(r, tface, NULL, &rect);
+   }
+   for (i = 0; i < 8; i++) {
+      rect.x = 40 - i * 5;
+      rect.y = i * 6;
+      rect.w = face->w;
+      rect.h = face->h;
+      SDL_SetTextureColorMod(tface, 255 - i * 30, 100 + i * 20, 50 + i * 25);
+      SDL_SetTextureAlphaMod(tface, 255 - i * 20);
+      SDL_SetTextureBlendMode(tface, modes[i % 4]);
+      SDL_RenderCopy(r, tface, NULL, &rect);
+   }
+
+   /* Viewport and clipping changes in the middle of the scene */
+   rect.x = 10;
+   rect.y = 10;
+   rect.w = 50;
+   rect.h = 40;
+   SDL_RenderSetViewport(r, &rect);
+   rect.x = 5;
+   rect.y = 5;
+   rect.w = 30;
+   rect.h = 20;
+   SDL_RenderSetClipRect(r, &rect);
+   SDL_SetTextureColorMod(tface, 255, 255, 255);
+   SDL_SetTextureAlphaMod(tface, 200);
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+   SDL_RenderCopyEx(r, tface, NULL, NULL, 30.0, NULL, SDL_FLIP_HORIZONTAL);
+   SDL_SetRenderDrawColor(r, 0, 255, 0, 255);
+   SDL_RenderDrawLine(r, 0, 0, 49, 39);
+   SDL_RenderSetClipRect(r, NULL);
+   SDL_RenderSetViewport(r, NULL);
+
+   /* Updating a texture that is still queued must not affect earlier copies */
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_NONE);
+   rect.x = 0;
+   rect.y = 40;
+   rect.w = 20;
+   rect.h = 20;
+   SDL_RenderCopy(r, tface, NULL, &rect);
+   update = SDL_ConvertSurfaceFormat(face, SDL_PIXELFORMAT_ARGB8888, 0);
+   if (update != NULL) {
+      SDL_Rect half = { 0, 0, 0, 0 };
+      half.w = update->w;
+      half.h = update->h / 2;
+      SDL_FillRect(update, &half, SDL_MapRGB(update->format, 255, 0, 255));
+      SDL_UpdateTexture(tface, NULL, update->pixels, update->pitch);
+      SDL_FreeSurface(update);
+   }
+   rect.x = 20;
+   SDL_RenderCopy(r, tface, NULL, &rect);
+}
+
+/**
+ * @brief Returns a copy of a hint's value, or NULL if it isn't set. Helper function.
+ */
+static char *
+_saveHint(const char *name)
+{
+   const char *value = SDL_GetHint(name);
+   return value ? SDL_strdup(value) : NULL;
+}
+
+/**
+ * @brief Puts back hints saved with _saveHint() and frees the copies. Helper function.
+ *
+ * Setting a hint to NULL leaves it as it is, so if any of them wasn't set, all hints are cleared first.
+ */
+static void
+_restoreHints(const char **names, char **values, int count)
+{
+   int i;
+
+   for (i = 0; i < count; i++) {
+      if (values[i] == NULL) {
+         SDL_ClearHints();
+         break;
+      }
+   }
+   for (i = 0; i < count; i++) {
+      if (values[i] != NULL) {
+         SDL_SetHint(names[i], values[i]);
+         SDL_free(values[i]);
+      }
+   }
+}
+
+/**
+ * @brief Tests that batched rendering is pixel for pixel identical to immediate rendering.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_BATCHING
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFlush
+ */
+int
+render_testBatching (void *arg)
+{
+   const char *batching[] = { "0", "1" };
+   const char *hint = SDL_HINT_RENDER_BATCHING;
+   char *originalValue = _saveHint(hint);
+   SDL_Surface *targets[2] = { NULL, NULL };
+   SDL_Renderer *renderers[2] = { NULL, NULL };
+   SDL_Surface *face;
+   SDL_Texture *tface;
+   int i, ret;
+
+   for (i = 0; i < 2; i++) {
+      targets[i] = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                        RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+      SDLTest_AssertCheck(targets[i] != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+      if (targets[i] == NULL) {
+         return TEST_ABORTED;
+      }
+
+      SDL_SetHint(SDL_HINT_RENDER_BATCHING, batching[i]);
+      renderers[i] = SDL_CreateSoftwareRenderer(targets[i]);
+      SDLTest_AssertPass("Call to SDL_CreateSoftwareRenderer() with batching %s", batching[i]);
+      SDLTest_AssertCheck(renderers[i] != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+      if (renderers[i] == NULL) {
+         return TEST_ABORTED;
+      }
+
+      face = SDLTest_ImageFace();
+      SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+      if (face == NULL) {
+         return TEST_ABORTED;
+      }
+      tface = SDL_CreateTextureFromSurface(renderers[i], face);
+      SDLTest_AssertCheck(tface != NULL, "Verify SDL_CreateTextureFromSurface() result");
+      if (tface == NULL) {
+         return TEST_ABORTED;
+      }
+
+      _drawBatchingScene(renderers[i], tface, face);
+      SDLTest_AssertPass("Drew test scene");
+
+      ret = SDL_RenderFlush(renderers[i]);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFlush, expected: 0, got: %i", ret);
+
+      SDL_DestroyTexture(tface);
+      SDL_FreeSurface(face);
+   }
+   _restoreHints(&hint, &originalValue, 1);
+
+   ret = SDLTest_CompareSurfaces(targets[1], targets[0], 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+   for (i = 0; i < 2; i++) {
+      SDL_DestroyRenderer(renderers[i]);
+      SDL_FreeSurface(targets[i]);
+   }
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that the software renderer draws pixel for pixel the same on several threads.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_SOFTWARE_THREADS
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderFlush
+ */
+int
+render_testSoftwareThreads (void *arg)
+{
+   const char *threads[] = { "0", "4" };
+   const char *hints[] = { SDL_HINT_RENDER_BATCHING, SDL_HINT_RENDER_SOFTWARE_THREADS };
+   char *originalValues[2];
+   SDL_Surface *targets[2] = { NULL, NULL };
+   SDL_Renderer *renderers[2] = { NULL, NULL };
+   SDL_Surface *face;
+   SDL_Texture *tface;
+   int i, ret;
+
+   for (i = 0; i < 2; i++) {
+      originalValues[i] = _saveHint(hints[i]);
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+   for (i = 0; i < 2; i++) {
+      targets[i] = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                        RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+      SDLTest_AssertCheck(targets[i] != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+      if (targets[i] == NULL) {
+         return TEST_ABORTED;
+      }
+
+      SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads[i]);
+      renderers[i] = SDL_CreateSoftwareRenderer(targets[i]);
+      SDLTest_AssertPass("Call to SDL_CreateSoftwareRenderer() with %s threads", threads[i]);
+      SDLTest_AssertCheck(renderers[i] != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+      if (renderers[i] == NULL) {
+         return TEST_ABORTED;
+      }
+
+      face = SDLTest_ImageFace();
+      SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+      if (face == NULL) {
+         return TEST_ABORTED;
+      }
+      tface = SDL_CreateTextureFromSurface(renderers[i], face);
+      SDLTest_AssertCheck(tface != NULL, "Verify SDL_CreateTextureFromSurface() result");
+      if (tface == NULL) {
+         return TEST_ABORTED;
+      }
+
+      _drawBatchingScene(renderers[i], tface, face);
+      SDLTest_AssertPass("Drew test scene");
+
+      ret = SDL_RenderFlush(renderers[i]);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFlush, expected: 0, got: %i", ret);
+
+      SDL_DestroyTexture(tface);
+      SDL_FreeSurface(face);
+   }
+   _restoreHints(hints, originalValues, 2);
+
+   ret = SDLTest_CompareSurfaces(targets[1], targets[0], 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+   for (i = 0; i < 2; i++) {
+      SDL_DestroyRenderer(renderers[i]);
+      SDL_FreeSurface(targets[i]);
+   }
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that filtered scaled copies blend like a filtered stretch followed by a blit.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_SCALE_QUALITY
+ * http://wiki.libsdl.org/moin.cgi/SDL_SoftStretchLinear
+ */
+int
+render_testLinearScaleBlend (void *arg)
+{
+   const SDL_Rect rects[] = { { 7, 5, 61, 43 }, { 50, 30, 19, 13 } };
+   const char *hint = SDL_HINT_RENDER_SCALE_QUALITY;
+   char *originalValue = _saveHint(hint);
+   SDL_Surface *target, *expected, *face, *src, *tmp;
+   SDL_Renderer *renderer;
+   SDL_Texture *tface;
+   int i, ret;
+
+   target = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                 RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   expected = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                   RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(target != NULL && expected != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (target == NULL || expected == NULL) {
+      return TEST_ABORTED;
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+   renderer = SDL_CreateSoftwareRenderer(target);
+   SDLTest_AssertCheck(renderer != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+   face = SDLTest_ImageFace();
+   src = face ? SDL_ConvertSurfaceFormat(face, SDL_PIXELFORMAT_ARGB8888, 0) : NULL;
+   SDLTest_AssertCheck(src != NULL, "Verify SDLTest_ImageFace() result");
+   if (renderer == NULL || src == NULL) {
+      return TEST_ABORTED;
+   }
+   tface = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, src->w, src->h);
+   SDLTest_AssertCheck(tface != NULL, "Verify SDL_CreateTexture() result");
+   if (tface == NULL) {
+      return TEST_ABORTED;
+   }
+   SDL_UpdateTexture(tface, NULL, src->pixels, src->pitch);
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+   SDL_SetTextureColorMod(tface, 200, 150, 100);
+   SDL_SetTextureAlphaMod(tface, 180);
+
+   SDL_SetRenderDrawColor(renderer, 13, 73, 200, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(renderer);
+   SDL_FillRect(expected, NULL, SDL_MapRGBA(expected->format, 13, 73, 200, SDL_ALPHA_OPAQUE));
+
+   /* One magnified and one minified copy */
+   for (i = 0; i < SDL_arraysize(rects); i++) {
+      SDL_Rect rect = rects[i];
+
+      ret = SDL_RenderCopy(renderer, tface, NULL, &rect);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+
+      tmp = SDL_CreateRGBSurfaceWithFormat(0, rect.w, rect.h, 32, SDL_PIXELFORMAT_ARGB8888);
+      SDLTest_AssertCheck(tmp != NULL, "Verify result from SDL_CreateRGBSurfaceWithFormat is not NULL");
+      if (tmp == NULL) {
+         return TEST_ABORTED;
+      }
+      ret = SDL_SoftStretchLinear(src, NULL, tmp, NULL);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SoftStretchLinear, expected: 0, got: %i", ret);
+      SDL_SetSurfaceBlendMode(tmp, SDL_BLENDMODE_BLEND);
+      SDL_SetSurfaceColorMod(tmp, 200, 150, 100);
+      SDL_SetSurfaceAlphaMod(tmp, 180);
+      SDL_BlitSurface(tmp, NULL, expected, &rect);
+      SDL_FreeSurface(tmp);
+   }
+   SDL_RenderFlush(renderer);
+   _restoreHints(&hint, &originalValue, 1);
+
+   ret = SDLTest_CompareSurfaces(target, expected, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+   SDL_DestroyTexture(tface);
+   SDL_DestroyRenderer(renderer);
+   SDL_FreeSurface(src);
+   SDL_FreeSurface(face);
+   SDL_FreeSurface(expected);
+   SDL_FreeSurface(target);
+
+   return TEST_COMPLETED;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1085,9 +1449,18 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testBatching, "render_testBatching", "Tests that batched rendering matches immediate rendering", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest9 =
+        { (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests that threaded software rendering matches single-threaded rendering", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest10 =
+        { (SDLTest_TestCaseFp)render_testLinearScaleBlend, "render_testLinearScaleBlend", "Tests that filtered scaled copies blend like a stretch followed by a blit", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, NULL
 };
 
 /* Render test suite (global) */
@@ -699,6 +699,157 @@ rwops_testFileWriteReadEndian(void)
    return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests reading from a memory-mapped file.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWFromFileMapped
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWGetMappedData
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWAdviseMapped
+ */
+int
+rwops_testFileMapped(void)
+{
+   SDL_RWops *rw;
+   const char *mapped;
+   char *loaded;
+   size_t size;
+   int result;
+
+   /* Read test. */
+   rw = SDL_RWFromFileMapped(RWopsAlphabetFilename);
+   SDLTest_AssertPass("Call to SDL_RWFromFileMapped() succeeded");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFileMapped does not return NULL");
+
+   /* Bail out if NULL; mapping isn't available everywhere */
+   if (rw == NULL) return TEST_SKIPPED;
+
+   SDLTest_AssertCheck(
+      rw->type == SDL_RWOPS_MAPPED,
+      "Verify RWops type is SDL_RWOPS_MAPPED; expected: %d, got: %d", SDL_RWOPS_MAPPED, rw->type);
+
+   /* The mapping holds the whole file */
+   size = 0;
+   mapped = (const char *) SDL_RWGetMappedData(rw, &size);
+   SDLTest_AssertPass("Call to SDL_RWGetMappedData() succeeded");
+   SDLTest_AssertCheck(size == SDL_strlen(RWopsAlphabetString), "Verify mapped size, expected %i, got %i", (int) SDL_strlen(RWopsAlphabetString), (int) size);
+   SDLTest_AssertCheck(mapped != NULL && SDL_memcmp(mapped, RWopsAlphabetString, size) == 0, "Verify mapped data matches the file contents");
+
+   result = SDL_RWAdviseMapped(rw, 3, 0, SDL_RWMAP_ADVICE_SEQUENTIAL);
+   SDLTest_AssertPass("Call to SDL_RWAdviseMapped() succeeded");
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+   /* Load the remainder after a seek */
+   SDL_RWseek(rw, 10, RW_SEEK_SET);
+   loaded = (char *) SDL_LoadFile_RW(rw, &size, 1);
+   SDLTest_AssertPass("Call to SDL_LoadFile_RW() succeeded");
+   SDLTest_AssertCheck(loaded != NULL, "Verify result from SDL_LoadFile_RW is not NULL");
+   if (loaded != NULL) {
+      SDLTest_AssertCheck(size == SDL_strlen(RWopsAlphabetString) - 10, "Verify loaded size, expected %i, got %i", (int) SDL_strlen(RWopsAlphabetString) - 10, (int) size);
+      SDLTest_AssertCheck(SDL_strcmp(loaded, RWopsAlphabetString + 10) == 0, "Verify loaded data, expected '%s', got '%s'", RWopsAlphabetString + 10, loaded);
+      SDL_free(loaded);
+   }
+
+   /* Generic tests on read-only data */
+   rw = SDL_RWFromFileMapped(RWopsReadTestFilename);
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFileMapped does not return NULL");
+   if (rw == NULL) return TEST_ABORTED;
+   _testGenericRWopsValidations(rw, 0);
+   result = SDL_RWclose(rw);
+   SDLTest_AssertPass("Call to SDL_RWclose() succeeded");
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+   /* Other streams have no mapping */
+   rw = SDL_RWFromConstMem(RWopsAlphabetString, (int) SDL_strlen(RWopsAlphabetString));
+   SDLTest_AssertCheck(SDL_RWGetMappedData(rw, NULL) == NULL, "Verify SDL_RWGetMappedData on a memory stream returns NULL");
+   SDL_RWclose(rw);
+
+   /* Missing file */
+   rw = SDL_RWFromFileMapped("rwops_nonexistent");
+   SDLTest_AssertCheck(rw == NULL, "Verify SDL_RWFromFileMapped on a missing file returns NULL");
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests queued reads, writes and file loads.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateAsyncIOQueue
+ * http://wiki.libsdl.org/moin.cgi/SDL_AsyncRead
+ * http://wiki.libsdl.org/moin.cgi/SDL_WaitAsyncIOResult
+ */
+int
+rwops_testAsyncIO(void)
+{
+   SDL_AsyncIOQueue *queue;
+   SDL_AsyncIOOutcome outcome;
+   SDL_RWops *rw;
+   char buf[4][8];
+   int seen[6];
+   int i, result;
+
+   queue = SDL_CreateAsyncIOQueue(2);
+   SDLTest_AssertPass("Call to SDL_CreateAsyncIOQueue() succeeded");
+   SDLTest_AssertCheck(queue != NULL, "Verify result from SDL_CreateAsyncIOQueue is not NULL");
+   if (queue == NULL) return TEST_ABORTED;
+
+   rw = SDL_RWFromFile(RWopsAlphabetFilename, "rb");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFile does not return NULL");
+   if (rw == NULL) {
+      SDL_DestroyAsyncIOQueue(queue);
+      return TEST_ABORTED;
+   }
+
+   /* Four reads on one stream, one at the current position, and a file load */
+   SDL_zero(buf);
+   SDL_zero(seen);
+   for (i = 0; i < 3; i++) {
+      result = SDL_AsyncRead(queue, rw, buf[i], i * 5, 5, (void *) (intptr_t) i);
+      SDLTest_AssertCheck(result == 0, "Verify result from SDL_AsyncRead, expected 0, got %i", result);
+   }
+   result = SDL_AsyncRead(queue, rw, buf[3], -1, 5, (void *) (intptr_t) 3);
+   SDLTest_AssertCheck(result == 0, "Verify result from SDL_AsyncRead, expected 0, got %i", result);
+   result = SDL_AsyncLoadFile(queue, RWopsReadTestFilename, (void *) (intptr_t) 4);
+   SDLTest_AssertCheck(result == 0, "Verify result from SDL_AsyncLoadFile, expected 0, got %i", result);
+   result = SDL_AsyncLoadFile(queue, "rwops_nonexistent", (void *) (intptr_t) 5);
+   SDLTest_AssertCheck(result == 0, "Verify result from SDL_AsyncLoadFile, expected 0, got %i", result);
+
+   for (i = 0; i < 6; i++) {
+      result = SDL_WaitAsyncIOResult(queue, &outcome, 5000);
+      SDLTest_AssertCheck(result == 1, "Verify result from SDL_WaitAsyncIOResult, expected 1, got %i", result);
+      if (result != 1) break;
+      seen[(intptr_t) outcome.userdata]++;
+
+      if ((intptr_t) outcome.userdata == 4) {
+         SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_COMPLETE, "Verify loading the file succeeded");
+         SDLTest_AssertCheck(outcome.bytes_transferred == SDL_strlen(RWopsHelloWorldTestString), "Verify loaded size, got %i", (int) outcome.bytes_transferred);
+         SDLTest_AssertCheck(outcome.buffer && SDL_strcmp((const char *) outcome.buffer, RWopsHelloWorldTestString) == 0, "Verify loaded data matches the file");
+         SDL_free(outcome.buffer);
+      } else if ((intptr_t) outcome.userdata == 5) {
+         SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_FAILURE, "Verify loading a missing file failed");
+      } else {
+         SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_COMPLETE && outcome.bytes_transferred == 5, "Verify read %i transferred 5 bytes, got %i", (int) (intptr_t) outcome.userdata, (int) outcome.bytes_transferred);
+      }
+   }
+
+   /* Reads on a stream run in order, so the last one follows the third */
+   for (i = 0; i < 4; i++) {
+      SDLTest_AssertCheck(SDL_strncmp(buf[i], RWopsAlphabetString + i * 5, 5) == 0, "Verify read %i, expected '%.5s', got '%s'", i, RWopsAlphabetString + i * 5, buf[i]);
+   }
+   for (i = 0; i < 6; i++) {
+      SDLTest_AssertCheck(seen[i] == 1, "Verify request %i completed once, got %i", i, seen[i]);
+   }
+
+   result = SDL_GetAsyncIOResult(queue, &outcome);
+   SDLTest_AssertCheck(result == 0, "Verify result from SDL_GetAsyncIOResult on an empty queue, expected 0, got %i", result);
+
+   SDL_DestroyAsyncIOQueue(queue);
+   SDLTest_AssertPass("Call to SDL_DestroyAsyncIOQueue() succeeded");
+   SDL_RWclose(rw);
+
+   return TEST_COMPLETED;
+}
 
 /* ================= Test References ================== */
 
@@ -733,10 +884,16 @@ static const SDLTest_TestCaseReference rwopsTest9 =
 static const SDLTest_TestCaseReference rwopsTest10 =
         { (SDLTest_TestCaseFp)rwops_testCompareRWFromMemWithRWFromFile, "rwops_testCompareRWFromMemWithRWFromFile", "Compare RWFromMem and RWFromFile RWops for read and seek", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference rwopsTest11 =
+        { (SDLTest_TestCaseFp)rwops_testFileMapped, "rwops_testFileMapped", "Tests reading from a memory-mapped file", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference rwopsTest12 =
+        { (SDLTest_TestCaseFp)rwops_testAsyncIO, "rwops_testAsyncIO", "Tests queued asynchronous reads and file loads", TEST_ENABLED };
+
 /* Sequence of RWops test cases */
 static const SDLTest_TestCaseReference *rwopsTests[] =  {
     &rwopsTest1, &rwopsTest2, &rwopsTest3, &rwopsTest4, &rwopsTest5, &rwopsTest6,
-    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, NULL
+    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, &rwopsTest11, &rwopsTest12, NULL
 };
 
 /* RWops test suite (global) */
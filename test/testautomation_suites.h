@@ -12,6 +12,7 @@
 extern SDLTest_TestSuiteReference audioTestSuite;
 extern SDLTest_TestSuiteReference clipboardTestSuite;
 extern SDLTest_TestSuiteReference eventsTestSuite;
+extern SDLTest_TestSuiteReference gamecontrollerTestSuite;
 extern SDLTest_TestSuiteReference keyboardTestSuite;
 extern SDLTest_TestSuiteReference mainTestSuite;
 extern SDLTest_TestSuiteReference mouseTestSuite;
@@ -25,6 +26,7 @@ extern SDLTest_TestSuiteReference stdlibTestSuite;
 extern SDLTest_TestSuiteReference surfaceTestSuite;
 extern SDLTest_TestSuiteReference syswmTestSuite;
 extern SDLTest_TestSuiteReference timerTestSuite;
+extern SDLTest_TestSuiteReference traceTestSuite;
 extern SDLTest_TestSuiteReference videoTestSuite;
 extern SDLTest_TestSuiteReference hintsTestSuite;
 
@@ -33,6 +35,7 @@ SDLTest_TestSuiteReference *testSuites[] =  {
     &audioTestSuite,
     &clipboardTestSuite,
     &eventsTestSuite,
+    &gamecontrollerTestSuite,
     &keyboardTestSuite,
     &mainTestSuite,
     &mouseTestSuite,
@@ -46,6 +49,7 @@ SDLTest_TestSuiteReference *testSuites[] =  {
     &surfaceTestSuite,
     &syswmTestSuite,
     &timerTestSuite,
+    &traceTestSuite,
     &videoTestSuite,
     &hintsTestSuite,
     NULL
@@ -588,6 +588,422 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/**
+ * @brief Tests filtered stretching with SDL_SoftStretchLinear.
+ */
+int
+surface_testSoftStretchLinear(void *arg)
+{
+   int ret;
+   int x, y, i;
+   int errors;
+   Uint32 *pixels;
+   Uint32 expected;
+   Uint8 *p, *q;
+   SDL_Surface *src, *dst;
+
+   src = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+   if (src == NULL) {
+      return TEST_ABORTED;
+   }
+   pixels = (Uint32 *) src->pixels;
+   for (y = 0; y < src->h; ++y) {
+      for (x = 0; x < src->w; ++x) {
+         pixels[y * (src->pitch / 4) + x] = (Uint32) SDLTest_RandomUint32();
+      }
+   }
+
+   /* Same size: the filter must reproduce the source exactly */
+   dst = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+   if (dst == NULL) {
+      SDL_FreeSurface(src);
+      return TEST_ABORTED;
+   }
+   ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+   SDLTest_AssertPass("Call to SDL_SoftStretchLinear() with equal sizes");
+   SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %i", ret);
+   ret = SDLTest_CompareSurfaces(dst, src, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+   SDL_FreeSurface(dst);
+
+   /* Half size: every pixel is the rounded average of a 2x2 block */
+   dst = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+   if (dst == NULL) {
+      SDL_FreeSurface(src);
+      return TEST_ABORTED;
+   }
+   ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+   SDLTest_AssertPass("Call to SDL_SoftStretchLinear() with half size");
+   SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %i", ret);
+   errors = 0;
+   for (y = 0; y < dst->h; ++y) {
+      for (x = 0; x < dst->w; ++x) {
+         p = (Uint8 *) src->pixels + (y * 2) * src->pitch + (x * 2) * 4;
+         q = (Uint8 *) dst->pixels + y * dst->pitch + x * 4;
+         for (i = 0; i < 4; ++i) {
+            expected = p[i] + p[i + 4] + p[i + src->pitch] + p[i + src->pitch + 4];
+            expected = (expected + 2) / 4;
+            if (q[i] != expected) {
+               ++errors;
+            }
+         }
+      }
+   }
+   SDLTest_AssertCheck(errors == 0, "Verify 2x2 box average, expected: 0 mismatches, got: %i", errors);
+   SDL_FreeSurface(dst);
+
+   /* Upscaling a solid color keeps it solid */
+   SDL_FillRect(src, NULL, 0x80402010);
+   dst = SDL_CreateRGBSurfaceWithFormat(0, 37, 23, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+   if (dst == NULL) {
+      SDL_FreeSurface(src);
+      return TEST_ABORTED;
+   }
+   ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+   SDLTest_AssertPass("Call to SDL_SoftStretchLinear() with odd upscale");
+   SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %i", ret);
+   errors = 0;
+   for (y = 0; y < dst->h; ++y) {
+      pixels = (Uint32 *) ((Uint8 *) dst->pixels + y * dst->pitch);
+      for (x = 0; x < dst->w; ++x) {
+         if (pixels[x] != 0x80402010) {
+            ++errors;
+         }
+      }
+   }
+   SDLTest_AssertCheck(errors == 0, "Verify solid upscale, expected: 0 mismatches, got: %i", errors);
+   SDL_FreeSurface(dst);
+
+   /* Mismatched formats are rejected */
+   dst = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 32, SDL_PIXELFORMAT_ABGR8888);
+   if (dst != NULL) {
+      ret = SDL_SoftStretchLinear(src, NULL, dst, NULL);
+      SDLTest_AssertCheck(ret == -1, "Verify mismatched formats fail, expected: -1, got: %i", ret);
+      SDL_FreeSurface(dst);
+   }
+
+   SDL_FreeSurface(src);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that converting in bands on several threads matches converting on one thread.
+ */
+int
+surface_testConvertThreads(void *arg)
+{
+   const struct {
+      Uint32 src;
+      Uint32 dst;
+   } pairs[] = {
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24 },
+      { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888 },
+      { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 },
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_YV12 },
+      { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_NV12 },
+      { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_YUY2 },
+      { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_IYUV },
+      { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_ARGB8888 },
+      { SDL_PIXELFORMAT_NV21, SDL_PIXELFORMAT_RGB24 },
+      { SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_ABGR8888 },
+   };
+   /* Odd sizes, and big enough to be split into several bands */
+   const int w = 1001;
+   const int h = 703;
+   const int pitch = w * 4 + 4;
+   const size_t size = (size_t)pitch * h * 2;
+   Uint8 *rgb, *source, *expected, *actual;
+   SDL_Surface *surface, *serial, *threaded;
+   char *originalValue;
+   int i, x, y, ret;
+
+   rgb = (Uint8 *)SDL_malloc(size);
+   source = (Uint8 *)SDL_malloc(size);
+   expected = (Uint8 *)SDL_malloc(size);
+   actual = (Uint8 *)SDL_malloc(size);
+   SDLTest_AssertCheck(rgb && source && expected && actual, "Verify buffers were allocated");
+   if (!rgb || !source || !expected || !actual) {
+      SDL_free(rgb);
+      SDL_free(source);
+      SDL_free(expected);
+      SDL_free(actual);
+      return TEST_ABORTED;
+   }
+   for (y = 0; y < h; ++y) {
+      for (x = 0; x < w * 4; ++x) {
+         rgb[y * pitch + x] = (Uint8)((x * 7 + y * 13) ^ (x * y));
+      }
+   }
+
+   originalValue = (char *)SDL_GetHint(SDL_HINT_CONVERT_THREADS);
+   if (originalValue != NULL) {
+      originalValue = SDL_strdup(originalValue);
+   }
+
+   for (i = 0; i < SDL_arraysize(pairs); ++i) {
+      const char *src_name = SDL_GetPixelFormatName(pairs[i].src);
+      const char *dst_name = SDL_GetPixelFormatName(pairs[i].dst);
+
+      SDL_SetHint(SDL_HINT_CONVERT_THREADS, "0");
+      SDL_memset(source, 0, size);
+      ret = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, rgb, pitch, pairs[i].src, source, pitch);
+      SDLTest_AssertCheck(ret == 0, "Verify creating %s source, expected: 0, got: %i", src_name, ret);
+
+      SDL_memset(expected, 0xAA, size);
+      ret = SDL_ConvertPixels(w, h, pairs[i].src, source, pitch, pairs[i].dst, expected, pitch);
+      SDLTest_AssertPass("Call to SDL_ConvertPixels(%s to %s) on one thread", src_name, dst_name);
+      SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %i", ret);
+
+      SDL_SetHint(SDL_HINT_CONVERT_THREADS, "4");
+      SDL_memset(actual, 0xAA, size);
+      ret = SDL_ConvertPixels(w, h, pairs[i].src, source, pitch, pairs[i].dst, actual, pitch);
+      SDLTest_AssertPass("Call to SDL_ConvertPixels(%s to %s) on 4 threads", src_name, dst_name);
+      SDLTest_AssertCheck(ret == 0, "Verify result value; expected: 0, got: %i", ret);
+      SDLTest_AssertCheck(SDL_memcmp(expected, actual, size) == 0, "Verify threaded %s to %s output matches", src_name, dst_name);
+   }
+
+   /* SDL_ConvertSurface() */
+   surface = SDL_CreateRGBSurfaceWithFormatFrom(rgb, w, h, 32, pitch, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(surface != NULL, "Verify source surface is not NULL");
+   if (surface != NULL) {
+      SDL_SetHint(SDL_HINT_CONVERT_THREADS, "0");
+      serial = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGB565, 0);
+      SDL_SetHint(SDL_HINT_CONVERT_THREADS, "4");
+      threaded = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGB565, 0);
+      SDLTest_AssertCheck(serial != NULL && threaded != NULL, "Verify converted surfaces are not NULL");
+      if (serial != NULL && threaded != NULL) {
+         ret = SDLTest_CompareSurfaces(threaded, serial, 0);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+      }
+      SDL_FreeSurface(serial);
+      SDL_FreeSurface(threaded);
+      SDL_FreeSurface(surface);
+   }
+
+   /* Setting a hint to NULL leaves it as it is, so clear all hints if it wasn't set before */
+   if (originalValue != NULL) {
+      SDL_SetHint(SDL_HINT_CONVERT_THREADS, originalValue);
+      SDL_free(originalValue);
+   } else {
+      SDL_ClearHints();
+   }
+   SDL_free(rgb);
+   SDL_free(source);
+   SDL_free(expected);
+   SDL_free(actual);
+
+   return TEST_COMPLETED;
+}
+
+/* Streams that aren't in memory, to exercise the reading path of SDL_LoadBMP_RW */
+static Sint64 SDLCALL
+_surface_streamSize(SDL_RWops *context)
+{
+   return SDL_RWsize((SDL_RWops *) context->hidden.unknown.data1);
+}
+
+static Sint64 SDLCALL
+_surface_streamSeek(SDL_RWops *context, Sint64 offset, int whence)
+{
+   return SDL_RWseek((SDL_RWops *) context->hidden.unknown.data1, offset, whence);
+}
+
+static size_t SDLCALL
+_surface_streamRead(SDL_RWops *context, void *ptr, size_t size, size_t maxnum)
+{
+   return SDL_RWread((SDL_RWops *) context->hidden.unknown.data1, ptr, size, maxnum);
+}
+
+static int SDLCALL
+_surface_streamClose(SDL_RWops *context)
+{
+   SDL_RWclose((SDL_RWops *) context->hidden.unknown.data1);
+   SDL_FreeRW(context);
+   return 0;
+}
+
+static SDL_RWops *
+_surface_openStream(const void *mem, int size)
+{
+   SDL_RWops *rw = SDL_AllocRW();
+   if (rw != NULL) {
+      rw->size = _surface_streamSize;
+      rw->seek = _surface_streamSeek;
+      rw->read = _surface_streamRead;
+      rw->write = NULL;
+      rw->close = _surface_streamClose;
+      rw->hidden.unknown.data1 = SDL_RWFromConstMem(mem, size);
+   }
+   return rw;
+}
+
+/* Writes an uncompressed BMP with random pixels and palette, returning its size */
+static int
+_surface_writeBMP(Uint8 *file, int w, int h, int bits, int colors, SDL_bool topDown, SDL_bool zeroAlpha)
+{
+   const int pitch = ((w * bits + 31) / 32) * 4;
+   const int ncolors = (bits <= 8) ? (colors ? colors : (1 << bits)) : 0;
+   Uint8 *p = file;
+   int i;
+#define PUT16(v) { *p++ = (Uint8) ((v) & 0xFF); *p++ = (Uint8) (((v) >> 8) & 0xFF); }
+#define PUT32(v) { PUT16((v) & 0xFFFF); PUT16(((v) >> 16) & 0xFFFF); }
+   *p++ = 'B';
+   *p++ = 'M';
+   PUT32(14 + 40 + ncolors * 4 + pitch * h);
+   PUT32(0);
+   PUT32(14 + 40 + ncolors * 4);
+   PUT32(40);
+   PUT32(w);
+   PUT32(topDown ? -h : h);
+   PUT16(1);
+   PUT16(bits);
+   PUT32(0);
+   PUT32(pitch * h);
+   PUT32(2835);
+   PUT32(2835);
+   PUT32((bits == 1 && !colors) ? 0 : ncolors);
+   PUT32(0);
+#undef PUT32
+#undef PUT16
+   for (i = 0; i < ncolors * 4 + pitch * h; ++i) {
+      *p++ = SDLTest_RandomUint8();
+   }
+   if (zeroAlpha) {
+      for (i = 3; i < pitch * h; i += 4) {
+         p[i - pitch * h] = 0;
+      }
+   }
+   return (int) (p - file);
+}
+
+/**
+ * @brief Tests loading BMP files straight into a pixel format against loading and converting them.
+ */
+int
+surface_testLoadBMPFormat(void *arg)
+{
+   const struct {
+      int w, h, bits, colors;
+      SDL_bool topDown, zeroAlpha;
+   } images[] = {
+      { 37, 5, 1, 0, SDL_FALSE, SDL_FALSE },
+      { 21, 6, 4, 0, SDL_TRUE, SDL_FALSE },
+      { 19, 7, 8, 0, SDL_FALSE, SDL_FALSE },
+      /* Color tables shorter than the pixels can index */
+      { 21, 6, 4, 5, SDL_FALSE, SDL_FALSE },
+      { 19, 7, 8, 16, SDL_TRUE, SDL_FALSE },
+      { 33, 9, 24, 0, SDL_FALSE, SDL_FALSE },
+      { 34, 3, 24, 0, SDL_TRUE, SDL_FALSE },
+      { 23, 4, 32, 0, SDL_FALSE, SDL_FALSE },
+      { 23, 4, 32, 0, SDL_TRUE, SDL_TRUE },
+   };
+   const Uint32 formats[] = {
+      SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888,
+      SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+      SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB24
+   };
+   static Uint8 file[4096];
+   int i, j, k, x, y;
+
+   for (i = 0; i < SDL_arraysize(images); ++i) {
+      const int size = _surface_writeBMP(file, images[i].w, images[i].h, images[i].bits, images[i].colors,
+                                         images[i].topDown, images[i].zeroAlpha);
+      SDL_Surface *native = SDL_LoadBMP_RW(SDL_RWFromConstMem(file, size), 1);
+
+      SDLTest_AssertPass("Call to SDL_LoadBMP_RW() with a %i-bit image", images[i].bits);
+      SDLTest_AssertCheck(native != NULL, "Verify result from SDL_LoadBMP_RW is not NULL");
+      if (native == NULL) {
+         return TEST_ABORTED;
+      }
+
+      for (j = 0; j < SDL_arraysize(formats); ++j) {
+         SDL_Surface *expected = SDL_ConvertSurfaceFormat(native, formats[j], 0);
+         Uint32 mask = 0xFFFFFFFF;
+
+         SDLTest_AssertCheck(expected != NULL, "Verify result from SDL_ConvertSurfaceFormat is not NULL");
+         if (expected == NULL) {
+            SDL_FreeSurface(native);
+            return TEST_ABORTED;
+         }
+         if (expected->format->BytesPerPixel == 4) {
+            /* Unused bits can be anything */
+            mask = expected->format->Rmask | expected->format->Gmask |
+                   expected->format->Bmask | expected->format->Amask;
+         }
+
+         for (k = 0; k < 2; ++k) {
+            SDL_RWops *src = k ? _surface_openStream(file, size) : SDL_RWFromConstMem(file, size);
+            SDL_Surface *actual = SDL_LoadBMPFormat_RW(src, 1, formats[j]);
+            int errors = 0;
+
+            SDLTest_AssertCheck(actual != NULL, "Verify result from SDL_LoadBMPFormat_RW(%s) is not NULL", SDL_GetPixelFormatName(formats[j]));
+            if (actual == NULL) {
+               continue;
+            }
+            SDLTest_AssertCheck(actual->format->format == formats[j] && actual->w == images[i].w && actual->h == images[i].h,
+                                "Verify surface format and size; expected: %s %ix%i, got: %s %ix%i",
+                                SDL_GetPixelFormatName(formats[j]), images[i].w, images[i].h,
+                                SDL_GetPixelFormatName(actual->format->format), actual->w, actual->h);
+            for (y = 0; y < actual->h && actual->format->format == formats[j]; ++y) {
+               const Uint8 *a = (const Uint8 *) actual->pixels + y * actual->pitch;
+               const Uint8 *e = (const Uint8 *) expected->pixels + y * expected->pitch;
+               if (expected->format->BytesPerPixel == 4) {
+                  for (x = 0; x < actual->w; ++x) {
+                     if ((((const Uint32 *) a)[x] & mask) != (((const Uint32 *) e)[x] & mask)) {
+                        ++errors;
+                     }
+                  }
+               } else if (SDL_memcmp(a, e, actual->w * expected->format->BytesPerPixel) != 0) {
+                  ++errors;
+               }
+            }
+            SDLTest_AssertCheck(errors == 0, "Verify %i-bit image loaded as %s from %s matches converting it, expected: 0 mismatches, got: %i",
+                                images[i].bits, SDL_GetPixelFormatName(formats[j]), k ? "a stream" : "memory", errors);
+            SDL_FreeSurface(actual);
+         }
+         SDL_FreeSurface(expected);
+      }
+
+      /* Reading from a stream gives the same surface as reading from memory */
+      {
+         SDL_Surface *streamed = SDL_LoadBMP_RW(_surface_openStream(file, size), 1);
+         SDLTest_AssertCheck(streamed != NULL, "Verify result from SDL_LoadBMP_RW with a stream is not NULL");
+         if (streamed != NULL) {
+            int ret = 0;
+            for (y = 0; y < native->h; ++y) {
+               if (SDL_memcmp((Uint8 *) native->pixels + y * native->pitch,
+                              (Uint8 *) streamed->pixels + y * streamed->pitch,
+                              native->w * native->format->BytesPerPixel) != 0) {
+                  ++ret;
+               }
+            }
+            SDLTest_AssertCheck(ret == 0, "Verify streamed rows match, expected: 0 mismatches, got: %i", ret);
+            SDL_FreeSurface(streamed);
+         }
+      }
+      SDL_FreeSurface(native);
+   }
+
+   /* A truncated pixel array is an error */
+   {
+      const int size = _surface_writeBMP(file, 33, 9, 24, 0, SDL_FALSE, SDL_FALSE);
+      SDL_Surface *surface = SDL_LoadBMPFormat_RW(SDL_RWFromConstMem(file, size - 40), 1, SDL_PIXELFORMAT_ARGB8888);
+      SDLTest_AssertCheck(surface == NULL, "Verify truncated image fails to load");
+      SDL_FreeSurface(surface);
+      surface = SDL_LoadBMPFormat_RW(_surface_openStream(file, size - 40), 1, SDL_PIXELFORMAT_UNKNOWN);
+      SDLTest_AssertCheck(surface == NULL, "Verify truncated stream fails to load");
+      SDL_FreeSurface(surface);
+   }
+
+   return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -630,11 +1046,21 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testSoftStretchLinear, "surface_testSoftStretchLinear", "Tests filtered stretching with SDL_SoftStretchLinear.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testConvertThreads, "surface_testConvertThreads", "Tests that converting on several threads matches converting on one thread.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testLoadBMPFormat, "surface_testLoadBMPFormat", "Tests loading BMP files straight into a pixel format.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14, &surfaceTest15,
+    NULL
 };
 
 /* Surface test suite (global) */
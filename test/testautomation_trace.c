@@ -0,0 +1,107 @@
+/**
+ * Trace test suite
+ */
+
+#include <stdio.h>
+
+#include "SDL.h"
+#include "SDL_test.h"
+
+/* Test case functions */
+
+static int SDLCALL
+_traceThread(void *arg)
+{
+  SDL_TraceEnd("TraceB", SDL_TraceBegin());
+  return 0;
+}
+
+/**
+ * @brief Call to SDL_TraceBegin, SDL_TraceEnd and the trace query functions
+ */
+int
+trace_zones(void *arg)
+{
+  SDL_TraceEvent events[16];
+  SDL_TraceCounter counters[4];
+  SDL_Thread *thread;
+  SDL_RWops *rw;
+  char json[1024];
+  Uint64 start;
+  int count, i;
+
+  /* Throw away anything recorded earlier */
+  while (SDL_GetTraceEvents(events, SDL_arraysize(events)) > 0) {
+  }
+
+  /* Nothing is recorded while disabled */
+  SDL_SetTraceEnabled(SDL_FALSE);
+  start = SDL_TraceBegin();
+  SDLTest_AssertCheck(start == 0, "Check SDL_TraceBegin() returns 0 when disabled, got: %"SDL_PRIu64, start);
+  SDL_TraceEnd("TraceA", start);
+  count = SDL_GetTraceEvents(events, SDL_arraysize(events));
+  SDLTest_AssertCheck(count == 0, "Check no events were recorded, got: %i", count);
+
+  SDL_SetTraceEnabled(SDL_TRUE);
+  SDLTest_AssertCheck(SDL_GetTraceEnabled() == SDL_TRUE, "Check tracing is enabled");
+  SDL_ResetTraceCounters();
+  SDL_TraceEnd("TraceA", SDL_TraceBegin());
+  SDL_TraceEnd("TraceA", SDL_TraceBegin());
+  thread = SDL_CreateThread(_traceThread, "TraceThread", NULL);
+  SDLTest_AssertCheck(thread != NULL, "Check SDL_CreateThread() succeeded");
+  SDL_WaitThread(thread, NULL);
+
+  count = SDL_GetTraceCounters(counters, SDL_arraysize(counters));
+  SDLTest_AssertCheck(count == 2, "Check zone count, expected: 2, got: %i", count);
+  for (i = 0; i < count; ++i) {
+    const int expected = (SDL_strcmp(counters[i].name, "TraceA") == 0) ? 2 : 1;
+    SDLTest_AssertCheck(counters[i].count == expected, "Check %s count, expected: %i, got: %u", counters[i].name, expected, counters[i].count);
+    SDLTest_AssertCheck(counters[i].max <= counters[i].total, "Check %s max is no more than its total", counters[i].name);
+  }
+  SDL_ResetTraceCounters();
+  count = SDL_GetTraceCounters(NULL, 0);
+  SDLTest_AssertCheck(count == 0, "Check zone count after reset, expected: 0, got: %i", count);
+
+  /* Export and consume the events */
+  rw = SDL_RWFromMem(json, sizeof(json) - 1);
+  SDLTest_AssertCheck(SDL_SaveTraceJSON_RW(rw, 0) == 0, "Check SDL_SaveTraceJSON_RW() succeeded");
+  json[SDL_RWtell(rw)] = '\0';
+  SDL_RWclose(rw);
+  SDLTest_AssertCheck(SDL_strncmp(json, "{\"traceEvents\":[", 16) == 0, "Check JSON header");
+  SDLTest_AssertCheck(SDL_strstr(json, "\"name\":\"TraceA\",\"ph\":\"X\"") != NULL, "Check JSON has TraceA");
+  SDLTest_AssertCheck(SDL_strstr(json, "\"name\":\"TraceB\",\"ph\":\"X\"") != NULL, "Check JSON has TraceB");
+  count = SDL_GetTraceEvents(events, SDL_arraysize(events));
+  SDLTest_AssertCheck(count == 0, "Check export consumed the events, got: %i", count);
+
+  /* Events are consumed by SDL_GetTraceEvents() */
+  SDL_TraceEnd("TraceA", SDL_TraceBegin());
+  SDL_SetTraceEnabled(SDL_FALSE);
+  count = SDL_GetTraceEvents(events, SDL_arraysize(events));
+  SDLTest_AssertCheck(count == 1, "Check event count, expected: 1, got: %i", count);
+  if (count == 1) {
+    SDLTest_AssertCheck(SDL_strcmp(events[0].name, "TraceA") == 0, "Check event name, expected: TraceA, got: %s", events[0].name);
+    SDLTest_AssertCheck(events[0].thread == SDL_ThreadID(), "Check event thread");
+    SDLTest_AssertCheck(events[0].start <= events[0].end, "Check event times are ordered");
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Trace test cases */
+static const SDLTest_TestCaseReference traceTest1 =
+        { (SDLTest_TestCaseFp)trace_zones, "trace_zones", "Call to SDL_TraceBegin, SDL_TraceEnd and the trace query functions", TEST_ENABLED };
+
+/* Sequence of Trace test cases */
+static const SDLTest_TestCaseReference *traceTests[] =  {
+    &traceTest1, NULL
+};
+
+/* Trace test suite (global) */
+SDLTest_TestSuiteReference traceTestSuite = {
+    "Trace",
+    NULL,
+    traceTests,
+    NULL
+};
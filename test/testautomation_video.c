@@ -1721,6 +1721,150 @@ video_getSetWindowData(void *arg)
 }
 
 
+/**
+ * @brief Tests the damage tracked on window surfaces
+ *
+ * @sa http://wiki.libsdl.org/SDL_GetWindowSurfaceDamage
+ * @sa http://wiki.libsdl.org/SDL_UpdateWindowSurface
+ */
+int
+video_getWindowSurfaceDamage(void *arg)
+{
+  const char* title = "video_getWindowSurfaceDamage Test Window";
+  char *originalValue;
+  SDL_Window* window;
+  SDL_Surface* surface;
+  SDL_Surface* sprite;
+  SDL_Rect rects[8];
+  SDL_Rect rect;
+  int w, h;
+  int i, result;
+
+  originalValue = (char *)SDL_GetHint(SDL_HINT_FRAMEBUFFER_DAMAGE);
+  if (originalValue != NULL) {
+    originalValue = SDL_strdup(originalValue);
+  }
+
+  /* Call against new test window with damage tracking */
+  SDL_SetHint(SDL_HINT_FRAMEBUFFER_DAMAGE, "1");
+  window = _createVideoSuiteTestWindow(title);
+  if (window == NULL) goto cleanup;
+  SDL_GetWindowSize(window, &w, &h);
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_GetWindowSurface()");
+  SDLTest_AssertCheck(surface != NULL, "Validate that returned surface is not NULL");
+  if (surface == NULL) goto destroy;
+
+  /* The first update copies everything */
+  result = SDL_GetWindowSurfaceDamage(window, rects, SDL_arraysize(rects));
+  SDLTest_AssertPass("Call to SDL_GetWindowSurfaceDamage()");
+  SDLTest_AssertCheck(result == 1, "Verify one rectangle is damaged; expected: 1, got: %d", result);
+  SDLTest_AssertCheck(rects[0].x == 0 && rects[0].y == 0 && rects[0].w == w && rects[0].h == h,
+    "Verify the whole window is damaged; expected: 0,0 %dx%d, got: %d,%d %dx%d", w, h, rects[0].x, rects[0].y, rects[0].w, rects[0].h);
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurface()");
+  SDLTest_AssertCheck(result == 0, "Verify return value; expected: 0, got: %d", result);
+  result = SDL_GetWindowSurfaceDamage(window, NULL, 0);
+  SDLTest_AssertCheck(result == 0, "Verify nothing is damaged after the update; expected: 0, got: %d", result);
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertCheck(result == 0, "Verify an update without damage succeeds; expected: 0, got: %d", result);
+
+  /* Touching fills are merged */
+  rect.x = 10; rect.y = 10; rect.w = 20; rect.h = 20;
+  SDL_FillRect(surface, &rect, 0);
+  rect.x = 30;
+  SDL_FillRect(surface, &rect, 0);
+  SDLTest_AssertPass("Call to SDL_FillRect()");
+  result = SDL_GetWindowSurfaceDamage(window, rects, SDL_arraysize(rects));
+  SDLTest_AssertCheck(result == 1, "Verify touching fills are merged; expected: 1, got: %d", result);
+  SDLTest_AssertCheck(rects[0].x == 10 && rects[0].y == 10 && rects[0].w == 40 && rects[0].h == 20,
+    "Verify the damaged rectangle; expected: 10,10 40x20, got: %d,%d %dx%d", rects[0].x, rects[0].y, rects[0].w, rects[0].h);
+
+  /* A fill inside the damage changes nothing, a fill far away adds a rectangle */
+  rect.x = 15; rect.y = 15; rect.w = 5; rect.h = 5;
+  SDL_FillRect(surface, &rect, 0);
+  rect.x = 200; rect.y = 200;
+  SDL_FillRect(surface, &rect, 0);
+  result = SDL_GetWindowSurfaceDamage(window, rects, SDL_arraysize(rects));
+  SDLTest_AssertCheck(result == 2, "Verify separate fills are kept apart; expected: 2, got: %d", result);
+
+  /* Blits, clipped to the window */
+  sprite = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+  SDLTest_AssertCheck(sprite != NULL, "Validate that the sprite surface is not NULL");
+  if (sprite != NULL) {
+    rect.x = w - 8; rect.y = 100;
+    result = SDL_BlitSurface(sprite, NULL, surface, &rect);
+    SDLTest_AssertPass("Call to SDL_BlitSurface()");
+    SDLTest_AssertCheck(result == 0, "Verify return value; expected: 0, got: %d", result);
+    SDL_FreeSurface(sprite);
+  }
+  result = SDL_GetWindowSurfaceDamage(window, rects, SDL_arraysize(rects));
+  SDLTest_AssertCheck(result == 3, "Verify the blit adds a rectangle; expected: 3, got: %d", result);
+  for (i = 0; i < SDL_min(result, (int)SDL_arraysize(rects)); i++) {
+    if (rects[i].y == 100) {
+      SDLTest_AssertCheck(rects[i].x == w - 8 && rects[i].w == 8 && rects[i].h == 16,
+        "Verify the blit damage is clipped; expected: %d,100 8x16, got: %d,%d %dx%d", w - 8, rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+    }
+  }
+
+  /* The list is bounded */
+  for (i = 0; i < 20; i++) {
+    rect.x = 15 * i; rect.y = 15 * i; rect.w = 2; rect.h = 2;
+    SDL_FillRect(surface, &rect, 0);
+  }
+  result = SDL_GetWindowSurfaceDamage(window, rects, SDL_arraysize(rects));
+  SDLTest_AssertCheck(result >= 1 && result <= 8, "Verify the damage list is bounded; expected: 1-8, got: %d", result);
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertCheck(result == 0, "Verify return value; expected: 0, got: %d", result);
+  result = SDL_GetWindowSurfaceDamage(window, NULL, 0);
+  SDLTest_AssertCheck(result == 0, "Verify nothing is damaged after the update; expected: 0, got: %d", result);
+
+  /* Unlocking damages everything */
+  SDL_LockSurface(surface);
+  SDL_UnlockSurface(surface);
+  SDLTest_AssertPass("Call to SDL_LockSurface() and SDL_UnlockSurface()");
+  result = SDL_GetWindowSurfaceDamage(window, rects, SDL_arraysize(rects));
+  SDLTest_AssertCheck(result == 1 && rects[0].w == w && rects[0].h == h,
+    "Verify the whole window is damaged; expected: 1 rect %dx%d, got: %d rect %dx%d", w, h, result, rects[0].w, rects[0].h);
+
+  /* Invalid parameters */
+  result = SDL_GetWindowSurfaceDamage(window, rects, -1);
+  SDLTest_AssertCheck(result == -1, "Verify return value with negative maxrects; expected: -1, got: %d", result);
+  result = SDL_GetWindowSurfaceDamage(NULL, rects, SDL_arraysize(rects));
+  SDLTest_AssertCheck(result == -1, "Verify return value with NULL window; expected: -1, got: %d", result);
+  _checkInvalidWindowError();
+
+  destroy:
+  _destroyVideoSuiteTestWindow(window);
+
+  /* Without damage tracking the whole window is always copied */
+  SDL_SetHint(SDL_HINT_FRAMEBUFFER_DAMAGE, "0");
+  window = _createVideoSuiteTestWindow(title);
+  if (window == NULL) goto cleanup;
+  SDL_GetWindowSize(window, &w, &h);
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertCheck(surface != NULL, "Validate that returned surface is not NULL");
+  if (surface != NULL) {
+    result = SDL_UpdateWindowSurface(window);
+    SDLTest_AssertCheck(result == 0, "Verify return value; expected: 0, got: %d", result);
+    result = SDL_GetWindowSurfaceDamage(window, rects, SDL_arraysize(rects));
+    SDLTest_AssertCheck(result == 1 && rects[0].w == w && rects[0].h == h,
+      "Verify the whole window is damaged; expected: 1 rect %dx%d, got: %d rect %dx%d", w, h, result, rects[0].w, rects[0].h);
+  }
+  _destroyVideoSuiteTestWindow(window);
+
+  cleanup:
+  /* Setting a hint to NULL leaves it as it is, so clear all hints if it wasn't set before */
+  if (originalValue != NULL) {
+    SDL_SetHint(SDL_HINT_FRAMEBUFFER_DAMAGE, originalValue);
+    SDL_free(originalValue);
+  } else {
+    SDL_ClearHints();
+  }
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Video test cases */
@@ -1793,13 +1937,16 @@ static const SDLTest_TestCaseReference videoTest22 =
 static const SDLTest_TestCaseReference videoTest23 =
         { (SDLTest_TestCaseFp)video_getSetWindowData, "video_getSetWindowData",  "Checks SDL_SetWindowData and SDL_GetWindowData positive and negative cases", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference videoTest24 =
+        { (SDLTest_TestCaseFp)video_getWindowSurfaceDamage, "video_getWindowSurfaceDamage",  "Checks SDL_GetWindowSurfaceDamage and the damage tracked by SDL_UpdateWindowSurface", TEST_ENABLED };
+
 /* Sequence of Video test cases */
 static const SDLTest_TestCaseReference *videoTests[] =  {
     &videoTest1, &videoTest2, &videoTest3, &videoTest4, &videoTest5, &videoTest6,
     &videoTest7, &videoTest8, &videoTest9, &videoTest10, &videoTest11, &videoTest12,
     &videoTest13, &videoTest14, &videoTest15, &videoTest16, &videoTest17,
     &videoTest18, &videoTest19, &videoTest20, &videoTest21, &videoTest22,
-    &videoTest23, NULL
+    &videoTest23, &videoTest24, NULL
 };
 
 /* Video test suite (global) */
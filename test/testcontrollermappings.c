@@ -0,0 +1,148 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Time loading a large game controller mapping database and looking up
+   mappings in it.
+
+   --mappings N  how many mappings to generate (default 5000)
+   --lookups N   how many lookups to time (default 1000000)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static void
+MakeGUID(int index, SDL_JoystickGUID *guid)
+{
+    Uint16 *guid16;
+
+    /* A USB device with a made up vendor and product */
+    SDL_zerop(guid);
+    guid16 = (Uint16 *)guid->data;
+    guid16[0] = SDL_SwapLE16(0x03);
+    guid16[2] = SDL_SwapLE16((Uint16)(0x4000 + index / 1000));
+    guid16[4] = SDL_SwapLE16((Uint16)(index % 1000));
+    guid16[6] = SDL_SwapLE16(0x0100);
+}
+
+static double
+ElapsedMS(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+int
+main(int argc, char *argv[])
+{
+    const size_t line_size = 256;
+    int num_mappings = 5000;
+    int num_lookups = 1000000;
+    int failures = 0;
+    char *db, *line;
+    size_t db_len = 0;
+    SDL_RWops *rw;
+    Uint64 start;
+    int i, added, found;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--mappings") == 0 && argv[i + 1]) {
+            num_mappings = SDL_atoi(argv[++i]);
+            num_mappings = SDL_max(num_mappings, 1);
+        } else if (SDL_strcmp(argv[i], "--lookups") == 0 && argv[i + 1]) {
+            num_lookups = SDL_atoi(argv[++i]);
+            num_lookups = SDL_max(num_lookups, 1);
+        } else {
+            SDL_Log("Usage: %s [--mappings N] [--lookups N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(SDL_INIT_GAMECONTROLLER) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    /* Write out a database in the gamecontrollerdb.txt format */
+    db = (char *)SDL_malloc(num_mappings * line_size);
+    if (!db) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_Quit();
+        return 1;
+    }
+    for (i = 0; i < num_mappings; ++i) {
+        SDL_JoystickGUID guid;
+        char pchGUID[33];
+
+        MakeGUID(i, &guid);
+        SDL_JoystickGetGUIDString(guid, pchGUID, sizeof(pchGUID));
+        line = db + db_len;
+        db_len += SDL_snprintf(line, line_size,
+            "%s,Test Controller %d,a:b0,b:b1,back:b6,leftx:a0,lefty:a1,start:b7,x:b2,y:b3,platform:%s,\n",
+            pchGUID, i, SDL_GetPlatform());
+    }
+
+    start = SDL_GetPerformanceCounter();
+    rw = SDL_RWFromConstMem(db, (int)db_len);
+    added = SDL_GameControllerAddMappingsFromRW(rw, 1);
+    SDL_Log("Loaded %d mappings in %.2f ms\n", added, ElapsedMS(start));
+    if (added != num_mappings) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Expected %d new mappings, got %d: %s\n", num_mappings, added, SDL_GetError());
+        ++failures;
+    }
+
+    /* Make sure the right mapping comes back */
+    for (i = 0; i < num_mappings; i += 97) {
+        SDL_JoystickGUID guid;
+        char name[64];
+        char *mapping;
+
+        MakeGUID(i, &guid);
+        SDL_snprintf(name, sizeof(name), ",Test Controller %d,", i);
+        mapping = SDL_GameControllerMappingForGUID(guid);
+        if (!mapping || !SDL_strstr(mapping, name)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Wrong mapping for controller %d: %s\n", i, mapping ? mapping : "(null)");
+            ++failures;
+        }
+        SDL_free(mapping);
+    }
+
+    start = SDL_GetPerformanceCounter();
+    found = 0;
+    for (i = 0; i < num_lookups; ++i) {
+        SDL_JoystickGUID guid;
+        char *mapping;
+
+        MakeGUID(i % num_mappings, &guid);
+        mapping = SDL_GameControllerMappingForGUID(guid);
+        if (mapping) {
+            ++found;
+            SDL_free(mapping);
+        }
+    }
+    SDL_Log("%d lookups in %.2f ms, %d found\n", num_lookups, ElapsedMS(start), found);
+    if (found != num_lookups) {
+        ++failures;
+    }
+
+    SDL_free(db);
+    SDL_Quit();
+
+    SDL_Log("%s\n", failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,142 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Time SDL_ConvertPixels() on 4K or 8K images, on one thread and in bands
+   on several threads (see SDL_HINT_CONVERT_THREADS).
+   Usage: testconvert [--threads N] [--iterations N] [--8k] */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static const struct {
+    Uint32 src;
+    Uint32 dst;
+} pairs[] = {
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24 },
+    { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_NV12 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_YV12 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_YUY2 },
+    { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_ABGR8888 },
+    { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_RGB24 },
+};
+
+static double
+TimeConversion(const char *threads, int iterations, int w, int h,
+               Uint32 src_format, const void *src, Uint32 dst_format, void *dst, int pitch)
+{
+    Uint64 start;
+    int i;
+
+    SDL_SetHint(SDL_HINT_CONVERT_THREADS, threads);
+
+    /* Warm up, and start the threads */
+    if (SDL_ConvertPixels(w, h, src_format, src, pitch, dst_format, dst, pitch) < 0) {
+        return -1.0;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_ConvertPixels(w, h, src_format, src, pitch, dst_format, dst, pitch);
+    }
+    return (double) (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *threads = "-1";
+    int iterations = 10;
+    int w = 3840, h = 2160;
+    int pitch, i, x, y;
+    size_t size;
+    Uint8 *rgb, *src, *serial, *threaded;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+            threads = argv[++i];
+        } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            iterations = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--8k") == 0) {
+            w = 7680;
+            h = 4320;
+        } else {
+            SDL_Log("Usage: %s [--threads N] [--iterations N] [--8k]\n", argv[0]);
+            return (1);
+        }
+    }
+    if (iterations <= 0) {
+        iterations = 1;
+    }
+
+    /* Load the SDL library */
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    /* Big enough for any of the formats, with the same pitch for all of them */
+    pitch = w * 4;
+    size = (size_t) pitch * h * 2;
+    rgb = (Uint8 *) SDL_malloc(size);
+    src = (Uint8 *) SDL_malloc(size);
+    serial = (Uint8 *) SDL_calloc(1, size);
+    threaded = (Uint8 *) SDL_calloc(1, size);
+    if (!rgb || !src || !serial || !threaded) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_Quit();
+        return (1);
+    }
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < pitch; x++) {
+            rgb[y * pitch + x] = (Uint8) ((x * 7 + y * 13) ^ (x * y));
+        }
+    }
+
+    SDL_Log("%dx%d, %d iterations, %s threads\n", w, h, iterations, threads);
+    for (i = 0; i < SDL_arraysize(pairs); i++) {
+        double serial_ms, threaded_ms;
+
+        SDL_SetHint(SDL_HINT_CONVERT_THREADS, "1");
+        if (SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, rgb, pitch, pairs[i].src, src, pitch) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert: %s\n", SDL_GetError());
+            continue;
+        }
+
+        serial_ms = TimeConversion("1", iterations, w, h, pairs[i].src, src, pairs[i].dst, serial, pitch);
+        threaded_ms = TimeConversion(threads, iterations, w, h, pairs[i].src, src, pairs[i].dst, threaded, pitch);
+        if (serial_ms < 0.0 || threaded_ms < 0.0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert: %s\n", SDL_GetError());
+            continue;
+        }
+
+        SDL_Log("%-24s -> %-24s %8.2f ms %8.2f ms  %.2fx%s\n",
+                SDL_GetPixelFormatName(pairs[i].src), SDL_GetPixelFormatName(pairs[i].dst),
+                serial_ms, threaded_ms, serial_ms / threaded_ms,
+                SDL_memcmp(serial, threaded, size) == 0 ? "" : "  OUTPUT DIFFERS");
+    }
+
+    SDL_free(rgb);
+    SDL_free(src);
+    SDL_free(serial);
+    SDL_free(threaded);
+    SDL_Quit();
+    return (0);
+}
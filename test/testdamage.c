@@ -0,0 +1,144 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measure how much SDL_UpdateWindowSurface() copies per frame with and
+   without SDL_HINT_FRAMEBUFFER_DAMAGE, for a window where a few small
+   widgets change each frame.  Run it with SDL_VIDEODRIVER=dummy or on X11
+   (e.g. under Xvfb).
+   Usage: testdamage [--frames N] */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define WINDOW_WIDTH    1024
+#define WINDOW_HEIGHT   768
+#define NUM_WIDGETS     4
+
+typedef struct
+{
+    double bytes;
+    double seconds;
+} Result;
+
+static SDL_bool
+RunFrames(const char *damage, int frames, Result *result)
+{
+    SDL_Window *window;
+    SDL_Surface *surface;
+    SDL_Surface *sprite;
+    SDL_Rect rects[8];
+    SDL_Rect rect;
+    Uint64 bytes = 0;
+    Uint64 ticks = 0;
+    Uint64 start;
+    int frame, i, n;
+
+    SDL_SetHint(SDL_HINT_FRAMEBUFFER_DAMAGE, damage);
+    window = SDL_CreateWindow("testdamage", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                              WINDOW_WIDTH, WINDOW_HEIGHT, 0);
+    if (!window) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create window: %s\n", SDL_GetError());
+        return SDL_FALSE;
+    }
+    surface = SDL_GetWindowSurface(window);
+    sprite = SDL_CreateRGBSurfaceWithFormat(0, 32, 32, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface || !sprite) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s\n", SDL_GetError());
+        SDL_FreeSurface(sprite);
+        SDL_DestroyWindow(window);
+        return SDL_FALSE;
+    }
+    SDL_FillRect(sprite, NULL, SDL_MapRGB(sprite->format, 0xFF, 0x80, 0x00));
+
+    /* Draw the whole window once */
+    SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 0x40, 0x40, 0x40));
+    SDL_UpdateWindowSurface(window);
+
+    for (frame = 0; frame < frames; ++frame) {
+        SDL_Event event;
+
+        while (SDL_PollEvent(&event)) {
+        }
+
+        /* A few progress bars and a moving sprite */
+        for (i = 0; i < NUM_WIDGETS; ++i) {
+            rect.x = 16 + i * 240;
+            rect.y = 16;
+            rect.w = (frame * (i + 1)) % 200 + 1;
+            rect.h = 12;
+            SDL_FillRect(surface, &rect, SDL_MapRGB(surface->format, 0x00, 0x80 + i * 0x20, 0x00));
+        }
+        rect.x = (frame * 4) % (WINDOW_WIDTH - 32);
+        rect.y = WINDOW_HEIGHT / 2;
+        SDL_BlitSurface(sprite, NULL, surface, &rect);
+
+        n = SDL_GetWindowSurfaceDamage(window, rects, SDL_arraysize(rects));
+        for (i = 0; i < SDL_min(n, (int) SDL_arraysize(rects)); ++i) {
+            bytes += (Uint64) rects[i].w * rects[i].h * surface->format->BytesPerPixel;
+        }
+
+        start = SDL_GetPerformanceCounter();
+        if (SDL_UpdateWindowSurface(window) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't update window surface: %s\n", SDL_GetError());
+            break;
+        }
+        ticks += SDL_GetPerformanceCounter() - start;
+    }
+
+    result->bytes = (double) bytes / frames;
+    result->seconds = (double) ticks / SDL_GetPerformanceFrequency() / frames;
+
+    SDL_FreeSurface(sprite);
+    SDL_DestroyWindow(window);
+    return (frame == frames) ? SDL_TRUE : SDL_FALSE;
+}
+
+int
+main(int argc, char *argv[])
+{
+    Result full, damage;
+    int frames = 300;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 2 && SDL_strcmp(argv[1], "--frames") == 0) {
+        frames = SDL_atoi(argv[2]);
+    }
+    if (frames <= 0) {
+        frames = 1;
+    }
+
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    if (!RunFrames("0", frames, &full) || !RunFrames("1", frames, &damage)) {
+        SDL_Quit();
+        return (1);
+    }
+
+    SDL_Log("Video driver %s, %dx%d window, %d frames\n", SDL_GetCurrentVideoDriver(),
+            WINDOW_WIDTH, WINDOW_HEIGHT, frames);
+    SDL_Log("Whole window: %.0f bytes per frame, %.3f ms per update\n",
+            full.bytes, full.seconds * 1000.0);
+    SDL_Log("Damage only: %.0f bytes per frame, %.3f ms per update\n",
+            damage.bytes, damage.seconds * 1000.0);
+
+    SDL_Quit();
+    return (0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,132 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how long it takes SDL_WaitEvent() to return an event that
+   another thread pushed while we were blocked. */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_EVENTS 500
+
+static int num_events = DEFAULT_EVENTS;
+static Uint64 *push_times = NULL;
+static Uint32 latency_event = 0;
+
+static int SDLCALL
+PushThread(void *data)
+{
+    int i;
+
+    for (i = 0; i < num_events; i++) {
+        SDL_Event event;
+
+        /* give the main thread time to go back to sleep. */
+        SDL_Delay(1 + (rand() % 4));
+
+        SDL_zero(event);
+        event.type = latency_event;
+        event.user.code = i;
+        push_times[i] = SDL_GetPerformanceCounter();
+        SDL_PushEvent(&event);
+    }
+    return 0;
+}
+
+static int SDLCALL
+CompareLatency(const void *a, const void *b)
+{
+    const double x = *(const double *) a;
+    const double y = *(const double *) b;
+    return (x < y) ? -1 : (x > y) ? 1 : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const double freq = (double) SDL_GetPerformanceFrequency();
+    double *latencies;
+    double total = 0.0;
+    SDL_Thread *thread;
+    int received = 0;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_events = SDL_atoi(argv[1]);
+        if (num_events <= 0) {
+            SDL_Log("USAGE: %s [number of events]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    /* Use the video subsystem if we can, so we wait on its events too. */
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        SDL_Log("Couldn't initialize video (%s), testing without it\n", SDL_GetError());
+        if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+            return 1;
+        }
+    } else {
+        SDL_Log("Using video driver: %s\n", SDL_GetCurrentVideoDriver());
+    }
+
+    latency_event = SDL_RegisterEvents(1);
+    push_times = (Uint64 *) SDL_calloc(num_events, sizeof (Uint64));
+    latencies = (double *) SDL_calloc(num_events, sizeof (double));
+    if (latency_event == (Uint32) -1 || !push_times || !latencies) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_Quit();
+        return 1;
+    }
+
+    thread = SDL_CreateThread(PushThread, "PushThread", NULL);
+    if (!thread) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+
+    while (received < num_events) {
+        SDL_Event event;
+        if (!SDL_WaitEvent(&event)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_WaitEvent failed: %s\n", SDL_GetError());
+            break;
+        }
+        if (event.type == latency_event) {
+            const Uint64 now = SDL_GetPerformanceCounter();
+            latencies[received++] = ((double) (now - push_times[event.user.code])) * 1000000.0 / freq;
+        }
+    }
+
+    SDL_WaitThread(thread, NULL);
+
+    if (received > 0) {
+        SDL_qsort(latencies, received, sizeof (double), CompareLatency);
+        for (i = 0; i < received; i++) {
+            total += latencies[i];
+        }
+        SDL_Log("Wake-to-dispatch latency over %d events: min %.1f us, avg %.1f us, median %.1f us, 99%% %.1f us, max %.1f us\n",
+                received, latencies[0], total / received, latencies[received / 2],
+                latencies[(received * 99) / 100], latencies[received - 1]);
+    }
+
+    SDL_free(latencies);
+    SDL_free(push_times);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
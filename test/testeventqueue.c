@@ -0,0 +1,177 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Hammers SDL's event queue with SDL_PushEvent() from several threads at
+   once while the main thread drains it, like the FIFO test in testatomic.c,
+   and reports how many events per second got through. Every event is checked
+   off, so lost, duplicated or reordered events are reported too. */
+
+#include "SDL.h"
+
+#define DEFAULT_WRITERS 4
+#define DEFAULT_EVENTS_PER_WRITER 250000
+
+typedef struct
+{
+    int index;
+    int waits;
+    int next_expected;
+    SDL_bool out_of_order;
+    char padding[SDL_CACHELINE_SIZE - ((sizeof (int) * 3) + sizeof (SDL_bool)) % SDL_CACHELINE_SIZE];
+} WriterData;
+
+static int events_per_writer = DEFAULT_EVENTS_PER_WRITER;
+static Uint32 queue_event = 0;
+static SDL_sem *start_sem = NULL;
+static SDL_atomic_t writers_running;
+
+static int SDLCALL
+Writer(void *_data)
+{
+    WriterData *data = (WriterData *) _data;
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = queue_event;
+    event.user.data1 = data;
+
+    SDL_SemWait(start_sem);
+
+    for (i = 0; i < events_per_writer; ++i) {
+        event.user.code = i;
+        while (SDL_PushEvent(&event) <= 0) {
+            /* the queue is full, let the reader catch up */
+            ++data->waits;
+            SDL_Delay(0);
+        }
+    }
+
+    SDL_AtomicAdd(&writers_running, -1);
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    WriterData *writers;
+    SDL_Thread **threads;
+    int num_writers = DEFAULT_WRITERS;
+    int total, received = 0, reader_waits = 0;
+    Uint64 start, end;
+    SDL_bool failed = SDL_FALSE;
+    double elapsed;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_writers = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        events_per_writer = SDL_atoi(argv[2]);
+    }
+    if (num_writers <= 0 || events_per_writer <= 0) {
+        SDL_Log("USAGE: %s [writer threads] [events per writer]\n", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    queue_event = SDL_RegisterEvents(1);
+    writers = (WriterData *) SDL_calloc(num_writers, sizeof (WriterData));
+    threads = (SDL_Thread **) SDL_calloc(num_writers, sizeof (SDL_Thread *));
+    start_sem = SDL_CreateSemaphore(0);
+    if (queue_event == (Uint32) -1 || !writers || !threads || !start_sem) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up the test: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+
+    SDL_Log("Pushing %d events from each of %d threads\n", events_per_writer, num_writers);
+
+    SDL_AtomicSet(&writers_running, num_writers);
+    for (i = 0; i < num_writers; ++i) {
+        char name[64];
+        SDL_snprintf(name, sizeof (name), "EventWriter%d", i);
+        writers[i].index = i;
+        threads[i] = SDL_CreateThread(Writer, name, &writers[i]);
+        if (!threads[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s\n", SDL_GetError());
+            SDL_Quit();
+            return 1;
+        }
+    }
+
+    total = num_writers * events_per_writer;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_writers; ++i) {
+        SDL_SemPost(start_sem);
+    }
+
+    while (received < total) {
+        SDL_Event events[64];
+        const int count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, queue_event, queue_event);
+        if (count < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_PeepEvents failed: %s\n", SDL_GetError());
+            failed = SDL_TRUE;
+            break;
+        } else if (count == 0) {
+            if (SDL_AtomicGet(&writers_running) == 0 && !SDL_HasEvent(queue_event)) {
+                break;  /* nothing else is coming. */
+            }
+            ++reader_waits;
+            SDL_Delay(0);
+            continue;
+        }
+        for (i = 0; i < count; ++i) {
+            WriterData *writer = (WriterData *) events[i].user.data1;
+            if (events[i].user.code != writer->next_expected) {
+                writer->out_of_order = SDL_TRUE;
+            }
+            writer->next_expected = events[i].user.code + 1;
+        }
+        received += count;
+    }
+    end = SDL_GetPerformanceCounter();
+
+    for (i = 0; i < num_writers; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    elapsed = ((double) (end - start)) / ((double) SDL_GetPerformanceFrequency());
+    SDL_Log("Received %d of %d events in %f sec: %.0f events/sec, reader waited %d times\n",
+            received, total, elapsed, ((double) received) / elapsed, reader_waits);
+    for (i = 0; i < num_writers; ++i) {
+        SDL_Log("Writer %d had %d waits%s\n", i, writers[i].waits,
+                writers[i].out_of_order ? ", EVENTS OUT OF ORDER" : "");
+        if (writers[i].out_of_order) {
+            failed = SDL_TRUE;
+        }
+    }
+    if (received != total) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Lost %d events!\n", total - received);
+        failed = SDL_TRUE;
+    }
+
+    SDL_DestroySemaphore(start_sem);
+    SDL_free(threads);
+    SDL_free(writers);
+    SDL_Quit();
+    return failed ? 2 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -25,6 +25,74 @@ widelen(char *data)
     return len;
 }
 
+static size_t
+unitlen(const char *data, size_t unit)
+{
+    size_t len = 0;
+    while (SDL_memcmp(data + len, "\0\0\0\0", unit) != 0) {
+        len += unit;
+    }
+    return len;
+}
+
+static int
+benchmark(const char *text, size_t len)
+{
+    const struct
+    {
+        const char *name;
+        size_t unit;
+        SDL_bool lossless;
+    } formats[] = {
+        { "ASCII", 1, SDL_FALSE },
+        { "ISO-8859-1", 1, SDL_FALSE },
+        { "UTF-8", 1, SDL_TRUE },
+        { "UTF-16LE", 2, SDL_TRUE },
+        { "UTF-16BE", 2, SDL_TRUE },
+        { "UTF-32LE", 4, SDL_TRUE },
+        { "UTF-32BE", 4, SDL_TRUE },
+    };
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    int i, errors = 0;
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        Uint64 start, to_elapsed = 0, from_elapsed = 0;
+        char *converted = NULL;
+        size_t convertedlen;
+        char *text_again = NULL;
+        int count = 0;
+
+        /* Convert the text back and forth for about half a second */
+        while ((to_elapsed + from_elapsed) < (frequency / 2)) {
+            SDL_free(converted);
+            SDL_free(text_again);
+            start = SDL_GetPerformanceCounter();
+            converted = SDL_iconv_string(formats[i].name, "UTF-8", text, len + 1);
+            to_elapsed += SDL_GetPerformanceCounter() - start;
+            if (!converted) {
+                text_again = NULL;
+                break;
+            }
+            convertedlen = unitlen(converted, formats[i].unit) + formats[i].unit;
+            start = SDL_GetPerformanceCounter();
+            text_again = SDL_iconv_string("UTF-8", formats[i].name, converted, convertedlen);
+            from_elapsed += SDL_GetPerformanceCounter() - start;
+            ++count;
+        }
+        if (!text_again || (formats[i].lossless && SDL_strcmp(text_again, text) != 0)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "FAIL: all text through %s\n", formats[i].name);
+            ++errors;
+        } else {
+            SDL_Log("UTF-8 to %s: %.1f MB/s, back: %.1f MB/s\n", formats[i].name,
+                    ((double) len * count / (1024 * 1024)) / ((double) to_elapsed / frequency),
+                    ((double) len * count / (1024 * 1024)) / ((double) from_elapsed / frequency));
+        }
+        SDL_free(converted);
+        SDL_free(text_again);
+    }
+    return errors;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -45,6 +113,8 @@ main(int argc, char *argv[])
     char buffer[BUFSIZ];
     char *ucs4;
     char *test[2];
+    char *text = NULL;
+    size_t textlen = 0;
     int i;
     FILE *file;
     int errors = 0;
@@ -81,8 +151,21 @@ main(int argc, char *argv[])
         test[0] = SDL_iconv_string("UTF-8", "UCS-4", ucs4, len);
         SDL_free(ucs4);
         fputs(test[0], stdout);
+
+        /* Collect the valid UTF-8 for timing */
+        len = SDL_strlen(test[0]);
+        text = (char *) SDL_realloc(text, textlen + len + 1);
+        if (text) {
+            SDL_memcpy(text + textlen, test[0], len + 1);
+            textlen += len;
+        }
         SDL_free(test[0]);
     }
     fclose(file);
+
+    if (text) {
+        errors += benchmark(text, textlen);
+        SDL_free(text);
+    }
     return (errors ? errors + 1 : 0);
 }
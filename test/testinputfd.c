@@ -0,0 +1,241 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test SDL_LinuxGetInputFD() with virtual uinput joysticks.
+
+   This needs write access to /dev/uinput.  Use --devices N to add N idle
+   joysticks and time how long updating them takes when nothing happens.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SDL.h"
+
+#if defined(__LINUX__) && !defined(SDL_JOYSTICK_DISABLED)
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/uinput.h>
+
+#define MAX_DEVICES 64
+
+static int
+CreateVirtualJoystick(const char *name)
+{
+    struct uinput_user_dev dev;
+    int fd;
+
+    fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK);
+    if (fd < 0) {
+        return -1;
+    }
+
+    ioctl(fd, UI_SET_EVBIT, EV_KEY);
+    ioctl(fd, UI_SET_EVBIT, EV_ABS);
+    ioctl(fd, UI_SET_EVBIT, EV_SYN);
+    ioctl(fd, UI_SET_KEYBIT, BTN_A);
+    ioctl(fd, UI_SET_KEYBIT, BTN_B);
+    ioctl(fd, UI_SET_ABSBIT, ABS_X);
+    ioctl(fd, UI_SET_ABSBIT, ABS_Y);
+
+    SDL_zero(dev);
+    SDL_strlcpy(dev.name, name, sizeof (dev.name));
+    dev.id.bustype = BUS_VIRTUAL;
+    dev.id.vendor = 0x1234;
+    dev.id.product = 0x5678;
+    dev.id.version = 1;
+    dev.absmin[ABS_X] = dev.absmin[ABS_Y] = -32768;
+    dev.absmax[ABS_X] = dev.absmax[ABS_Y] = 32767;
+
+    if (write(fd, &dev, sizeof (dev)) != sizeof (dev) ||
+        ioctl(fd, UI_DEV_CREATE) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void
+DestroyVirtualJoystick(int fd)
+{
+    ioctl(fd, UI_DEV_DESTROY);
+    close(fd);
+}
+
+static void
+Emit(int fd, int type, int code, int value)
+{
+    struct input_event event;
+
+    SDL_zero(event);
+    event.type = type;
+    event.code = code;
+    event.value = value;
+    if (write(fd, &event, sizeof (event)) != sizeof (event)) {
+        SDL_Log("Couldn't write to uinput device\n");
+    }
+}
+
+static SDL_bool
+IsReadable(int fd, int timeout)
+{
+    struct pollfd pfd;
+
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return (poll(&pfd, 1, timeout) > 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int uinput[MAX_DEVICES];
+    SDL_Joystick *joysticks[MAX_DEVICES];
+    int numdevices = 1;
+    int numjoysticks = 0;
+    SDL_Joystick *joystick = NULL;
+    int failures = 0;
+    int i, fd;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--devices") == 0 && argv[i + 1]) {
+            numdevices = 1 + SDL_atoi(argv[++i]);
+            numdevices = SDL_min(SDL_max(numdevices, 1), MAX_DEVICES);
+        } else {
+            SDL_Log("Usage: %s [--devices N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    for (i = 0; i < numdevices; ++i) {
+        char name[64];
+        SDL_snprintf(name, sizeof (name), "SDL virtual joystick %d", i);
+        uinput[i] = CreateVirtualJoystick(name);
+        if (uinput[i] < 0) {
+            SDL_Log("Couldn't create a uinput device, skipping the test\n");
+            while (i--) {
+                DestroyVirtualJoystick(uinput[i]);
+            }
+            return 0;
+        }
+    }
+
+    /* Give the kernel a moment to create the device nodes */
+    SDL_Delay(500);
+
+    if (SDL_Init(SDL_INIT_JOYSTICK) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < SDL_NumJoysticks() && numjoysticks < MAX_DEVICES; ++i) {
+        const char *name = SDL_JoystickNameForIndex(i);
+        if (name && SDL_strncmp(name, "SDL virtual joystick", 20) == 0) {
+            joysticks[numjoysticks] = SDL_JoystickOpen(i);
+            if (SDL_strcmp(name, "SDL virtual joystick 0") == 0) {
+                joystick = joysticks[numjoysticks];
+            }
+            ++numjoysticks;
+        }
+    }
+    if (!joystick) {
+        SDL_Log("The virtual joystick didn't show up, skipping the test\n");
+        goto done;
+    }
+
+    fd = SDL_LinuxGetInputFD();
+    if (fd < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_LinuxGetInputFD() failed: %s\n", SDL_GetError());
+        ++failures;
+        goto done;
+    }
+
+    /* Read anything the devices sent when they were opened */
+    SDL_JoystickUpdate();
+    if (IsReadable(fd, 0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Input fd is readable with no input\n");
+        ++failures;
+    }
+
+    Emit(uinput[0], EV_KEY, BTN_A, 1);
+    Emit(uinput[0], EV_SYN, SYN_REPORT, 0);
+    if (!IsReadable(fd, 1000)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Input fd didn't wake up for a button press\n");
+        ++failures;
+    }
+    SDL_JoystickUpdate();
+    if (!SDL_JoystickGetButton(joystick, 0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Button press wasn't read\n");
+        ++failures;
+    }
+    if (IsReadable(fd, 0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Input fd is still readable after updating\n");
+        ++failures;
+    }
+
+    Emit(uinput[0], EV_ABS, ABS_X, 12345);
+    Emit(uinput[0], EV_SYN, SYN_REPORT, 0);
+    if (!IsReadable(fd, 1000)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Input fd didn't wake up for axis motion\n");
+        ++failures;
+    }
+    SDL_JoystickUpdate();
+    if (SDL_JoystickGetAxis(joystick, 0) == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Axis motion wasn't read\n");
+        ++failures;
+    }
+
+    if (numjoysticks > 1) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        const int iterations = 10000;
+        double elapsed;
+
+        for (i = 0; i < iterations; ++i) {
+            SDL_JoystickUpdate();
+        }
+        elapsed = (double) (SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+        SDL_Log("Idle update of %d joysticks: %.2f us\n", numjoysticks, (elapsed * 1000000.0) / iterations);
+    }
+
+    SDL_Log("%s\n", failures ? "FAILED" : "PASSED");
+
+done:
+    for (i = 0; i < numjoysticks; ++i) {
+        SDL_JoystickClose(joysticks[i]);
+    }
+    SDL_Quit();
+    for (i = 0; i < numdevices; ++i) {
+        DestroyVirtualJoystick(uinput[i]);
+    }
+    return failures ? 1 : 0;
+}
+
+#else
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Log("This test needs Linux with joystick support.\n");
+    return 0;
+}
+
+#endif
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,245 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measure joystick input latency with a virtual uinput joystick.
+
+   This needs write access to /dev/uinput.  Each button press is timed from
+   the write to uinput, both to the timestamp SDL_PeepEventsTimestamps()
+   reports and to when the event comes out of the queue.
+
+   --thread   reads input on SDL's input thread (SDL_HINT_LINUX_INPUT_THREAD)
+   --frame MS pumps events only every MS milliseconds, like a busy game loop
+   --count N  measures N presses
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SDL.h"
+
+#if defined(__LINUX__) && !defined(SDL_JOYSTICK_DISABLED)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/uinput.h>
+
+static int
+CreateVirtualJoystick(const char *name)
+{
+    struct uinput_user_dev dev;
+    int fd;
+
+    fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK);
+    if (fd < 0) {
+        return -1;
+    }
+
+    ioctl(fd, UI_SET_EVBIT, EV_KEY);
+    ioctl(fd, UI_SET_EVBIT, EV_ABS);
+    ioctl(fd, UI_SET_EVBIT, EV_SYN);
+    ioctl(fd, UI_SET_KEYBIT, BTN_A);
+    ioctl(fd, UI_SET_KEYBIT, BTN_B);
+    ioctl(fd, UI_SET_ABSBIT, ABS_X);
+    ioctl(fd, UI_SET_ABSBIT, ABS_Y);
+
+    SDL_zero(dev);
+    SDL_strlcpy(dev.name, name, sizeof (dev.name));
+    dev.id.bustype = BUS_VIRTUAL;
+    dev.id.vendor = 0x1234;
+    dev.id.product = 0x5678;
+    dev.id.version = 1;
+    dev.absmin[ABS_X] = dev.absmin[ABS_Y] = -32768;
+    dev.absmax[ABS_X] = dev.absmax[ABS_Y] = 32767;
+
+    if (write(fd, &dev, sizeof (dev)) != sizeof (dev) ||
+        ioctl(fd, UI_DEV_CREATE) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void
+DestroyVirtualJoystick(int fd)
+{
+    ioctl(fd, UI_DEV_DESTROY);
+    close(fd);
+}
+
+static void
+Emit(int fd, int type, int code, int value)
+{
+    struct input_event event;
+
+    SDL_zero(event);
+    event.type = type;
+    event.code = code;
+    event.value = value;
+    if (write(fd, &event, sizeof (event)) != sizeof (event)) {
+        SDL_Log("Couldn't write to uinput device\n");
+    }
+}
+
+typedef struct
+{
+    Uint64 total;
+    Uint64 max;
+} Stats;
+
+static void
+AddSample(Stats *stats, Uint64 ns)
+{
+    stats->total += ns;
+    if (ns > stats->max) {
+        stats->max = ns;
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Joystick *joystick = NULL;
+    Stats stamp_stats, delivery_stats;
+    int frame_ms = 0;
+    int count = 100;
+    int failures = 0;
+    int uinput;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--thread") == 0) {
+            SDL_SetHint(SDL_HINT_LINUX_INPUT_THREAD, "1");
+        } else if (SDL_strcmp(argv[i], "--frame") == 0 && argv[i + 1]) {
+            frame_ms = SDL_atoi(argv[++i]);
+            frame_ms = SDL_max(frame_ms, 0);
+        } else if (SDL_strcmp(argv[i], "--count") == 0 && argv[i + 1]) {
+            count = SDL_atoi(argv[++i]);
+            count = SDL_max(count, 1);
+        } else {
+            SDL_Log("Usage: %s [--thread] [--frame MS] [--count N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    SDL_SetHint(SDL_HINT_EVENT_TIMESTAMPS_NS, "1");
+
+    uinput = CreateVirtualJoystick("SDL latency joystick");
+    if (uinput < 0) {
+        SDL_Log("Couldn't create a uinput device, skipping the test\n");
+        return 0;
+    }
+
+    /* Give the kernel a moment to create the device node */
+    SDL_Delay(500);
+
+    if (SDL_Init(SDL_INIT_JOYSTICK) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        DestroyVirtualJoystick(uinput);
+        return 1;
+    }
+
+    for (i = 0; i < SDL_NumJoysticks(); ++i) {
+        const char *name = SDL_JoystickNameForIndex(i);
+        if (name && SDL_strcmp(name, "SDL latency joystick") == 0) {
+            joystick = SDL_JoystickOpen(i);
+            break;
+        }
+    }
+    if (!joystick) {
+        SDL_Log("The virtual joystick didn't show up, skipping the test\n");
+        goto done;
+    }
+
+    /* Let the open settle and throw away whatever it queued */
+    SDL_JoystickUpdate();
+    SDL_Delay(100);
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    SDL_zero(stamp_stats);
+    SDL_zero(delivery_stats);
+    for (i = 0; i < count; ++i) {
+        const Uint8 state = (i % 2) ? SDL_RELEASED : SDL_PRESSED;
+        Uint64 written, delivered, stamped;
+        SDL_Event event;
+        SDL_bool found = SDL_FALSE;
+
+        written = SDL_GetTicksNS();
+        Emit(uinput, EV_KEY, BTN_A, state);
+        Emit(uinput, EV_SYN, SYN_REPORT, 0);
+
+        if (frame_ms) {
+            SDL_Delay(frame_ms);
+        }
+        while (!found && SDL_WaitEventTimeout(NULL, 1000) &&
+               SDL_PeepEventsTimestamps(&event, &stamped, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) == 1) {
+            if ((event.type == SDL_JOYBUTTONDOWN || event.type == SDL_JOYBUTTONUP) &&
+                event.jbutton.state == state) {
+                found = SDL_TRUE;
+            }
+        }
+        delivered = SDL_GetTicksNS();
+
+        if (!found) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Button event %d never arrived\n", i);
+            ++failures;
+            break;
+        }
+
+        /* Allow a millisecond for the kernel and SDL clocks to disagree */
+        if (stamped + 1000000 < written || stamped > delivered) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Button event %d timestamp %" SDL_PRIu64 " isn't between %" SDL_PRIu64 " and %" SDL_PRIu64 "\n",
+                         i, stamped, written, delivered);
+            ++failures;
+        }
+        AddSample(&stamp_stats, (stamped > written) ? (stamped - written) : 0);
+        AddSample(&delivery_stats, delivered - written);
+    }
+
+    if (i == count) {
+        SDL_Log("Input %s, pumping every %d ms, %d presses\n",
+                SDL_GetHintBoolean(SDL_HINT_LINUX_INPUT_THREAD, SDL_FALSE) ? "thread" : "read when pumping",
+                frame_ms, count);
+        SDL_Log("  write to timestamp: %.1f us average, %.1f us max\n",
+                (double) stamp_stats.total / count / 1000.0, (double) stamp_stats.max / 1000.0);
+        SDL_Log("  write to delivery:  %.1f us average, %.1f us max\n",
+                (double) delivery_stats.total / count / 1000.0, (double) delivery_stats.max / 1000.0);
+    }
+
+    SDL_Log("%s\n", failures ? "FAILED" : "PASSED");
+
+done:
+    if (joystick) {
+        SDL_JoystickClose(joystick);
+    }
+    SDL_Quit();
+    DestroyVirtualJoystick(uinput);
+    return failures ? 1 : 0;
+}
+
+#else
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Log("This test needs Linux with joystick support.\n");
+    return 0;
+}
+
+#endif
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,200 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Time getting BMP files into a texture with SDL_LoadBMP_RW() and a
+   conversion, and with SDL_LoadBMPFormat_RW() in the texture format.
+   Without files, large 8-bit and 24-bit images are made up in memory.
+   Usage: testloadbmp [--iterations N] [file ...] */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    const char *name;
+    void *data;
+    size_t size;
+} Image;
+
+static SDL_RWops *
+OpenImage(const Image *image)
+{
+    if (image->data) {
+        return SDL_RWFromConstMem(image->data, (int) image->size);
+    }
+    return SDL_RWFromFile(image->name, "rb");
+}
+
+static SDL_bool
+MakeImage(Image *image, const char *name, int w, int h, Uint32 format)
+{
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, format);
+    SDL_RWops *dst;
+    Uint8 *pixels;
+    int x, y;
+
+    if (!surface) {
+        return SDL_FALSE;
+    }
+    if (surface->format->palette) {
+        SDL_Color colors[256];
+        for (x = 0; x < SDL_arraysize(colors); ++x) {
+            colors[x].r = (Uint8) x;
+            colors[x].g = (Uint8) (x * 3);
+            colors[x].b = (Uint8) (255 - x);
+            colors[x].a = SDL_ALPHA_OPAQUE;
+        }
+        SDL_SetPaletteColors(surface->format->palette, colors, 0, SDL_arraysize(colors));
+    }
+    for (y = 0; y < h; ++y) {
+        pixels = (Uint8 *) surface->pixels + y * surface->pitch;
+        for (x = 0; x < w * surface->format->BytesPerPixel; ++x) {
+            pixels[x] = (Uint8) (x ^ y);
+        }
+    }
+
+    image->name = name;
+    image->size = 2048 + (size_t) surface->pitch * h;
+    image->data = SDL_malloc(image->size);
+    dst = image->data ? SDL_RWFromMem(image->data, (int) image->size) : NULL;
+    if (!dst || SDL_SaveBMP_RW(surface, dst, 0) < 0) {
+        if (dst) {
+            SDL_RWclose(dst);
+        }
+        SDL_free(image->data);
+        image->data = NULL;
+        SDL_FreeSurface(surface);
+        return SDL_FALSE;
+    }
+    image->size = (size_t) SDL_RWtell(dst);
+    SDL_RWclose(dst);
+    SDL_FreeSurface(surface);
+    return SDL_TRUE;
+}
+
+static double
+TimeLoad(SDL_Renderer *renderer, Uint32 format, const Image *image, int iterations, SDL_bool direct)
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+        SDL_Surface *surface;
+        SDL_Texture *texture;
+
+        if (direct) {
+            surface = SDL_LoadBMPFormat_RW(OpenImage(image), 1, format);
+        } else {
+            SDL_Surface *loaded = SDL_LoadBMP_RW(OpenImage(image), 1);
+            surface = loaded ? SDL_ConvertSurfaceFormat(loaded, format, 0) : NULL;
+            SDL_FreeSurface(loaded);
+        }
+        if (!surface) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load %s: %s\n", image->name, SDL_GetError());
+            return -1.0;
+        }
+        texture = SDL_CreateTextureFromSurface(renderer, surface);
+        SDL_FreeSurface(surface);
+        if (!texture) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture: %s\n", SDL_GetError());
+            return -1.0;
+        }
+        SDL_DestroyTexture(texture);
+    }
+    return (double) (SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+}
+
+int
+main(int argc, char *argv[])
+{
+    Image images[16];
+    int numimages = 0;
+    int iterations = 20;
+    SDL_Surface *target;
+    SDL_Renderer *renderer;
+    SDL_RendererInfo info;
+    Uint32 format;
+    int i, failed = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 2 && SDL_strcmp(argv[1], "--iterations") == 0) {
+        iterations = SDL_atoi(argv[2]);
+        argc -= 2;
+        argv += 2;
+    }
+    if (iterations <= 0) {
+        iterations = 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    for (i = 1; i < argc && numimages < SDL_arraysize(images); ++i) {
+        images[numimages].name = argv[i];
+        images[numimages].data = NULL;
+        images[numimages].size = 0;
+        ++numimages;
+    }
+    if (numimages == 0) {
+        if (!MakeImage(&images[numimages++], "4096x2048 8-bit", 4096, 2048, SDL_PIXELFORMAT_INDEX8) ||
+            !MakeImage(&images[numimages++], "4096x2048 24-bit", 4096, 2048, SDL_PIXELFORMAT_BGR24)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't make test images: %s\n", SDL_GetError());
+            SDL_Quit();
+            return (1);
+        }
+    }
+
+    /* Textures are made in the first format the renderer lists */
+    target = SDL_CreateRGBSurfaceWithFormat(0, 64, 64, 32, SDL_PIXELFORMAT_ARGB8888);
+    renderer = target ? SDL_CreateSoftwareRenderer(target) : NULL;
+    if (!renderer || SDL_GetRendererInfo(renderer, &info) < 0 || info.num_texture_formats == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create renderer: %s\n", SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+    format = info.texture_formats[0];
+    SDL_Log("Loading into %s textures, %d iterations\n", SDL_GetPixelFormatName(format), iterations);
+
+    for (i = 0; i < numimages; ++i) {
+        double convert_time, direct_time;
+
+        /* Warm up the page cache and the allocator */
+        if (TimeLoad(renderer, format, &images[i], 1, SDL_TRUE) < 0.0) {
+            failed = 1;
+            continue;
+        }
+        convert_time = TimeLoad(renderer, format, &images[i], iterations, SDL_FALSE);
+        direct_time = TimeLoad(renderer, format, &images[i], iterations, SDL_TRUE);
+        if (convert_time < 0.0 || direct_time < 0.0) {
+            failed = 1;
+            continue;
+        }
+        SDL_Log("%s: load and convert %.2f ms, load in format %.2f ms\n", images[i].name,
+                (convert_time * 1000.0) / iterations, (direct_time * 1000.0) / iterations);
+    }
+
+    for (i = 0; i < numimages; ++i) {
+        SDL_free(images[i].data);
+    }
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(target);
+    SDL_Quit();
+    return (failed);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
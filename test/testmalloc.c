@@ -0,0 +1,150 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Compare the default allocator with the thread-caching one on several threads */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define NUMTHREADS 8
+#define NUMSLOTS 256
+#define ITERATIONS 1000000
+
+typedef struct
+{
+    SDL_malloc_func malloc_func;
+    SDL_free_func free_func;
+    Uint32 seed;
+} ThreadData;
+
+static SDL_atomic_t start_threads;
+
+static Uint32
+NextRandom(Uint32 *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 8;
+}
+
+int SDLCALL
+ThreadFunc(void *data)
+{
+    ThreadData *thread = (ThreadData *) data;
+    void *slots[NUMSLOTS];
+    int i;
+
+    SDL_zero(slots);
+    while (!SDL_AtomicGet(&start_threads)) {
+        ;                       /* do nothing */
+    }
+
+    /* Mostly small blocks, with the odd one too big to cache */
+    for (i = 0; i < ITERATIONS; i++) {
+        const Uint32 r = NextRandom(&thread->seed);
+        const int slot = (int) (r % NUMSLOTS);
+        const size_t size = ((r >> 8) & 31) ? (size_t) ((r >> 13) % 512) + 1 : 4096;
+
+        if (slots[slot]) {
+            thread->free_func(slots[slot]);
+            slots[slot] = NULL;
+        } else {
+            slots[slot] = thread->malloc_func(size);
+            if (!slots[slot]) {
+                return -1;
+            }
+            SDL_memset(slots[slot], i, size);
+        }
+    }
+
+    for (i = 0; i < NUMSLOTS; i++) {
+        thread->free_func(slots[i]);
+    }
+    return 0;
+}
+
+static double
+RunBenchmark(const char *name, SDL_malloc_func malloc_func, SDL_free_func free_func)
+{
+    SDL_Thread *threads[NUMTHREADS];
+    ThreadData data[NUMTHREADS];
+    Uint64 start, end;
+    double seconds;
+    int i, status;
+
+    SDL_AtomicSet(&start_threads, 0);
+    for (i = 0; i < NUMTHREADS; i++) {
+        data[i].malloc_func = malloc_func;
+        data[i].free_func = free_func;
+        data[i].seed = (Uint32) i + 1;
+        threads[i] = SDL_CreateThread(ThreadFunc, "malloc", &data[i]);
+        if (threads[i] == NULL) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s\n", SDL_GetError());
+            return -1.0;
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    SDL_AtomicSet(&start_threads, 1);
+    for (i = 0; i < NUMTHREADS; i++) {
+        SDL_WaitThread(threads[i], &status);
+        if (status != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: allocation failed\n", name);
+        }
+    }
+    end = SDL_GetPerformanceCounter();
+
+    seconds = (double) (end - start) / SDL_GetPerformanceFrequency();
+    SDL_Log("%s: %d threads x %d operations in %.3f seconds\n", name, NUMTHREADS, ITERATIONS, seconds);
+    return seconds;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_malloc_func malloc_func;
+    SDL_free_func free_func;
+    SDL_MemorySizeClassStats stats[32];
+    int i, numstats;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Load the SDL library */
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    /* Both sets of functions are called directly, since SDL already has
+       allocations from its default ones and they can't be swapped now. */
+    SDL_GetMemoryFunctions(&malloc_func, NULL, NULL, &free_func);
+    RunBenchmark("default allocator", malloc_func, free_func);
+
+    if (SDL_GetThreadCachedMemoryFunctions(&malloc_func, NULL, NULL, &free_func) < 0) {
+        SDL_Log("Thread-caching allocator not available: %s\n", SDL_GetError());
+        SDL_Quit();
+        return (0);
+    }
+    RunBenchmark("thread-caching allocator", malloc_func, free_func);
+
+    numstats = SDL_GetMemorySizeClassStats(stats, SDL_arraysize(stats));
+    for (i = 0; i < numstats && i < (int) SDL_arraysize(stats); i++) {
+        SDL_Log("%5u bytes: %10" SDL_PRIu64 " allocations, %10" SDL_PRIu64 " frees, %10" SDL_PRIu64 " cache hits, %8" SDL_PRIu64 " from the heap\n",
+                (unsigned int) stats[i].size, stats[i].allocations, stats[i].frees,
+                stats[i].cache_hits, stats[i].heap_allocations);
+    }
+
+    SDL_Quit();
+    return (0);
+}
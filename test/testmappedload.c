@@ -0,0 +1,122 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Compare loading BMP and WAV files through stdio and memory-mapped streams.
+   Usage: testmappedload [--iterations N] [file ...] */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static int
+LoadOne(SDL_RWops *src, const char *file)
+{
+    const char *ext = SDL_strrchr(file, '.');
+
+    if (!src) {
+        return -1;
+    }
+
+    if (ext && SDL_strcasecmp(ext, ".bmp") == 0) {
+        SDL_Surface *surface = SDL_LoadBMP_RW(src, 1);
+        if (!surface) {
+            return -1;
+        }
+        SDL_FreeSurface(surface);
+    } else if (ext && SDL_strcasecmp(ext, ".wav") == 0) {
+        SDL_AudioSpec spec;
+        Uint8 *buf;
+        Uint32 len;
+        if (!SDL_LoadWAV_RW(src, 1, &spec, &buf, &len)) {
+            return -1;
+        }
+        SDL_FreeWAV(buf);
+    } else {
+        void *data = SDL_LoadFile_RW(src, NULL, 1);
+        if (!data) {
+            return -1;
+        }
+        SDL_free(data);
+    }
+    return 0;
+}
+
+static double
+LoadAll(SDL_bool mapped, char **files, int numfiles, int iterations)
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+    int i, j;
+
+    for (i = 0; i < iterations; i++) {
+        for (j = 0; j < numfiles; j++) {
+            SDL_RWops *src = mapped ? SDL_RWFromFileMapped(files[j]) : SDL_RWFromFile(files[j], "rb");
+            if (LoadOne(src, files[j]) < 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load %s: %s\n", files[j], SDL_GetError());
+                return -1.0;
+            }
+        }
+    }
+    return (double) (SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+}
+
+int
+main(int argc, char *argv[])
+{
+    static char *default_files[] = { "sample.bmp", "sample.wav" };
+    char **files = default_files;
+    int numfiles = SDL_arraysize(default_files);
+    int iterations = 100;
+    double stdio_time, mapped_time;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 2 && SDL_strcmp(argv[1], "--iterations") == 0) {
+        iterations = SDL_atoi(argv[2]);
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc > 1) {
+        files = argv + 1;
+        numfiles = argc - 1;
+    }
+    if (iterations <= 0) {
+        iterations = 1;
+    }
+
+    /* Load the SDL library */
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    /* Warm the page cache so both runs start from the same state */
+    if (LoadAll(SDL_FALSE, files, numfiles, 1) < 0) {
+        SDL_Quit();
+        return (1);
+    }
+
+    stdio_time = LoadAll(SDL_FALSE, files, numfiles, iterations);
+    mapped_time = LoadAll(SDL_TRUE, files, numfiles, iterations);
+    if (stdio_time < 0.0 || mapped_time < 0.0) {
+        SDL_Quit();
+        return (1);
+    }
+
+    SDL_Log("%d files x %d iterations\n", numfiles, iterations);
+    SDL_Log("stdio:  %.3f seconds\n", stdio_time);
+    SDL_Log("mapped: %.3f seconds\n", mapped_time);
+
+    SDL_Quit();
+    return (0);
+}
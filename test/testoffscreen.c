@@ -0,0 +1,403 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test the offscreen video driver with a reader in another process.
+
+   The window is drawn with the window surface API, resized, then drawn
+   with the software renderer.  The reader gets the shared memory and the
+   eventfd by inheritance and checks every frame it manages to read.
+   Usage: testoffscreen [--frames N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+#include "SDL_syswm.h"
+
+#if defined(SDL_VIDEO_DRIVER_OFFSCREEN)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+/* Every fourth frame drawn with the window surface only updates a square */
+static SDL_bool
+IsPartialFrame(Uint32 sequence, Uint32 frames)
+{
+    return (sequence <= frames / 2 && (sequence % 4) == 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+static void
+GetPartialRect(Uint32 sequence, int w, int h, SDL_Rect *rect)
+{
+    rect->w = 16;
+    rect->h = 16;
+    rect->x = (int) (sequence * 7) % (w - rect->w);
+    rect->y = (int) (sequence * 5) % (h - rect->h);
+}
+
+static void
+GetFrameColor(Uint32 sequence, Uint8 *r, Uint8 *g, Uint8 *b)
+{
+    *r = (Uint8) sequence;
+    *g = (Uint8) (sequence >> 8);
+    *b = (Uint8) (0x80 + (sequence & 0x7F));
+}
+
+static Uint64
+GetMonotonicTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (Uint64) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+typedef struct
+{
+    int memfd;
+    SDL_OffscreenHeader *header;
+    size_t size;
+} Reader;
+
+static SDL_bool
+MapSharedMemory(Reader *reader)
+{
+    struct stat st;
+    void *header;
+
+    if (fstat(reader->memfd, &st) < 0) {
+        return SDL_FALSE;
+    }
+    if ((size_t) st.st_size == reader->size) {
+        return SDL_TRUE;
+    }
+    header = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, reader->memfd, 0);
+    if (header == MAP_FAILED) {
+        return SDL_FALSE;
+    }
+    if (reader->header) {
+        munmap(reader->header, reader->size);
+    }
+    reader->header = (SDL_OffscreenHeader *) header;
+    reader->size = (size_t) st.st_size;
+    return SDL_TRUE;
+}
+
+/* Returns 1 if the frame was right, 0 if it was overwritten, -1 if it was wrong */
+static int
+CheckFrame(Reader *reader, Uint32 sequence, Uint32 frames, Uint64 *latency)
+{
+    const Uint32 slot = (sequence - 1) % reader->header->num_frames;
+    const SDL_OffscreenFrame *frame = &reader->header->frames[slot];
+    SDL_PixelFormat *format;
+    SDL_Rect partial;
+    Uint32 color, background;
+    Uint8 r, g, b;
+    Uint64 offset, timestamp;
+    int w, h, pitch, x, y;
+    int mismatches = 0;
+
+    if (frame->sequence != sequence) {
+        return 0;
+    }
+    SDL_MemoryBarrierAcquire();
+    offset = frame->offset;
+    timestamp = frame->timestamp;
+    w = frame->w;
+    h = frame->h;
+    pitch = frame->pitch;
+    format = SDL_AllocFormat(frame->format);
+    if (!format || format->BytesPerPixel != 4) {
+        SDL_FreeFormat(format);
+        return (frame->sequence == sequence) ? -1 : 0;
+    }
+    if (offset + (Uint64) h * pitch > reader->size) {
+        /* The window grew, the old mapping is gone after this */
+        if (!MapSharedMemory(reader)) {
+            SDL_FreeFormat(format);
+            return -1;
+        }
+        frame = &reader->header->frames[slot];
+    }
+    if (offset + (Uint64) h * pitch > reader->size) {
+        SDL_FreeFormat(format);
+        return (frame->sequence == sequence) ? -1 : 0;
+    }
+
+    GetFrameColor(sequence, &r, &g, &b);
+    color = SDL_MapRGB(format, r, g, b);
+    GetFrameColor(sequence - 1, &r, &g, &b);
+    background = SDL_MapRGB(format, r, g, b);
+    SDL_zero(partial);
+    if (IsPartialFrame(sequence, frames)) {
+        GetPartialRect(sequence, w, h, &partial);
+    }
+    SDL_FreeFormat(format);
+
+    for (y = 0; y < h; ++y) {
+        const Uint32 *row = (const Uint32 *) ((const Uint8 *) reader->header + offset + y * pitch);
+        for (x = 0; x < w; ++x) {
+            SDL_Point point;
+            Uint32 expected = color;
+
+            point.x = x;
+            point.y = y;
+            if (!SDL_RectEmpty(&partial) && !SDL_PointInRect(&point, &partial)) {
+                expected = background;
+            }
+            if ((row[x] & 0x00FFFFFF) != (expected & 0x00FFFFFF)) {
+                ++mismatches;
+            }
+        }
+    }
+
+    /* The frame may have been overwritten while it was checked */
+    SDL_MemoryBarrierAcquire();
+    if (frame->sequence != sequence) {
+        return 0;
+    }
+    *latency += GetMonotonicTime() - timestamp;
+    if (mismatches) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Frame %u: %d of %dx%d pixels are wrong\n",
+                     (unsigned int) sequence, mismatches, w, h);
+        return -1;
+    }
+    return 1;
+}
+
+static int
+RunReader(int memfd, int eventfd, Uint32 frames)
+{
+    Reader reader;
+    Uint32 last = 0, newest = 0, checked = 0, dropped = 0, failed = 0;
+    Uint64 latency = 0;
+
+    SDL_zero(reader);
+    reader.memfd = memfd;
+    if (!MapSharedMemory(&reader) || reader.header->magic != SDL_OFFSCREEN_MAGIC ||
+        reader.header->version != SDL_OFFSCREEN_VERSION) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reader: the shared memory isn't an offscreen window\n");
+        return 1;
+    }
+
+    while (last < frames) {
+        struct pollfd pfd;
+        Uint64 count;
+        Uint32 current, sequence;
+
+        pfd.fd = eventfd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (poll(&pfd, 1, 5000) <= 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reader: timed out after frame %u\n", (unsigned int) last);
+            return 1;
+        }
+        if (read(eventfd, &count, sizeof(count)) < 0 && errno != EAGAIN) {
+            return 1;
+        }
+
+        current = reader.header->sequence;
+        SDL_MemoryBarrierAcquire();
+        for (sequence = last + 1; sequence <= current; ++sequence) {
+            int result = 0;
+            if (current - sequence < reader.header->num_frames) {
+                result = CheckFrame(&reader, sequence, frames, &latency);
+            }
+            if (result > 0) {
+                newest = sequence;
+                ++checked;
+            } else if (result == 0) {
+                ++dropped;
+            } else {
+                ++failed;
+            }
+        }
+        if (current > last) {
+            last = current;
+        }
+    }
+
+    SDL_Log("Reader: %u frames checked, %u dropped, %u wrong, %.1f us average latency\n",
+            (unsigned int) checked, (unsigned int) dropped, (unsigned int) failed,
+            checked ? (double) latency / checked / 1000.0 : 0.0);
+    /* Nothing overwrites the last frame, it can't be missed */
+    if (newest != frames) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reader: the last frame wasn't read\n");
+        return 1;
+    }
+    return failed ? 1 : 0;
+}
+
+static pid_t
+StartReader(const char *program, int memfd, int eventfd, Uint32 frames)
+{
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        char memfd_arg[16], eventfd_arg[16], frames_arg[16];
+
+        /* The descriptors are close-on-exec, the reader has to keep them */
+        fcntl(memfd, F_SETFD, 0);
+        fcntl(eventfd, F_SETFD, 0);
+        SDL_snprintf(memfd_arg, sizeof(memfd_arg), "%d", memfd);
+        SDL_snprintf(eventfd_arg, sizeof(eventfd_arg), "%d", eventfd);
+        SDL_snprintf(frames_arg, sizeof(frames_arg), "%u", (unsigned int) frames);
+        execl(program, program, "--reader", memfd_arg, eventfd_arg, frames_arg, (char *) NULL);
+        _exit(127);
+    }
+    return pid;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Window *window;
+    SDL_Surface *surface;
+    SDL_Renderer *renderer = NULL;
+    SDL_SysWMinfo info;
+    Uint32 frames = 200;
+    Uint32 sequence;
+    Uint64 ticks = 0;
+    Uint8 r, g, b;
+    pid_t reader;
+    int status = 0;
+    int failed = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc == 5 && SDL_strcmp(argv[1], "--reader") == 0) {
+        return RunReader(SDL_atoi(argv[2]), SDL_atoi(argv[3]), (Uint32) SDL_atoi(argv[4]));
+    }
+    if (argc > 2 && SDL_strcmp(argv[1], "--frames") == 0) {
+        frames = (Uint32) SDL_atoi(argv[2]);
+    }
+    frames = SDL_max(frames, 8);
+
+    /* Like the dummy driver, it's only used when asked for by name */
+    SDL_setenv("SDL_VIDEODRIVER", "offscreen", 1);
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize the offscreen video driver: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    window = SDL_CreateWindow("testoffscreen", 0, 0, 320, 240, 0);
+    SDL_VERSION(&info.version);
+    if (!window || !SDL_GetWindowWMInfo(window, &info) || info.subsystem != SDL_SYSWM_OFFSCREEN) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create window: %s\n", SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+
+    reader = StartReader(argv[0], info.info.offscreen.memfd, info.info.offscreen.eventfd, frames);
+    if (reader < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't start the reader\n");
+        SDL_Quit();
+        return (1);
+    }
+
+    /* Draw the first half with the window surface */
+    surface = SDL_GetWindowSurface(window);
+    for (sequence = 1; surface && sequence <= frames / 2; ++sequence) {
+        Uint64 start;
+        int result;
+
+        if (sequence == ((frames / 4) | 1)) {
+            /* Grow the window, the shared memory has to grow as well */
+            SDL_SetWindowSize(window, 640, 480);
+            surface = SDL_GetWindowSurface(window);
+            if (!surface) {
+                break;
+            }
+        }
+
+        GetFrameColor(sequence, &r, &g, &b);
+        start = SDL_GetPerformanceCounter();
+        if (IsPartialFrame(sequence, frames)) {
+            SDL_Rect rect;
+            GetPartialRect(sequence, surface->w, surface->h, &rect);
+            SDL_FillRect(surface, &rect, SDL_MapRGB(surface->format, r, g, b));
+            result = SDL_UpdateWindowSurfaceRects(window, &rect, 1);
+        } else {
+            SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, r, g, b));
+            result = SDL_UpdateWindowSurface(window);
+        }
+        ticks += SDL_GetPerformanceCounter() - start;
+        if (result < 0) {
+            break;
+        }
+    }
+    if (sequence <= frames / 2) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't update the window surface: %s\n", SDL_GetError());
+        failed = 1;
+    }
+
+    /* Draw the second half with the software renderer */
+    if (!failed) {
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+        if (!renderer) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create renderer: %s\n", SDL_GetError());
+            failed = 1;
+        }
+    }
+    for (; !failed && sequence <= frames; ++sequence) {
+        Uint64 start;
+
+        GetFrameColor(sequence, &r, &g, &b);
+        start = SDL_GetPerformanceCounter();
+        SDL_SetRenderDrawColor(renderer, r, g, b, 0xFF);
+        SDL_RenderClear(renderer);
+        SDL_RenderPresent(renderer);
+        ticks += SDL_GetPerformanceCounter() - start;
+    }
+
+    if (!failed) {
+        SDL_Log("Presented %u frames, %.1f us per frame\n", (unsigned int) frames,
+                (double) ticks * 1000000.0 / SDL_GetPerformanceFrequency() / frames);
+    } else {
+        kill(reader, SIGTERM);
+    }
+    waitpid(reader, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        failed = 1;
+    }
+
+    if (renderer) {
+        SDL_DestroyRenderer(renderer);
+    }
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+
+    SDL_Log("%s\n", failed ? "FAILED" : "PASSED");
+    return (failed);
+}
+
+#else
+
+int
+main(int argc, char *argv[])
+{
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "This test needs the offscreen video driver.\n");
+    return 77;  /* the exit code automake test harnesses report as skipped, rather than passed */
+}
+
+#endif
+
+/* vi: set ts=4 sw=4 expandtab: */
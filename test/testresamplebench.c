@@ -0,0 +1,265 @@
+/*
+  Copyright (C) 1997-2018 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmarks SDL's resampler: reports output frames per second for a range
+   of rates and channel counts, and the signal-to-noise ratio of SDL's output
+   against a reference copy of the original (per-sample, double precision)
+   resampling loop and against the ideal, analytically resampled signal. */
+
+#include <math.h>
+
+#include "SDL.h"
+
+#define REFERENCE_ZERO_CROSSINGS 5
+#define REFERENCE_BITS_PER_SAMPLE 16
+#define REFERENCE_SAMPLES_PER_ZERO_CROSSING  (1 << ((REFERENCE_BITS_PER_SAMPLE / 2) + 1))
+#define REFERENCE_FILTER_SIZE ((REFERENCE_SAMPLES_PER_ZERO_CROSSING * REFERENCE_ZERO_CROSSINGS) + 1)
+
+static float reference_filter[REFERENCE_FILTER_SIZE];
+static float reference_filter_difference[REFERENCE_FILTER_SIZE];
+
+static double
+bessel(const double x)
+{
+    const double xdiv2 = x / 2.0;
+    double i0 = 1.0f;
+    double f = 1.0f;
+    int i = 1;
+
+    while (SDL_TRUE) {
+        const double diff = SDL_pow(xdiv2, i * 2) / SDL_pow(f, 2);
+        if (diff < 1.0e-21f) {
+            break;
+        }
+        i0 += diff;
+        i++;
+        f *= (double) i;
+    }
+
+    return i0;
+}
+
+static void
+build_reference_filter(void)
+{
+    const double beta = 0.1102 * (80.0 - 8.7);
+    const int tablelen = REFERENCE_FILTER_SIZE;
+    const int lenm1 = tablelen - 1;
+    const int lenm1div2 = lenm1 / 2;
+    float *table = reference_filter;
+    float *diffs = reference_filter_difference;
+    int i;
+
+    table[0] = 1.0f;
+    for (i = 1; i < tablelen; i++) {
+        const double kaiser = bessel(beta * SDL_sqrt(1.0 - SDL_pow(((i - lenm1) / 2.0) / lenm1div2, 2.0))) / bessel(beta);
+        table[tablelen - i] = (float) kaiser;
+    }
+
+    for (i = 1; i < tablelen; i++) {
+        const float x = (((float) i) / ((float) REFERENCE_SAMPLES_PER_ZERO_CROSSING)) * ((float) M_PI);
+        table[i] *= SDL_sinf(x) / x;
+        diffs[i - 1] = table[i] - table[i - 1];
+    }
+    diffs[lenm1] = 0.0f;
+}
+
+/* This is the resampler SDL used before the polyphase one, padding with silence like SDL_ConvertAudio does. */
+static int
+reference_resample(const int chans, const int inrate, const int outrate,
+                   const float *inbuf, const int inframes, float *outbuf)
+{
+    const double finrate = (double) inrate;
+    const double outtimeincr = 1.0 / ((float) outrate);
+    const double ratio = ((float) outrate) / ((float) inrate);
+    const int outframes = (int) (inframes * ratio);
+    float *dst = outbuf;
+    double outtime = 0.0;
+    int i, j, chan;
+
+    for (i = 0; i < outframes; i++) {
+        const int srcindex = (int) (outtime * inrate);
+        const double intime = ((double) srcindex) / finrate;
+        const double innexttime = ((double) (srcindex + 1)) / finrate;
+        const double interpolation1 = 1.0 - ((innexttime - outtime) / (innexttime - intime));
+        const int filterindex1 = (int) (interpolation1 * REFERENCE_SAMPLES_PER_ZERO_CROSSING);
+        const double interpolation2 = 1.0 - interpolation1;
+        const int filterindex2 = (int) (interpolation2 * REFERENCE_SAMPLES_PER_ZERO_CROSSING);
+
+        for (chan = 0; chan < chans; chan++) {
+            float outsample = 0.0f;
+
+            for (j = 0; (filterindex1 + (j * REFERENCE_SAMPLES_PER_ZERO_CROSSING)) < REFERENCE_FILTER_SIZE; j++) {
+                const int srcframe = srcindex - j;
+                const float insample = (srcframe < 0) ? 0.0f : inbuf[(srcframe * chans) + chan];
+                outsample += (float)(insample * (reference_filter[filterindex1 + (j * REFERENCE_SAMPLES_PER_ZERO_CROSSING)] + (interpolation1 * reference_filter_difference[filterindex1 + (j * REFERENCE_SAMPLES_PER_ZERO_CROSSING)])));
+            }
+
+            for (j = 0; (filterindex2 + (j * REFERENCE_SAMPLES_PER_ZERO_CROSSING)) < REFERENCE_FILTER_SIZE; j++) {
+                const int srcframe = srcindex + 1 + j;
+                const float insample = (srcframe >= inframes) ? 0.0f : inbuf[(srcframe * chans) + chan];
+                outsample += (float)(insample * (reference_filter[filterindex2 + (j * REFERENCE_SAMPLES_PER_ZERO_CROSSING)] + (interpolation2 * reference_filter_difference[filterindex2 + (j * REFERENCE_SAMPLES_PER_ZERO_CROSSING)])));
+            }
+            *(dst++) = outsample;
+        }
+
+        outtime += outtimeincr;
+    }
+
+    return outframes;
+}
+
+/* a few tones per channel, so each channel is different. */
+static float
+test_signal(const int chan, const double t)
+{
+    const double base = 220.0 * (chan + 1);
+    return (float) ((0.4 * SDL_sin(2.0 * M_PI * base * t)) +
+                    (0.2 * SDL_sin(2.0 * M_PI * base * 3.1 * t)) +
+                    (0.1 * SDL_sin(2.0 * M_PI * 5000.0 * t)));
+}
+
+static void
+generate_input(float *buf, const int chans, const int rate, const int frames)
+{
+    int i, chan;
+    for (i = 0; i < frames; i++) {
+        for (chan = 0; chan < chans; chan++) {
+            *(buf++) = test_signal(chan, ((double) i) / ((double) rate));
+        }
+    }
+}
+
+static double
+snr(const double signal, const double noise)
+{
+    return (noise > 0.0) ? (10.0 * SDL_log10(signal / noise)) : INFINITY;
+}
+
+static int
+run_benchmark(const int chans, const int inrate, const int outrate, const double seconds)
+{
+    const int inframes = inrate;  /* one second of audio per pass. */
+    const int inlen = inframes * chans * (int) sizeof (float);
+    float *input = (float *) SDL_malloc(inlen);
+    float *reference = NULL;
+    int refframes = 0;
+    SDL_AudioCVT cvt;
+    Uint64 start, now, outframes = 0;
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    const float *output;
+    double elapsed, signal = 0.0, noise = 0.0, idealsignal = 0.0, idealnoise = 0.0;
+    int passes = 0;
+    int i, chan, total;
+
+    if (SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, chans, inrate, AUDIO_F32SYS, chans, outrate) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_BuildAudioCVT failed: %s\n", SDL_GetError());
+        SDL_free(input);
+        return -1;
+    }
+
+    cvt.buf = (Uint8 *) SDL_malloc(inlen * cvt.len_mult);
+    reference = (float *) SDL_malloc(((Sint64) inlen * outrate / inrate) + (chans * sizeof (float)));
+    if (!input || !cvt.buf || !reference) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory.\n");
+        SDL_free(input);
+        SDL_free(cvt.buf);
+        SDL_free(reference);
+        return -1;
+    }
+
+    generate_input(input, chans, inrate, inframes);
+
+    start = SDL_GetPerformanceCounter();
+    do {
+        SDL_memcpy(cvt.buf, input, inlen);
+        cvt.len = inlen;
+        SDL_ConvertAudio(&cvt);
+        outframes += cvt.len_cvt / (chans * sizeof (float));
+        passes++;
+        now = SDL_GetPerformanceCounter();
+        elapsed = ((double) (now - start)) / ((double) freq);
+    } while (elapsed < seconds);
+
+    refframes = reference_resample(chans, inrate, outrate, input, inframes, reference);
+    output = (const float *) cvt.buf;
+    total = SDL_min(refframes, (int) (cvt.len_cvt / (chans * sizeof (float))));
+    for (i = 0; i < total * chans; i++) {
+        const double diff = output[i] - reference[i];
+        signal += reference[i] * reference[i];
+        noise += diff * diff;
+    }
+
+    /* compare against the test signal itself too, away from the silence padding at either end. */
+    for (i = total / 10; i < (total - (total / 10)); i++) {
+        for (chan = 0; chan < chans; chan++) {
+            const double ideal = test_signal(chan, ((double) i) / ((double) outrate));
+            const double diff = output[(i * chans) + chan] - ideal;
+            idealsignal += ideal * ideal;
+            idealnoise += diff * diff;
+        }
+    }
+
+    SDL_Log("%d -> %d Hz, %d channel%s: %12.0f frames/sec (%d passes), SNR %6.1f dB vs. reference, %6.1f dB vs. ideal\n",
+            inrate, outrate, chans, (chans == 1) ? " " : "s",
+            ((double) outframes) / elapsed, passes,
+            snr(signal, noise), snr(idealsignal, idealnoise));
+
+    SDL_free(input);
+    SDL_free(cvt.buf);
+    SDL_free(reference);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    static const int rates[][2] = {
+        { 44100, 48000 }, { 48000, 44100 }, { 22050, 48000 },
+        { 48000, 96000 }, { 96000, 48000 }, { 44100, 48001 }
+    };
+    static const int channels[] = { 1, 2, 4, 6, 8 };
+    double seconds = 0.25;
+    int i, j;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        seconds = SDL_atof(argv[1]);
+        if (seconds <= 0.0) {
+            SDL_Log("USAGE: %s [seconds per test]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(0) == -1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s\n", SDL_GetError());
+        return 2;
+    }
+
+    build_reference_filter();
+
+    for (i = 0; i < SDL_arraysize(rates); i++) {
+        for (j = 0; j < SDL_arraysize(channels); j++) {
+            if (run_benchmark(channels[j], rates[i][0], rates[i][1], seconds) < 0) {
+                SDL_Quit();
+                return 3;
+            }
+        }
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* end of testresamplebench.c ... */
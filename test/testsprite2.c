@@ -42,6 +42,9 @@ static SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
 /* -1: infinite random moves (default); >=0: enables N deterministic moves */
 static int iterations = -1;
 
+/* Quit after this many frames, for benchmarking (0 runs until closed) */
+static int max_frames = 0;
+
 int done;
 
 /* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
@@ -311,6 +314,17 @@ main(int argc, char *argv[])
                     if (iterations < -1) iterations = -1;
                     consumed = 2;
                 }
+            } else if (SDL_strcasecmp(argv[i], "--frames") == 0) {
+                if (argv[i + 1]) {
+                    max_frames = SDL_atoi(argv[i + 1]);
+                    consumed = 2;
+                }
+            } else if (SDL_strcasecmp(argv[i], "--threads") == 0) {
+                /* Benchmark the software renderer drawing on several threads */
+                if (argv[i + 1]) {
+                    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, argv[i + 1]);
+                    consumed = 2;
+                }
             } else if (SDL_strcasecmp(argv[i], "--cyclecolor") == 0) {
                 cycle_color = SDL_TRUE;
                 consumed = 1;
@@ -326,7 +340,7 @@ main(int argc, char *argv[])
             }
         }
         if (consumed < 0) {
-            SDL_Log("Usage: %s %s [--blend none|blend|add|mod] [--cyclecolor] [--cyclealpha] [--iterations N] [num_sprites] [icon.bmp]\n",
+            SDL_Log("Usage: %s %s [--blend none|blend|add|mod] [--cyclecolor] [--cyclealpha] [--iterations N] [--frames N] [--threads N] [num_sprites] [icon.bmp]\n",
                     argv[0], SDLTest_CommonUsage(state));
             quit(1);
         }
@@ -393,6 +407,9 @@ main(int argc, char *argv[])
     while (!done) {
         ++frames;
         loop();
+        if (max_frames > 0 && frames >= max_frames) {
+            done = 1;
+        }
     }
 #endif
 
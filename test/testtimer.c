@@ -20,6 +20,7 @@
 #include "SDL.h"
 
 #define DEFAULT_RESOLUTION  1
+#define BENCHMARK_TIMERS    100000
 
 static int ticks = 0;
 
@@ -37,6 +38,74 @@ callback(Uint32 interval, void *param)
     return interval;
 }
 
+static SDL_atomic_t benchmark_fired;
+
+static Uint32 SDLCALL
+benchmark_callback(Uint32 interval, void *param)
+{
+    SDL_AtomicAdd(&benchmark_fired, 1);
+    return 0;
+}
+
+static double
+elapsed_ms(Uint64 start)
+{
+    return (double)((SDL_GetPerformanceCounter() - start)*1000) / SDL_GetPerformanceFrequency();
+}
+
+static void
+timer_benchmark(void)
+{
+    SDL_TimerID *ids = (SDL_TimerID *) SDL_malloc(BENCHMARK_TIMERS * sizeof (SDL_TimerID));
+    int i, removed = 0;
+    Uint64 start;
+    double ms;
+
+    if (!ids) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return;
+    }
+
+    /* Lots of long timers (network timeouts, say) that get canceled before they fire */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < BENCHMARK_TIMERS; ++i) {
+        ids[i] = SDL_AddTimer(60 * 1000 + (rand() % (60 * 1000)), benchmark_callback, NULL);
+    }
+    ms = elapsed_ms(start);
+    SDL_Log("Adding %d timers took %f ms\n", BENCHMARK_TIMERS, ms);
+
+    /* Cancel them in random order */
+    for (i = BENCHMARK_TIMERS - 1; i > 0; --i) {
+        const int j = rand() % (i + 1);
+        const SDL_TimerID id = ids[i];
+        ids[i] = ids[j];
+        ids[j] = id;
+    }
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < BENCHMARK_TIMERS; ++i) {
+        if (SDL_RemoveTimer(ids[i])) {
+            ++removed;
+        }
+    }
+    ms = elapsed_ms(start);
+    SDL_Log("Removing %d timers took %f ms\n", removed, ms);
+
+    /* Lots of short one-shot timers (animation tweens, say) that all fire */
+    SDL_AtomicSet(&benchmark_fired, 0);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < BENCHMARK_TIMERS; ++i) {
+        SDL_AddTimer(1 + (rand() % 100), benchmark_callback, NULL);
+    }
+    while (SDL_AtomicGet(&benchmark_fired) < BENCHMARK_TIMERS && elapsed_ms(start) < 10 * 1000) {
+        SDL_Delay(1);
+    }
+    ms = elapsed_ms(start);
+    SDL_Log("%d of %d timers of 1-100 ms fired in %f ms\n",
+            SDL_AtomicGet(&benchmark_fired), BENCHMARK_TIMERS, ms);
+
+    SDL_free(ids);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -115,6 +184,9 @@ main(int argc, char *argv[])
     now32 = SDL_GetTicks();
     SDL_Log("Delay 1 second = %d ms in ticks, %f ms according to performance counter\n", (now32-start32), (double)((now - start)*1000) / SDL_GetPerformanceFrequency());
 
+    SDL_Log("Benchmarking %d timers...\n", BENCHMARK_TIMERS);
+    timer_benchmark();
+
     SDL_Quit();
     return (0);
 }
@@ -42,7 +42,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
 
         /* R, G, B in alternating horizontal bands */
         for (y = 0; y < pattern->h; y += thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && (y + i) < pattern->h; ++i) {
                 p = (Uint8 *)pattern->pixels + (y + i) * pattern->pitch + ((y/thickness) % 3);
                 for (x = 0; x < pattern->w; ++x) {
                     *p = 0xFF;
@@ -54,7 +54,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
         /* Black and white in alternating vertical bands */
         c = 0xFF;
         for (x = 1*thickness; x < pattern->w; x += 2*thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && (x + i) < pattern->w; ++i) {
                 p = (Uint8 *)pattern->pixels + (x + i)*3;
                 for (y = 0; y < pattern->h; ++y) {
                     SDL_memset(p, c, 3);
@@ -216,6 +216,14 @@ done:
     return result;
 }
 
+static void
+LogThroughput(const char *what, Uint32 iterations, Uint32 ms, int w, int h)
+{
+    const float seconds = (float)(ms ? ms : 1) / 1000.0f;
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s: %d iterations in %d ms, %.2fms each, %.1f Mpixels/s\n",
+                what, iterations, ms, (float)ms / iterations, ((float)w * h * iterations) / seconds / 1000000.0f);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -263,6 +271,7 @@ main(int argc, char **argv)
     int current = 0;
     int pitch;
     Uint8 *raw_yuv;
+    Uint8 *encoded;
     Uint32 then, now, i, iterations = 100;
     SDL_bool should_run_automated_tests = SDL_FALSE;
 
@@ -354,7 +363,20 @@ main(int argc, char **argv)
         SDL_ConvertPixels(original->w, original->h, yuv_format, raw_yuv, pitch, rgb_format, converted->pixels, converted->pitch);
     }
     now = SDL_GetTicks();
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%d iterations in %d ms, %.2fms each\n", iterations, (now - then), (float)(now - then)/iterations);
+    LogThroughput("YUV to RGB", iterations, (now - then), original->w, original->h);
+
+    encoded = SDL_calloc(1, MAX_YUV_SURFACE_SIZE(original->w, original->h, 0));
+    if (!encoded) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return 3;
+    }
+    then = SDL_GetTicks();
+    for ( i = 0; i < iterations; ++i ) {
+        SDL_ConvertPixels(original->w, original->h, rgb_format, converted->pixels, converted->pitch, yuv_format, encoded, pitch);
+    }
+    now = SDL_GetTicks();
+    LogThroughput("RGB to YUV", iterations, (now - then), original->w, original->h);
+    SDL_free(encoded);
 
     window = SDL_CreateWindow("YUV test",
                               SDL_WINDOWPOS_UNDEFINED,